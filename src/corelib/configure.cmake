@@ -361,6 +361,49 @@ int main(void)
     return 0;
 }")
 
+# epoll
+qt_config_compile_test(epoll
+    LABEL "epoll()"
+    CODE
+"#include <sys/epoll.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+struct epoll_event ev = {};
+int fd = epoll_create1(EPOLL_CLOEXEC);
+epoll_ctl(fd, EPOLL_CTL_ADD, 0, &ev);
+epoll_wait(fd, &ev, 1, 0);
+    /* END TEST: */
+    return 0;
+}
+")
+
+# io_uring
+qt_config_compile_test(io_uring
+    LABEL "io_uring"
+    CODE
+"#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+struct io_uring_params params = {};
+int fd = syscall(__NR_io_uring_setup, 1, &params);
+struct io_uring_sqe sqe = {};
+sqe.opcode = IORING_OP_TIMEOUT_REMOVE;
+sqe.poll32_events = 0;
+sqe.timeout_flags = IORING_TIMEOUT_ABS;
+(void) (params.features & IORING_FEAT_NODROP);
+(void) (params.sq_off.flags & IORING_SQ_CQ_OVERFLOW);
+syscall(__NR_io_uring_enter, fd, 1, 1, IORING_ENTER_GETEVENTS, 0, 0);
+    /* END TEST: */
+    return 0;
+}
+")
+
 # ppoll
 qt_config_compile_test(ppoll
     LABEL "ppoll()"
@@ -621,6 +664,16 @@ qt_feature("system-pcre2" PRIVATE SYSTEM_LIBRARY
     ENABLE INPUT_pcre STREQUAL 'system'
     DISABLE INPUT_pcre STREQUAL 'no' OR INPUT_pcre STREQUAL 'qt'
 )
+qt_feature("epoll" PRIVATE
+    LABEL "epoll() event dispatcher"
+    CONDITION LINUX AND TEST_epoll
+    PURPOSE "Provides an event dispatcher that keeps socket notifiers in a persistent epoll interest set."
+)
+qt_feature("io_uring" PRIVATE
+    LABEL "io_uring event dispatcher"
+    CONDITION LINUX AND TEST_io_uring
+    PURPOSE "Provides an experimental event dispatcher that submits socket polls, timeouts and wake-ups to an io_uring."
+)
 qt_feature("poll_ppoll" PRIVATE
     LABEL "Native ppoll()"
     CONDITION NOT WASM AND TEST_ppoll
@@ -976,6 +1029,8 @@ qt_configure_add_summary_entry(ARGS "backtrace")
 qt_configure_add_summary_entry(ARGS "cxx23_stacktrace")
 qt_configure_add_summary_entry(ARGS "doubleconversion")
 qt_configure_add_summary_entry(ARGS "system-doubleconversion")
+qt_configure_add_summary_entry(ARGS "epoll" CONDITION LINUX)
+qt_configure_add_summary_entry(ARGS "io_uring" CONDITION LINUX)
 qt_configure_add_summary_entry(ARGS "forkfd_pidfd" CONDITION LINUX)
 qt_configure_add_summary_entry(ARGS "glib")
 qt_configure_add_summary_entry(ARGS "icu")
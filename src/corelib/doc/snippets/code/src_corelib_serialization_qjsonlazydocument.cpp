@@ -0,0 +1,14 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QJsonParseError error;
+const QJsonLazyDocument document = QJsonLazyDocument::fromJson(file.readAll(), &error);
+if (document.isNull())
+    return error.errorString();
+
+for (const QJsonLazyValue user : document[u"users"]) {
+    if (user[u"active"].toBool())
+        names << user[u"name"].toString();
+}
+//! [0]
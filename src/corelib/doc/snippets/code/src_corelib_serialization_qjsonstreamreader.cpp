@@ -0,0 +1,46 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QFile file("access.ndjson");
+file.open(QIODevice::ReadOnly);
+QJsonStreamReader reader(&file);
+reader.setDocumentSequence(true);
+
+qint64 errors = 0;
+while (!reader.atEnd()) {
+    if (reader.readNext() == QJsonStreamReader::Key && reader.depth() == 1
+            && reader.text() == u"status") {
+        if (reader.readNext() == QJsonStreamReader::Number && reader.toInteger() >= 500)
+            ++errors;
+    }
+}
+if (reader.error() != QJsonStreamReader::NoError)
+    qWarning() << reader.errorString() << "at" << reader.offset();
+//! [0]
+
+//! [1]
+void Client::onReadyRead()
+{
+    reader.addData(socket->readAll());
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QJsonStreamReader::Key:
+            handleKey(reader.text());
+            break;
+        case QJsonStreamReader::String:
+        case QJsonStreamReader::Number:
+        case QJsonStreamReader::Bool:
+        case QJsonStreamReader::Null:
+            handleValue(reader.value());
+            break;
+        default:
+            break;
+        }
+    }
+    if (reader.error() == QJsonStreamReader::PrematureEndOfDocumentError)
+        return;     // wait for more data
+    if (reader.hasError())
+        socket->abort();
+}
+//! [1]
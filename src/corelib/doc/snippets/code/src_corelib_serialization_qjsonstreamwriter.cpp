@@ -0,0 +1,14 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QJsonStreamWriter writer(&file);
+for (const Request &request : requests) {
+    writer.startObject();
+    writer.writeKey(u"path");
+    writer.writeString(request.path);
+    writer.writeKey(u"status");
+    writer.writeInteger(request.status);
+    writer.endObject();         // followed by a newline
+}
+//! [0]
@@ -0,0 +1,19 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+const QMultiStringMatcher keywords({ u"class"_s, u"struct"_s, u"union"_s },
+                                   Qt::CaseInsensitive);
+
+for (const QString &line : lines) {
+    for (const QMultiStringMatcher::Match &m : keywords.matchAll(line))
+        qDebug() << keywords.patterns().at(m.patternIndex) << "at" << m.position;
+}
+//! [0]
+
+//! [1]
+const QMultiByteArrayMatcher methods({ "GET", "HEAD", "POST" });
+const QMultiByteArrayMatcher::Match m = methods.match(requestLine);
+if (m.isValid() && m.position == 0)
+    handleMethod(m.patternIndex);
+//! [1]
@@ -0,0 +1,17 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QNumberFormatter formatter(QLocale(QLocale::German));
+formatter.setDoubleFormat('f', 2);
+
+QByteArray line;
+for (const Row &row : rows) {
+    line.resize(0); // keeps the capacity
+    formatter.appendTo(line, row.id);
+    line += ';';
+    formatter.appendTo(line, row.measurements, ";");
+    line += '\n';
+    file.write(line);
+}
+//! [0]
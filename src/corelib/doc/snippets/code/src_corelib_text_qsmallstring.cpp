@@ -0,0 +1,21 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+struct Field
+{
+    QSmallString name;  // no allocation for names of up to 15 characters
+    QSmallString value;
+};
+
+QList<Field> fields;
+for (QByteArrayView line : lines) {
+    const qsizetype colon = line.indexOf(':');
+    fields.append({ QSmallString::fromUtf8(line.first(colon)),
+                    QSmallString::fromUtf8(line.sliced(colon + 1).trimmed()) });
+}
+
+QHash<QSmallString, int> index;   // hashes like QString
+if (fields.first().name == "Content-Type"_L1)
+    ...
+//! [0]
@@ -0,0 +1,18 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QCoroTask<int> Downloader::fetchSize(QUrl url)
+{
+    QByteArray data = co_await download(url);            // QFuture<QByteArray>
+    if (data.isEmpty())
+        co_await qAwaitSignal(this, &Downloader::online); // wait for the signal
+    co_return data.size();
+}
+
+QCoroTask<> Downloader::report(QUrl url)
+{
+    const int size = co_await fetchSize(url);
+    label->setText(tr("%n bytes", nullptr, size));       // back on the GUI thread
+}
+//! [0]
@@ -0,0 +1,16 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+const QDateTimeFormat stamp(u"dd MMM yyyy HH:mm:ss.zzz");
+
+QString line;
+for (const Event &event : events) {
+    line.resize(0); // keeps the capacity
+    stamp.appendTo(line, event.when);
+    line += u' ' + event.message + u'\n';
+    log.write(line.toUtf8());
+}
+
+const QDateTime when = stamp.toDateTime(u"03 Mar 2025 14:05:59.250"_s);
+//! [0]
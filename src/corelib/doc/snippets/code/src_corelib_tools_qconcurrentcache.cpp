@@ -0,0 +1,16 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+// up to 64 MB of images, costs are in kilobytes
+QConcurrentCache<QString, QImage> images(64 * 1024);
+
+// in any worker thread
+QImage image = images.getOrCompute(path,
+                                   [&] { return QImage(path); },
+                                   [](const QImage &img) { return img.sizeInBytes() / 1024; });
+
+// in a monitoring timer
+const auto stats = images.statistics();
+qDebug() << "hit ratio" << stats.hitRatio() << "evictions" << stats.evictions;
+//! [0]
@@ -0,0 +1,24 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QConcurrentHash<QString, QImage> thumbnails;
+
+// in any thread
+QImage thumbnail = thumbnails.valueOrInsert(path, [&] {
+    return QImage(path).scaled(128, 128, Qt::KeepAspectRatio);
+});
+//! [0]
+
+//! [1]
+QConcurrentHash<QString, int> wordCounts;
+
+// in any thread
+wordCounts.insertOrUpdate(word, 1, [](int &count) { ++count; });
+//! [1]
+
+//! [2]
+const auto snapshot = wordCounts.snapshot();
+for (auto it = snapshot.begin(); it != snapshot.end(); ++it)
+    qDebug() << it.key() << it.value();
+//! [2]
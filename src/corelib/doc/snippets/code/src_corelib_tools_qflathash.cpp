@@ -0,0 +1,22 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QFlatHash<quint64, Record> records;
+records.reserve(expectedCount);     // no rehashing while filling it
+for (const Record &record : incoming)
+    records.insert(record.id, record);
+
+if (records.contains(id))
+    process(records.value(id));
+//! [0]
+
+//! [1]
+QFlatHash<QString, int>::iterator it = hash.begin();
+while (it != hash.end()) {
+    if (it.value() < 0)
+        it = hash.erase(it);        // other iterators stay valid
+    else
+        ++it;
+}
+//! [1]
@@ -0,0 +1,24 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+QFlatMap<int, QString> names;
+names.insert(3, "three");
+names.insert(1, "one");
+for (auto [number, name] : names)
+    qDebug() << number << name;                 // 1 "one", 3 "three"
+//! [0]
+
+//! [1]
+QList<int> ids = readIds();                     // unsorted, may contain duplicates
+QList<QString> labels = readLabels();           // same size as ids
+QFlatMap<int, QString> index(std::move(ids), std::move(labels));
+
+QFlatMap<int, QString> table(Qt::OrderedUniqueRange, { { 1, "one" }, { 2, "two" } });
+//! [1]
+
+//! [2]
+QFlatSet<int> set({ 5, 1, 3, 1 });              // contains 1, 3, 5
+set.insert(4);
+const QList<int> &sorted = set.values();        // 1, 3, 4, 5
+//! [2]
@@ -0,0 +1,23 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+//! [0]
+void Server::handleRequest(const QByteArray &request)
+{
+    // the fields of the request come from the arena...
+    QMonotonicMemoryResource arena(64 * 1024);
+
+    const QList<QByteArray> lines = request.split('\n');
+    QStringList fields;
+    arena.reserve(fields, lines.size());
+    for (const QByteArray &line : lines) {
+        QString field;
+        arena.reserve(field, line.size());
+        field.append(QString::fromUtf8(line));
+        fields.append(std::move(field));
+    }
+    sendReply(process(fields));
+
+    // ...and are all freed at once when it is destroyed, after them
+}
+//! [0]
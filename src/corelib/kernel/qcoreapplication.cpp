@@ -347,7 +347,10 @@ Q_CONSTINIT bool QCoreApplicationPrivate::is_app_closing = false;
 
 qsizetype qGlobalPostedEventsCount()
 {
-    const QPostEventList &l = QThreadData::current()->postEventList;
+    QPostEventList &l = QThreadData::current()->postEventList;
+    l.incoming.waitForProducers();
+    const auto locker = qt_scoped_lock(l.mutex);
+    l.takeIncoming();
     return l.size() - l.startOffset;
 }
 
@@ -496,7 +499,9 @@ void QCoreApplicationPrivate::cleanupThreadData()
 #endif
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
+        thisThreadData->postEventList.incoming.waitForProducers();
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        thisThreadData->postEventList.takeIncoming();
         for (const QPostEvent &pe : std::as_const(thisThreadData->postEventList)) {
             if (pe.event) {
                 --pe.receiver->d_func()->postedEvents;
@@ -969,6 +974,10 @@ QCoreApplication::~QCoreApplication()
         guiThreadPool->waitForDone();
         delete guiThreadPool;
     }
+    for (QThreadPool *numaNodeThreadPool : QThreadPoolPrivate::numaNodeInstances()) {
+        numaNodeThreadPool->waitForDone();
+        delete numaNodeThreadPool;
+    }
 #endif
 
 #ifndef QT_NO_QOBJECT
@@ -1618,7 +1627,9 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
 
     if (!object) {
         locker.threadData = QThreadData::current();
+        locker.threadData->postEventList.incoming.waitForProducers();
         locker.locker = qt_unique_lock(locker.threadData->postEventList.mutex);
+        locker.threadData->postEventList.takeIncoming();
         return locker;
     }
 
@@ -1633,6 +1644,9 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
             return locker;
         }
 
+        // so that takeIncoming() below takes all the events posted so far,
+        // and events posted through the list keep their order with them
+        locker.threadData->postEventList.incoming.waitForProducers();
         auto temporaryLocker = qt_unique_lock(locker.threadData->postEventList.mutex);
         if (locker.threadData == threadData.loadAcquire()) {
             locker.locker = std::move(temporaryLocker);
@@ -1641,9 +1655,102 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     }
 
     Q_ASSERT(locker.threadData);
+    locker.threadData->postEventList.takeIncoming();
     return locker;
 }
 
+/*!
+    \internal
+
+    Queues \a event for \a receiver without locking the mutex of the
+    receiving thread's QPostEventList, so that threads posting to the same
+    thread don't serialize on it. The event is moved into the list by the
+    next function that locks it. Returns \c false if the event could not be
+    queued, in which case it must be posted through the list.
+
+    This is only suitable for events posted at Qt::NormalEventPriority that
+    are never compressed: the queue is invisible to compressEvent().
+*/
+bool QCoreApplicationPrivate::tryPostEventLockFree(QObject *receiver, QEvent *event)
+{
+    auto &threadData = QObjectPrivate::get(receiver)->threadData;
+    QThreadData *data = threadData.loadAcquire();
+    if (!data)
+        return false;
+
+    QPostEventQueue &queue = data->postEventList.incoming;
+    if (!queue.beginEnqueue())
+        return false; // QObject::moveToThread() is moving events out of this thread
+    // also when QThread::terminate() cancels this thread in wakeUp() below
+    const auto endEnqueue = qScopeGuard([&queue] { queue.endEnqueue(); });
+
+    // QObject::moveToThread() waits for us if it moves the receiver out of
+    // data from now on, but it may have done so already
+    if (threadData.loadAcquire() != data)
+        return false;
+
+    event->m_posted = true;
+    ++receiver->d_func()->postedEvents;
+    if (!queue.enqueue(receiver, event)) {
+        --receiver->d_func()->postedEvents;
+        event->m_posted = false;
+        return false;
+    }
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type());
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+    return true;
+}
+
+/*!
+    \internal
+
+    Appends the queued \a call to \a receiver to the QMetaCallBatchEvent at
+    the end of the event queue of the receiver's thread, or posts a new batch
+    if there is no open one for \a receiver. Like postEvent(), this must be
+    called with the signal slot lock of \a receiver held, which keeps it from
+    being deleted. The arguments owned by \a call are taken over.
+
+    \sa QThread::setQueuedCallBatchingEnabled()
+*/
+void QCoreApplicationPrivate::postBatchedMetaCall(QObject *receiver,
+                                                  const QMetaCallBatchEvent::PendingCall &call)
+{
+    auto locker = lockThreadPostEventList(receiver);
+    if (!locker.threadData) {
+        // posting during destruction? just discard the call
+        QMetaCallBatchEvent::discard(call);
+        return;
+    }
+
+    QThreadData *data = locker.threadData;
+    QPostEventList &postEventList = data->postEventList;
+    QMetaCallBatchEvent *batch = postEventList.openMetaCallBatch();
+    if (batch && postEventList.constLast().receiver == receiver) {
+        // the thread was woken up when the batch was posted
+        batch->append(call);
+        data->canWait = false;
+        return;
+    }
+
+    auto event = std::make_unique<QMetaCallBatchEvent>();
+    event->append(call);
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event.get(), event->type());
+    postEventList.addEvent(QPostEvent(receiver, event.get(), Qt::NormalEventPriority));
+    batch = event.release();
+    postEventList.openBatch = batch;
+    batch->m_posted = true;
+    ++receiver->d_func()->postedEvents;
+    data->canWait = false;
+    locker.unlock();
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+}
+
 /*!
     \since 4.3
 
@@ -1682,6 +1789,13 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // queued meta-calls, most of the events posted between threads, are
+    // never compressed and can bypass the lock
+    if (event->type() == QEvent::MetaCall && priority == Qt::NormalEventPriority
+        && QCoreApplicationPrivate::tryPostEventLockFree(receiver, event)) {
+        return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1801,6 +1915,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    data->postEventList.takeIncoming();
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -2044,7 +2159,10 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
 
     QThreadData *data = QThreadData::current();
 
+    // the event must be found if it is still queued
+    data->postEventList.incoming.waitForProducers();
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    data->postEventList.takeIncoming();
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
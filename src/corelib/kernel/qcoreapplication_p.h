@@ -125,6 +125,9 @@ public:
         void unlock() { locker.unlock(); }
     };
     static QPostEventListLocker lockThreadPostEventList(QObject *object);
+    static bool tryPostEventLockFree(QObject *receiver, QEvent *event);
+    static void postBatchedMetaCall(QObject *receiver,
+                                    const QMetaCallBatchEvent::PendingCall &call);
 #endif // QT_NO_QOBJECT
 
     int &argc;
@@ -0,0 +1,553 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplatformdefs.h"
+
+#include "qcoreapplication.h"
+#include "qsocketnotifier.h"
+#include "qthread.h"
+
+#include "qeventdispatcher_epoll_p.h"
+#include <private/qthread_p.h>
+#include <private/qcoreapplication_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+
+#include <limits>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEventDispatcherEpoll
+
+    An event dispatcher for Linux that keeps its socket notifiers in a
+    persistent epoll(7) interest set. Unlike QEventDispatcherUNIX, which
+    rebuilds and passes the whole pollfd array to the kernel on every
+    iteration, the interest set is only updated when a QSocketNotifier is
+    enabled or disabled, so the cost of waking up is proportional to the
+    number of ready descriptors rather than the number of registered ones.
+
+    The interest set is level-triggered, which gives QSocketNotifier the
+    same semantics it has with poll(2). One difference is that the kernel
+    drops a descriptor from the set when it is closed, so notifiers on
+    closed descriptors are silently not activated instead of being disabled
+    with a warning.
+
+    It is used instead of the default dispatcher if the
+    \c QT_EVENT_DISPATCHER_EPOLL environment variable is set to a positive
+    integer, or it can be installed explicitly with
+    QCoreApplication::setEventDispatcher() and QThread::setEventDispatcher().
+*/
+
+// Maximum number of ready descriptors retrieved per epoll_wait(). Any others
+// stay ready (the set is level-triggered) and are picked up next iteration.
+static constexpr int MaxEpollEvents = 256;
+
+static const char *socketType(QSocketNotifier::Type type)
+{
+    switch (type) {
+    case QSocketNotifier::Read:
+        return "Read";
+    case QSocketNotifier::Write:
+        return "Write";
+    case QSocketNotifier::Exception:
+        return "Exception";
+    }
+
+    Q_UNREACHABLE();
+}
+
+static uint32_t pollToEpollEvents(short events)
+{
+    uint32_t result = 0;
+    if (events & POLLIN)
+        result |= EPOLLIN;
+    if (events & POLLOUT)
+        result |= EPOLLOUT;
+    if (events & POLLPRI)
+        result |= EPOLLPRI;
+    return result;
+}
+
+static short epollToPollEvents(uint32_t events)
+{
+    short result = 0;
+    if (events & EPOLLIN)
+        result |= POLLIN;
+    if (events & EPOLLOUT)
+        result |= POLLOUT;
+    if (events & EPOLLPRI)
+        result |= POLLPRI;
+    if (events & EPOLLERR)
+        result |= POLLERR;
+    if (events & EPOLLHUP)
+        result |= POLLHUP;
+    return result;
+}
+
+/*
+    Like qt_safe_poll(), waits until \a deadline expires, retrying on EINTR.
+    epoll_pwait2() takes a timespec and so preserves the resolution of
+    Qt::PreciseTimer; when it is not available we round the timeout up to
+    whole milliseconds so that we never return before a timer is due.
+*/
+static int qt_epoll_wait(int epfd, epoll_event *events, int maxevents, nanoseconds timeout)
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 35)
+    Q_CONSTINIT static QBasicAtomicInt hasEpollPwait2 = Q_BASIC_ATOMIC_INITIALIZER(1);
+    if (hasEpollPwait2.loadRelaxed()) {
+        timespec ts = durationToTimespec(timeout);
+        const int ret = epoll_pwait2(epfd, events, maxevents, &ts, nullptr);
+        if (ret != -1 || errno != ENOSYS)
+            return ret;
+        hasEpollPwait2.storeRelaxed(0);
+    }
+#endif
+    const auto ms = ceil<milliseconds>(timeout).count();
+    return epoll_wait(epfd, events, maxevents, int(qMin<qint64>(ms, std::numeric_limits<int>::max())));
+}
+
+static int qt_safe_epoll_wait(int epfd, epoll_event *events, int maxevents,
+                              QDeadlineTimer deadline)
+{
+    if (deadline.isForever()) {
+        int ret;
+        QT_EINTR_LOOP(ret, epoll_wait(epfd, events, maxevents, -1));
+        return ret;
+    }
+
+    nanoseconds remaining = deadline.remainingTimeAsDuration();
+    do {
+        const int ret = qt_epoll_wait(epfd, events, maxevents, remaining);
+        if (ret != -1 || errno != EINTR)
+            return ret;
+        remaining = deadline.remainingTimeAsDuration();
+    } while (remaining > 0ns);
+
+    return 0;
+}
+
+QEventDispatcherEpollPrivate::QEventDispatcherEpollPrivate()
+{
+    if (Q_UNLIKELY(threadPipe.init() == false))
+        qFatal("QEventDispatcherEpollPrivate(): Cannot continue without a thread pipe");
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (Q_UNLIKELY(epollFd == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to create epoll instance: %s",
+               qPrintable(qt_error_string()));
+
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = threadPipe.fds[0];
+    if (Q_UNLIKELY(epoll_ctl(epollFd, EPOLL_CTL_ADD, threadPipe.fds[0], &ev) == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to watch the thread pipe: %s",
+               qPrintable(qt_error_string()));
+}
+
+QEventDispatcherEpollPrivate::~QEventDispatcherEpollPrivate()
+{
+    // cleanup timers
+    timerList.clearTimers();
+
+    if (epollFd != -1)
+        qt_safe_close(epollFd);
+}
+
+/*
+    Brings the kernel interest set for \a fd in line with the notifiers
+    registered for it. This is the only place the interest set is modified,
+    so an idle notifier costs nothing per event loop iteration.
+*/
+void QEventDispatcherEpollPrivate::updateInterest(int fd, short oldEvents, short newEvents)
+{
+    if (oldEvents == newEvents)
+        return;
+
+    if (unpollableFds.contains(fd)) {
+        if (!newEvents)
+            unpollableFds.removeOne(fd);
+        return;
+    }
+
+    epoll_event ev = {};
+    ev.events = pollToEpollEvents(newEvents);
+    ev.data.fd = fd;
+
+    int op = EPOLL_CTL_MOD;
+    if (!oldEvents)
+        op = EPOLL_CTL_ADD;
+    else if (!newEvents)
+        op = EPOLL_CTL_DEL;
+
+    if (epoll_ctl(epollFd, op, fd, &ev) == 0)
+        return;
+
+    switch (errno) {
+    case EPERM:
+        // regular files and directories can't be watched, but poll(2)
+        // reports them as always readable and writable
+        if (op == EPOLL_CTL_ADD) {
+            unpollableFds.append(fd);
+            return;
+        }
+        break;
+    case ENOENT:
+        // the descriptor was closed and the kernel dropped it from the set;
+        // the number may since have been reused for a new descriptor
+        if (op == EPOLL_CTL_MOD && epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) == 0)
+            return;
+        if (op == EPOLL_CTL_DEL)
+            return;
+        break;
+    case EBADF:
+        if (op == EPOLL_CTL_DEL)
+            return;
+        qWarning("QSocketNotifier: Invalid socket %d, cannot be watched", fd);
+        return;
+    default:
+        break;
+    }
+    qErrnoWarning("QEventDispatcherEpoll: epoll_ctl failed for socket %d", fd);
+}
+
+void QEventDispatcherEpollPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+
+    if (pendingNotifiers.contains(notifier))
+        return;
+
+    pendingNotifiers << notifier;
+}
+
+void QEventDispatcherEpollPrivate::markPendingSocketNotifiers(int fd, short revents)
+{
+    auto it = socketNotifiers.constFind(fd);
+    if (it == socketNotifiers.cend())
+        return;
+
+    const QSocketNotifierSetUNIX &sn_set = it.value();
+
+    static const struct {
+        QSocketNotifier::Type type;
+        short flags;
+    } notifiers[] = {
+        { QSocketNotifier::Read,      POLLIN  | POLLHUP | POLLERR },
+        { QSocketNotifier::Write,     POLLOUT | POLLHUP | POLLERR },
+        { QSocketNotifier::Exception, POLLPRI | POLLHUP | POLLERR }
+    };
+
+    for (const auto &n : notifiers) {
+        QSocketNotifier *notifier = sn_set.notifiers[n.type];
+        if (notifier && (revents & n.flags))
+            setSocketNotifierPending(notifier);
+    }
+}
+
+int QEventDispatcherEpollPrivate::activateSocketNotifiers()
+{
+    if (pendingNotifiers.isEmpty())
+        return 0;
+
+    int n_activated = 0;
+    QEvent event(QEvent::SockAct);
+
+    while (!pendingNotifiers.isEmpty()) {
+        QSocketNotifier *notifier = pendingNotifiers.takeFirst();
+        QCoreApplication::sendEvent(notifier, &event);
+        ++n_activated;
+    }
+
+    return n_activated;
+}
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QObject *parent)
+    : QAbstractEventDispatcherV2(*new QEventDispatcherEpollPrivate, parent)
+{ }
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QEventDispatcherEpollPrivate &dd, QObject *parent)
+    : QAbstractEventDispatcherV2(dd, parent)
+{ }
+
+QEventDispatcherEpoll::~QEventDispatcherEpoll()
+{ }
+
+/*!
+    \internal
+
+    Returns \c true if the \c QT_EVENT_DISPATCHER_EPOLL environment variable
+    requests this dispatcher to be used for new threads.
+*/
+bool QEventDispatcherEpoll::isEnabledByEnvironment()
+{
+    bool ok = false;
+    const int value = qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_EPOLL", &ok);
+    return ok && value > 0;
+}
+
+/*!
+    \internal
+*/
+void QEventDispatcherEpoll::registerTimer(Qt::TimerId timerId, Duration interval,
+                                          Qt::TimerType timerType, QObject *obj)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1 || interval.count() < 0 || !obj) {
+        qWarning("QEventDispatcherEpoll::registerTimer: invalid arguments");
+        return;
+    } else if (obj->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::registerTimer: timers cannot be started from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    d->timerList.registerTimer(timerId, interval, timerType, obj);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimer(Qt::TimerId timerId)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: invalid argument");
+        return false;
+    } else if (thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimer(timerId);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimers(QObject *object)
+{
+#ifndef QT_NO_DEBUG
+    if (!object) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: invalid argument");
+        return false;
+    } else if (object->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimers(object);
+}
+
+QList<QEventDispatcherEpoll::TimerInfoV2>
+QEventDispatcherEpoll::timersForObject(QObject *object) const
+{
+    if (!object) {
+        qWarning("QEventDispatcherEpoll:registeredTimers: invalid argument");
+        return QList<TimerInfoV2>();
+    }
+
+    Q_D(const QEventDispatcherEpoll);
+    return d->timerList.registeredTimers(object);
+}
+
+auto QEventDispatcherEpoll::remainingTime(Qt::TimerId timerId) const -> Duration
+{
+#ifndef QT_NO_DEBUG
+    if (int(timerId) < 1) {
+        qWarning("QEventDispatcherEpoll::remainingTime: invalid argument");
+        return Duration::min();
+    }
+#endif
+
+    Q_D(const QEventDispatcherEpoll);
+    return d->timerList.remainingDuration(timerId);
+}
+
+void QEventDispatcherEpoll::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifiers cannot be enabled from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    QSocketNotifierSetUNIX &sn_set = d->socketNotifiers[sockfd];
+    const short oldEvents = sn_set.events();
+
+    if (sn_set.notifiers[type] && sn_set.notifiers[type] != notifier)
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+
+    sn_set.notifiers[type] = notifier;
+    d->updateInterest(sockfd, oldEvents, sn_set.events());
+}
+
+void QEventDispatcherEpoll::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifier (fd %d) cannot be disabled from another thread.\n"
+                "(Notifier's thread is %s(%p), event dispatcher's thread is %s(%p), current thread is %s(%p))",
+                sockfd,
+                notifier->thread() ? notifier->thread()->metaObject()->className() : "QThread", notifier->thread(),
+                thread() ? thread()->metaObject()->className() : "QThread", thread(),
+                QThread::currentThread() ? QThread::currentThread()->metaObject()->className() : "QThread", QThread::currentThread());
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+
+    d->pendingNotifiers.removeOne(notifier);
+
+    auto i = d->socketNotifiers.find(sockfd);
+    if (i == d->socketNotifiers.end())
+        return;
+
+    QSocketNotifierSetUNIX &sn_set = i.value();
+
+    if (sn_set.notifiers[type] == nullptr)
+        return;
+
+    if (sn_set.notifiers[type] != notifier) {
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+        return;
+    }
+
+    const short oldEvents = sn_set.events();
+    sn_set.notifiers[type] = nullptr;
+    d->updateInterest(sockfd, oldEvents, sn_set.events());
+
+    if (sn_set.isEmpty())
+        d->socketNotifiers.erase(i);
+}
+
+bool QEventDispatcherEpoll::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.storeRelaxed(0);
+
+    // we are awake, broadcast it
+    emit awake();
+
+    auto threadData = d->threadData.loadRelaxed();
+    QCoreApplicationPrivate::sendPostedEvents(nullptr, 0, threadData);
+
+    const bool include_timers = (flags & QEventLoop::X11ExcludeTimers) == 0;
+    const bool include_notifiers = (flags & QEventLoop::ExcludeSocketNotifiers) == 0;
+    const bool wait_for_events = (flags & QEventLoop::WaitForMoreEvents) != 0;
+
+    const bool canWait = (threadData->canWaitLocked()
+                          && !d->interrupt.loadRelaxed()
+                          && wait_for_events);
+
+    if (canWait)
+        emit aboutToBlock();
+
+    if (d->interrupt.loadRelaxed())
+        return false;
+
+    QDeadlineTimer deadline;
+    if (canWait) {
+        if (include_timers) {
+            std::optional<nanoseconds> remaining = d->timerList.timerWait();
+            deadline = remaining ? QDeadlineTimer{*remaining}
+                                 : QDeadlineTimer(QDeadlineTimer::Forever);
+        } else {
+            deadline = QDeadlineTimer(QDeadlineTimer::Forever);
+        }
+    }
+
+    int nevents = 0;
+    if (include_notifiers) {
+        // descriptors outside the interest set are always ready, so don't block
+        if (!d->unpollableFds.isEmpty())
+            deadline = QDeadlineTimer();
+
+        epoll_event events[MaxEpollEvents];
+        const int ready = qt_safe_epoll_wait(d->epollFd, events, MaxEpollEvents, deadline);
+        if (ready == -1) {
+            qErrnoWarning("epoll_wait");
+            if (QT_CONFIG(poll_exit_on_error))
+                abort();
+        }
+
+        for (int i = 0; i < ready; ++i) {
+            const int fd = events[i].data.fd;
+            const short revents = epollToPollEvents(events[i].events);
+            if (fd == d->threadPipe.fds[0]) {
+                pollfd pfd = d->threadPipe.prepare();
+                pfd.revents = revents;
+                nevents += d->threadPipe.check(pfd);
+            } else {
+                d->markPendingSocketNotifiers(fd, revents);
+            }
+        }
+
+        for (int fd : std::as_const(d->unpollableFds))
+            d->markPendingSocketNotifiers(fd, POLLIN | POLLOUT);
+
+        nevents += d->activateSocketNotifiers();
+    } else {
+        // the interest set can't exclude the notifiers without modifying it,
+        // so wait on the thread pipe alone
+        pollfd pfd = d->threadPipe.prepare();
+        switch (qt_safe_poll(&pfd, 1, deadline)) {
+        case -1:
+            qErrnoWarning("qt_safe_poll");
+            if (QT_CONFIG(poll_exit_on_error))
+                abort();
+            break;
+        case 0:
+            break;
+        default:
+            nevents += d->threadPipe.check(pfd);
+            break;
+        }
+    }
+
+    if (include_timers)
+        nevents += d->timerList.activateTimers();
+
+    // return true if we handled events, false otherwise
+    return (nevents > 0);
+}
+
+void QEventDispatcherEpoll::wakeUp()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->threadPipe.wakeUp();
+}
+
+void QEventDispatcherEpoll::interrupt()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.storeRelaxed(1);
+    wakeUp();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_epoll_p.cpp"
@@ -0,0 +1,89 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QEVENTDISPATCHER_EPOLL_P_H
+#define QEVENTDISPATCHER_EPOLL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "QtCore/qabstracteventdispatcher.h"
+#include "QtCore/qlist.h"
+#include "QtCore/qhash.h"
+#include "private/qabstracteventdispatcher_p.h"
+#include "private/qeventdispatcher_unix_p.h"
+#include "private/qtimerinfo_unix_p.h"
+
+QT_REQUIRE_CONFIG(epoll);
+
+QT_BEGIN_NAMESPACE
+
+class QEventDispatcherEpollPrivate;
+
+class Q_CORE_EXPORT QEventDispatcherEpoll : public QAbstractEventDispatcherV2
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QEventDispatcherEpoll)
+
+public:
+    explicit QEventDispatcherEpoll(QObject *parent = nullptr);
+    ~QEventDispatcherEpoll();
+
+    bool processEvents(QEventLoop::ProcessEventsFlags flags) override;
+
+    void registerSocketNotifier(QSocketNotifier *notifier) final;
+    void unregisterSocketNotifier(QSocketNotifier *notifier) final;
+
+    void registerTimer(Qt::TimerId timerId, Duration interval, Qt::TimerType timerType,
+                       QObject *object) override final;
+    bool unregisterTimer(Qt::TimerId timerId) override final;
+    bool unregisterTimers(QObject *object) override final;
+    QList<TimerInfoV2> timersForObject(QObject *object) const override final;
+    Duration remainingTime(Qt::TimerId timerId) const override final;
+
+    void wakeUp() override;
+    void interrupt() final;
+
+    static bool isEnabledByEnvironment();
+
+protected:
+    QEventDispatcherEpoll(QEventDispatcherEpollPrivate &dd, QObject *parent = nullptr);
+};
+
+class Q_CORE_EXPORT QEventDispatcherEpollPrivate : public QAbstractEventDispatcherPrivate
+{
+    Q_DECLARE_PUBLIC(QEventDispatcherEpoll)
+
+public:
+    QEventDispatcherEpollPrivate();
+    ~QEventDispatcherEpollPrivate();
+
+    void updateInterest(int fd, short oldEvents, short newEvents);
+    void markPendingSocketNotifiers(int fd, short revents);
+    int activateSocketNotifiers();
+    void setSocketNotifierPending(QSocketNotifier *notifier);
+
+    QThreadPipe threadPipe;
+    int epollFd = -1;
+
+    QHash<int, QSocketNotifierSetUNIX> socketNotifiers;
+    // descriptors the kernel refuses to add to the interest set (regular
+    // files, directories); like poll(2) we report them as always ready
+    QList<int> unpollableFds;
+    QList<QSocketNotifier *> pendingNotifiers;
+
+    QTimerInfoList timerList;
+    QAtomicInt interrupt; // bool
+};
+
+QT_END_NAMESPACE
+
+#endif // QEVENTDISPATCHER_EPOLL_P_H
@@ -0,0 +1,806 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplatformdefs.h"
+
+#include "qcoreapplication.h"
+#include "qsocketnotifier.h"
+#include "qthread.h"
+
+#include "qeventdispatcher_io_uring_p.h"
+#include <private/qthread_p.h>
+#include <private/qcoreapplication_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEventDispatcherIoUring
+
+    An experimental event dispatcher for Linux built on io_uring(7). Socket
+    readiness, the timeout of the next timer and wake-ups from other threads
+    are all requests in a single submission ring, so that an event loop
+    iteration that changes any of them and then waits costs one
+    io_uring_enter() system call.
+
+    Every socket descriptor with enabled notifiers has a one-shot
+    IORING_OP_POLL_ADD request in the ring, which is submitted again after
+    its notifiers have been activated; a descriptor that is still ready
+    completes immediately, which gives QSocketNotifier the same
+    level-triggered semantics it has with poll(2). When the notifiers of a
+    descriptor change, the old request is removed with IORING_OP_POLL_REMOVE
+    and completions carry a generation number, so that those of removed
+    requests are recognized and ignored. The next timer is an absolute
+    IORING_OP_TIMEOUT, which is only replaced when the deadline changes, and
+    wake-ups poll the eventfd of the QThreadPipe.
+
+    A pending poll request holds a reference to the socket, so the requests
+    of a descriptor are removed as soon as its last notifier is disabled,
+    before the descriptor is normally closed.
+
+    Not all kernels provide io_uring, and it may be disabled by the system
+    configuration or a seccomp filter, so isSupported() must be checked
+    before creating the dispatcher. It is used instead of the default
+    dispatcher if the \c QT_EVENT_DISPATCHER_IO_URING environment variable
+    is set to a positive integer and isSupported() returns \c true, or it
+    can be installed explicitly with QCoreApplication::setEventDispatcher()
+    and QThread::setEventDispatcher().
+*/
+
+// Number of submission queue entries. Requests beyond this are submitted
+// in batches, and completions beyond twice this are buffered by the kernel.
+static constexpr unsigned QueueDepth = 256;
+
+// The user_data of a request encodes its kind, a generation number and,
+// for poll requests, the descriptor.
+enum class Request : quint8 {
+    Cancel,
+    WakeUp,
+    Poll,
+    Timeout,
+};
+
+static constexpr quint32 GenerationMask = (1U << 30) - 1;
+
+static constexpr quint64 makeUserData(Request request, quint32 generation = 0, int fd = -1)
+{
+    return quint64(request) << 62 | quint64(generation & GenerationMask) << 32 | quint32(fd);
+}
+
+static constexpr Request requestOf(quint64 userData)
+{
+    return Request(userData >> 62);
+}
+
+static constexpr quint32 generationOf(quint64 userData)
+{
+    return quint32(userData >> 32) & GenerationMask;
+}
+
+static constexpr int fdOf(quint64 userData)
+{
+    return int(quint32(userData));
+}
+
+static const char *socketType(QSocketNotifier::Type type)
+{
+    switch (type) {
+    case QSocketNotifier::Read:
+        return "Read";
+    case QSocketNotifier::Write:
+        return "Write";
+    case QSocketNotifier::Exception:
+        return "Exception";
+    }
+
+    Q_UNREACHABLE();
+}
+
+static void prepPollAdd(io_uring_sqe *sqe, int fd, short events, quint64 userData)
+{
+    quint32 mask = quint16(events);
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    // the kernel expects the halfwords of poll32_events in little-endian order
+    mask = (mask << 16) | (mask >> 16);
+#endif
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = mask;
+    sqe->user_data = userData;
+}
+
+static void prepRemove(io_uring_sqe *sqe, quint8 opcode, quint64 target)
+{
+    sqe->opcode = opcode;
+    sqe->fd = -1;
+    sqe->addr = target;
+    sqe->user_data = makeUserData(Request::Cancel);
+}
+
+QIoUring::~QIoUring()
+{
+    if (sqes)
+        munmap(sqes, sqesSize);
+    if (cqRing && cqRing != sqRing)
+        munmap(cqRing, cqRingSize);
+    if (sqRing)
+        munmap(sqRing, sqRingSize);
+    if (fd != -1)
+        qt_safe_close(fd);
+}
+
+/*
+    Creates the ring with \a entries submission queue entries and maps it
+    into memory. Returns \c false, with errno set, if the kernel doesn't
+    support io_uring or lacks a feature we rely on.
+*/
+bool QIoUring::init(unsigned entries)
+{
+    io_uring_params params = {};
+    fd = int(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd == -1)
+        return false;
+
+    // IORING_FEAT_NODROP (Linux 5.5) guarantees no completion is ever lost,
+    // and also implies support for all the operations we use
+    if (!(params.features & IORING_FEAT_NODROP)) {
+        errno = ENOSYS;
+        return false;
+    }
+
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMmap)
+        sqRingSize = cqRingSize = qMax(sqRingSize, cqRingSize);
+
+    auto map = [this](size_t size, off_t offset) -> void * {
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         fd, offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    };
+
+    sqRing = map(sqRingSize, IORING_OFF_SQ_RING);
+    if (!sqRing)
+        return false;
+    cqRing = singleMmap ? sqRing : map(cqRingSize, IORING_OFF_CQ_RING);
+    if (!cqRing)
+        return false;
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe *>(map(sqesSize, IORING_OFF_SQES));
+    if (!sqes)
+        return false;
+
+    auto sqField = [this](quint32 offset) {
+        return reinterpret_cast<unsigned *>(static_cast<char *>(sqRing) + offset);
+    };
+    sqHead = sqField(params.sq_off.head);
+    sqTail = sqField(params.sq_off.tail);
+    sqFlags = sqField(params.sq_off.flags);
+    sqArray = sqField(params.sq_off.array);
+    sqMask = *sqField(params.sq_off.ring_mask);
+    sqEntries = params.sq_entries;
+    sqLocalTail = *sqTail;
+
+    auto cqField = [this](quint32 offset) {
+        return reinterpret_cast<unsigned *>(static_cast<char *>(cqRing) + offset);
+    };
+    cqHead = cqField(params.cq_off.head);
+    cqTail = cqField(params.cq_off.tail);
+    cqMask = *cqField(params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(static_cast<char *>(cqRing) + params.cq_off.cqes);
+    return true;
+}
+
+/*
+    Returns a cleared submission queue entry, to be submitted by the next
+    call to enter(). If the queue is full, the entries in it are submitted
+    first; returns \c nullptr if the kernel can't take them right now.
+*/
+io_uring_sqe *QIoUring::nextSqe()
+{
+    if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) {
+        enter(0);
+        if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+            return nullptr;
+    }
+
+    const unsigned index = sqLocalTail & sqMask;
+    io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqArray[index] = index;
+    ++sqLocalTail;
+    return sqe;
+}
+
+/*
+    Returns \c true if there are entries to submit, or if completions
+    didn't fit into the completion queue and wait to be flushed into it.
+*/
+bool QIoUring::needsEnter() const
+{
+    return sqLocalTail != __atomic_load_n(sqHead, __ATOMIC_ACQUIRE)
+            || (__atomic_load_n(sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW);
+}
+
+/*
+    Submits the queued entries and waits until at least \a waitCount
+    completions are available, retrying on EINTR.
+*/
+int QIoUring::enter(unsigned waitCount)
+{
+    __atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+    for (;;) {
+        const unsigned toSubmit = sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        const int ret = int(syscall(__NR_io_uring_enter, fd, toSubmit, waitCount,
+                                    IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (ret != -1 || errno != EINTR)
+            return ret;
+    }
+}
+
+/*
+    Calls \a handler with the user data and result of each available
+    completion, returning the sum of what it returned. The handler may
+    submit new requests, but not wait for completions.
+*/
+template <typename Handler>
+int QIoUring::processCompletions(Handler handler)
+{
+    int result = 0;
+    unsigned head = *cqHead;
+    while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+        const io_uring_cqe &cqe = cqes[head & cqMask];
+        const quint64 userData = cqe.user_data;
+        const int res = cqe.res;
+        __atomic_store_n(cqHead, ++head, __ATOMIC_RELEASE);
+        result += handler(userData, res);
+    }
+    return result;
+}
+
+QEventDispatcherIoUringPrivate::QEventDispatcherIoUringPrivate()
+{
+    if (Q_UNLIKELY(threadPipe.init() == false))
+        qFatal("QEventDispatcherIoUringPrivate(): Cannot continue without a thread pipe");
+
+    if (Q_UNLIKELY(!ring.init(QueueDepth)))
+        qFatal("QEventDispatcherIoUringPrivate(): Unable to create io_uring instance: %s",
+               qPrintable(qt_error_string()));
+}
+
+QEventDispatcherIoUringPrivate::~QEventDispatcherIoUringPrivate()
+{
+    // cleanup timers
+    timerList.clearTimers();
+}
+
+/*
+    Brings the poll requests in the ring in line with the notifiers of the
+    descriptors in changedFds, removing the requests of descriptors whose
+    notifiers changed and adding one for each descriptor that has enabled
+    notifiers but no request.
+*/
+void QEventDispatcherIoUringPrivate::submitPollRequests()
+{
+    while (!changedFds.isEmpty()) {
+        const int fd = changedFds.constLast();
+        const short events = socketNotifiers.value(fd).events();
+
+        if (auto it = pollRequests.constFind(fd); it != pollRequests.cend()) {
+            if (it->events == events) {
+                changedFds.removeLast();
+                continue;
+            }
+            io_uring_sqe *sqe = ring.nextSqe();
+            if (!sqe)
+                return; // try again on the next iteration
+            prepRemove(sqe, IORING_OP_POLL_REMOVE, makeUserData(Request::Poll, it->generation, fd));
+            pollRequests.erase(it);
+        }
+
+        if (events) {
+            io_uring_sqe *sqe = ring.nextSqe();
+            if (!sqe)
+                return;
+            const quint32 generation = ++nextGeneration & GenerationMask;
+            prepPollAdd(sqe, fd, events, makeUserData(Request::Poll, generation, fd));
+            pollRequests.insert(fd, { generation, events });
+        }
+
+        changedFds.removeLast();
+    }
+}
+
+/*
+    Removes the poll request for \a fd right away, as it keeps the socket
+    open even if the descriptor is closed.
+*/
+void QEventDispatcherIoUringPrivate::cancelPollRequest(int fd)
+{
+    auto it = pollRequests.constFind(fd);
+    if (it == pollRequests.cend())
+        return;
+
+    io_uring_sqe *sqe = ring.nextSqe();
+    if (!sqe) {
+        changedFds.append(fd);
+        return;
+    }
+    prepRemove(sqe, IORING_OP_POLL_REMOVE, makeUserData(Request::Poll, it->generation, fd));
+    pollRequests.erase(it);
+    ring.enter(0);
+}
+
+void QEventDispatcherIoUringPrivate::armWakeUp()
+{
+    if (wakeUpArmed)
+        return;
+
+    if (io_uring_sqe *sqe = ring.nextSqe()) {
+        const pollfd pfd = threadPipe.prepare();
+        prepPollAdd(sqe, pfd.fd, pfd.events, makeUserData(Request::WakeUp));
+        wakeUpArmed = true;
+    }
+}
+
+void QEventDispatcherIoUringPrivate::armTimeout(TimePoint deadline)
+{
+    if (timeoutArmed && timeoutDeadline == deadline)
+        return;
+
+    if (timeoutArmed) {
+        io_uring_sqe *sqe = ring.nextSqe();
+        if (!sqe)
+            return;
+        prepRemove(sqe, IORING_OP_TIMEOUT_REMOVE, makeUserData(Request::Timeout, timeoutGeneration));
+        timeoutArmed = false;
+    }
+
+    io_uring_sqe *sqe = ring.nextSqe();
+    if (!sqe)
+        return;
+
+    // the kernel measures absolute timeouts on CLOCK_MONOTONIC, like steady_clock
+    const timespec ts = durationToTimespec(deadline.time_since_epoch());
+    timeoutSpec.tv_sec = ts.tv_sec;
+    timeoutSpec.tv_nsec = ts.tv_nsec;
+    timeoutGeneration = (timeoutGeneration + 1) & GenerationMask;
+
+    sqe->opcode = IORING_OP_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = quintptr(&timeoutSpec);
+    sqe->len = 1;
+    sqe->timeout_flags = IORING_TIMEOUT_ABS;
+    sqe->user_data = makeUserData(Request::Timeout, timeoutGeneration);
+    timeoutArmed = true;
+    timeoutDeadline = deadline;
+}
+
+auto QEventDispatcherIoUringPrivate::processCompletion(quint64 userData, int result,
+                                                       bool includeNotifiers) -> Completion
+{
+    switch (requestOf(userData)) {
+    case Request::Cancel:
+        break;
+
+    case Request::WakeUp: {
+        wakeUpArmed = false;
+        pollfd pfd = threadPipe.prepare();
+        if (result < 0) {
+            errno = -result;
+            qErrnoWarning("QEventDispatcherIoUring: Unable to poll the thread pipe");
+            return Completion::Event;
+        }
+        pfd.revents = short(result);
+        return threadPipe.check(pfd) ? Completion::WakeUp : Completion::Event;
+    }
+
+    case Request::Timeout:
+        if (!timeoutArmed || generationOf(userData) != timeoutGeneration)
+            break;
+        timeoutArmed = false;
+        return Completion::Event;
+
+    case Request::Poll: {
+        const int fd = fdOf(userData);
+        auto it = pollRequests.constFind(fd);
+        if (it == pollRequests.cend() || it->generation != generationOf(userData))
+            break; // a removed request
+        pollRequests.erase(it);
+
+        if (result == -EBADF) {
+            // like POLLNVAL from poll(2)
+            const QSocketNotifierSetUNIX sn_set = socketNotifiers.value(fd);
+            for (QSocketNotifier *notifier : sn_set.notifiers) {
+                if (!notifier)
+                    continue;
+                qWarning("QSocketNotifier: Invalid socket %d with type %s, disabling...",
+                         fd, socketType(notifier->type()));
+                notifier->setEnabled(false);
+            }
+            return Completion::Event;
+        }
+        if (result < 0) {
+            errno = -result;
+            qErrnoWarning("QEventDispatcherIoUring: Unable to poll socket %d", fd);
+            return Completion::Event;
+        }
+
+        if (includeNotifiers) {
+            markPendingSocketNotifiers(fd, short(result));
+            changedFds.append(fd);
+        } else {
+            // poll again once the notifiers are no longer excluded
+            deferredFds.append(fd);
+        }
+        return Completion::Event;
+    }
+    }
+
+    return Completion::Stale;
+}
+
+void QEventDispatcherIoUringPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+
+    if (pendingNotifiers.contains(notifier))
+        return;
+
+    pendingNotifiers << notifier;
+}
+
+void QEventDispatcherIoUringPrivate::markPendingSocketNotifiers(int fd, short revents)
+{
+    auto it = socketNotifiers.constFind(fd);
+    if (it == socketNotifiers.cend())
+        return;
+
+    const QSocketNotifierSetUNIX &sn_set = it.value();
+
+    static const struct {
+        QSocketNotifier::Type type;
+        short flags;
+    } notifiers[] = {
+        { QSocketNotifier::Read,      POLLIN  | POLLHUP | POLLERR },
+        { QSocketNotifier::Write,     POLLOUT | POLLHUP | POLLERR },
+        { QSocketNotifier::Exception, POLLPRI | POLLHUP | POLLERR }
+    };
+
+    for (const auto &n : notifiers) {
+        QSocketNotifier *notifier = sn_set.notifiers[n.type];
+        if (notifier && (revents & n.flags))
+            setSocketNotifierPending(notifier);
+    }
+}
+
+int QEventDispatcherIoUringPrivate::activateSocketNotifiers()
+{
+    if (pendingNotifiers.isEmpty())
+        return 0;
+
+    int n_activated = 0;
+    QEvent event(QEvent::SockAct);
+
+    while (!pendingNotifiers.isEmpty()) {
+        QSocketNotifier *notifier = pendingNotifiers.takeFirst();
+        QCoreApplication::sendEvent(notifier, &event);
+        ++n_activated;
+    }
+
+    return n_activated;
+}
+
+QEventDispatcherIoUring::QEventDispatcherIoUring(QObject *parent)
+    : QAbstractEventDispatcherV2(*new QEventDispatcherIoUringPrivate, parent)
+{ }
+
+QEventDispatcherIoUring::QEventDispatcherIoUring(QEventDispatcherIoUringPrivate &dd,
+                                                 QObject *parent)
+    : QAbstractEventDispatcherV2(dd, parent)
+{ }
+
+QEventDispatcherIoUring::~QEventDispatcherIoUring()
+{ }
+
+/*!
+    \internal
+
+    Returns \c true if the running kernel provides io_uring with the
+    features this dispatcher needs, and it is not disabled for this process.
+*/
+bool QEventDispatcherIoUring::isSupported()
+{
+    static const bool supported = [] {
+        QIoUring ring;
+        return ring.init(2);
+    }();
+    return supported;
+}
+
+/*!
+    \internal
+
+    Returns \c true if the \c QT_EVENT_DISPATCHER_IO_URING environment
+    variable requests this dispatcher to be used for new threads.
+*/
+bool QEventDispatcherIoUring::isEnabledByEnvironment()
+{
+    bool ok = false;
+    const int value = qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_IO_URING", &ok);
+    return ok && value > 0;
+}
+
+/*!
+    \internal
+*/
+void QEventDispatcherIoUring::registerTimer(Qt::TimerId timerId, Duration interval,
+                                            Qt::TimerType timerType, QObject *obj)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1 || interval.count() < 0 || !obj) {
+        qWarning("QEventDispatcherIoUring::registerTimer: invalid arguments");
+        return;
+    } else if (obj->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherIoUring::registerTimer: timers cannot be started from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherIoUring);
+    d->timerList.registerTimer(timerId, interval, timerType, obj);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherIoUring::unregisterTimer(Qt::TimerId timerId)
+{
+#ifndef QT_NO_DEBUG
+    if (qToUnderlying(timerId) < 1) {
+        qWarning("QEventDispatcherIoUring::unregisterTimer: invalid argument");
+        return false;
+    } else if (thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherIoUring::unregisterTimer: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherIoUring);
+    return d->timerList.unregisterTimer(timerId);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherIoUring::unregisterTimers(QObject *object)
+{
+#ifndef QT_NO_DEBUG
+    if (!object) {
+        qWarning("QEventDispatcherIoUring::unregisterTimers: invalid argument");
+        return false;
+    } else if (object->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherIoUring::unregisterTimers: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherIoUring);
+    return d->timerList.unregisterTimers(object);
+}
+
+QList<QEventDispatcherIoUring::TimerInfoV2>
+QEventDispatcherIoUring::timersForObject(QObject *object) const
+{
+    if (!object) {
+        qWarning("QEventDispatcherIoUring:registeredTimers: invalid argument");
+        return QList<TimerInfoV2>();
+    }
+
+    Q_D(const QEventDispatcherIoUring);
+    return d->timerList.registeredTimers(object);
+}
+
+auto QEventDispatcherIoUring::remainingTime(Qt::TimerId timerId) const -> Duration
+{
+#ifndef QT_NO_DEBUG
+    if (int(timerId) < 1) {
+        qWarning("QEventDispatcherIoUring::remainingTime: invalid argument");
+        return Duration::min();
+    }
+#endif
+
+    Q_D(const QEventDispatcherIoUring);
+    return d->timerList.remainingDuration(timerId);
+}
+
+void QEventDispatcherIoUring::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifiers cannot be enabled from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherIoUring);
+    QSocketNotifierSetUNIX &sn_set = d->socketNotifiers[sockfd];
+
+    if (sn_set.notifiers[type] && sn_set.notifiers[type] != notifier)
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+
+    sn_set.notifiers[type] = notifier;
+    d->changedFds.append(sockfd);
+}
+
+void QEventDispatcherIoUring::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifier (fd %d) cannot be disabled from another thread.\n"
+                "(Notifier's thread is %s(%p), event dispatcher's thread is %s(%p), current thread is %s(%p))",
+                sockfd,
+                notifier->thread() ? notifier->thread()->metaObject()->className() : "QThread", notifier->thread(),
+                thread() ? thread()->metaObject()->className() : "QThread", thread(),
+                QThread::currentThread() ? QThread::currentThread()->metaObject()->className() : "QThread", QThread::currentThread());
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherIoUring);
+
+    d->pendingNotifiers.removeOne(notifier);
+
+    auto i = d->socketNotifiers.find(sockfd);
+    if (i == d->socketNotifiers.end())
+        return;
+
+    QSocketNotifierSetUNIX &sn_set = i.value();
+
+    if (sn_set.notifiers[type] == nullptr)
+        return;
+
+    if (sn_set.notifiers[type] != notifier) {
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+        return;
+    }
+
+    sn_set.notifiers[type] = nullptr;
+
+    if (sn_set.isEmpty()) {
+        d->socketNotifiers.erase(i);
+        d->cancelPollRequest(sockfd);
+    } else {
+        d->changedFds.append(sockfd);
+    }
+}
+
+bool QEventDispatcherIoUring::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherIoUring);
+    d->interrupt.storeRelaxed(0);
+
+    // we are awake, broadcast it
+    emit awake();
+
+    auto threadData = d->threadData.loadRelaxed();
+    QCoreApplicationPrivate::sendPostedEvents(nullptr, 0, threadData);
+
+    const bool include_timers = (flags & QEventLoop::X11ExcludeTimers) == 0;
+    const bool include_notifiers = (flags & QEventLoop::ExcludeSocketNotifiers) == 0;
+    const bool wait_for_events = (flags & QEventLoop::WaitForMoreEvents) != 0;
+
+    const bool canWait = (threadData->canWaitLocked()
+                          && !d->interrupt.loadRelaxed()
+                          && wait_for_events);
+
+    if (canWait)
+        emit aboutToBlock();
+
+    if (d->interrupt.loadRelaxed())
+        return false;
+
+    bool block = canWait;
+    std::optional<QEventDispatcherIoUringPrivate::TimePoint> deadline;
+    if (canWait && include_timers) {
+        if (std::optional<nanoseconds> remaining = d->timerList.timerWait()) {
+            if (*remaining > 0ns)
+                deadline = d->timerList.currentTime + *remaining;
+            else
+                block = false;
+        }
+    }
+
+    if (include_notifiers && !d->deferredFds.isEmpty()) {
+        d->changedFds += d->deferredFds;
+        d->deferredFds.clear();
+    }
+
+    d->armWakeUp();
+    d->submitPollRequests();
+    if (block && deadline)
+        d->armTimeout(*deadline);
+
+    // don't sleep if we couldn't queue what would wake us up
+    if (!d->wakeUpArmed || (deadline && !d->timeoutArmed))
+        block = false;
+
+    int nevents = 0;
+    auto handleCompletion = [&](quint64 userData, int result) {
+        switch (d->processCompletion(userData, result, include_notifiers)) {
+        case QEventDispatcherIoUringPrivate::Completion::Stale:
+            return 0;
+        case QEventDispatcherIoUringPrivate::Completion::WakeUp:
+            ++nevents;
+            break;
+        case QEventDispatcherIoUringPrivate::Completion::Event:
+            break;
+        }
+        return 1;
+    };
+
+    for (;;) {
+        if (block || d->ring.needsEnter()) {
+            if (d->ring.enter(block ? 1 : 0) == -1) {
+                // EBUSY: completions are waiting to be flushed to the queue,
+                // which they will be once we have processed those in it
+                if (errno != EBUSY) {
+                    qErrnoWarning("io_uring_enter");
+                    if (QT_CONFIG(poll_exit_on_error))
+                        abort();
+                }
+                block = false;
+            }
+        }
+
+        // the completions of removed requests don't end the wait
+        if (d->ring.processCompletions(handleCompletion) > 0 || !block)
+            break;
+    }
+
+    if (include_notifiers)
+        nevents += d->activateSocketNotifiers();
+
+    if (include_timers)
+        nevents += d->timerList.activateTimers();
+
+    // return true if we handled events, false otherwise
+    return (nevents > 0);
+}
+
+void QEventDispatcherIoUring::wakeUp()
+{
+    Q_D(QEventDispatcherIoUring);
+    d->threadPipe.wakeUp();
+}
+
+void QEventDispatcherIoUring::interrupt()
+{
+    Q_D(QEventDispatcherIoUring);
+    d->interrupt.storeRelaxed(1);
+    wakeUp();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_io_uring_p.cpp"
@@ -0,0 +1,161 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QEVENTDISPATCHER_IO_URING_P_H
+#define QEVENTDISPATCHER_IO_URING_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "QtCore/qabstracteventdispatcher.h"
+#include "QtCore/qlist.h"
+#include "QtCore/qhash.h"
+#include "private/qabstracteventdispatcher_p.h"
+#include "private/qeventdispatcher_unix_p.h"
+#include "private/qtimerinfo_unix_p.h"
+
+#include <linux/io_uring.h>
+
+#include <chrono>
+
+QT_REQUIRE_CONFIG(io_uring);
+
+QT_BEGIN_NAMESPACE
+
+class QEventDispatcherIoUringPrivate;
+
+class Q_CORE_EXPORT QEventDispatcherIoUring : public QAbstractEventDispatcherV2
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QEventDispatcherIoUring)
+
+public:
+    explicit QEventDispatcherIoUring(QObject *parent = nullptr);
+    ~QEventDispatcherIoUring();
+
+    bool processEvents(QEventLoop::ProcessEventsFlags flags) override;
+
+    void registerSocketNotifier(QSocketNotifier *notifier) final;
+    void unregisterSocketNotifier(QSocketNotifier *notifier) final;
+
+    void registerTimer(Qt::TimerId timerId, Duration interval, Qt::TimerType timerType,
+                       QObject *object) override final;
+    bool unregisterTimer(Qt::TimerId timerId) override final;
+    bool unregisterTimers(QObject *object) override final;
+    QList<TimerInfoV2> timersForObject(QObject *object) const override final;
+    Duration remainingTime(Qt::TimerId timerId) const override final;
+
+    void wakeUp() override;
+    void interrupt() final;
+
+    static bool isSupported();
+    static bool isEnabledByEnvironment();
+
+protected:
+    QEventDispatcherIoUring(QEventDispatcherIoUringPrivate &dd, QObject *parent = nullptr);
+};
+
+// A minimal io_uring instance: the mapped submission and completion rings
+class QIoUring
+{
+    Q_DISABLE_COPY_MOVE(QIoUring)
+public:
+    QIoUring() = default;
+    ~QIoUring();
+
+    bool init(unsigned entries);
+
+    io_uring_sqe *nextSqe();
+    int enter(unsigned waitCount);
+    bool needsEnter() const;
+
+    template <typename Handler> int processCompletions(Handler handler);
+
+    int fd = -1;
+
+private:
+    void *sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void *cqRing = nullptr;
+    size_t cqRingSize = 0;
+    io_uring_sqe *sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned *sqHead = nullptr;
+    unsigned *sqTail = nullptr;
+    unsigned *sqFlags = nullptr;
+    unsigned *sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned sqLocalTail = 0;                   // SQEs queued but not yet published
+
+    unsigned *cqHead = nullptr;
+    unsigned *cqTail = nullptr;
+    io_uring_cqe *cqes = nullptr;
+    unsigned cqMask = 0;
+};
+
+class Q_CORE_EXPORT QEventDispatcherIoUringPrivate : public QAbstractEventDispatcherPrivate
+{
+    Q_DECLARE_PUBLIC(QEventDispatcherIoUring)
+
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>;
+
+    QEventDispatcherIoUringPrivate();
+    ~QEventDispatcherIoUringPrivate();
+
+    void submitPollRequests();
+    void cancelPollRequest(int fd);
+    void armWakeUp();
+    void armTimeout(TimePoint deadline);
+
+    enum class Completion {
+        Stale,                                  // of a request that was removed
+        Event,
+        WakeUp,                                 // the thread pipe was woken up
+    };
+    Completion processCompletion(quint64 userData, int result, bool includeNotifiers);
+
+    void markPendingSocketNotifiers(int fd, short revents);
+    int activateSocketNotifiers();
+    void setSocketNotifierPending(QSocketNotifier *notifier);
+
+    QThreadPipe threadPipe;
+    QIoUring ring;
+
+    // the one-shot poll request currently in the ring for a descriptor
+    struct PollRequest
+    {
+        quint32 generation;
+        short events;
+    };
+
+    QHash<int, QSocketNotifierSetUNIX> socketNotifiers;
+    QHash<int, PollRequest> pollRequests;
+    QList<int> changedFds;                      // descriptors whose poll request is out of date
+    QList<int> deferredFds;                     // ready while socket notifiers were excluded
+    QList<QSocketNotifier *> pendingNotifiers;
+    quint32 nextGeneration = 0;
+
+    bool wakeUpArmed = false;
+    bool timeoutArmed = false;
+    quint32 timeoutGeneration = 0;
+    TimePoint timeoutDeadline;
+    __kernel_timespec timeoutSpec = {};         // read by the kernel on submission
+
+    QTimerInfoList timerList;
+    QAtomicInt interrupt; // bool
+};
+
+QT_END_NAMESPACE
+
+#endif // QEVENTDISPATCHER_IO_URING_P_H
@@ -26,6 +26,7 @@
 #include <qscopeguard.h>
 #include <qset.h>
 #if QT_CONFIG(thread)
+#include <qpointer.h>
 #include <qsemaphore.h>
 #endif
 
@@ -480,6 +481,122 @@ QAbstractMetaCallEvent::~QAbstractMetaCallEvent()
 #endif
 }
 
+/*!
+    \internal
+    \class QMetaCallEventPool
+
+    A pool of memory blocks for the QMetaCallEvents allocated by a thread,
+    owned by its QThreadData. Queued connections allocate an event per
+    emission in the emitting thread, which is then deleted in the receiving
+    thread. The receiving thread pushes the block onto a lock-free stack of
+    the allocating thread's pool, from which the allocating thread takes
+    all blocks at once when it runs out of free blocks, so that neither
+    needs to lock and the blocks are reused once the queue is in a steady
+    state.
+
+    The pool lives as long as its thread's QThreadData or any of its blocks,
+    whichever is the longest. Threads without a QThreadData allocate from
+    the heap.
+*/
+
+QMetaCallEventPool::~QMetaCallEventPool()
+{
+    Q_ASSERT(!freeBlocks);
+    Block *block = releasedBlocks.load(std::memory_order_acquire);
+    while (block)
+        free(std::exchange(block, block->next));
+}
+
+void *QMetaCallEventPool::allocate(size_t size)
+{
+    QThreadData *data = QThreadData::current(false);
+    QMetaCallEventPool *pool = nullptr;
+    if (size == sizeof(QMetaCallEvent) && data) {
+        pool = data->metaCallEventPool;
+        if (!pool)
+            pool = data->metaCallEventPool = new QMetaCallEventPool;
+    }
+
+    Block *block = nullptr;
+    if (pool) {
+        if (!pool->freeBlocks) {
+            pool->freeBlocks = pool->releasedBlocks.exchange(nullptr, std::memory_order_acquire);
+            for (Block *b = pool->freeBlocks; b; b = b->next)
+                ++pool->freeBlockCount;
+        }
+        if ((block = pool->freeBlocks)) {
+            pool->freeBlocks = block->next;
+            --pool->freeBlockCount;
+        }
+        pool->ref.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!block) {
+        block = static_cast<Block *>(malloc(sizeof(Block) + size));
+        if (!block) {
+            if (pool)
+                pool->deref();
+            qBadAlloc();
+        }
+    }
+    block->pool = pool;
+    return block + 1;
+}
+
+void QMetaCallEventPool::release(void *ptr) noexcept
+{
+    if (!ptr)
+        return;
+    Block *block = static_cast<Block *>(ptr) - 1;
+    QMetaCallEventPool *pool = block->pool;
+    if (!pool) {
+        free(block);
+        return;
+    }
+
+    QThreadData *data = QThreadData::current(false);
+    if (data && data->metaCallEventPool == pool) {
+        if (pool->freeBlockCount < MaxFreeBlocks) {
+            block->next = pool->freeBlocks;
+            pool->freeBlocks = block;
+            ++pool->freeBlockCount;
+        } else {
+            free(block);
+        }
+        // the thread holds a reference, too
+        pool->ref.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Block *head = pool->releasedBlocks.load(std::memory_order_relaxed);
+    do {
+        block->next = head;
+    } while (!pool->releasedBlocks.compare_exchange_weak(head, block, std::memory_order_release,
+                                                         std::memory_order_relaxed));
+    pool->deref();
+}
+
+/*!
+    \internal
+
+    Called by ~QThreadData(). The blocks still in use return to the heap
+    when they are released.
+*/
+void QMetaCallEventPool::threadFinished(QMetaCallEventPool *pool) noexcept
+{
+    if (!pool)
+        return;
+    while (pool->freeBlocks)
+        free(std::exchange(pool->freeBlocks, pool->freeBlocks->next));
+    pool->freeBlockCount = 0;
+    pool->deref();
+}
+
+void QMetaCallEventPool::deref() noexcept
+{
+    if (ref.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete this;
+}
+
 /*!
     \internal
  */
@@ -603,7 +720,11 @@ QMetaCallEvent::~QMetaCallEvent()
     if (d.nargs_) {
         QMetaType *t = types();
         for (int i = 0; i < d.nargs_; ++i) {
-            if (t[i].isValid() && d.args_[i])
+            if (!t[i].isValid() || !d.args_[i])
+                continue;
+            if (isInlineArgument(d.args_[i]))
+                t[i].destruct(d.args_[i]);
+            else
                 t[i].destroy(d.args_[i]);
         }
         if (reinterpret_cast<void *>(d.args_) != reinterpret_cast<void *>(prealloc_))
@@ -611,6 +732,44 @@ QMetaCallEvent::~QMetaCallEvent()
     }
 }
 
+/*!
+    \internal
+
+    Allocates the events from the QMetaCallEventPool of the current thread.
+    This is out of line, as the pool is not exported.
+ */
+void *QMetaCallEvent::operator new(size_t size)
+{
+    return QMetaCallEventPool::allocate(size);
+}
+
+/*!
+    \internal
+ */
+void QMetaCallEvent::operator delete(void *ptr) noexcept
+{
+    QMetaCallEventPool::release(ptr);
+}
+
+/*!
+    \internal
+
+    Returns a copy of \a copy, an argument of \a type, for args(). Small
+    arguments are copied into the event itself, others onto the heap.
+ */
+void *QMetaCallEvent::copyArgument(QMetaType type, const void *copy)
+{
+    const size_t alignment = type.alignOf();
+    const size_t offset = (argStorageUsed_ + alignment - 1) & ~(alignment - 1);
+    if (alignment <= alignof(std::max_align_t) && offset + type.sizeOf() <= sizeof(argStorage_)) {
+        void *where = argStorage_ + offset;
+        type.construct(where, copy);
+        argStorageUsed_ = uint(offset + type.sizeOf());
+        return where;
+    }
+    return type.create(copy);
+}
+
 /*!
     \internal
  */
@@ -638,13 +797,227 @@ QMetaCallEvent* QMetaCallEvent::create_impl(QtPrivate::SlotObjUniquePtr slotObj,
     QMetaType *types = metaCallEvent->types();
     for (size_t i = 0; i < argc; ++i) {
         types[i] = metaTypes[i];
-        args[i] = types[i].create(argp[i]);
+        args[i] = i ? metaCallEvent->copyArgument(types[i], argp[i]) : nullptr;
         Q_CHECK_PTR(!i || args[i]);
     }
 
     return metaCallEvent.release();
 }
 
+/*!
+    \internal
+    \class QMetaCallBatchEvent
+
+    A QEvent::MetaCall event carrying any number of queued calls to its
+    receiver, used for the queued connections to objects in threads that
+    have QThread::setQueuedCallBatchingEnabled() set. The calls are appended
+    by QCoreApplicationPrivate::postBatchedMetaCall() for as long as the
+    event is the last one in the thread's event queue, and are invoked in
+    order when it is delivered.
+
+    Each call is stored as a Call record followed by its argument pointers
+    and types, and the arguments copied in place, in a list of blocks that
+    grow geometrically. Appending a call thus takes no allocation most of
+    the time, and the calls lie next to each other in memory.
+*/
+
+struct QMetaCallBatchEvent::Call
+{
+    Call *next;
+    QtPrivate::QSlotObjectBase *slotObj;
+    QObjectPrivate::StaticMetaCallFunction callFunction;
+    const QObject *sender;
+    int signalId;
+    int nargs;
+    ushort method_offset;
+    ushort method_relative;
+
+    void **args() { return reinterpret_cast<void **>(this + 1); }
+    QMetaType *types() { return reinterpret_cast<QMetaType *>(args() + nargs); }
+};
+static_assert(alignof(QMetaType) <= alignof(void *));
+
+struct QMetaCallBatchEvent::Block
+{
+    Block *next;
+    size_t size;
+    size_t used;
+
+    char *data() { return reinterpret_cast<char *>(this + 1); }
+};
+
+namespace {
+constexpr size_t FirstBatchBlockSize = 1024;
+constexpr size_t MaxBatchBlockSize = 64 * 1024;
+}
+
+QMetaCallBatchEvent::QMetaCallBatchEvent()
+    : QAbstractMetaCallEvent(nullptr, -1)
+{
+}
+
+QMetaCallBatchEvent::~QMetaCallBatchEvent()
+{
+    for (Call *call = first; call; call = call->next)
+        destroy(call);
+    while (blocks)
+        free(std::exchange(blocks, blocks->next));
+}
+
+/*!
+    \internal
+
+    Returns whether an argument of \a type is copied into the batch while the
+    event queue of the receiver's thread is locked. That is only done for
+    the types whose copy cannot run arbitrary code, the others are copied
+    by queued_activate() beforehand.
+*/
+bool QMetaCallBatchEvent::canCopyInPlace(QMetaType type)
+{
+    if (!type.iface()->copyCtr)
+        return true;    // trivially copyable
+    switch (type.id()) {
+    case QMetaType::QString:
+    case QMetaType::QByteArray:
+    case QMetaType::QStringList:
+    case QMetaType::QByteArrayList:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*!
+    \internal
+
+    Destroys the arguments of \a call that were copied beforehand, for a call
+    that is not going to be appended after all.
+*/
+void QMetaCallBatchEvent::discard(const PendingCall &call)
+{
+    for (int n = 1; n < call.nargs; ++n) {
+        if (!canCopyInPlace(call.types[n]))
+            call.types[n].destroy(call.args[n]);
+    }
+}
+
+void QMetaCallBatchEvent::destroy(Call *call)
+{
+    void **args = call->args();
+    QMetaType *types = call->types();
+    for (int n = 1; n < call->nargs; ++n) {
+        if (canCopyInPlace(types[n]))
+            types[n].destruct(args[n]);
+        else
+            types[n].destroy(args[n]);
+    }
+    if (call->slotObj)
+        call->slotObj->destroyIfLastRef();
+}
+
+void *QMetaCallBatchEvent::allocate(size_t size, size_t alignment)
+{
+    if (blocks) {
+        const quintptr start = quintptr(blocks->data());
+        const quintptr aligned = (start + blocks->used + alignment - 1) & ~quintptr(alignment - 1);
+        if (aligned - start + size <= blocks->size) {
+            blocks->used = aligned - start + size;
+            return reinterpret_cast<void *>(aligned);
+        }
+    }
+
+    size_t blockSize = blocks ? qMin(blocks->size * 2, MaxBatchBlockSize) : FirstBatchBlockSize;
+    blockSize = qMax(blockSize, size + alignment);
+    Block *block = static_cast<Block *>(malloc(sizeof(Block) + blockSize));
+    Q_CHECK_PTR(block);
+    block->next = blocks;
+    block->size = blockSize;
+    block->used = 0;
+    blocks = block;
+    return allocate(size, alignment);
+}
+
+/*!
+    \internal
+
+    Appends \a pending to the calls of this batch, copying the arguments that
+    can be copied in place and taking over the others.
+*/
+void QMetaCallBatchEvent::append(const PendingCall &pending)
+{
+    const int nargs = pending.nargs;
+    void *where = allocate(sizeof(Call) + nargs * (sizeof(void *) + sizeof(QMetaType)),
+                           alignof(Call));
+    Call *call = new (where) Call{ nullptr, pending.slotObj, pending.callFunction,
+                                   pending.sender, pending.signalId, nargs,
+                                   pending.method_offset, pending.method_relative };
+    if (call->slotObj)
+        call->slotObj->ref();
+
+    void **args = call->args();
+    QMetaType *types = call->types();
+    new (&types[0]) QMetaType();
+    args[0] = nullptr;
+    for (int n = 1; n < nargs; ++n) {
+        const QMetaType type = pending.types[n];
+        new (&types[n]) QMetaType(type);
+        if (canCopyInPlace(type)) {
+            args[n] = allocate(type.sizeOf(), type.alignOf());
+            type.construct(args[n], pending.args[n]);
+        } else {
+            args[n] = pending.args[n];
+        }
+    }
+
+    if (last)
+        last->next = call;
+    else
+        first = call;
+    last = call;
+}
+
+/*!
+    \internal
+ */
+void QMetaCallBatchEvent::placeMetaCall(QObject *object)
+{
+    QObjectPrivate *d = QObjectPrivate::get(object);
+    QObjectPrivate::ConnectionData *connections = d->connections.loadRelaxed();
+    const QThreadData *threadData = d->threadData.loadRelaxed();
+    // tells a deleted receiver from one moved to another thread below
+    QPointer<QObject> guard(first && first->next ? object : nullptr);
+
+    while (Call *call = first) {
+        QObjectPrivate::Sender currentSender(object, const_cast<QObject *>(call->sender),
+                                             call->signalId, connections);
+        void **args = call->args();
+        if (call->slotObj) {
+            call->slotObj->call(object, args);
+        } else if (call->callFunction && call->method_offset <= object->metaObject()->methodOffset()) {
+            call->callFunction(object, QMetaObject::InvokeMetaMethod, call->method_relative, args);
+        } else {
+            QMetaObject::metacall(object, QMetaObject::InvokeMetaMethod,
+                                  call->method_offset + call->method_relative, args);
+        }
+
+        first = call->next;
+        destroy(call);
+        if (!currentSender.receiver) {
+            // the receiver was deleted or moved to another thread by the call
+            if (first && guard && QObjectPrivate::get(object)->threadData.loadRelaxed() != threadData) {
+                auto rest = new QMetaCallBatchEvent;
+                rest->first = std::exchange(first, nullptr);
+                rest->last = last;
+                rest->blocks = std::exchange(blocks, nullptr);
+                QCoreApplication::postEvent(object, rest);
+            }
+            break;
+        }
+    }
+    if (!first)
+        last = nullptr;
+}
+
 /*!
     \class QSignalBlocker
     \brief Exception-safe wrapper around QObject::blockSignals().
@@ -1691,12 +2064,19 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
     // make sure nobody adds/removes connections to this object while we're moving it
     QMutexLocker l(signalSlotLock(this));
 
+    // events for this object may be queued without the lock, make sure none
+    // can arrive in currentData after we moved them; this waits for the
+    // threads that are queuing, so it must not be done with the lock held
+    currentData->postEventList.incoming.close();
+
     QOrderedMutexLocker locker(&currentData->postEventList.mutex,
                                &targetData->postEventList.mutex);
 
     // keep currentData alive (since we've got it locked)
     currentData->ref();
 
+    currentData->postEventList.takeIncoming();
+
     // move the object
     auto threadPrivate =  targetThread
         ? static_cast<QThreadPrivate *>(QThreadPrivate::get(targetThread))
@@ -1708,6 +2088,7 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
         bindingStatus = threadPrivate->addObjectWithPendingBindingStatusChange(this);
     }
     d_func()->setThreadData_helper(currentData, targetData, bindingStatus);
+    currentData->postEventList.incoming.reopen();
 
     locker.unlock();
 
@@ -3925,6 +4306,56 @@ private:
     QtPrivate::SlotObjUniquePtr m_slotObject;
 };
 
+/*!
+    \internal
+
+    The part of queued_activate() that appends the call to a
+    QMetaCallBatchEvent instead of posting a QMetaCallEvent for it.
+*/
+static void queued_activate_batched(QObject *sender, int signal, QObjectPrivate::Connection *c,
+                                    void **argv, const int *argumentTypes, int nargs,
+                                    QObject *receiver, QMutexLocker<QBasicMutex> &locker)
+{
+    QVarLengthArray<QMetaType, 8> types(nargs);
+    QVarLengthArray<void *, 8> args(nargs);
+    types[0] = QMetaType(); // return type
+    args[0] = nullptr; // return value
+    for (int n = 1; n < nargs; ++n) {
+        types[n] = QMetaType(argumentTypes[n - 1]);
+        args[n] = QMetaCallBatchEvent::canCopyInPlace(types[n]) ? argv[n] : types[n].create(argv[n]);
+    }
+
+    QMetaCallBatchEvent::PendingCall call = {};
+    if (c->isSlotObject) {
+        call.slotObj = c->slotObj;
+        call.method_relative = ushort(-1);
+    } else {
+        call.callFunction = c->callFunction;
+        call.method_offset = c->method_offset;
+        call.method_relative = c->method_relative;
+    }
+    call.sender = sender;
+    call.signalId = signal;
+    call.nargs = nargs;
+    call.types = types.constData();
+    call.args = args.data();
+
+    if (c->isSingleShot && !QObjectPrivate::removeConnection(c)) {
+        QMetaCallBatchEvent::discard(call);
+        return;
+    }
+
+    locker.relock();
+    if (!c->isSingleShot && !c->receiver.loadRelaxed()) {
+        // the connection has been disconnected while we were unlocked
+        locker.unlock();
+        QMetaCallBatchEvent::discard(call);
+        return;
+    }
+
+    QCoreApplicationPrivate::postBatchedMetaCall(receiver, call);
+}
+
 /*!
     \internal
 
@@ -3958,8 +4389,15 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
     }
 
     SlotObjectGuard slotObjectGuard { c->isSlotObject ? c->slotObj : nullptr };
+    const QThreadData *receiverThreadData = QObjectPrivate::get(receiver)->threadData.loadRelaxed();
+    const bool batched = receiverThreadData && receiverThreadData->batchQueuedCalls.loadRelaxed();
     locker.unlock();
 
+    if (batched) {
+        queued_activate_batched(sender, signal, c, argv, argumentTypes, nargs, receiver, locker);
+        return;
+    }
+
     QMetaCallEvent *ev = c->isSlotObject ?
         new QMetaCallEvent(c->slotObj, sender, signal, nargs) :
         new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender, signal, nargs);
@@ -3975,7 +4413,7 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
             types[n] = QMetaType(argumentTypes[n - 1]);
 
         for (int n = 1; n < nargs; ++n)
-            args[n] = types[n].create(argv[n]);
+            args[n] = ev->copyArgument(types[n], argv[n]);
     }
 
     if (c->isSingleShot && !QObjectPrivate::removeConnection(c)) {
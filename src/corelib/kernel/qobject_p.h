@@ -27,6 +27,7 @@
 #include <QtCore/qshareddata.h>
 #include "QtCore/private/qproperty_p.h"
 
+#include <atomic>
 #include <string>
 
 QT_BEGIN_NAMESPACE
@@ -340,6 +341,35 @@ bool QObjectPrivate::disconnect(const typename QtPrivate::FunctionPointer< Func1
                           &SignalType::Object::staticMetaObject);
 }
 
+// Recycles the memory of the QMetaCallEvents allocated by one thread. The
+// events are usually deleted by the thread receiving them, which hands the
+// memory back to the allocating thread's pool.
+class QMetaCallEventPool
+{
+    Q_DISABLE_COPY_MOVE(QMetaCallEventPool)
+public:
+    static void *allocate(size_t size);
+    static void release(void *ptr) noexcept;
+    static void threadFinished(QMetaCallEventPool *pool) noexcept;
+
+private:
+    struct alignas(std::max_align_t) Block
+    {
+        QMetaCallEventPool *pool;       // or nullptr if not pooled
+        Block *next;
+    };
+    static constexpr int MaxFreeBlocks = 1024;
+
+    QMetaCallEventPool() = default;
+    ~QMetaCallEventPool();
+    void deref() noexcept;
+
+    Block *freeBlocks = nullptr;        // only used by the allocating thread
+    int freeBlockCount = 0;
+    std::atomic<Block *> releasedBlocks = nullptr;  // pushed by other threads
+    std::atomic<int> ref = 1;           // the thread and the blocks in use
+};
+
 class QSemaphore;
 class Q_CORE_EXPORT QAbstractMetaCallEvent : public QEvent
 {
@@ -419,8 +449,13 @@ public:
     inline const QMetaType *types() const { return reinterpret_cast<QMetaType *>(d.args_ + d.nargs_); }
     inline QMetaType *types() { return reinterpret_cast<QMetaType *>(d.args_ + d.nargs_); }
 
+    void *copyArgument(QMetaType type, const void *copy);
+
     virtual void placeMetaCall(QObject *object) override;
 
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr) noexcept;
+
 private:
     static QMetaCallEvent *create_impl(QtPrivate::QSlotObjectBase *slotObj, const QObject *sender,
                                        int signal_index, size_t argc, const void * const argp[],
@@ -435,6 +470,10 @@ private:
                                        int signal_index, size_t argc, const void * const argp[],
                                        const QMetaType metaTypes[]);
     inline void allocArgs();
+    inline bool isInlineArgument(const void *arg) const
+    {
+        return quintptr(arg) - quintptr(argStorage_) < sizeof(argStorage_);
+    }
 
     struct Data {
         QtPrivate::SlotObjUniquePtr slotObj_;
@@ -446,6 +485,49 @@ private:
     } d;
     // preallocate enough space for three arguments
     alignas(void *) char prealloc_[3 * sizeof(void *) + 3 * sizeof(QMetaType)];
+    // and for copies of them as large as an int, a double and a QString
+    alignas(std::max_align_t) char argStorage_[6 * sizeof(void *)];
+    uint argStorageUsed_ = 0;
+};
+
+class Q_CORE_EXPORT QMetaCallBatchEvent : public QAbstractMetaCallEvent
+{
+public:
+    // a queued call as described by queued_activate(); the arguments that
+    // cannot be copied in place have already been copied by the caller and
+    // are adopted by the batch
+    struct PendingCall
+    {
+        QtPrivate::QSlotObjectBase *slotObj;
+        QObjectPrivate::StaticMetaCallFunction callFunction;
+        const QObject *sender;
+        int signalId;
+        int nargs;
+        ushort method_offset;
+        ushort method_relative;
+        const QMetaType *types;
+        void **args;
+    };
+
+    QMetaCallBatchEvent();
+    ~QMetaCallBatchEvent() override;
+
+    static bool canCopyInPlace(QMetaType type);
+    static void discard(const PendingCall &call);
+
+    void append(const PendingCall &call);
+    void placeMetaCall(QObject *object) override;
+
+private:
+    struct Call;
+    struct Block;
+
+    void *allocate(size_t size, size_t alignment);
+    static void destroy(Call *call);
+
+    Call *first = nullptr;
+    Call *last = nullptr;
+    Block *blocks = nullptr;            // the one calls are currently appended to comes first
 };
 
 class QBoolBlocker
@@ -7,6 +7,7 @@
 
 #include "private/qcore_unix_p.h"
 #include "private/qtimerinfo_unix_p.h"
+#include "private/qtimerwheel_p.h"
 #include "private/qobject_p.h"
 #include "private/qabstracteventdispatcher_p.h"
 
@@ -25,7 +26,26 @@ Q_CORE_EXPORT bool qt_disable_lowpriority_timers=false;
  * timerBitVec array is used for keeping track of timer identifiers.
  */
 
-QTimerInfoList::QTimerInfoList() = default;
+static QTimerInfoList::Storage defaultStorage()
+{
+    // the timer wheel scales better with many timers that are restarted often,
+    // e.g. the idle timeouts of a server's connections
+    static const bool useWheel = qEnvironmentVariableIntValue("QT_TIMER_WHEEL") > 0;
+    return useWheel ? QTimerInfoList::Storage::TimerWheel : QTimerInfoList::Storage::SortedList;
+}
+
+QTimerInfoList::QTimerInfoList()
+    : QTimerInfoList(defaultStorage())
+{
+}
+
+QTimerInfoList::QTimerInfoList(Storage storage)
+{
+    if (storage == Storage::TimerWheel)
+        wheel = std::make_unique<QTimerWheel>();
+}
+
+QTimerInfoList::~QTimerInfoList() = default;
 
 steady_clock::time_point QTimerInfoList::updateCurrentTime() const
 {
@@ -41,6 +61,13 @@ steady_clock::time_point QTimerInfoList::updateCurrentTime() const
 */
 bool QTimerInfoList::hasPendingTimers()
 {
+    if (wheel) {
+        if (wheel->isEmpty())
+            return false;
+        wheel->advance(updateCurrentTime());
+        return !wheel->hasExpired();
+    }
+
     if (timers.isEmpty())
         return false;
     return updateCurrentTime() < timers.at(0)->timeout;
@@ -54,6 +81,10 @@ static bool byTimeout(const QTimerInfo *a, const QTimerInfo *b)
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
+    if (wheel) {
+        wheel->insert(ti);
+        return;
+    }
     timers.insert(std::upper_bound(timers.cbegin(), timers.cend(), ti, byTimeout),
                   ti);
 }
@@ -239,13 +270,22 @@ std::optional<QTimerInfoList::Duration> QTimerInfoList::timerWait()
 {
     steady_clock::time_point now = updateCurrentTime();
 
-    auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
-    // Find first waiting timer not already active
-    auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
-    if (it == timers.cend())
-        return std::nullopt;
+    QTimerInfo::TimePoint timeout;
+    if (wheel) {
+        const std::optional<QTimerWheel::TimePoint> next = wheel->nextTimeout();
+        if (!next)
+            return std::nullopt;
+        timeout = *next;
+    } else {
+        auto isWaiting = [](QTimerInfo *tinfo) { return !tinfo->activateRef; };
+        // Find first waiting timer not already active
+        auto it = std::find_if(timers.cbegin(), timers.cend(), isWaiting);
+        if (it == timers.cend())
+            return std::nullopt;
+        timeout = (*it)->timeout;
+    }
 
-    Duration timeToWait = (*it)->timeout - now;
+    Duration timeToWait = timeout - now;
     if (timeToWait > 0ns)
         return roundToMillisecond(timeToWait);
     return 0ms;
@@ -260,15 +300,20 @@ QTimerInfoList::Duration QTimerInfoList::remainingDuration(Qt::TimerId timerId)
 {
     const steady_clock::time_point now = updateCurrentTime();
 
-    auto it = findTimerById(timerId);
-    if (it == timers.cend()) {
+    const QTimerInfo *t = nullptr;
+    if (wheel) {
+        t = wheel->find(timerId);
+    } else if (auto it = findTimerById(timerId); it != timers.cend()) {
+        t = *it;
+    }
+
+    if (!t) {
 #ifndef QT_NO_DEBUG
         qWarning("QTimerInfoList::timerRemainingTime: timer id %i not found", int(timerId));
 #endif
         return Duration::min();
     }
 
-    const QTimerInfo *t = *it;
     if (now < t->timeout) // time to wait
         return t->timeout - now;
     return 0ms;
@@ -319,6 +364,16 @@ void QTimerInfoList::registerTimer(Qt::TimerId timerId, QTimerInfoList::Duration
 
 bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 {
+    if (wheel) {
+        QTimerInfo *t = wheel->take(timerId);
+        if (!t)
+            return false; // id not found
+        if (t->activateRef)
+            *(t->activateRef) = nullptr;
+        delete t;
+        return true;
+    }
+
     auto it = findTimerById(timerId);
     if (it == timers.cend())
         return false; // id not found
@@ -336,6 +391,16 @@ bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
+    if (wheel) {
+        const QList<QTimerInfo *> removed = wheel->takeAll(object);
+        for (QTimerInfo *t : removed) {
+            if (t->activateRef)
+                *(t->activateRef) = nullptr;
+            delete t;
+        }
+        return !removed.isEmpty();
+    }
+
     if (timers.isEmpty())
         return false;
 
@@ -360,6 +425,13 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
 {
     QList<TimerInfo> list;
+    if (wheel) {
+        const QList<QTimerInfo *> forObject = wheel->timersForObject(object);
+        for (const QTimerInfo *t : forObject)
+            list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
+        return list;
+    }
+
     for (const auto &t : timers) {
         if (t->obj == object)
             list.emplaceBack(TimerInfo{t->interval, t->id, t->timerType});
@@ -367,14 +439,80 @@ auto QTimerInfoList::registeredTimers(QObject *object) const -> QList<TimerInfo>
     return list;
 }
 
+void QTimerInfoList::clearTimers()
+{
+    if (wheel) {
+        qDeleteAll(wheel->takeAll());
+        return;
+    }
+    qDeleteAll(timers);
+    timers.clear();
+}
+
+bool QTimerInfoList::isEmpty() const
+{
+    return wheel ? wheel->isEmpty() : timers.empty();
+}
+
+qsizetype QTimerInfoList::size() const
+{
+    return wheel ? wheel->size() : timers.size();
+}
+
+/*
+    Sends the timer event for \a currentTimerInfo, but doesn't allow it to recurse.
+*/
+static void sendTimerEvent(QTimerInfo *currentTimerInfo)
+{
+    if (!currentTimerInfo->activateRef) {
+        currentTimerInfo->activateRef = &currentTimerInfo;
+
+        QTimerEvent e(qToUnderlying(currentTimerInfo->id));
+        QCoreApplication::sendEvent(currentTimerInfo->obj, &e);
+
+        // Storing currentTimerInfo's address in its activateRef allows the
+        // handling of that event to clear this local variable on deletion
+        // of the object it points to - if it didn't, clear activateRef:
+        if (currentTimerInfo)
+            currentTimerInfo->activateRef = nullptr;
+    }
+}
+
+/*
+    Activates the timers that the wheel has expired. A timer is rescheduled
+    before its event is sent, so any timer that expires again while the
+    events are being delivered is left for the next call.
+*/
+int QTimerInfoList::activateWheelTimers()
+{
+    const steady_clock::time_point now = updateCurrentTime();
+    wheel->advance(now);
+
+    int n_act = 0;
+    while (QTimerInfo *currentTimerInfo = wheel->takeExpired()) {
+        // determine next timeout time
+        calculateNextTimeout(currentTimerInfo, now);
+        wheel->reschedule(currentTimerInfo);
+
+        if (currentTimerInfo->interval > 0ms)
+            n_act++;
+
+        sendTimerEvent(currentTimerInfo);
+    }
+    return n_act;
+}
+
 /*
     Activate pending timers, returning how many where activated.
 */
 int QTimerInfoList::activateTimers()
 {
-    if (qt_disable_lowpriority_timers || timers.isEmpty())
+    if (qt_disable_lowpriority_timers || isEmpty())
         return 0; // nothing to do
 
+    if (wheel)
+        return activateWheelTimers();
+
     firstTimerInfo = nullptr;
 
     const steady_clock::time_point now = updateCurrentTime();
@@ -418,19 +556,7 @@ int QTimerInfoList::activateTimers()
         if (currentTimerInfo->interval > 0ms)
             n_act++;
 
-        // Send event, but don't allow it to recurse:
-        if (!currentTimerInfo->activateRef) {
-            currentTimerInfo->activateRef = &currentTimerInfo;
-
-            QTimerEvent e(qToUnderlying(currentTimerInfo->id));
-            QCoreApplication::sendEvent(currentTimerInfo->obj, &e);
-
-            // Storing currentTimerInfo's address in its activateRef allows the
-            // handling of that event to clear this local variable on deletion
-            // of the object it points to - if it didn't, clear activateRef:
-            if (currentTimerInfo)
-                currentTimerInfo->activateRef = nullptr;
-        }
+        sendTimerEvent(currentTimerInfo);
     }
 
     firstTimerInfo = nullptr;
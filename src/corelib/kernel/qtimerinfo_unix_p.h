@@ -21,6 +21,7 @@
 
 #include <sys/time.h> // struct timespec
 #include <chrono>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -40,14 +41,32 @@ struct QTimerInfo
     Qt::TimerType timerType; // - timer type
     QObject *obj = nullptr; // - object to receive event
     QTimerInfo **activateRef = nullptr; // - ref from activateTimers
+
+    // used by QTimerWheel
+    QTimerInfo *wheelPrev = nullptr;            // - timers in the same slot
+    QTimerInfo *wheelNext = nullptr;
+    QTimerInfo *objectPrev = nullptr;           // - timers of the same object
+    QTimerInfo *objectNext = nullptr;
+    quint8 wheelLevel = 0;
+    quint8 wheelSlot = 0;
 };
 
+class QTimerWheel;
+
 class Q_CORE_EXPORT QTimerInfoList
 {
 public:
     using Duration = QAbstractEventDispatcher::Duration;
     using TimerInfo = QAbstractEventDispatcher::TimerInfoV2;
+
+    enum class Storage {
+        SortedList,
+        TimerWheel,
+    };
+
     QTimerInfoList();
+    explicit QTimerInfoList(Storage storage);
+    ~QTimerInfoList();
 
     mutable std::chrono::steady_clock::time_point currentTime;
 
@@ -65,15 +84,10 @@ public:
     int activateTimers();
     bool hasPendingTimers();
 
-    void clearTimers()
-    {
-        qDeleteAll(timers);
-        timers.clear();
-    }
-
-    bool isEmpty() const { return timers.empty(); }
+    void clearTimers();
 
-    qsizetype size() const { return timers.size(); }
+    bool isEmpty() const;
+    qsizetype size() const;
 
     auto findTimerById(Qt::TimerId timerId) const
     {
@@ -83,10 +97,13 @@ public:
 
 private:
     std::chrono::steady_clock::time_point updateCurrentTime() const;
+    int activateWheelTimers();
 
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo = nullptr;
     QList<QTimerInfo *> timers;
+    // replaces the timers list if the timer wheel is in use
+    std::unique_ptr<QTimerWheel> wheel;
 };
 
 QT_END_NAMESPACE
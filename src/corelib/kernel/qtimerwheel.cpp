@@ -0,0 +1,376 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "private/qtimerwheel_p.h"
+#include "private/qtimerinfo_unix_p.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+
+using namespace std::chrono;
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QTimerWheel
+
+    A hierarchical timing wheel holding QTimerInfo objects for QTimerInfoList.
+
+    Time is divided into ticks of one millisecond, counted from the
+    construction of the wheel. The wheel has LevelCount levels of
+    SlotsPerLevel slots each; a slot on level \e n spans 64^\e n ticks. A
+    timer is kept on the lowest level on which its expiry tick and the
+    current (elapsed) tick fall into the same slot of the level above, so
+    every timer on a level expires later than all timers on the levels
+    below it. Timers further away than the whole wheel spans are kept on a
+    separate overflow list and placed into the wheel once they come within
+    range.
+
+    Inserting and removing a timer are O(1): the slot is computed from the
+    expiry tick, the timers of a slot and those of an object form intrusive
+    doubly-linked lists, and hashes map timer ids and objects to their
+    timers. Advancing the wheel finds the next non-empty slot through a
+    64-bit occupancy mask per level, so idle stretches of time are skipped
+    at no cost. When the wheel reaches a slot on a higher level, its timers
+    cascade down to the lower levels; when it reaches a slot on the lowest
+    level, the timers in it whose exact timeout has passed are moved to the
+    expired list. The exact timeout of each timer is kept, so
+    Qt::PreciseTimer timers are not delayed by the tick resolution.
+*/
+
+QTimerWheel::QTimerWheel()
+    : base(floor<milliseconds>(steady_clock::now()))
+{
+}
+
+// the timers are owned by QTimerInfoList, which deletes them in clearTimers()
+QTimerWheel::~QTimerWheel() = default;
+
+quint64 QTimerWheel::tickFor(TimePoint timeout) const
+{
+    if (timeout <= base)
+        return 0;
+    return quint64(floor<milliseconds>(timeout - base).count());
+}
+
+QTimerWheel::TimePoint QTimerWheel::timePointFor(quint64 tick) const
+{
+    return base + milliseconds(qint64(tick));
+}
+
+QTimerWheel::Bucket &QTimerWheel::bucketFor(const QTimerInfo *t)
+{
+    switch (t->wheelLevel) {
+    case ExpiredList:
+        return expired;
+    case OverflowList:
+        return overflow;
+    default:
+        Q_ASSERT(t->wheelLevel < LevelCount);
+        return buckets[t->wheelLevel][t->wheelSlot];
+    }
+}
+
+void QTimerWheel::append(Bucket &bucket, QTimerInfo *t)
+{
+    t->wheelPrev = bucket.last;
+    t->wheelNext = nullptr;
+    if (bucket.last)
+        bucket.last->wheelNext = t;
+    else
+        bucket.first = t;
+    bucket.last = t;
+}
+
+void QTimerWheel::unlink(QTimerInfo *t)
+{
+    if (t->wheelLevel == Unlinked)
+        return;
+
+    Bucket &bucket = bucketFor(t);
+    if (t->wheelPrev)
+        t->wheelPrev->wheelNext = t->wheelNext;
+    else
+        bucket.first = t->wheelNext;
+    if (t->wheelNext)
+        t->wheelNext->wheelPrev = t->wheelPrev;
+    else
+        bucket.last = t->wheelPrev;
+
+    if (!bucket.first && t->wheelLevel < LevelCount)
+        occupied[t->wheelLevel] &= ~(quint64(1) << t->wheelSlot);
+
+    t->wheelPrev = t->wheelNext = nullptr;
+    t->wheelLevel = Unlinked;
+}
+
+/*
+    Places the unlinked timer \a t according to its timeout. Timers that are
+    already overdue go into the slot of the current tick, so that they are
+    expired by the next call to advance() and not immediately, which keeps
+    activateTimers() from activating a zero-interval timer in a loop.
+*/
+void QTimerWheel::schedule(QTimerInfo *t)
+{
+    Q_ASSERT(t->wheelLevel == Unlinked);
+
+    const quint64 tick = qMax(tickFor(t->timeout), elapsed);
+
+    // the level is given by the most significant bit in which the expiry
+    // tick differs from the current one
+    const quint64 masked = (elapsed ^ tick) | (SlotsPerLevel - 1);
+    const int level = (63 - qCountLeadingZeroBits(masked)) / LevelBits;
+
+    if (level >= LevelCount) {
+        const quint64 rangeStart = tick & ~(WheelRange - 1);
+        overflowCheck = overflow.first ? qMin(overflowCheck, rangeStart) : rangeStart;
+        t->wheelLevel = OverflowList;
+        append(overflow, t);
+        return;
+    }
+
+    const int slot = int(tick >> (level * LevelBits)) & (SlotsPerLevel - 1);
+    t->wheelLevel = quint8(level);
+    t->wheelSlot = quint8(slot);
+    append(buckets[level][slot], t);
+    occupied[level] |= quint64(1) << slot;
+}
+
+void QTimerWheel::insert(QTimerInfo *t)
+{
+    byId.insert(t->id, t);
+
+    QTimerInfo *&first = byObject[t->obj];
+    t->objectPrev = nullptr;
+    t->objectNext = std::exchange(first, t);
+    if (t->objectNext)
+        t->objectNext->objectPrev = t;
+
+    t->wheelLevel = Unlinked;
+    schedule(t);
+}
+
+void QTimerWheel::removeFromObject(QTimerInfo *t)
+{
+    if (t->objectPrev) {
+        t->objectPrev->objectNext = t->objectNext;
+    } else if (t->objectNext) {
+        byObject[t->obj] = t->objectNext;
+    } else {
+        byObject.remove(t->obj);
+    }
+    if (t->objectNext)
+        t->objectNext->objectPrev = t->objectPrev;
+    t->objectPrev = t->objectNext = nullptr;
+}
+
+void QTimerWheel::reschedule(QTimerInfo *t)
+{
+    unlink(t);
+    schedule(t);
+}
+
+QTimerInfo *QTimerWheel::take(Qt::TimerId timerId)
+{
+    QTimerInfo *t = byId.take(timerId);
+    if (!t)
+        return nullptr;
+    removeFromObject(t);
+    unlink(t);
+    return t;
+}
+
+QList<QTimerInfo *> QTimerWheel::takeAll(QObject *object)
+{
+    QList<QTimerInfo *> timers;
+    QTimerInfo *t = byObject.take(object);
+    while (t) {
+        QTimerInfo *next = std::exchange(t->objectNext, nullptr);
+        t->objectPrev = nullptr;
+        byId.remove(t->id);
+        unlink(t);
+        timers.append(t);
+        t = next;
+    }
+    return timers;
+}
+
+QList<QTimerInfo *> QTimerWheel::timersForObject(QObject *object) const
+{
+    QList<QTimerInfo *> timers;
+    for (QTimerInfo *t = byObject.value(object); t; t = t->objectNext)
+        timers.append(t);
+    return timers;
+}
+
+QList<QTimerInfo *> QTimerWheel::takeAll()
+{
+    QList<QTimerInfo *> timers = byId.values();
+    byId.clear();
+    byObject.clear();
+    for (QTimerInfo *t : std::as_const(timers))
+        t->wheelLevel = Unlinked;
+
+    for (auto &level : buckets)
+        std::fill(std::begin(level), std::end(level), Bucket{});
+    std::fill(std::begin(occupied), std::end(occupied), 0);
+    expired = Bucket{};
+    overflow = Bucket{};
+    return timers;
+}
+
+/*
+    Returns the first non-empty slot at or after the current tick. All
+    timers on a level expire after those on the levels below it, so the
+    lowest level that has any timer wins.
+*/
+auto QTimerWheel::nextExpiration() const -> std::optional<Expiration>
+{
+    for (int level = 0; level < LevelCount; ++level) {
+        const int shift = level * LevelBits;
+        const int current = int(elapsed >> shift) & (SlotsPerLevel - 1);
+        const quint64 pending = occupied[level] & (~quint64(0) << current);
+        // nothing can be scheduled in the part of a level we already passed
+        Q_ASSERT((occupied[level] & ~(~quint64(0) << current)) == 0);
+        if (!pending)
+            continue;
+
+        const int slot = qCountTrailingZeroBits(pending);
+        const quint64 levelStart = elapsed & ~((quint64(1) << (shift + LevelBits)) - 1);
+        return Expiration{ level, slot, levelStart + (quint64(slot) << shift) };
+    }
+    return std::nullopt;
+}
+
+void QTimerWheel::expireSlot(steady_clock::time_point now, Bucket &slot)
+{
+    QVarLengthArray<QTimerInfo *, 32> due;
+    for (QTimerInfo *t = slot.first; t; ) {
+        QTimerInfo *next = t->wheelNext;
+        if (t->timeout <= now) {
+            unlink(t);
+            due.append(t);
+        }
+        t = next;
+    }
+
+    // a slot spans a whole tick, activate the timers in it in timeout order
+    std::stable_sort(due.begin(), due.end(), [](const QTimerInfo *a, const QTimerInfo *b) {
+        return a->timeout < b->timeout;
+    });
+    for (QTimerInfo *t : std::as_const(due)) {
+        t->wheelLevel = ExpiredList;
+        append(expired, t);
+    }
+}
+
+void QTimerWheel::rescheduleOverflow()
+{
+    QTimerInfo *t = std::exchange(overflow, Bucket{}).first;
+    while (t) {
+        QTimerInfo *next = t->wheelNext;
+        t->wheelLevel = Unlinked;
+        schedule(t);
+        t = next;
+    }
+}
+
+/*
+    Advances the wheel to \a now, moving all timers whose timeout has passed
+    to the expired list.
+*/
+void QTimerWheel::advance(steady_clock::time_point now)
+{
+    const quint64 nowTick = tickFor(now);
+
+    for (;;) {
+        const std::optional<Expiration> next = nextExpiration();
+        if (!next || next->deadline > nowTick) {
+            if (overflow.first && overflowCheck <= nowTick) {
+                elapsed = overflowCheck;
+                rescheduleOverflow();
+                continue;
+            }
+            break;
+        }
+
+        elapsed = next->deadline;
+        Bucket &slot = buckets[next->level][next->slot];
+        if (next->level == 0) {
+            expireSlot(now, slot);
+            if (slot.first)
+                return;     // the remaining timers are due later in this tick
+            continue;
+        }
+
+        // cascade the timers of this slot to the lower levels
+        QTimerInfo *t = std::exchange(slot, Bucket{}).first;
+        occupied[next->level] &= ~(quint64(1) << next->slot);
+        while (t) {
+            QTimerInfo *following = t->wheelNext;
+            t->wheelLevel = Unlinked;
+            schedule(t);
+            t = following;
+        }
+    }
+
+    elapsed = qMax(elapsed, nowTick);
+}
+
+QTimerInfo *QTimerWheel::takeExpired()
+{
+    QTimerInfo *t = expired.first;
+    if (t)
+        unlink(t);
+    return t;
+}
+
+/*
+    Returns the earliest time at which a timer that is not currently being
+    activated may expire. For timers on the lowest level and the expired
+    list this is the exact timeout; for the higher levels it is the start of
+    the slot, at which point the timers in it cascade down and the exact
+    timeout becomes known.
+*/
+auto QTimerWheel::nextTimeout() const -> std::optional<TimePoint>
+{
+    for (const QTimerInfo *t = expired.first; t; t = t->wheelNext) {
+        if (!t->activateRef)
+            return t->timeout;
+    }
+
+    const int current = int(elapsed) & (SlotsPerLevel - 1);
+    quint64 pending = occupied[0] & (~quint64(0) << current);
+    while (pending) {
+        const int slot = qCountTrailingZeroBits(pending);
+        std::optional<TimePoint> earliest;
+        for (const QTimerInfo *t = buckets[0][slot].first; t; t = t->wheelNext) {
+            if (!t->activateRef && (!earliest || t->timeout < *earliest))
+                earliest = t->timeout;
+        }
+        if (earliest)
+            return earliest;
+        pending &= pending - 1;
+    }
+
+    for (int level = 1; level < LevelCount; ++level) {
+        const int shift = level * LevelBits;
+        const int current = int(elapsed >> shift) & (SlotsPerLevel - 1);
+        const quint64 pending = occupied[level] & (~quint64(0) << current);
+        if (!pending)
+            continue;
+
+        const int slot = qCountTrailingZeroBits(pending);
+        const quint64 levelStart = elapsed & ~((quint64(1) << (shift + LevelBits)) - 1);
+        return timePointFor(levelStart + (quint64(slot) << shift));
+    }
+
+    if (overflow.first)
+        return timePointFor(overflowCheck);
+    return std::nullopt;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,111 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTIMERWHEEL_P_H
+#define QTIMERWHEEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+
+#include <chrono>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+struct QTimerInfo;
+
+class Q_CORE_EXPORT QTimerWheel
+{
+    Q_DISABLE_COPY_MOVE(QTimerWheel)
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>;
+
+    QTimerWheel();
+    ~QTimerWheel();
+
+    void insert(QTimerInfo *t);
+    void reschedule(QTimerInfo *t);
+    QTimerInfo *take(Qt::TimerId timerId);
+    QList<QTimerInfo *> takeAll(QObject *object);
+    QList<QTimerInfo *> takeAll();
+
+    QTimerInfo *find(Qt::TimerId timerId) const { return byId.value(timerId); }
+    QList<QTimerInfo *> timersForObject(QObject *object) const;
+
+    void advance(std::chrono::steady_clock::time_point now);
+    bool hasExpired() const { return expired.first != nullptr; }
+    QTimerInfo *takeExpired();
+
+    std::optional<TimePoint> nextTimeout() const;
+
+    qsizetype size() const { return byId.size(); }
+    bool isEmpty() const { return byId.isEmpty(); }
+
+private:
+    static constexpr int LevelBits = 6;
+    static constexpr int SlotsPerLevel = 1 << LevelBits;
+    static constexpr int LevelCount = 6;
+    // a timer in the top level expires at most this many ticks from now
+    static constexpr quint64 WheelRange = quint64(1) << (LevelBits * LevelCount);
+
+    // QTimerInfo::wheelLevel values for timers that are not in a slot
+    enum : quint8 {
+        ExpiredList = LevelCount,
+        OverflowList,
+        Unlinked = 0xff
+    };
+
+    struct Bucket
+    {
+        QTimerInfo *first = nullptr;
+        QTimerInfo *last = nullptr;
+    };
+
+    struct Expiration
+    {
+        int level;
+        int slot;
+        quint64 deadline;                       // first tick of the slot
+    };
+
+    quint64 tickFor(TimePoint timeout) const;
+    TimePoint timePointFor(quint64 tick) const;
+
+    Bucket &bucketFor(const QTimerInfo *t);
+    void append(Bucket &bucket, QTimerInfo *t);
+    void unlink(QTimerInfo *t);
+    void schedule(QTimerInfo *t);
+    void removeFromObject(QTimerInfo *t);
+    std::optional<Expiration> nextExpiration() const;
+    void expireSlot(std::chrono::steady_clock::time_point now, Bucket &slot);
+    void rescheduleOverflow();
+
+    const std::chrono::steady_clock::time_point base;
+    quint64 elapsed = 0;                        // ticks since base that have been processed
+    quint64 overflowCheck = 0;                  // when to revisit the overflow list
+
+    Bucket buckets[LevelCount][SlotsPerLevel];
+    quint64 occupied[LevelCount] = {};         // bit i set if buckets[level][i] is not empty
+    Bucket expired;                             // due timers, in timeout order
+    Bucket overflow;                            // timers beyond WheelRange ticks away
+
+    QHash<Qt::TimerId, QTimerInfo *> byId;
+    QHash<QObject *, QTimerInfo *> byObject;  // first of the object's timers
+};
+
+QT_END_NAMESPACE
+
+#endif // QTIMERWHEEL_P_H
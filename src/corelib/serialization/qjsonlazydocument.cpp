@@ -0,0 +1,907 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonlazydocument.h"
+
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qlist.h>
+#include <QtCore/private/qjsonparser_p.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+// The document is parsed into a tape: one token per value, in the order in
+// which they appear in the document, each member of an object being the
+// token of its key followed by the token of its value. The token of a string,
+// a number or a literal holds the offsets of its first byte and of the byte
+// past it. The token of an array or an object holds the offset of its opening
+// bracket and the index of the token of its closing bracket, which comes
+// after its elements and holds the offset of the bracket.
+class QJsonLazyDocumentPrivate : public QSharedData
+{
+public:
+    struct Token
+    {
+        quint32 offset;
+        quint32 extent;
+    };
+
+    char firstByte(qsizetype index) const noexcept { return json.at(tape.at(index).offset); }
+    bool isContainer(qsizetype index) const noexcept
+    {
+        const char c = firstByte(index);
+        return c == '[' || c == '{';
+    }
+
+    // the index of the token that follows the value at index
+    qsizetype next(qsizetype index) const noexcept
+    {
+        return isContainer(index) ? tape.at(index).extent + 1 : index + 1;
+    }
+
+    QByteArrayView contents(qsizetype index) const noexcept
+    {
+        const Token &token = tape.at(index);
+        const quint32 end = isContainer(index) ? tape.at(token.extent).offset + 1 : token.extent;
+        return QByteArrayView(json.constData() + token.offset, end - token.offset);
+    }
+
+    // the contents of the string at index, without the quotes, and whether
+    // they contain escape sequences
+    QByteArrayView rawString(qsizetype index, bool *hasEscapes) const noexcept
+    {
+        const QByteArrayView s = contents(index).sliced(1).chopped(1);
+        *hasEscapes = s.contains('\\');
+        return s;
+    }
+
+    QString string(qsizetype index) const
+    {
+        bool hasEscapes;
+        const QByteArrayView s = rawString(index, &hasEscapes);
+        if (!hasEscapes)
+            return QString::fromUtf8(s);
+
+        QString result;
+        const char *json = s.begin();
+        QJsonParseError::ParseError error;
+        QJsonPrivate::Parser::scanEscapedString(json, s.end(), &result, &error);
+        return result;
+    }
+
+    QByteArray json;
+    QList<Token> tape;
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QJsonLazyDocumentPrivate)
+
+namespace {
+using Token = QJsonLazyDocumentPrivate::Token;
+
+// Builds the tape of a document. It follows QJsonPrivate::Parser step by
+// step, so that it accepts the same documents and reports the same errors,
+// but records where the values are instead of decoding them.
+class TapeBuilder
+{
+public:
+    TapeBuilder(const char *json, qsizetype length, QList<Token> *tape)
+        : head(json), json(json), end(json + length), tape(tape)
+    {}
+
+    bool build(QJsonParseError *error);
+
+private:
+    bool eatSpace();
+    char nextToken();
+
+    bool parseObject();
+    bool parseArray();
+    bool parseMember();
+    bool parseString();
+    bool parseValue();
+    bool parseNumber();
+
+    void append(const char *begin, const char *valueEnd)
+    {
+        tape->append(Token{ quint32(begin - head), quint32(valueEnd - head) });
+    }
+    qsizetype beginContainer(const char *bracket)
+    {
+        append(bracket, bracket + 1);
+        return tape->size() - 1;
+    }
+    void endContainer(qsizetype open)
+    {
+        (*tape)[open].extent = quint32(tape->size());
+        append(json - 1, json);
+    }
+
+    const char *head;
+    const char *json;
+    const char *end;
+    QList<Token> *tape;
+
+    int nestingLevel = 0;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+};
+
+enum {
+    BeginArray = 0x5b,
+    BeginObject = 0x7b,
+    EndArray = 0x5d,
+    EndObject = 0x7d,
+    NameSeparator = 0x3a,
+    ValueSeparator = 0x2c,
+    Quote = 0x22
+};
+
+static constexpr int nestingLimit = 1024;
+
+bool TapeBuilder::build(QJsonParseError *error)
+{
+    // eat UTF-8 byte order mark
+    if (end - json > 3 && uchar(json[0]) == 0xef && uchar(json[1]) == 0xbb
+        && uchar(json[2]) == 0xbf) {
+        json += 3;
+    }
+
+    const char token = nextToken();
+    if (token == BeginArray || token == BeginObject) {
+        const qsizetype open = beginContainer(json - 1);
+        if (!(token == BeginArray ? parseArray() : parseObject()))
+            goto error;
+        endContainer(open);
+    } else {
+        lastError = QJsonParseError::IllegalValue;
+        goto error;
+    }
+
+    eatSpace();
+    if (json < end) {
+        lastError = QJsonParseError::GarbageAtEnd;
+        goto error;
+    }
+
+    if (error) {
+        error->offset = 0;
+        error->error = QJsonParseError::NoError;
+    }
+    return true;
+
+error:
+    if (error) {
+        error->offset = json - head;
+        error->error = lastError;
+    }
+    return false;
+}
+
+bool TapeBuilder::eatSpace()
+{
+    json = QJsonPrivate::Parser::skipWhitespace(json, end);
+    return json < end;
+}
+
+char TapeBuilder::nextToken()
+{
+    if (!eatSpace())
+        return 0;
+    char token = *json++;
+    switch (token) {
+    case BeginArray:
+    case BeginObject:
+    case NameSeparator:
+    case ValueSeparator:
+    case EndArray:
+    case EndObject:
+    case Quote:
+        break;
+    default:
+        token = 0;
+        break;
+    }
+    return token;
+}
+
+bool TapeBuilder::parseObject()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    char token = nextToken();
+    while (token == Quote) {
+        if (!parseMember())
+            return false;
+        token = nextToken();
+        if (token != ValueSeparator)
+            break;
+        token = nextToken();
+        if (token == EndObject) {
+            lastError = QJsonParseError::MissingObject;
+            return false;
+        }
+    }
+
+    if (token != EndObject) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+
+    --nestingLevel;
+    return true;
+}
+
+bool TapeBuilder::parseMember()
+{
+    if (!parseString())
+        return false;
+    if (nextToken() != NameSeparator) {
+        lastError = QJsonParseError::MissingNameSeparator;
+        return false;
+    }
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+    return parseValue();
+}
+
+bool TapeBuilder::parseArray()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedArray;
+        return false;
+    }
+    if (*json == EndArray) {
+        nextToken();
+    } else {
+        while (true) {
+            if (!eatSpace()) {
+                lastError = QJsonParseError::UnterminatedArray;
+                return false;
+            }
+            if (!parseValue())
+                return false;
+            const char token = nextToken();
+            if (token == EndArray)
+                break;
+            if (token != ValueSeparator) {
+                if (!eatSpace())
+                    lastError = QJsonParseError::UnterminatedArray;
+                else
+                    lastError = QJsonParseError::MissingValueSeparator;
+                return false;
+            }
+        }
+    }
+
+    --nestingLevel;
+    return true;
+}
+
+bool TapeBuilder::parseValue()
+{
+    const char *begin = json;
+    const auto literal = [&](QByteArrayView rest) {
+        if (end - json < 4 || (rest.size() == 4 && end - json < 5)) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+        for (char c : rest) {
+            if (*json++ != c) {
+                lastError = QJsonParseError::IllegalValue;
+                return false;
+            }
+        }
+        append(begin, json);
+        return true;
+    };
+
+    switch (*json++) {
+    case 'n':
+        return literal("ull");
+    case 't':
+        return literal("rue");
+    case 'f':
+        return literal("alse");
+    case Quote:
+        return parseString();
+    case BeginArray:
+    case BeginObject: {
+        const qsizetype open = beginContainer(begin);
+        if (!(*begin == BeginArray ? parseArray() : parseObject()))
+            return false;
+        endContainer(open);
+        return true;
+    }
+    case ValueSeparator:
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case EndObject:
+    case EndArray:
+        lastError = QJsonParseError::MissingObject;
+        return false;
+    default:
+        --json;
+        return parseNumber();
+    }
+}
+
+// Numbers with a few digits and no exponent are always valid, and common
+// enough not to convert them just to check.
+static bool isPlainNumber(QByteArrayView number) noexcept
+{
+    if (number.startsWith('-'))
+        number = number.sliced(1);
+    if (number.isEmpty() || number.size() > std::numeric_limits<qint64>::digits10)
+        return false;
+    const qsizetype dot = number.indexOf('.');
+    if (dot == 0 || dot == number.size() - 1)
+        return false;
+    for (qsizetype i = 0; i < number.size(); ++i) {
+        if (i != dot && (number[i] < '0' || number[i] > '9'))
+            return false;
+    }
+    return true;
+}
+
+bool TapeBuilder::parseNumber()
+{
+    const char *start = json;
+    bool isInt;
+    QJsonPrivate::Parser::scanNumber(json, end, &isInt);
+
+    if (json >= end) {
+        lastError = QJsonParseError::TerminationByNumber;
+        return false;
+    }
+
+    const QByteArrayView number(start, json - start);
+    QCborValue value;
+    if (!isPlainNumber(number) && !QJsonPrivate::Parser::numberValue(number, isInt, &value)) {
+        lastError = QJsonParseError::IllegalNumber;
+        return false;
+    }
+    append(start, json);
+    return true;
+}
+
+bool TapeBuilder::parseString()
+{
+    const char *start = json;
+
+    bool isAscii;
+    if (!QJsonPrivate::Parser::scanUtf8String(json, end, &isAscii)) {
+        lastError = QJsonParseError::IllegalUTF8String;
+        return false;
+    }
+    const bool hasEscapes = json < end && *json == '\\';
+    ++json;
+    if (json >= end) {
+        lastError = QJsonParseError::UnterminatedString;
+        return false;
+    }
+
+    if (hasEscapes) {
+        // check the escape sequences, without decoding them
+        json = start;
+        if (!QJsonPrivate::Parser::scanEscapedString(json, end, nullptr, &lastError))
+            return false;
+        ++json;
+        if (json >= end) {
+            lastError = QJsonParseError::UnterminatedString;
+            return false;
+        }
+    }
+
+    append(start - 1, json);
+    return true;
+}
+} // unnamed namespace
+
+/*!
+    \class QJsonLazyDocument
+    \inmodule QtCore
+    \ingroup json
+    \ingroup shared
+    \ingroup qtserialization
+    \reentrant
+    \since 6.9
+
+    \brief The QJsonLazyDocument class gives read-only access to a JSON
+    document without decoding it.
+
+    QJsonDocument::fromJson() decodes a whole document into QJsonObject and
+    QJsonArray instances, copying every string and converting every number,
+    even when only a few of them are needed. QJsonLazyDocument::fromJson()
+    instead checks that the document is valid and records where each of its
+    values is. The values are then decoded only when they are read through
+    QJsonLazyValue, so extracting a few fields from a large document costs
+    little more than finding them.
+
+    \snippet code/src_corelib_serialization_qjsonlazydocument.cpp 0
+
+    QJsonLazyDocument accepts exactly the documents that QJsonDocument
+    accepts, and reports the same errors. It keeps a shallow copy of the
+    document it was created from.
+
+    The QJsonLazyValue objects it returns refer to the document, so they must
+    not be used after the last copy of the document has been destroyed.
+
+    \sa QJsonDocument, QJsonLazyValue
+*/
+
+/*!
+    Constructs a null document.
+
+    \sa isNull()
+*/
+QJsonLazyDocument::QJsonLazyDocument() noexcept
+    = default;
+
+/*!
+    Constructs a copy of \a other. The copy shares the data of \a other.
+*/
+QJsonLazyDocument::QJsonLazyDocument(const QJsonLazyDocument &other) noexcept
+    = default;
+
+/*!
+    \fn QJsonLazyDocument::QJsonLazyDocument(QJsonLazyDocument &&other)
+
+    Move-constructs a document from \a other.
+*/
+
+/*!
+    \fn QJsonLazyDocument &QJsonLazyDocument::operator=(QJsonLazyDocument &&other)
+
+    Move-assigns \a other to this document.
+*/
+
+/*!
+    Assigns \a other to this document, and returns a reference to this
+    document.
+*/
+QJsonLazyDocument &QJsonLazyDocument::operator=(const QJsonLazyDocument &other) noexcept
+    = default;
+
+/*!
+    Destroys the document. The values obtained from it are no longer valid
+    once all of its copies have been destroyed.
+*/
+QJsonLazyDocument::~QJsonLazyDocument()
+    = default;
+
+/*!
+    \fn void QJsonLazyDocument::swap(QJsonLazyDocument &other)
+    \memberswap{document}
+*/
+
+/*!
+    Parses \a json as a UTF-8 encoded JSON document, and returns a
+    QJsonLazyDocument that reads from it.
+
+    If \a json isn't a valid document, returns a null document, and stores
+    the reason and the position of the error in \a error if it isn't \nullptr.
+
+    \sa QJsonDocument::fromJson()
+*/
+QJsonLazyDocument QJsonLazyDocument::fromJson(const QByteArray &json, QJsonParseError *error)
+{
+    QJsonLazyDocument result;
+    if (json.size() > std::numeric_limits<int>::max()) {
+        if (error) {
+            error->offset = 0;
+            error->error = QJsonParseError::DocumentTooLarge;
+        }
+        return result;
+    }
+
+    QExplicitlySharedDataPointer<QJsonLazyDocumentPrivate> d(new QJsonLazyDocumentPrivate);
+    d->json = json;
+    TapeBuilder builder(d->json.constData(), d->json.size(), &d->tape);
+    if (builder.build(error))
+        result.d = std::move(d);
+    return result;
+}
+
+/*!
+    \fn bool QJsonLazyDocument::isNull() const
+
+    Returns \c true if this document is null, that is if it was
+    default-constructed or if it was created from invalid JSON.
+*/
+
+/*!
+    \fn bool QJsonLazyDocument::isArray() const
+
+    Returns \c true if the document contains an array.
+
+    \sa isObject(), root()
+*/
+
+/*!
+    \fn bool QJsonLazyDocument::isObject() const
+
+    Returns \c true if the document contains an object.
+
+    \sa isArray(), root()
+*/
+
+/*!
+    Returns the array or the object that the document contains, or an
+    undefined value if the document is null.
+*/
+QJsonLazyValue QJsonLazyDocument::root() const noexcept
+{
+    return d ? QJsonLazyValue(d.data(), 0) : QJsonLazyValue();
+}
+
+/*!
+    \fn QJsonLazyValue QJsonLazyDocument::operator[](qsizetype i) const
+
+    Returns \c{root()[i]}.
+*/
+
+/*!
+    \fn QJsonLazyValue QJsonLazyDocument::operator[](QStringView key) const
+    \fn QJsonLazyValue QJsonLazyDocument::operator[](QLatin1StringView key) const
+
+    Returns \c{root()[key]}.
+*/
+
+/*!
+    Decodes the whole document, and returns it as a QJsonDocument. Returns a
+    null QJsonDocument if this document is null.
+*/
+QJsonDocument QJsonLazyDocument::toDocument() const
+{
+    return d ? QJsonDocument::fromJson(d->json) : QJsonDocument();
+}
+
+/*!
+    \class QJsonLazyValue
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.9
+
+    \brief The QJsonLazyValue class is a value in a QJsonLazyDocument.
+
+    A QJsonLazyValue refers to the text of a value in its document, and
+    decodes it when it is converted with one of the toBool(), toInteger(),
+    toDouble(), toString() or toJsonValue() functions. The elements of arrays
+    and the members of objects are looked up by walking over the values that
+    come before them, without decoding those.
+
+    A default-constructed QJsonLazyValue, or one obtained by looking up an
+    element or a member that doesn't exist, is undefined.
+
+    \sa QJsonLazyDocument, QJsonValue
+*/
+
+/*!
+    \fn QJsonLazyValue::QJsonLazyValue()
+
+    Constructs an undefined value.
+*/
+
+/*!
+    Returns the type of this value.
+*/
+QJsonValue::Type QJsonLazyValue::type() const noexcept
+{
+    if (!d)
+        return QJsonValue::Undefined;
+    switch (d->firstByte(index)) {
+    case BeginArray:
+        return QJsonValue::Array;
+    case BeginObject:
+        return QJsonValue::Object;
+    case Quote:
+        return QJsonValue::String;
+    case 't':
+    case 'f':
+        return QJsonValue::Bool;
+    case 'n':
+        return QJsonValue::Null;
+    default:
+        return QJsonValue::Double;
+    }
+}
+
+/*!
+    \fn bool QJsonLazyValue::isNull() const
+    \fn bool QJsonLazyValue::isBool() const
+    \fn bool QJsonLazyValue::isDouble() const
+    \fn bool QJsonLazyValue::isString() const
+    \fn bool QJsonLazyValue::isArray() const
+    \fn bool QJsonLazyValue::isObject() const
+    \fn bool QJsonLazyValue::isUndefined() const
+
+    Returns \c true if this value is of the corresponding type.
+
+    \sa type()
+*/
+
+/*!
+    Returns the value if it is a boolean, and \a defaultValue otherwise.
+*/
+bool QJsonLazyValue::toBool(bool defaultValue) const noexcept
+{
+    return isBool() ? d->firstByte(index) == 't' : defaultValue;
+}
+
+/*!
+    Returns the value if it is a number that is a whole number and fits in an
+    \c int, and \a defaultValue otherwise.
+
+    \sa QJsonValue::toInt()
+*/
+int QJsonLazyValue::toInt(int defaultValue) const
+{
+    return isDouble() ? toJsonValue().toInt(defaultValue) : defaultValue;
+}
+
+/*!
+    Returns the value if it is a number that is a whole number and fits in a
+    \c qint64, and \a defaultValue otherwise.
+
+    \sa QJsonValue::toInteger()
+*/
+qint64 QJsonLazyValue::toInteger(qint64 defaultValue) const
+{
+    return isDouble() ? toJsonValue().toInteger(defaultValue) : defaultValue;
+}
+
+/*!
+    Returns the value if it is a number, and \a defaultValue otherwise.
+*/
+double QJsonLazyValue::toDouble(double defaultValue) const
+{
+    return isDouble() ? toJsonValue().toDouble(defaultValue) : defaultValue;
+}
+
+/*!
+    Returns the value if it is a string, and a null QString otherwise.
+*/
+QString QJsonLazyValue::toString() const
+{
+    return toString(QString());
+}
+
+/*!
+    \overload
+    Returns the value if it is a string, and \a defaultValue otherwise.
+*/
+QString QJsonLazyValue::toString(const QString &defaultValue) const
+{
+    return isString() ? d->string(index) : defaultValue;
+}
+
+/*!
+    Decodes this value, and everything it contains, and returns it as a
+    QJsonValue.
+*/
+QJsonValue QJsonLazyValue::toJsonValue() const
+{
+    switch (type()) {
+    case QJsonValue::Null:
+        return QJsonValue::Null;
+    case QJsonValue::Bool:
+        return toBool();
+    case QJsonValue::Double: {
+        const QByteArrayView number = d->contents(index);
+        const char *json = number.begin();
+        bool isInt;
+        QJsonPrivate::Parser::scanNumber(json, number.end(), &isInt);
+        QCborValue value;
+        QJsonPrivate::Parser::numberValue(number, isInt, &value);
+        return value.toJsonValue();
+    }
+    case QJsonValue::String:
+        return d->string(index);
+    case QJsonValue::Array:
+    case QJsonValue::Object: {
+        // the parser decodes containers faster than we can build them
+        const QByteArrayView json = d->contents(index);
+        const QJsonDocument document =
+                QJsonDocument::fromJson(QByteArray::fromRawData(json.data(), json.size()));
+        if (document.isArray())
+            return document.array();
+        return document.object();
+    }
+    case QJsonValue::Undefined:
+        break;
+    }
+    return QJsonValue::Undefined;
+}
+
+/*!
+    Returns the number of elements of this value if it is an array, the
+    number of its members if it is an object, and 0 otherwise. The members
+    of an object that have the same key are all counted.
+
+    This function walks over the whole array or object.
+*/
+qsizetype QJsonLazyValue::size() const noexcept
+{
+    qsizetype n = 0;
+    for (auto it = begin(), last = end(); it != last; ++it)
+        ++n;
+    return n;
+}
+
+/*!
+    Returns the element at position \a i if this value is an array that has
+    more than \a i elements, and an undefined value otherwise.
+
+    This function walks over the elements before \a i.
+*/
+QJsonLazyValue QJsonLazyValue::operator[](qsizetype i) const noexcept
+{
+    if (!isArray() || i < 0)
+        return QJsonLazyValue();
+    for (auto it = begin(), last = end(); it != last; ++it) {
+        if (i-- == 0)
+            return it.value();
+    }
+    return QJsonLazyValue();
+}
+
+template <typename String>
+QJsonLazyValue QJsonLazyValue::member(String key) const noexcept
+{
+    if (!isObject())
+        return QJsonLazyValue();
+
+    // like QJsonObject, the last of the members with the same key wins
+    QJsonLazyValue result;
+    for (auto it = begin(), last = end(); it != last; ++it) {
+        bool hasEscapes;
+        const QByteArrayView raw = d->rawString(it.index, &hasEscapes);
+        if (hasEscapes ? it.key() == key
+                       : QtPrivate::equalStrings(QUtf8StringView(raw), key)) {
+            result = it.value();
+        }
+    }
+    return result;
+}
+
+/*!
+    Returns the value of the member named \a key if this value is an object
+    that has such a member, and an undefined value otherwise. If several
+    members have this key, returns the value of the last one, like
+    QJsonObject does.
+
+    This function walks over all the members of the object.
+*/
+QJsonLazyValue QJsonLazyValue::operator[](QStringView key) const noexcept
+{
+    return member(key);
+}
+
+/*!
+    \overload
+*/
+QJsonLazyValue QJsonLazyValue::operator[](QLatin1StringView key) const noexcept
+{
+    return member(key);
+}
+
+/*!
+    Returns an iterator to the first element of this value if it is an
+    array, or to its first member if it is an object. For other values,
+    returns end().
+*/
+QJsonLazyValue::const_iterator QJsonLazyValue::begin() const noexcept
+{
+    const QJsonValue::Type t = type();
+    if (t != QJsonValue::Array && t != QJsonValue::Object)
+        return const_iterator();
+    return const_iterator(d, index + 1, t == QJsonValue::Object);
+}
+
+/*!
+    Returns an iterator past the last element of this value if it is an
+    array, or past its last member if it is an object. For other values,
+    returns a default-constructed iterator.
+*/
+QJsonLazyValue::const_iterator QJsonLazyValue::end() const noexcept
+{
+    const QJsonValue::Type t = type();
+    if (t != QJsonValue::Array && t != QJsonValue::Object)
+        return const_iterator();
+    return const_iterator(d, d->tape.at(index).extent, t == QJsonValue::Object);
+}
+
+/*!
+    \fn QJsonLazyValue::const_iterator QJsonLazyValue::constBegin() const
+    \fn QJsonLazyValue::const_iterator QJsonLazyValue::cbegin() const
+
+    Same as begin().
+*/
+
+/*!
+    \fn QJsonLazyValue::const_iterator QJsonLazyValue::constEnd() const
+    \fn QJsonLazyValue::const_iterator QJsonLazyValue::cend() const
+
+    Same as end().
+*/
+
+/*!
+    \class QJsonLazyValue::const_iterator
+    \inmodule QtCore
+    \since 6.9
+
+    \brief The QJsonLazyValue::const_iterator class iterates over the
+    elements of an array or the members of an object in a QJsonLazyDocument.
+
+    The elements and the members are visited in the order in which they
+    appear in the document. Unlike the iterators of QJsonObject, the
+    iterators of an object visit all the members that have the same key.
+*/
+
+/*!
+    \fn QJsonLazyValue::const_iterator::const_iterator()
+
+    Constructs an iterator that doesn't refer to anything.
+*/
+
+/*!
+    Returns the key of the current member if the iterator is over an object,
+    and a null QString otherwise.
+*/
+QString QJsonLazyValue::const_iterator::key() const
+{
+    return isObject ? d->string(index) : QString();
+}
+
+/*!
+    Returns the current element or the value of the current member.
+*/
+QJsonLazyValue QJsonLazyValue::const_iterator::value() const noexcept
+{
+    return QJsonLazyValue(d, isObject ? index + 1 : index);
+}
+
+/*!
+    \fn QJsonLazyValue QJsonLazyValue::const_iterator::operator*() const
+
+    Same as value().
+*/
+
+/*!
+    Advances the iterator to the next element or member, and returns a
+    reference to it.
+*/
+QJsonLazyValue::const_iterator &QJsonLazyValue::const_iterator::operator++() noexcept
+{
+    index = d->next(isObject ? index + 1 : index);
+    return *this;
+}
+
+/*!
+    \fn QJsonLazyValue::const_iterator QJsonLazyValue::const_iterator::operator++(int)
+
+    Advances the iterator to the next element or member, and returns a copy
+    of it from before.
+*/
+
+/*!
+    \fn bool QJsonLazyValue::const_iterator::operator==(const const_iterator &lhs, const const_iterator &rhs)
+    \fn bool QJsonLazyValue::const_iterator::operator!=(const const_iterator &lhs, const const_iterator &rhs)
+
+    Returns whether \a lhs and \a rhs point to the same element or member.
+*/
+
+QT_END_NAMESPACE
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONLAZYDOCUMENT_H
+#define QJSONLAZYDOCUMENT_H
+
+#include <QtCore/qcompare.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+class QJsonLazyDocumentPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QJsonLazyDocumentPrivate, Q_CORE_EXPORT)
+
+class QJsonLazyValue
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = qsizetype;
+        using value_type = QJsonLazyValue;
+        using pointer = void;
+        using reference = QJsonLazyValue;
+
+        constexpr const_iterator() noexcept = default;
+
+        Q_CORE_EXPORT QString key() const;
+        Q_CORE_EXPORT QJsonLazyValue value() const noexcept;
+        QJsonLazyValue operator*() const noexcept { return value(); }
+
+        Q_CORE_EXPORT const_iterator &operator++() noexcept;
+        const_iterator operator++(int) noexcept
+        {
+            const_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+    private:
+        friend class QJsonLazyValue;
+        constexpr const_iterator(const QJsonLazyDocumentPrivate *d, qsizetype index,
+                                 bool isObject) noexcept
+            : d(d), index(index), isObject(isObject)
+        {}
+
+        friend bool comparesEqual(const const_iterator &lhs, const const_iterator &rhs) noexcept
+        {
+            return lhs.d == rhs.d && lhs.index == rhs.index;
+        }
+        Q_DECLARE_EQUALITY_COMPARABLE(const_iterator)
+
+        const QJsonLazyDocumentPrivate *d = nullptr;
+        qsizetype index = -1;   // of the key in objects, of the element in arrays
+        bool isObject = false;
+    };
+    using ConstIterator = const_iterator;
+
+    constexpr QJsonLazyValue() noexcept = default;
+
+    Q_CORE_EXPORT QJsonValue::Type type() const noexcept;
+    bool isNull() const noexcept { return type() == QJsonValue::Null; }
+    bool isBool() const noexcept { return type() == QJsonValue::Bool; }
+    bool isDouble() const noexcept { return type() == QJsonValue::Double; }
+    bool isString() const noexcept { return type() == QJsonValue::String; }
+    bool isArray() const noexcept { return type() == QJsonValue::Array; }
+    bool isObject() const noexcept { return type() == QJsonValue::Object; }
+    bool isUndefined() const noexcept { return type() == QJsonValue::Undefined; }
+
+    Q_CORE_EXPORT bool toBool(bool defaultValue = false) const noexcept;
+    Q_CORE_EXPORT int toInt(int defaultValue = 0) const;
+    Q_CORE_EXPORT qint64 toInteger(qint64 defaultValue = 0) const;
+    Q_CORE_EXPORT double toDouble(double defaultValue = 0) const;
+    Q_CORE_EXPORT QString toString() const;
+    Q_CORE_EXPORT QString toString(const QString &defaultValue) const;
+    Q_CORE_EXPORT QJsonValue toJsonValue() const;
+
+    Q_CORE_EXPORT qsizetype size() const noexcept;
+    Q_CORE_EXPORT QJsonLazyValue operator[](qsizetype i) const noexcept;
+    Q_CORE_EXPORT QJsonLazyValue operator[](QStringView key) const noexcept;
+    Q_CORE_EXPORT QJsonLazyValue operator[](QLatin1StringView key) const noexcept;
+
+    Q_CORE_EXPORT const_iterator begin() const noexcept;
+    Q_CORE_EXPORT const_iterator end() const noexcept;
+    const_iterator constBegin() const noexcept { return begin(); }
+    const_iterator constEnd() const noexcept { return end(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    friend class QJsonLazyDocument;
+    constexpr QJsonLazyValue(const QJsonLazyDocumentPrivate *d, qsizetype index) noexcept
+        : d(d), index(index)
+    {}
+
+    template <typename String> QJsonLazyValue member(String key) const noexcept;
+
+    const QJsonLazyDocumentPrivate *d = nullptr;
+    qsizetype index = -1;
+};
+
+Q_DECLARE_TYPEINFO(QJsonLazyValue, Q_RELOCATABLE_TYPE);
+
+class QJsonLazyDocument
+{
+public:
+    Q_CORE_EXPORT QJsonLazyDocument() noexcept;
+    Q_CORE_EXPORT QJsonLazyDocument(const QJsonLazyDocument &other) noexcept;
+    QJsonLazyDocument(QJsonLazyDocument &&other) noexcept = default;
+    Q_CORE_EXPORT QJsonLazyDocument &operator=(const QJsonLazyDocument &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QJsonLazyDocument)
+    Q_CORE_EXPORT ~QJsonLazyDocument();
+
+    void swap(QJsonLazyDocument &other) noexcept { d.swap(other.d); }
+
+    Q_CORE_EXPORT static QJsonLazyDocument fromJson(const QByteArray &json,
+                                                    QJsonParseError *error = nullptr);
+
+    bool isNull() const noexcept { return !d; }
+    bool isArray() const noexcept { return root().isArray(); }
+    bool isObject() const noexcept { return root().isObject(); }
+
+    Q_CORE_EXPORT QJsonLazyValue root() const noexcept;
+    QJsonLazyValue operator[](qsizetype i) const noexcept { return root()[i]; }
+    QJsonLazyValue operator[](QStringView key) const noexcept { return root()[key]; }
+    QJsonLazyValue operator[](QLatin1StringView key) const noexcept { return root()[key]; }
+
+    Q_CORE_EXPORT QJsonDocument toDocument() const;
+
+private:
+    QExplicitlySharedDataPointer<QJsonLazyDocumentPrivate> d;
+};
+
+Q_DECLARE_SHARED(QJsonLazyDocument)
+
+QT_END_NAMESPACE
+
+#endif // QJSONLAZYDOCUMENT_H
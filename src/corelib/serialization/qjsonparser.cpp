@@ -11,6 +11,7 @@
 #include "private/qstringconverter_p.h"
 #include "private/qcborvalue_p.h"
 #include "private/qnumeric_p.h"
+#include <private/qsimd_p.h>
 #include <private/qtools_p.h>
 
 //#define PARSER_DEBUG
@@ -255,8 +256,39 @@ void Parser::eatBOM()
         json += 3;
 }
 
-bool Parser::eatSpace()
+/*
+    Returns the first byte in [\a json, \a end) that isn't whitespace, or
+    \a end.
+*/
+const char *Parser::skipWhitespace(const char *json, const char *end) noexcept
 {
+    // Most tokens are followed by a single space at most, but indentation
+    // makes for long runs.
+    if (json < end && *json > Space)
+        return json;
+#if defined(__SSE2__)
+    while (end - json >= 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        const __m128i space = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(Space)),
+                                                        _mm_cmpeq_epi8(data, _mm_set1_epi8(Tab))),
+                                           _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(LineFeed)),
+                                                        _mm_cmpeq_epi8(data, _mm_set1_epi8(Return))));
+        if (const uint mask = ~_mm_movemask_epi8(space) & 0xffff)
+            return json + qCountTrailingZeroBits(mask);
+        json += 16;
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    while (end - json >= 16) {
+        const uint8x16_t data = vld1q_u8(reinterpret_cast<const uchar *>(json));
+        const uint8x16_t space = vorrq_u8(vorrq_u8(vceqq_u8(data, vdupq_n_u8(Space)),
+                                                   vceqq_u8(data, vdupq_n_u8(Tab))),
+                                          vorrq_u8(vceqq_u8(data, vdupq_n_u8(LineFeed)),
+                                                   vceqq_u8(data, vdupq_n_u8(Return))));
+        if (vminvq_u8(space) == 0)
+            break;
+        json += 16;
+    }
+#endif
     while (json < end) {
         if (*json > Space)
             break;
@@ -267,6 +299,12 @@ bool Parser::eatSpace()
             break;
         ++json;
     }
+    return json;
+}
+
+bool Parser::eatSpace()
+{
+    json = skipWhitespace(json, end);
     return (json < end);
 }
 
@@ -690,7 +728,33 @@ bool Parser::parseNumber()
     QT_PARSER_TRACING_BEGIN << "parseNumber" << json;
 
     const char *start = json;
-    bool isInt = true;
+    bool isInt;
+    scanNumber(json, end, &isInt);
+
+    if (json >= end) {
+        lastError = QJsonParseError::TerminationByNumber;
+        return false;
+    }
+
+    QCborValue value;
+    if (!numberValue(QByteArrayView(start, json - start), isInt, &value)) {
+        lastError = QJsonParseError::IllegalNumber;
+        return false;
+    }
+    container->append(value);
+
+    QT_PARSER_TRACING_END;
+    return true;
+}
+
+/*
+    Advances \a json past the longest prefix that looks like a number, and
+    sets \a isInt to whether it has neither an exponent nor a fraction with
+    a non-zero digit. The prefix may be empty or malformed.
+*/
+bool Parser::scanNumber(const char *&json, const char *end, bool *isInt) noexcept
+{
+    *isInt = true;
 
     // minus
     if (json < end && *json == '-')
@@ -708,14 +772,14 @@ bool Parser::parseNumber()
     if (json < end && *json == '.') {
         ++json;
         while (json < end && isAsciiDigit(*json)) {
-            isInt = isInt && *json == '0';
+            *isInt = *isInt && *json == '0';
             ++json;
         }
     }
 
     // exp = e [ minus / plus ] 1*DIGIT
     if (json < end && (*json == 'e' || *json == 'E')) {
-        isInt = false;
+        *isInt = false;
         ++json;
         if (json < end && (*json == '-' || *json == '+'))
             ++json;
@@ -723,20 +787,22 @@ bool Parser::parseNumber()
             ++json;
     }
 
-    if (json >= end) {
-        lastError = QJsonParseError::TerminationByNumber;
-        return false;
-    }
+    return json < end;
+}
 
-    const QByteArray number = QByteArray::fromRawData(start, json - start);
+/*
+    Converts the \a number found by scanNumber() to an integer if it is one
+    and fits, or to a double otherwise.
+*/
+bool Parser::numberValue(QByteArrayView number, bool isInt, QCborValue *value)
+{
     QT_PARSER_TRACING_DEBUG << "numberstring" << number;
 
     if (isInt) {
         bool ok;
         qlonglong n = number.toLongLong(&ok);
         if (ok) {
-            container->append(QCborValue(n));
-            QT_PARSER_TRACING_END;
+            *value = QCborValue(n);
             return true;
         }
     }
@@ -744,18 +810,14 @@ bool Parser::parseNumber()
     bool ok;
     double d = number.toDouble(&ok);
 
-    if (!ok) {
-        lastError = QJsonParseError::IllegalNumber;
+    if (!ok)
         return false;
-    }
 
     qint64 n;
     if (convertDoubleTo(d, &n))
-        container->append(QCborValue(n));
+        *value = QCborValue(n);
     else
-        container->append(QCborValue(d));
-
-    QT_PARSER_TRACING_END;
+        *value = QCborValue(d);
     return true;
 }
 
@@ -851,35 +913,75 @@ static inline bool scanUtf8Char(const char *&json, const char *end, char32_t *re
     return true;
 }
 
-bool Parser::parseString()
+// Returns the first quote, backslash or non-ASCII byte in [json, end), or end.
+static const char *skipPlainAscii(const char *json, const char *end) noexcept
 {
-    const char *start = json;
-
-    // try to parse a utf-8 string without escape sequences, and note whether it's 7bit ASCII.
+#if defined(__SSE2__)
+    while (end - json >= 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(Quote)),
+                                             _mm_cmpeq_epi8(data, _mm_set1_epi8('\\')));
+        // non-ASCII bytes have their sign bit set already
+        if (const uint mask = _mm_movemask_epi8(_mm_or_si128(special, data)))
+            return json + qCountTrailingZeroBits(mask);
+        json += 16;
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    while (end - json >= 16) {
+        const uint8x16_t data = vld1q_u8(reinterpret_cast<const uchar *>(json));
+        const uint8x16_t special = vorrq_u8(vceqq_u8(data, vdupq_n_u8(Quote)),
+                                            vceqq_u8(data, vdupq_n_u8('\\')));
+        if (vmaxvq_u8(vorrq_u8(special, vcgeq_u8(data, vdupq_n_u8(0x80)))))
+            break;
+        json += 16;
+    }
+#endif
+    while (json < end && uchar(*json) < 0x80 && *json != Quote && *json != '\\')
+        ++json;
+    return json;
+}
 
-    QT_PARSER_TRACING_BEGIN << "parse string" << json;
-    bool isUtf8 = true;
-    bool isAscii = true;
+/*
+    Advances \a json to the closing quote or to the first backslash of a
+    string, and sets \a isAscii to whether the characters it went over are
+    all ASCII. Returns \c false if they aren't valid UTF-8.
+*/
+bool Parser::scanUtf8String(const char *&json, const char *end, bool *isAscii) noexcept
+{
+    *isAscii = true;
+    bool lastWasAscii = true;
     while (json < end) {
-        char32_t ch = 0;
-        if (*json == '"')
+        if (lastWasAscii)
+            json = skipPlainAscii(json, end);
+        if (json == end || *json == '"' || *json == '\\')
             break;
-        if (*json == '\\') {
-            isAscii = false;
-            // If we find escape sequences, we store UTF-16 as there are some
-            // escape sequences which are hard to represent in UTF-8.
-            // (plain "\\ud800" for example)
-            isUtf8 = false;
-            break;
-        }
-        if (!scanUtf8Char(json, end, &ch)) {
-            lastError = QJsonParseError::IllegalUTF8String;
+        char32_t ch = 0;
+        if (!scanUtf8Char(json, end, &ch))
             return false;
-        }
-        if (ch > 0x7f)
-            isAscii = false;
+        lastWasAscii = ch <= 0x7f;
+        if (!lastWasAscii)
+            *isAscii = false;
         QT_PARSER_TRACING_DEBUG << "  " << ch << char(ch);
     }
+    return true;
+}
+
+bool Parser::parseString()
+{
+    const char *start = json;
+
+    QT_PARSER_TRACING_BEGIN << "parse string" << json;
+    // try to parse a utf-8 string without escape sequences, and note whether it's 7bit ASCII.
+
+    bool isAscii;
+    if (!scanUtf8String(json, end, &isAscii)) {
+        lastError = QJsonParseError::IllegalUTF8String;
+        return false;
+    }
+    // If we find escape sequences, we store UTF-16 as there are some
+    // escape sequences which are hard to represent in UTF-8.
+    // (plain "\\ud800" for example)
+    const bool isUtf8 = json >= end || *json != '\\';
     ++json;
     QT_PARSER_TRACING_DEBUG << "end of string";
     if (json >= end) {
@@ -902,33 +1004,47 @@ bool Parser::parseString()
     json = start;
 
     QString ucs4;
+    if (!scanEscapedString(json, end, &ucs4, &lastError))
+        return false;
+    ++json;
+
+    if (json >= end) {
+        lastError = QJsonParseError::UnterminatedString;
+        return false;
+    }
+
+    container->appendByteData(reinterpret_cast<const char *>(ucs4.constData()), ucs4.size() * 2,
+                              QCborValue::String, QtCbor::Element::StringIsUtf16);
+    QT_PARSER_TRACING_END;
+    return true;
+}
+
+/*
+    Decodes the contents of a string that may contain escape sequences into
+    \a out, up to but not including the closing quote. If \a out is \nullptr,
+    only checks them.
+*/
+bool Parser::scanEscapedString(const char *&json, const char *end, QString *out,
+                               QJsonParseError::ParseError *error)
+{
     while (json < end) {
         char32_t ch = 0;
         if (*json == '"')
             break;
         else if (*json == '\\') {
             if (!scanEscapeSequence(json, end, &ch)) {
-                lastError = QJsonParseError::IllegalEscapeSequence;
+                *error = QJsonParseError::IllegalEscapeSequence;
                 return false;
             }
         } else {
             if (!scanUtf8Char(json, end, &ch)) {
-                lastError = QJsonParseError::IllegalUTF8String;
+                *error = QJsonParseError::IllegalUTF8String;
                 return false;
             }
         }
-        ucs4.append(QChar::fromUcs4(ch));
-    }
-    ++json;
-
-    if (json >= end) {
-        lastError = QJsonParseError::UnterminatedString;
-        return false;
+        if (out)
+            out->append(QChar::fromUcs4(ch));
     }
-
-    container->appendByteData(reinterpret_cast<const char *>(ucs4.constData()), ucs4.size() * 2,
-                              QCborValue::String, QtCbor::Element::StringIsUtf16);
-    QT_PARSER_TRACING_END;
     return true;
 }
 
@@ -30,6 +30,13 @@ public:
 
     QCborValue parse(QJsonParseError *error);
 
+    static const char *skipWhitespace(const char *json, const char *end) noexcept;
+    static bool scanNumber(const char *&json, const char *end, bool *isInt) noexcept;
+    static bool numberValue(QByteArrayView number, bool isInt, QCborValue *value);
+    static bool scanUtf8String(const char *&json, const char *end, bool *isAscii) noexcept;
+    static bool scanEscapedString(const char *&json, const char *end, QString *out,
+                                  QJsonParseError::ParseError *error);
+
 private:
     inline void eatBOM();
     inline bool eatSpace();
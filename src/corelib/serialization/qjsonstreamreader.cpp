@@ -0,0 +1,821 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamreader.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qjsonparser_p.h>
+#include <QtCore/private/qstringconverter_p.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QJsonPrivate;
+using namespace Qt::StringLiterals;
+
+// Tokens are read atomically: if the data ends in the middle of one, nothing
+// of it is consumed and it is read again from its first byte once more data
+// has arrived. Everything before the current token is discarded from the
+// buffer, so the memory used does not depend on the size of the stream.
+class QJsonStreamReaderPrivate
+{
+public:
+    enum {
+        // how much is read from the device at a time, and how much of the
+        // buffer may be consumed before it is compacted
+        IdealIoBufferSize = 16384,
+        NestingLimit = 1024
+    };
+
+    enum State : quint8 {
+        DocumentStart,      // a byte order mark may come next
+        DocumentValue,      // a top-level value comes next
+        DocumentEnd,        // the top-level value was read
+        Finished,           // EndDocument was reported
+        FirstElement,       // after '[', a value or ']'
+        Element,            // after ',' in an array, a value
+        FirstMember,        // after '{', a key or '}'
+        Member,             // after ',' in an object, a key
+        MemberValue,        // after a key and its ':', a value
+        Separator           // after a value in a container, ',' or its end
+    };
+
+    using TokenType = QJsonStreamReader::TokenType;
+
+    QJsonStreamReaderPrivate(QIODevice *device, const QByteArray &data)
+        : device(device), buffer(data)
+    {}
+
+    void reset()
+    {
+        buffer.clear();
+        pos = 0;
+        scanned = 0;
+        discarded = 0;
+        tokenOffset = 0;
+        containers.clear();
+        state = DocumentStart;
+        token = QJsonStreamReader::NoToken;
+        error = QJsonStreamReader::NoError;
+        parseError = QJsonParseError::NoError;
+    }
+
+    const char *base() const noexcept { return buffer.constData(); }
+    void consume(const char *to) noexcept
+    {
+        pos = to - base();
+        scanned = 0;
+    }
+
+    void compact();
+    bool fetchMore();
+    bool inputIsFinal() const
+    {
+        return device && !device->isSequential() && device->atEnd();
+    }
+
+    TokenType parseNext(bool atEndOfInput);
+    TokenType parseValue(const char *json, const char *end, bool atEndOfInput);
+    TokenType parseKey(const char *json, const char *end);
+    TokenType parseLiteral(const char *json, const char *end, QLatin1StringView literal);
+    TokenType parseNumber(const char *json, const char *end, bool atEndOfInput);
+    TokenType endContainer(const char *json);
+    const char *findStringEnd(const char *json, const char *end);
+    bool decodeString(const char *json, const char *end);
+    void valueDone()
+    {
+        if (!containers.isEmpty())
+            state = Separator;
+        else
+            state = documentSequence ? DocumentValue : DocumentEnd;
+    }
+    TokenType setError(QJsonParseError::ParseError code, const char *where)
+    {
+        error = QJsonStreamReader::NotWellFormedError;
+        parseError = code;
+        tokenOffset = discarded + (where - base());
+        return QJsonStreamReader::Invalid;
+    }
+
+    QIODevice *device;
+    QByteArray buffer;
+    qsizetype pos = 0;          // of the first byte not consumed yet
+    qsizetype scanned = 0;      // how far a pending string was searched for its end
+    qint64 discarded = 0;       // bytes removed from the front of the buffer
+    qint64 tokenOffset = 0;
+    QVarLengthArray<bool, 32> containers;   // true for objects
+    State state = DocumentStart;
+    bool documentSequence = false;
+    TokenType token = QJsonStreamReader::NoToken;
+    QJsonStreamReader::Error error = QJsonStreamReader::NoError;
+    QJsonParseError::ParseError parseError = QJsonParseError::NoError;
+    QString text;
+    QCborValue scalar;
+};
+
+void QJsonStreamReaderPrivate::compact()
+{
+    if (pos == 0 || (pos < IdealIoBufferSize && pos != buffer.size()))
+        return;
+    buffer.remove(0, pos);
+    discarded += pos;
+    scanned = qMax(scanned - pos, qsizetype(0));
+    pos = 0;
+}
+
+bool QJsonStreamReaderPrivate::fetchMore()
+{
+    if (!device)
+        return false;
+    const qsizetype size = buffer.size();
+    buffer.resize(size + IdealIoBufferSize);
+    const qint64 read = device->read(buffer.data() + size, IdealIoBufferSize);
+    buffer.resize(size + qMax(read, qint64(0)));
+    return read > 0;
+}
+
+// Returns NoToken if more data is needed to read the next token.
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::parseNext(bool atEndOfInput)
+{
+    while (true) {
+        const char *end = base() + buffer.size();
+        const char *json = base() + pos;
+
+        if (state == DocumentStart) {
+            static const char bom[] = "\xef\xbb\xbf";
+            const qsizetype available = qMin(end - json, qsizetype(3));
+            if (memcmp(json, bom, available) == 0) {
+                if (available < 3 && !atEndOfInput)
+                    return QJsonStreamReader::NoToken;
+                if (available == 3)
+                    consume(json + 3);
+            }
+            state = DocumentValue;
+            continue;
+        }
+
+        json = Parser::skipWhitespace(json, end);
+        pos = json - base();
+        tokenOffset = discarded + pos;
+
+        switch (state) {
+        case DocumentStart:
+            Q_UNREACHABLE();
+        case DocumentValue:
+            if (json == end) {
+                if (atEndOfInput && documentSequence) {
+                    state = Finished;
+                    return QJsonStreamReader::EndDocument;
+                }
+                return QJsonStreamReader::NoToken;
+            }
+            return parseValue(json, end, atEndOfInput);
+        case DocumentEnd:
+            if (json != end)
+                return setError(QJsonParseError::GarbageAtEnd, json);
+            state = Finished;
+            return QJsonStreamReader::EndDocument;
+        case Finished:
+            return QJsonStreamReader::EndDocument;
+        case FirstElement:
+            if (json != end && *json == ']')
+                return endContainer(json);
+            Q_FALLTHROUGH();
+        case Element:
+        case MemberValue:
+            if (json == end)
+                return QJsonStreamReader::NoToken;
+            return parseValue(json, end, atEndOfInput);
+        case FirstMember:
+            if (json == end)
+                return QJsonStreamReader::NoToken;
+            if (*json == '}')
+                return endContainer(json);
+            if (*json != '"')
+                return setError(QJsonParseError::UnterminatedObject, json);
+            return parseKey(json, end);
+        case Member:
+            if (json == end)
+                return QJsonStreamReader::NoToken;
+            if (*json == '}')
+                return setError(QJsonParseError::MissingObject, json);
+            if (*json != '"')
+                return setError(QJsonParseError::UnterminatedObject, json);
+            return parseKey(json, end);
+        case Separator: {
+            if (json == end)
+                return QJsonStreamReader::NoToken;
+            const bool inObject = containers.last();
+            if (*json == ',') {
+                consume(json + 1);
+                state = inObject ? Member : Element;
+                continue;
+            }
+            if (*json == (inObject ? '}' : ']'))
+                return endContainer(json);
+            return setError(inObject ? QJsonParseError::UnterminatedObject
+                                     : QJsonParseError::MissingValueSeparator, json);
+        }
+        }
+    }
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::parseValue(const char *json, const char *end, bool atEndOfInput)
+{
+    switch (*json) {
+    case '[':
+    case '{': {
+        if (containers.size() >= NestingLimit)
+            return setError(QJsonParseError::DeepNesting, json);
+        const bool isObject = *json == '{';
+        containers.append(isObject);
+        state = isObject ? FirstMember : FirstElement;
+        consume(json + 1);
+        return isObject ? QJsonStreamReader::StartObject : QJsonStreamReader::StartArray;
+    }
+    case '"': {
+        const char *stringEnd = findStringEnd(json + 1, end);
+        if (!stringEnd)
+            return QJsonStreamReader::NoToken;
+        if (!decodeString(json + 1, stringEnd))
+            return QJsonStreamReader::Invalid;
+        consume(stringEnd + 1);
+        valueDone();
+        return QJsonStreamReader::String;
+    }
+    case 't':
+        scalar = QCborValue(true);
+        return parseLiteral(json, end, "true"_L1);
+    case 'f':
+        scalar = QCborValue(false);
+        return parseLiteral(json, end, "false"_L1);
+    case 'n':
+        scalar = QCborValue(nullptr);
+        return parseLiteral(json, end, "null"_L1);
+    case ',':
+        return setError(QJsonParseError::IllegalValue, json);
+    case ']':
+    case '}':
+        return setError(QJsonParseError::MissingObject, json);
+    default:
+        return parseNumber(json, end, atEndOfInput);
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::parseKey(const char *json, const char *end)
+{
+    const char *stringEnd = findStringEnd(json + 1, end);
+    if (!stringEnd)
+        return QJsonStreamReader::NoToken;
+    if (!decodeString(json + 1, stringEnd))
+        return QJsonStreamReader::Invalid;
+
+    const char *separator = Parser::skipWhitespace(stringEnd + 1, end);
+    if (separator == end) {
+        // don't search for the end of the string again
+        scanned = stringEnd - base();
+        return QJsonStreamReader::NoToken;
+    }
+    if (*separator != ':')
+        return setError(QJsonParseError::MissingNameSeparator, separator);
+
+    consume(separator + 1);
+    state = MemberValue;
+    return QJsonStreamReader::Key;
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::parseLiteral(const char *json, const char *end, QLatin1StringView literal)
+{
+    const qsizetype available = qMin(end - json, literal.size());
+    if (memcmp(json, literal.data(), available) != 0)
+        return setError(QJsonParseError::IllegalValue, json);
+    if (available < literal.size())
+        return QJsonStreamReader::NoToken;
+
+    consume(json + literal.size());
+    valueDone();
+    return scalar.isBool() ? QJsonStreamReader::Bool : QJsonStreamReader::Null;
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::parseNumber(const char *json, const char *end, bool atEndOfInput)
+{
+    // a number is only known to be complete once something follows it
+    const char *numberEnd = json;
+    bool isInt;
+    if (!Parser::scanNumber(numberEnd, end, &isInt) && !atEndOfInput)
+        return QJsonStreamReader::NoToken;
+
+    if (!Parser::numberValue(QByteArrayView(json, numberEnd), isInt, &scalar))
+        return setError(QJsonParseError::IllegalNumber, json);
+
+    consume(numberEnd);
+    valueDone();
+    return QJsonStreamReader::Number;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::endContainer(const char *json)
+{
+    const bool isObject = containers.last();
+    containers.removeLast();
+    consume(json + 1);
+    valueDone();
+    return isObject ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray;
+}
+
+// Returns the closing quote of the string whose contents start at json, or
+// nullptr if it hasn't arrived yet.
+const char *QJsonStreamReaderPrivate::findStringEnd(const char *json, const char *end)
+{
+    const char *quote = qMax(json, base() + scanned);
+    while ((quote = static_cast<const char *>(memchr(quote, '"', end - quote)))) {
+        const char *backslashes = quote;
+        while (backslashes > json && backslashes[-1] == '\\')
+            --backslashes;
+        if ((quote - backslashes) % 2 == 0)
+            return quote;
+        ++quote;
+    }
+    scanned = end - base();
+    return nullptr;
+}
+
+bool QJsonStreamReaderPrivate::decodeString(const char *json, const char *end)
+{
+    const char *start = json;
+    bool isAscii;
+    if (!Parser::scanUtf8String(json, end, &isAscii)) {
+        setError(QJsonParseError::IllegalUTF8String, json);
+        return false;
+    }
+    // decode into the buffer of the previous string, which is usually no
+    // longer referenced, to avoid allocating for every string
+    text.resize(json - start);
+    QChar *out = text.data();
+    if (isAscii)
+        out = QLatin1::convertToUnicode(out, QLatin1StringView(start, json));
+    else
+        out = QUtf8::convertToUnicode(out, QByteArrayView(start, json));
+    text.truncate(out - text.constData());
+    if (json == end)
+        return true;
+
+    QJsonParseError::ParseError code;
+    if (!Parser::scanEscapedString(json, end, &text, &code)) {
+        setError(code, json);
+        return false;
+    }
+    Q_ASSERT(json == end);
+    return true;
+}
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.9
+
+    \brief The QJsonStreamReader class is a fast parser for reading JSON
+    one token at a time.
+
+    QJsonDocument::fromJson() needs the whole document in memory, and decodes
+    all of it before returning. QJsonStreamReader instead reports the document
+    as a series of tokens, read one at a time with readNext(), so a document
+    can be processed while it is being received and without holding more than
+    the current token in memory.
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 0
+
+    The data is read from a QIODevice set with setDevice(), or from chunks
+    passed to addData(). When the data ends in the middle of a document,
+    readNext() returns Invalid and error() returns
+    PrematureEndOfDocumentError; this is not a fatal error, and reading
+    continues from the same token once more data is available. This makes
+    QJsonStreamReader suitable for reading from sockets:
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 1
+
+    Any JSON value is accepted at the top level of a document, not only
+    arrays and objects. By default, the reader expects a single document and
+    reports EndDocument after it; anything but whitespace following it is an
+    error. When document sequences are enabled with setDocumentSequence(), the
+    reader instead accepts any number of documents separated by whitespace,
+    such as newline-delimited JSON, and the memory it uses does not depend on
+    their number.
+
+    QJsonStreamReader accepts the documents that QJsonDocument accepts and
+    reports the same QJsonParseError errors, through errorString(), but does
+    not detect duplicate keys in objects.
+
+    \sa QJsonStreamWriter, QJsonDocument, QCborStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token that the reader just read.
+
+    \value NoToken      The reader has not read anything yet.
+    \value Invalid      An error occurred, see error() and errorString().
+    \value StartArray   The reader reports the start of an array.
+    \value EndArray     The reader reports the end of an array.
+    \value StartObject  The reader reports the start of an object.
+    \value EndObject    The reader reports the end of an object.
+    \value Key          The reader reports the key of a member of an object
+                        in text().
+    \value String       The reader reports a string in text().
+    \value Number       The reader reports a number, see isInteger(),
+                        toInteger() and toDouble().
+    \value Bool         The reader reports \c true or \c false in toBool().
+    \value Null         The reader reports \c null.
+    \value EndDocument  The reader reached the end of the document, or the
+                        end of a document sequence.
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum specifies the errors that the reader can report.
+
+    \value NoError  No error occurred.
+    \value NotWellFormedError  The data is not valid JSON. The reader can't
+                    continue.
+    \value PrematureEndOfDocumentError  The data ended before the end of the
+                    document. The reader continues when more data is
+                    available.
+*/
+
+/*!
+    Constructs a stream reader without any data. Use addData() or
+    setDevice() to provide it.
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate(nullptr, QByteArray()))
+{
+}
+
+/*!
+    Constructs a stream reader that reads from \a device. The device must
+    have been opened already, and QJsonStreamReader does not take ownership
+    of it.
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d(new QJsonStreamReaderPrivate(device, QByteArray()))
+{
+}
+
+/*!
+    Constructs a stream reader that reads from \a data. More data can be
+    added with addData().
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d(new QJsonStreamReaderPrivate(nullptr, data))
+{
+}
+
+/*!
+    Destroys the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+}
+
+/*!
+    Sets the device to read from to \a device, and resets the reader to its
+    initial state.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    d->reset();
+    d->device = device;
+}
+
+/*!
+    Returns the device set with setDevice() or the constructor, or
+    \nullptr if the reader reads from a QByteArray.
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Adds \a data to the data that the reader reads, and clears any
+    PrematureEndOfDocumentError. This function must not be used when reading
+    from a device.
+
+    \sa readNext(), error()
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    addData(data.constData(), data.size());
+}
+
+/*!
+    \overload
+
+    Adds the \a len bytes starting at \a data to the data that the reader
+    reads.
+*/
+void QJsonStreamReader::addData(const char *data, qsizetype len)
+{
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with device()");
+        return;
+    }
+    d->buffer.append(data, len);
+    if (d->error == PrematureEndOfDocumentError)
+        d->error = NoError;
+}
+
+/*!
+    Removes any device or data from the reader and resets it to its initial
+    state. The document sequence setting is kept.
+
+    \sa setDevice(), addData()
+*/
+void QJsonStreamReader::clear()
+{
+    d->reset();
+    d->device = nullptr;
+}
+
+/*!
+    Sets whether the reader reads a sequence of documents to \a enabled.
+
+    A sequence of documents is any number of JSON values separated by
+    whitespace, such as newline-delimited JSON, where each line of a file is
+    a separate document. When reading such a sequence, the reader reports
+    the tokens of each document in turn and reports EndDocument only at the
+    end of the input. As the reader can only know that the input has ended
+    when reading from a device that is not sequential, it otherwise reports
+    PrematureEndOfDocumentError between documents until more data
+    arrives.
+
+    \sa isDocumentSequence(), depth()
+*/
+void QJsonStreamReader::setDocumentSequence(bool enabled)
+{
+    d->documentSequence = enabled;
+}
+
+/*!
+    Returns \c true if the reader reads a sequence of documents.
+
+    \sa setDocumentSequence()
+*/
+bool QJsonStreamReader::isDocumentSequence() const
+{
+    return d->documentSequence;
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    If error() is NotWellFormedError, this function does nothing and
+    returns Invalid. If it is PrematureEndOfDocumentError, this function
+    tries to read the token that could not be read before.
+
+    A number at the top level of a document can only be read once it is
+    followed by whitespace, or at the end of a device that is not
+    sequential, as it might otherwise continue in the data yet to arrive.
+
+    \sa tokenType(), error()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    if (d->error == NotWellFormedError)
+        return Invalid;
+
+    d->error = NoError;
+    d->compact();
+    TokenType token = d->parseNext(false);
+    while (token == NoToken) {
+        if (d->fetchMore()) {
+            token = d->parseNext(false);
+            continue;
+        }
+        if (d->inputIsFinal())
+            token = d->parseNext(true);
+        if (token == NoToken) {
+            d->error = PrematureEndOfDocumentError;
+            token = Invalid;
+        }
+    }
+    d->token = token;
+    return token;
+}
+
+/*!
+    Returns the type of the token that readNext() last returned.
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    return d->token;
+}
+
+/*!
+    Returns \c true if the reader reached the end of the document or the
+    sequence of documents, or if an error occurred. After a
+    PrematureEndOfDocumentError, it returns \c false again once more data is
+    available.
+
+    \sa readNext(), error()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    if (d->error == PrematureEndOfDocumentError)
+        return !d->device || d->device->bytesAvailable() == 0;
+    return d->error != NoError || d->state == QJsonStreamReaderPrivate::Finished;
+}
+
+/*!
+    Returns how many arrays and objects enclose the current position. It is
+    0 between the documents of a sequence.
+*/
+int QJsonStreamReader::depth() const
+{
+    return int(d->containers.size());
+}
+
+/*!
+    Returns the offset, in bytes from the start of the data, of the current
+    token, or of the error if readNext() returned Invalid.
+*/
+qint64 QJsonStreamReader::offset() const
+{
+    return d->tokenOffset;
+}
+
+/*!
+    Returns the key or the string of the current token, or an empty string
+    view if it is not a Key or a String. The view remains valid until the
+    next call to readNext().
+*/
+QStringView QJsonStreamReader::text() const
+{
+    if (d->token != Key && d->token != String)
+        return {};
+    return d->text;
+}
+
+/*!
+    Returns \c true if the current token is a number that has neither a
+    fractional part nor an exponent, and fits in a qint64.
+
+    \sa toInteger(), toDouble()
+*/
+bool QJsonStreamReader::isInteger() const
+{
+    return d->token == Number && d->scalar.isInteger();
+}
+
+/*!
+    Returns the current token converted to an integer if it is a number, or
+    0 otherwise.
+
+    \sa isInteger(), toDouble()
+*/
+qint64 QJsonStreamReader::toInteger() const
+{
+    return d->token == Number ? d->scalar.toInteger() : 0;
+}
+
+/*!
+    Returns the current token if it is a number, or 0 otherwise.
+
+    \sa isInteger(), toInteger()
+*/
+double QJsonStreamReader::toDouble() const
+{
+    return d->token == Number ? d->scalar.toDouble() : 0;
+}
+
+/*!
+    Returns the current token if it is a Bool, or \c false otherwise.
+*/
+bool QJsonStreamReader::toBool() const
+{
+    return d->token == Bool && d->scalar.isTrue();
+}
+
+/*!
+    Returns the current token as a QJsonValue if it is a String, a Number, a
+    Bool or a Null, or an undefined QJsonValue otherwise.
+*/
+QJsonValue QJsonStreamReader::value() const
+{
+    switch (d->token) {
+    case String:
+        return d->text;
+    case Number:
+        return d->scalar.isInteger() ? QJsonValue(d->scalar.toInteger())
+                                     : QJsonValue(d->scalar.toDouble());
+    case Bool:
+        return d->scalar.isTrue();
+    case Null:
+        return QJsonValue::Null;
+    default:
+        return QJsonValue::Undefined;
+    }
+}
+
+/*!
+    Returns the error that occurred while reading the last token.
+
+    \sa errorString(), hasError()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    return d->error;
+}
+
+/*!
+    Returns a human-readable description of error(), or an empty string if
+    there is no error.
+*/
+QString QJsonStreamReader::errorString() const
+{
+    switch (d->error) {
+    case NoError:
+        break;
+    case NotWellFormedError:
+        return QJsonParseError{0, d->parseError}.errorString();
+    case PrematureEndOfDocumentError:
+        return QCoreApplication::translate("QJsonStreamReader", "premature end of document");
+    }
+    return QString();
+}
+
+/*!
+    \fn bool QJsonStreamReader::hasError() const
+
+    Returns \c true if an error occurred.
+
+    \sa error()
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isStartArray() const
+
+    Returns \c true if tokenType() is StartArray.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isEndArray() const
+
+    Returns \c true if tokenType() is EndArray.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isStartObject() const
+
+    Returns \c true if tokenType() is StartObject.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isEndObject() const
+
+    Returns \c true if tokenType() is EndObject.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isKey() const
+
+    Returns \c true if tokenType() is Key.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isString() const
+
+    Returns \c true if tokenType() is String.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isNumber() const
+
+    Returns \c true if tokenType() is Number.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isBool() const
+
+    Returns \c true if tokenType() is Bool.
+*/
+
+/*!
+    \fn bool QJsonStreamReader::isNull() const
+
+    Returns \c true if tokenType() is Null.
+*/
+
+QT_END_NAMESPACE
+
+#include "moc_qjsonstreamreader.cpp"
@@ -0,0 +1,94 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONSTREAMREADER_H
+#define QJSONSTREAMREADER_H
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qobjectdefs.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringview.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+class QJsonStreamReaderPrivate;
+class Q_CORE_EXPORT QJsonStreamReader
+{
+    Q_GADGET
+public:
+    enum TokenType {
+        NoToken = 0,
+        Invalid,
+        StartArray,
+        EndArray,
+        StartObject,
+        EndObject,
+        Key,
+        String,
+        Number,
+        Bool,
+        Null,
+        EndDocument
+    };
+    Q_ENUM(TokenType)
+
+    enum Error {
+        NoError = 0,
+        NotWellFormedError,
+        PrematureEndOfDocumentError
+    };
+    Q_ENUM(Error)
+
+    QJsonStreamReader();
+    explicit QJsonStreamReader(QIODevice *device);
+    explicit QJsonStreamReader(const QByteArray &data);
+    ~QJsonStreamReader();
+    Q_DISABLE_COPY(QJsonStreamReader)
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+    void addData(const QByteArray &data);
+    void addData(const char *data, qsizetype len);
+    void clear();
+
+    void setDocumentSequence(bool enabled);
+    bool isDocumentSequence() const;
+
+    TokenType readNext();
+    TokenType tokenType() const;
+    bool atEnd() const;
+    int depth() const;
+    qint64 offset() const;
+
+    bool isStartArray() const { return tokenType() == StartArray; }
+    bool isEndArray() const { return tokenType() == EndArray; }
+    bool isStartObject() const { return tokenType() == StartObject; }
+    bool isEndObject() const { return tokenType() == EndObject; }
+    bool isKey() const { return tokenType() == Key; }
+    bool isString() const { return tokenType() == String; }
+    bool isNumber() const { return tokenType() == Number; }
+    bool isBool() const { return tokenType() == Bool; }
+    bool isNull() const { return tokenType() == Null; }
+
+    QStringView text() const;
+    bool isInteger() const;
+    qint64 toInteger() const;
+    double toDouble() const;
+    bool toBool() const;
+    QJsonValue value() const;
+
+    Error error() const;
+    QString errorString() const;
+    bool hasError() const { return error() != NoError; }
+
+private:
+    QScopedPointer<QJsonStreamReaderPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMREADER_H
@@ -0,0 +1,404 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamwriter.h"
+
+#include <QtCore/qbuffer.h>
+#include <QtCore/qcborvalue.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qjsonwriter_p.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QJsonPrivate;
+
+/*!
+    \class QJsonStreamWriter
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.9
+
+    \brief The QJsonStreamWriter class is a simple JSON encoder operating on a
+    one-value-at-a-time basis.
+
+    QJsonDocument::toJson() needs the whole document in memory as
+    QJsonObject and QJsonArray instances before encoding it. QJsonStreamWriter
+    instead writes each value to a QIODevice or a QByteArray as soon as it is
+    added, so documents of any size can be produced without building them
+    first.
+
+    \snippet code/src_corelib_serialization_qjsonstreamwriter.cpp 0
+
+    Arrays and objects are opened with startArray() and startObject(), and
+    closed with endArray() and endObject(). In an object, each value must be
+    preceded by its key, written with writeKey(). Values are written with
+    writeString(), writeInteger(), writeDouble(), writeBool(), writeNull(), or
+    writeValue() for any QJsonValue, including whole arrays and objects.
+
+    The output is formatted as QJsonDocument::toJson() formats it for the
+    format() set with setFormat(), except that each value written at the top
+    level is followed by a newline. Writing several top-level values in the
+    QJsonDocument::Compact format therefore produces newline-delimited JSON,
+    which QJsonStreamReader reads as a sequence of documents.
+
+    QJsonStreamWriter does not buffer its output: every call results in at
+    most one call to the device's \l {QIODevice::}{write()} method.
+
+    \sa QJsonStreamReader, QJsonDocument, QCborStreamWriter
+*/
+
+class QJsonStreamWriterPrivate
+{
+public:
+    struct Container
+    {
+        bool isObject;
+        bool isEmpty;
+    };
+
+    QJsonStreamWriterPrivate(QIODevice *device)
+        : device(device)
+    {
+    }
+
+    ~QJsonStreamWriterPrivate()
+    {
+        if (deleteDevice)
+            delete device;
+    }
+
+    int depth() const { return int(containers.size()); }
+    bool compact() const { return format == QJsonDocument::Compact; }
+
+    void indent(int level)
+    {
+        if (!compact())
+            pending.append(4 * level, ' ');
+    }
+
+    bool startValue(const char *what);
+    void finishValue();
+    void writePending();
+
+    QIODevice *device;
+    QByteArray pending;         // the output of the current call
+    QVarLengthArray<Container, 32> containers;
+    QJsonDocument::JsonFormat format = QJsonDocument::Compact;
+    bool keyWritten = false;
+    bool hasError = false;
+    bool deleteDevice = false;
+};
+
+bool QJsonStreamWriterPrivate::startValue(const char *what)
+{
+    if (containers.isEmpty())
+        return true;
+
+    Container &container = containers.last();
+    if (container.isObject) {
+        if (!keyWritten) {
+            qWarning("QJsonStreamWriter: %s in an object without a key", what);
+            return false;
+        }
+        keyWritten = false;
+        return true;
+    }
+
+    if (!container.isEmpty)
+        pending += compact() ? "," : ",\n";
+    container.isEmpty = false;
+    indent(depth());
+    return true;
+}
+
+void QJsonStreamWriterPrivate::finishValue()
+{
+    if (containers.isEmpty())
+        pending += '\n';
+    writePending();
+}
+
+void QJsonStreamWriterPrivate::writePending()
+{
+    if (device && device->write(pending) != pending.size())
+        hasError = true;
+    pending.resize(0);
+}
+
+static QByteArray escapedString(QAnyStringView str)
+{
+    return str.visit([](auto s) {
+        if constexpr (std::is_same_v<decltype(s), QStringView>)
+            return Writer::escapedString(s);
+        else
+            return Writer::escapedString(s.toString());
+    });
+}
+
+/*!
+    Creates a QJsonStreamWriter object that writes to \a device. The device
+    must be opened before the first value is written, and QJsonStreamWriter
+    does not take ownership of it.
+
+    \sa device(), setDevice()
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : d(new QJsonStreamWriterPrivate(device))
+{
+}
+
+/*!
+    Creates a QJsonStreamWriter object that appends to \a data.
+    QJsonStreamWriter does not take ownership of \a data.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *data)
+    : d(new QJsonStreamWriterPrivate(new QBuffer(data)))
+{
+    d->deleteDevice = true;
+    d->device->open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered);
+}
+
+/*!
+    Destroys this QJsonStreamWriter object.
+
+    QJsonStreamWriter does not check that all arrays and objects were closed
+    before it is destroyed. It is the programmer's responsibility to ensure
+    that they were.
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+}
+
+/*!
+    Replaces the device or byte array that this QJsonStreamWriter object is
+    writing to with \a device.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    if (d->deleteDevice)
+        delete d->device;
+    d->device = device;
+    d->deleteDevice = false;
+}
+
+/*!
+    Returns the QIODevice that this QJsonStreamWriter object is writing to.
+
+    If this object was created by writing to a QByteArray, this function
+    returns an internal instance of QBuffer, which is owned by
+    QJsonStreamWriter.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    return d->device;
+}
+
+/*!
+    Sets the format of the output to \a format. The default is
+    QJsonDocument::Compact.
+
+    \sa format()
+*/
+void QJsonStreamWriter::setFormat(QJsonDocument::JsonFormat format)
+{
+    d->format = format;
+}
+
+/*!
+    Returns the format of the output.
+
+    \sa setFormat()
+*/
+QJsonDocument::JsonFormat QJsonStreamWriter::format() const
+{
+    return d->format;
+}
+
+/*!
+    Starts an array. Its elements are the values written until the matching
+    call to endArray().
+
+    \sa endArray(), startObject()
+*/
+void QJsonStreamWriter::startArray()
+{
+    if (!d->startValue("array"))
+        return;
+    d->containers.append({false, true});
+    d->pending += d->compact() ? "[" : "[\n";
+    d->writePending();
+}
+
+/*!
+    Ends the array started by the last call to startArray() and returns
+    \c true, or returns \c false if the innermost open container is not an
+    array.
+
+    \sa startArray()
+*/
+bool QJsonStreamWriter::endArray()
+{
+    if (d->containers.isEmpty() || d->containers.last().isObject) {
+        qWarning("QJsonStreamWriter: closing array that wasn't open");
+        return false;
+    }
+    if (!d->containers.last().isEmpty && !d->compact())
+        d->pending += '\n';
+    d->containers.removeLast();
+    d->indent(d->depth());
+    d->pending += ']';
+    d->finishValue();
+    return true;
+}
+
+/*!
+    Starts an object. Its members are the keys and values written until the
+    matching call to endObject().
+
+    \sa endObject(), writeKey(), startArray()
+*/
+void QJsonStreamWriter::startObject()
+{
+    if (!d->startValue("object"))
+        return;
+    d->containers.append({true, true});
+    d->pending += d->compact() ? "{" : "{\n";
+    d->writePending();
+}
+
+/*!
+    Ends the object started by the last call to startObject() and returns
+    \c true, or returns \c false if the innermost open container is not an
+    object or the value of its last key is missing.
+
+    \sa startObject()
+*/
+bool QJsonStreamWriter::endObject()
+{
+    if (d->containers.isEmpty() || !d->containers.last().isObject) {
+        qWarning("QJsonStreamWriter: closing object that wasn't open");
+        return false;
+    }
+    if (d->keyWritten) {
+        qWarning("QJsonStreamWriter: closing object with a key without a value");
+        return false;
+    }
+    if (!d->containers.last().isEmpty && !d->compact())
+        d->pending += '\n';
+    d->containers.removeLast();
+    d->indent(d->depth());
+    d->pending += '}';
+    d->finishValue();
+    return true;
+}
+
+/*!
+    Writes \a key as the key of the next member of the current object. It
+    must be followed by exactly one value.
+
+    \sa startObject()
+*/
+void QJsonStreamWriter::writeKey(QAnyStringView key)
+{
+    if (d->containers.isEmpty() || !d->containers.last().isObject || d->keyWritten) {
+        qWarning("QJsonStreamWriter: key not expected here");
+        return;
+    }
+
+    auto &container = d->containers.last();
+    if (!container.isEmpty)
+        d->pending += d->compact() ? "," : ",\n";
+    container.isEmpty = false;
+    d->indent(d->depth());
+    d->pending += '"';
+    d->pending += escapedString(key);
+    d->pending += d->compact() ? "\":" : "\": ";
+    d->keyWritten = true;
+    d->writePending();
+}
+
+/*!
+    Writes the string \a str.
+*/
+void QJsonStreamWriter::writeString(QAnyStringView str)
+{
+    if (!d->startValue("string"))
+        return;
+    d->pending += '"';
+    d->pending += escapedString(str);
+    d->pending += '"';
+    d->finishValue();
+}
+
+/*!
+    Writes the integer \a i.
+*/
+void QJsonStreamWriter::writeInteger(qint64 i)
+{
+    if (!d->startValue("integer"))
+        return;
+    d->pending += QByteArray::number(i);
+    d->finishValue();
+}
+
+/*!
+    Writes the number \a d. Infinities and NaN are written as \c null, as
+    JSON cannot represent them.
+*/
+void QJsonStreamWriter::writeDouble(double d)
+{
+    if (!this->d->startValue("number"))
+        return;
+    Writer::valueToJson(QCborValue(d), this->d->pending, 0, true);
+    this->d->finishValue();
+}
+
+/*!
+    Writes \c true or \c false, depending on \a b.
+*/
+void QJsonStreamWriter::writeBool(bool b)
+{
+    if (!d->startValue("boolean"))
+        return;
+    d->pending += b ? "true" : "false";
+    d->finishValue();
+}
+
+/*!
+    Writes \c null.
+*/
+void QJsonStreamWriter::writeNull()
+{
+    if (!d->startValue("null"))
+        return;
+    d->pending += "null";
+    d->finishValue();
+}
+
+/*!
+    Writes \a value, which may be an array or an object. An undefined value
+    is written as \c null.
+*/
+void QJsonStreamWriter::writeValue(const QJsonValue &value)
+{
+    if (!d->startValue("value"))
+        return;
+    Writer::valueToJson(QCborValue::fromJsonValue(value), d->pending, d->depth(), d->compact());
+    d->finishValue();
+}
+
+/*!
+    Returns \c true if writing to the device failed.
+*/
+bool QJsonStreamWriter::hasError() const
+{
+    return d->hasError;
+}
+
+QT_END_NAMESPACE
@@ -22,7 +22,7 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(QStringView s)
+QByteArray Writer::escapedString(QStringView s)
 {
     // give it a minimum size to ensure the resize() below always adds enough space
     QByteArray ba(qMax(s.size(), 16), Qt::Uninitialized);
@@ -93,7 +93,7 @@ static QByteArray escapedString(QStringView s)
     return ba;
 }
 
-static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
+void Writer::valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
 {
     QCborValue::Type type = v.type();
     switch (type) {
@@ -116,7 +116,7 @@ static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        json += Writer::escapedString(v.toString());
         json += '"';
         break;
     case QCborValue::Array:
@@ -149,7 +149,7 @@ static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json,
     qsizetype i = 0;
     while (true) {
         json += indentString;
-        valueToJson(a->valueAt(i), json, indent, compact);
+        Writer::valueToJson(a->valueAt(i), json, indent, compact);
 
         if (++i == a->elements.size()) {
             if (!compact)
@@ -174,9 +174,9 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
         QCborValue e = o->valueAt(i);
         json += indentString;
         json += '"';
-        json += escapedString(o->valueAt(i).toString());
+        json += Writer::escapedString(o->valueAt(i).toString());
         json += compact ? "\":" : "\": ";
-        valueToJson(o->valueAt(i + 1), json, indent, compact);
+        Writer::valueToJson(o->valueAt(i + 1), json, indent, compact);
 
         if ((i += 2) == o->elements.size()) {
             if (!compact)
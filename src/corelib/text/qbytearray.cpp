@@ -1980,7 +1980,7 @@ void QByteArray::reallocData(qsizetype alloc, QArrayData::AllocationOption optio
     const bool cannotUseReallocate = d.freeSpaceAtBegin() > 0;
 
     if (d->needsDetach() || cannotUseReallocate) {
-        DataPointer dd(alloc, qMin(alloc, d.size), option);
+        DataPointer dd(alloc, qMin(alloc, d.size), option, d.growthResource());
         Q_CHECK_PTR(dd.data());
         if (dd.size > 0)
             ::memcpy(dd.data(), d.data(), dd.size);
@@ -3296,12 +3296,18 @@ QByteArray QByteArray::toUpper_helper(QByteArray &a)
 
     Clears the contents of the byte array and makes it null.
 
+    A byte array that allocates from a QMemoryResource keeps its array
+    instead, and becomes empty but not null.
+
     \sa resize(), isNull()
 */
 
 void QByteArray::clear()
 {
-    d.clear();
+    if (Q_UNLIKELY(d.growthResource()))
+        resize(0); // keep the array from the memory resource
+    else
+        d.clear();
 }
 
 #if !defined(QT_NO_DATASTREAM)
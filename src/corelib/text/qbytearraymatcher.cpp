@@ -8,6 +8,9 @@
 #  include <private/qtcore-config_p.h>
 #endif
 
+#include <private/qmatchersimd_p.h>
+#include <QtCore/qalgorithms.h>
+
 #include <limits.h>
 
 QT_BEGIN_NAMESPACE
@@ -26,6 +29,20 @@ static inline qsizetype bm_find(const uchar *cc, qsizetype l, qsizetype index, c
 {
     if (pl == 0)
         return index > l ? -1 : index;
+    if (index > l - pl)
+        return -1;
+    if (pl == 1) {
+        const void *found = memchr(cc + index, *puc, size_t(l - index));
+        return found ? static_cast<const uchar *>(found) - cc : -1;
+    }
+#ifdef __SSE2__
+    if (pl <= SimdFilterMaxNeedleLength) {
+        const qsizetype found = simd_find(cc, l, index, puc, pl);
+        if (found >= 0)
+            return found;
+        // the rest is shorter than a vector, if there is any
+    }
+#endif
     const qsizetype pl_minus_one = pl - 1;
 
     const uchar *current = cc + index + pl_minus_one;
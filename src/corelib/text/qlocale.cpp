@@ -3717,6 +3717,79 @@ QString QCalendarBackend::dateTimeToString(QStringView format, const QDateTime &
 
 // End of QCalendar intrustions
 
+// Writes the digits of d, as doubleToString() lays them out, to buf, with
+// their count in length and the position of the decimal point in decpt.
+// The precision must be QLocale::FloatingPointShortest or not negative.
+void QLocaleData::doubleToDigits(QVarLengthArray<char> &buf, double d, int precision,
+                                 DoubleForm form, bool &negative, int &length, int &decpt)
+{
+    qsizetype bufSize = 1;
+    if (precision == QLocale::FloatingPointShortest)
+        bufSize += std::numeric_limits<double>::max_digits10;
+    else if (form == DFDecimal && qt_is_finite(d))
+        bufSize += wholePartSpace(qAbs(d)) + precision;
+    else // Add extra digit due to different interpretations of precision.
+        bufSize += qMax(2, precision) + 1; // Must also be big enough for "nan" or "inf"
+
+    buf.resize(bufSize);
+    negative = false;
+    qt_doubleToAscii(d, form, precision, buf.data(), bufSize, negative, length, decpt);
+}
+
+// Returns whether DFSignificantDigits lays out the digitCount digits from
+// doubleToDigits() in decimal rather than exponent form. Only the
+// GroupDigits, ZeroPadExponent and ForcePoint flags matter.
+bool QLocaleData::useDecimalForm(int decpt, qsizetype digitCount, int precision,
+                                 unsigned flags) const
+{
+    const bool groupDigits = flags & GroupDigits;
+    const int minExponentDigits = flags & ZeroPadExponent ? 2 : 1;
+    /* POSIX specifies sprintf() to follow fprintf(), whose 'g/G' format
+       says; with P = 6 if precision unspecified else 1 if precision is
+       0 else precision; when 'e/E' would have exponent X, use:
+         * 'f/F' if P > X >= -4, with precision P-1-X
+         * 'e/E' otherwise, with precision P-1
+       Helpfully, we already have mapped precision < 0 to 6 - except for
+       F.P.Shortest mode, which is its own story - and those of our
+       callers with unspecified precision either used 6 or -1 for it.
+    */
+    if (precision == QLocale::FloatingPointShortest) {
+        // Find out which representation is shorter.
+        // Set bias to everything added to exponent form but not
+        // decimal, minus the converse.
+
+        // Exponent adds separator, sign and digits:
+        int bias = 2 + minExponentDigits;
+        // Decimal form may get grouping separators inserted:
+        if (groupDigits && decpt >= m_grouping_top + m_grouping_least)
+            bias -= (decpt - m_grouping_least) / m_grouping_higher + 1;
+        // X = decpt - 1 needs two digits if decpt > 10:
+        if (decpt > 10 && minExponentDigits == 1)
+            ++bias;
+        // Assume digitCount < 95, so we can ignore the 3-digit
+        // exponent case (we'll return false anyway).
+
+        if (!(flags & ForcePoint)) {
+            // Decimal separator is skipped if at end; adjust if
+            // that happens for only one form:
+            if (digitCount <= decpt && digitCount > 1)
+                ++bias; // decimal but not exponent
+            else if (digitCount == 1 && decpt <= 0)
+                --bias; // exponent but not decimal
+        }
+        // When 0 < decpt <= digitCount, the forms have equal digit
+        // counts, plus things bias has taken into account; otherwise
+        // decimal form's digit count is right-padded with zeros to
+        // decpt, when decpt is positive, otherwise it's left-padded
+        // with 1 - decpt zeros.
+        return (decpt <= 0 ? 1 - decpt <= bias
+                : decpt <= digitCount ? 0 <= bias : decpt <= digitCount + bias);
+    }
+    // X == decpt - 1, POSIX's P; -4 <= X < P iff -4 < decpt <= P
+    Q_ASSERT(precision >= 0);
+    return decpt > -4 && decpt <= (precision ? precision : 1);
+}
+
 QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
                                     int width, unsigned flags) const
 {
@@ -3730,19 +3803,11 @@ QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
     if (width < 0)
         width = 0;
 
-    int decpt;
-    qsizetype bufSize = 1;
-    if (precision == QLocale::FloatingPointShortest)
-        bufSize += std::numeric_limits<double>::max_digits10;
-    else if (form == DFDecimal && qt_is_finite(d))
-        bufSize += wholePartSpace(qAbs(d)) + precision;
-    else // Add extra digit due to different interpretations of precision.
-        bufSize += qMax(2, precision) + 1; // Must also be big enough for "nan" or "inf"
-
-    QVarLengthArray<char> buf(bufSize);
+    QVarLengthArray<char> buf;
+    bool negative;
     int length;
-    bool negative = false;
-    qt_doubleToAscii(d, form, precision, buf.data(), bufSize, negative, length, decpt);
+    int decpt;
+    doubleToDigits(buf, d, precision, form, negative, length, decpt);
 
     const QString prefix = signPrefix(negative && !isZero(d), flags);
     QString numStr;
@@ -3794,54 +3859,7 @@ QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
             PrecisionMode mode
                 = (flags & AddTrailingZeroes) ? PMSignificantDigits : PMChopTrailingZeros;
 
-            /* POSIX specifies sprintf() to follow fprintf(), whose 'g/G' format
-               says; with P = 6 if precision unspecified else 1 if precision is
-               0 else precision; when 'e/E' would have exponent X, use:
-                 * 'f/F' if P > X >= -4, with precision P-1-X
-                 * 'e/E' otherwise, with precision P-1
-               Helpfully, we already have mapped precision < 0 to 6 - except for
-               F.P.Shortest mode, which is its own story - and those of our
-               callers with unspecified precision either used 6 or -1 for it.
-            */
-            bool useDecimal;
-            if (precision == QLocale::FloatingPointShortest) {
-                // Find out which representation is shorter.
-                // Set bias to everything added to exponent form but not
-                // decimal, minus the converse.
-
-                // Exponent adds separator, sign and digits:
-                int bias = 2 + minExponentDigits;
-                // Decimal form may get grouping separators inserted:
-                if (groupDigits && decpt >= m_grouping_top + m_grouping_least)
-                    bias -= (decpt - m_grouping_least) / m_grouping_higher + 1;
-                // X = decpt - 1 needs two digits if decpt > 10:
-                if (decpt > 10 && minExponentDigits == 1)
-                    ++bias;
-                // Assume digitCount < 95, so we can ignore the 3-digit
-                // exponent case (we'll set useDecimal false anyway).
-
-                const qsizetype digitCount = digits.size() / zero.size();
-                if (!mustMarkDecimal) {
-                    // Decimal separator is skipped if at end; adjust if
-                    // that happens for only one form:
-                    if (digitCount <= decpt && digitCount > 1)
-                        ++bias; // decimal but not exponent
-                    else if (digitCount == 1 && decpt <= 0)
-                        --bias; // exponent but not decimal
-                }
-                // When 0 < decpt <= digitCount, the forms have equal digit
-                // counts, plus things bias has taken into account; otherwise
-                // decimal form's digit count is right-padded with zeros to
-                // decpt, when decpt is positive, otherwise it's left-padded
-                // with 1 - decpt zeros.
-                useDecimal = (decpt <= 0 ? 1 - decpt <= bias
-                              : decpt <= digitCount ? 0 <= bias : decpt <= digitCount + bias);
-            } else {
-                // X == decpt - 1, POSIX's P; -4 <= X < P iff -4 < decpt <= P
-                Q_ASSERT(precision >= 0);
-                useDecimal = decpt > -4 && decpt <= (precision ? precision : 1);
-            }
-
+            const bool useDecimal = useDecimalForm(decpt, length, precision, flags);
             numStr = useDecimal
                 ? decimalForm(std::move(digits), decpt, precision, mode,
                               mustMarkDecimal, groupDigits)
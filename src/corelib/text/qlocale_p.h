@@ -290,6 +290,10 @@ private:
                                                  int base, int width, unsigned flags) const;
 
 public:
+    static void doubleToDigits(QVarLengthArray<char> &buf, double d, int precision,
+                               DoubleForm form, bool &negative, int &length, int &decpt);
+    [[nodiscard]] bool useDecimalForm(int decpt, qsizetype digitCount, int precision,
+                                      unsigned flags) const;
     [[nodiscard]] QString doubleToString(double d,
                                          int precision = -1,
                                          DoubleForm form = DFSignificantDigits,
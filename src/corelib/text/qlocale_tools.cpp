@@ -25,6 +25,13 @@
 #    include <fenv.h>
 #endif
 
+// std::to_chars() and std::from_chars() for double are exact and fast (Ryu- and
+// fast_float-derived) in the implementations that advertise them, except in
+// libstdc++ before 12, where from_chars() goes through strtod() and uselocale().
+#if defined(__cpp_lib_to_chars) && (!defined(_GLIBCXX_RELEASE) || _GLIBCXX_RELEASE >= 12)
+#    define QT_HAS_FLOATING_POINT_CHARCONV
+#endif
+
 // Sizes as defined by the ISO C99 standard - fallback
 #ifndef LLONG_MAX
 #   define LLONG_MAX Q_INT64_C(0x7fffffffffffffff)
@@ -84,6 +91,42 @@ void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
     if (form == QLocaleData::DFSignificantDigits && precision == 0)
         precision = 1; // 0 significant digits is silently converted to 1
 
+#ifdef QT_HAS_FLOATING_POINT_CHARCONV
+    if (precision == QLocale::FloatingPointShortest) {
+        // Without a precision, std::to_chars() produces the shortest digit
+        // sequence that round-trips, like DoubleToAscii's SHORTEST mode, but
+        // considerably faster. The scientific form has exactly one digit before
+        // the '.', so the exponent gives us decpt.
+        sign = std::signbit(d);
+        if (isZero(d)) {
+#if defined(QT_NO_DOUBLECONVERSION) || defined(QT_BOOTSTRAPPED)
+            sign = false; // as the snprintf() code below reports it
+#endif
+            buf[0] = '0';
+            length = 1;
+            decpt = 1;
+            return;
+        }
+
+        char scientific[32]; // "1.2345678901234567e-308" is the longest we can get
+        const auto r = std::to_chars(scientific, scientific + sizeof scientific, qAbs(d),
+                                     std::chars_format::scientific);
+        Q_ASSERT(r.ec == std::errc{});
+        const char *p = scientific;
+        length = 0;
+        for (; *p != 'e'; ++p) {
+            if (*p != '.' && length < bufSize)
+                buf[length++] = *p;
+        }
+        const bool negativeExponent = p[1] == '-';
+        int exponent = 0;
+        for (p += 2; p != r.ptr; ++p)
+            exponent = exponent * 10 + (*p - '0');
+        decpt = (negativeExponent ? -exponent : exponent) + 1;
+        return; // shortest digits never end in '0'
+    }
+#endif // QT_HAS_FLOATING_POINT_CHARCONV
+
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
     // one digit before the decimal dot, counts as significant digit for DoubleToStringConverter
     if (form == QLocaleData::DFExponent && precision >= 0)
@@ -292,6 +335,24 @@ QSimpleParsedNumber<double> qt_asciiToDouble(const char *num, qsizetype numLen,
         }
     }
 
+#ifdef QT_HAS_FLOATING_POINT_CHARCONV
+    {
+        // Fast path for the common case: std::from_chars() rounds correctly,
+        // so whenever it consumes the whole input without overflow or
+        // underflow, its result is the one we would compute below. Everything
+        // else (stray characters, out-of-range values) takes the slow path,
+        // which decides how to report it. from_chars() doesn't accept a '+'.
+        const char *begin = num;
+        const char *const end = num + numLen;
+        if (*begin == '+' && numLen > 1 && begin[1] != '-' && begin[1] != '+')
+            ++begin;
+        double d;
+        const auto r = std::from_chars(begin, end, d);
+        if (r.ec == std::errc{} && r.ptr == end)
+            return { d, numLen };
+    }
+#endif // QT_HAS_FLOATING_POINT_CHARCONV
+
     double d = 0.0;
     int processed;
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
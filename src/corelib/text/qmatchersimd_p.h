@@ -0,0 +1,182 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMATCHERSIMD_P_H
+#define QMATCHERSIMD_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/private/qsimd_p.h>
+#include <QtCore/qalgorithms.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+#ifdef __SSE2__
+// Short needles are found faster by comparing the first and the last
+// character of the needle with a whole vector of positions of the haystack at
+// once, and only checking the middle of the needle at the positions where
+// both match (a "SIMD-friendly Rabin-Karp", with these two characters as the
+// hash). Longer needles make the skip table of Boyer-Moore more efficient.
+// QByteArrayMatcher uses these on bytes, QStringMatcher on 16-bit units.
+static constexpr qsizetype SimdFilterMaxNeedleLength = 32;
+
+// Checks the candidates whose bits are set in \a mask, BitsPerChar bits per
+// character, starting at \a i. Returns the position of the first match, or -1.
+template <uint BitsPerChar, typename Char>
+static inline qsizetype simd_checkCandidates(uint mask, qsizetype i, const Char *s,
+                                             const Char *puc, qsizetype pl)
+{
+    constexpr uint CharBits = (1u << BitsPerChar) - 1;
+    while (mask) {
+        const uint bit = qCountTrailingZeroBits(mask);
+        const qsizetype pos = i + bit / BitsPerChar;
+        if (pl <= 2 || memcmp(s + pos + 1, puc + 1, size_t(pl - 2) * sizeof(Char)) == 0)
+            return pos;
+        mask &= ~(CharBits << bit);
+    }
+    return -1;
+}
+
+// The simd_find_* functions return the position of the first match, or -1 if
+// there is none before \a index, which they update to the first position
+// that remains to be checked.
+template <typename Char>
+static qsizetype simd_find_sse2(const Char *s, qsizetype l, qsizetype &index,
+                                const Char *puc, qsizetype pl)
+{
+    static_assert(sizeof(Char) == 1 || sizeof(Char) == 2);
+    constexpr qsizetype Step = sizeof(__m128i) / sizeof(Char);
+    __m128i first, last;
+    if constexpr (sizeof(Char) == 1) {
+        first = _mm_set1_epi8(char(puc[0]));
+        last = _mm_set1_epi8(char(puc[pl - 1]));
+    } else {
+        first = _mm_set1_epi16(short(puc[0]));
+        last = _mm_set1_epi16(short(puc[pl - 1]));
+    }
+    qsizetype i = index;
+    for ( ; i + Step <= l - pl + 1; i += Step) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + pl - 1));
+        __m128i match;
+        if constexpr (sizeof(Char) == 1)
+            match = _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last));
+        else
+            match = _mm_and_si128(_mm_cmpeq_epi16(a, first), _mm_cmpeq_epi16(b, last));
+        const uint mask = _mm_movemask_epi8(match);
+        const qsizetype found = simd_checkCandidates<sizeof(Char)>(mask, i, s, puc, pl);
+        if (found >= 0)
+            return found;
+    }
+    index = i;
+    return -1;
+}
+
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+template <typename Char>
+static QT_FUNCTION_TARGET(AVX2)
+qsizetype simd_find_avx2(const Char *s, qsizetype l, qsizetype &index,
+                         const Char *puc, qsizetype pl)
+{
+    constexpr qsizetype Step = sizeof(__m256i) / sizeof(Char);
+    __m256i first, last;
+    if constexpr (sizeof(Char) == 1) {
+        first = _mm256_set1_epi8(char(puc[0]));
+        last = _mm256_set1_epi8(char(puc[pl - 1]));
+    } else {
+        first = _mm256_set1_epi16(short(puc[0]));
+        last = _mm256_set1_epi16(short(puc[pl - 1]));
+    }
+    qsizetype i = index;
+    for ( ; i + Step <= l - pl + 1; i += Step) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i + pl - 1));
+        __m256i match;
+        if constexpr (sizeof(Char) == 1)
+            match = _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last));
+        else
+            match = _mm256_and_si256(_mm256_cmpeq_epi16(a, first), _mm256_cmpeq_epi16(b, last));
+        const uint mask = uint(_mm256_movemask_epi8(match));
+        const qsizetype found = simd_checkCandidates<sizeof(Char)>(mask, i, s, puc, pl);
+        if (found >= 0)
+            return found;
+    }
+    index = i;
+    return -1;
+}
+#  endif
+
+#  if QT_COMPILER_SUPPORTS_HERE(AVX512VL) && QT_COMPILER_SUPPORTS_HERE(AVX512BW)
+// Uses 256-bit registers, which have no performance penalty (see qstring.cpp),
+// and masked loads to handle the end of the haystack too
+template <typename Char>
+static QT_FUNCTION_TARGET(ARCH_SKYLAKE_AVX512)
+qsizetype simd_find_avx512(const Char *s, qsizetype l, qsizetype &index,
+                           const Char *puc, qsizetype pl)
+{
+    constexpr qsizetype Step = sizeof(__m256i) / sizeof(Char);
+    constexpr uint AllLanes = ~0u >> (32 - Step);
+    __m256i first, last;
+    if constexpr (sizeof(Char) == 1) {
+        first = _mm256_set1_epi8(char(puc[0]));
+        last = _mm256_set1_epi8(char(puc[pl - 1]));
+    } else {
+        first = _mm256_set1_epi16(short(puc[0]));
+        last = _mm256_set1_epi16(short(puc[pl - 1]));
+    }
+    const qsizetype end = l - pl + 1;
+    for (qsizetype i = index; i < end; i += Step) {
+        const uint loadMask = i + Step <= end ? AllLanes : _bzhi_u32(AllLanes, uint(end - i));
+        uint mask;
+        if constexpr (sizeof(Char) == 1) {
+            const __m256i a = _mm256_maskz_loadu_epi8(__mmask32(loadMask), s + i);
+            const __m256i b = _mm256_maskz_loadu_epi8(__mmask32(loadMask), s + i + pl - 1);
+            mask = _mm256_mask_cmpeq_epi8_mask(
+                    _mm256_mask_cmpeq_epi8_mask(__mmask32(loadMask), a, first), b, last);
+        } else {
+            const __m256i a = _mm256_maskz_loadu_epi16(__mmask16(loadMask), s + i);
+            const __m256i b = _mm256_maskz_loadu_epi16(__mmask16(loadMask), s + i + pl - 1);
+            mask = _mm256_mask_cmpeq_epi16_mask(
+                    _mm256_mask_cmpeq_epi16_mask(__mmask16(loadMask), a, first), b, last);
+        }
+        // one bit per character
+        const qsizetype found = simd_checkCandidates<1>(mask, i, s, puc, pl);
+        if (found >= 0)
+            return found;
+    }
+    index = end;
+    return -1;
+}
+#  endif
+
+template <typename Char>
+static qsizetype simd_find(const Char *s, qsizetype l, qsizetype &index,
+                           const Char *puc, qsizetype pl)
+{
+#  if QT_COMPILER_SUPPORTS_HERE(AVX512VL) && QT_COMPILER_SUPPORTS_HERE(AVX512BW)
+    if (qCpuHasFeature(ArchSkylakeAvx512))
+        return simd_find_avx512(s, l, index, puc, pl);
+#  endif
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (qCpuHasFeature(AVX2))
+        return simd_find_avx2(s, l, index, puc, pl);
+#  endif
+    return simd_find_sse2(s, l, index, puc, pl);
+}
+#endif // __SSE2__
+
+QT_END_NAMESPACE
+
+#endif // QMATCHERSIMD_P_H
@@ -0,0 +1,785 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmultistringmatcher.h"
+
+#include <QtCore/qlatin1stringmatcher.h>
+
+#include <algorithm>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+// The matchers run an Aho-Corasick automaton: a trie of the patterns, in
+// which the missing transitions of each state are those of the longest
+// proper suffix of the state that is in the trie too. This makes it a
+// deterministic automaton, which reads each unit of the haystack once,
+// whatever the number of patterns.
+//
+// To keep its transition table small, the units are first mapped to
+// classes: all the units that appear in no pattern share class 0, and
+// the others each have their own. When searching case-insensitively, the
+// units that fold to the same unit share its class, so that the automaton
+// does not need to fold the haystack.
+
+// Maps bytes to classes
+class ByteClassMap
+{
+public:
+    using Unit = uchar;
+    static constexpr qsizetype UnitCount = 256;
+
+    void assign(const std::vector<quint16> &classes)
+    {
+        std::copy(classes.begin(), classes.end(), map);
+    }
+
+    quint16 operator()(uchar unit) const noexcept { return map[unit]; }
+
+private:
+    quint16 map[UnitCount] = {};
+};
+
+// Maps UTF-16 code units to classes, with a table for each 256 units
+// that appear in the patterns, and a shared one for the others
+class Utf16ClassMap
+{
+public:
+    using Unit = char16_t;
+    static constexpr qsizetype UnitCount = 0x10000;
+
+    void assign(const std::vector<quint16> &classes)
+    {
+        tables.assign(256, 0);      // the shared table, of class 0
+        for (qsizetype page = 0; page < 256; ++page) {
+            const auto first = classes.begin() + page * 256;
+            if (std::all_of(first, first + 256, [](quint16 c) { return c == 0; })) {
+                offsets[page] = 0;
+            } else {
+                offsets[page] = quint32(tables.size());
+                tables.append(QList<quint16>(first, first + 256));
+            }
+        }
+    }
+
+    quint16 operator()(char16_t unit) const noexcept
+    {
+        return tables.constData()[offsets[unit >> 8] + (unit & 0xff)];
+    }
+
+private:
+    quint32 offsets[256] = {};
+    QList<quint16> tables;
+};
+
+template <typename ClassMap>
+class Automaton
+{
+public:
+    using Unit = typename ClassMap::Unit;
+
+    // \a patterns must be already folded, and \a fold maps units to their
+    // folded counterparts, or is null for case-sensitive searches
+    void build(const QList<QList<Unit>> &patterns, Unit (*fold)(Unit));
+
+    // Returns the state after reading \a unit in \a state
+    qint32 next(qint32 state, Unit unit) const noexcept
+    {
+        return transitions.constData()[qsizetype(state) * classCount + classes(unit)];
+    }
+
+    bool hasMatches(qint32 state) const noexcept { return outputs.constData()[state] >= 0; }
+
+    // Calls \a onMatch for all the patterns that end at \a end, where the
+    // automaton reached \a state
+    template <typename OnMatch>
+    void forEachMatch(qint32 state, qsizetype end, OnMatch onMatch) const
+    {
+        for (qint32 s = outputs.at(state); s >= 0; s = dictionaryLinks.at(s)) {
+            for (qint32 p = firstPatterns.at(s); p >= 0; p = nextSamePatterns.at(p))
+                onMatch(QMultiStringMatcher::Match{ end - depths.at(s), depths.at(s), p });
+        }
+    }
+
+    qsizetype maximumPatternLength = 0;
+
+private:
+    ClassMap classes;
+    qsizetype classCount = 1;
+    QList<qint32> transitions;      // classCount for each state
+    QList<qint32> depths;           // for each state
+    QList<qint32> firstPatterns;    // for each state: a pattern ending there, or -1
+    QList<qint32> outputs;          // for each state: the state itself or its nearest
+                                    // suffix that has a pattern, or -1
+    QList<qint32> dictionaryLinks;  // for each state: its nearest proper suffix that
+                                    // has a pattern, or -1
+    QList<qint32> nextSamePatterns; // for each pattern: the next one that is the
+                                    // same string, or -1
+};
+
+template <typename ClassMap>
+void Automaton<ClassMap>::build(const QList<QList<Unit>> &patterns, Unit (*fold)(Unit))
+{
+    std::vector<quint16> unitClasses(ClassMap::UnitCount, 0);
+    classCount = 1;
+    for (const QList<Unit> &pattern : patterns) {
+        for (Unit unit : pattern) {
+            if (!unitClasses[unit])
+                unitClasses[unit] = quint16(classCount++);
+        }
+    }
+    if (fold) {
+        for (qsizetype unit = 0; unit < ClassMap::UnitCount; ++unit) {
+            const Unit folded = fold(Unit(unit));
+            if (folded != unit && unitClasses[folded])
+                unitClasses[unit] = unitClasses[folded];
+        }
+    }
+    classes.assign(unitClasses);
+
+    // the trie
+    const auto addState = [this](qint32 depth) {
+        transitions.resize(transitions.size() + classCount, -1);
+        depths.append(depth);
+        firstPatterns.append(-1);
+        return qint32(depths.size() - 1);
+    };
+    transitions.clear();
+    depths.clear();
+    firstPatterns.clear();
+    nextSamePatterns.fill(-1, patterns.size());
+    maximumPatternLength = 0;
+    addState(0);
+    for (qsizetype p = 0; p < patterns.size(); ++p) {
+        const QList<Unit> &pattern = patterns.at(p);
+        if (pattern.isEmpty())
+            continue;       // never matches
+        qint32 state = 0;
+        for (Unit unit : pattern) {
+            qint32 &target = transitions[qsizetype(state) * classCount + unitClasses[unit]];
+            if (target < 0) {
+                const qint32 child = addState(depths.at(state) + 1);
+                transitions[qsizetype(state) * classCount + unitClasses[unit]] = child;
+                state = child;
+            } else {
+                state = target;
+            }
+        }
+        // chain the duplicates after the first one
+        qint32 *last = &firstPatterns[state];
+        while (*last >= 0)
+            last = &nextSamePatterns[*last];
+        *last = qint32(p);
+        maximumPatternLength = qMax(maximumPatternLength, pattern.size());
+    }
+
+    // the failure links, in breadth-first order so that the states of the
+    // links are complete when they are used
+    const qsizetype stateCount = depths.size();
+    QList<qint32> failureLinks(stateCount, 0);
+    dictionaryLinks.fill(-1, stateCount);
+    outputs.fill(-1, stateCount);
+    QList<qint32> queue;
+    queue.reserve(stateCount);
+    for (qsizetype c = 0; c < classCount; ++c) {
+        qint32 &target = transitions[c];
+        if (target < 0)
+            target = 0;
+        else
+            queue.append(target);
+    }
+    for (qsizetype i = 0; i < queue.size(); ++i) {
+        const qint32 state = queue.at(i);
+        const qint32 failure = failureLinks.at(state);
+        dictionaryLinks[state] = firstPatterns.at(failure) >= 0
+                ? failure : dictionaryLinks.at(failure);
+        outputs[state] = firstPatterns.at(state) >= 0 ? state : dictionaryLinks.at(state);
+        for (qsizetype c = 0; c < classCount; ++c) {
+            qint32 &target = transitions[qsizetype(state) * classCount + c];
+            const qint32 fallback = transitions.at(qsizetype(failure) * classCount + c);
+            if (target < 0) {
+                target = fallback;
+            } else {
+                failureLinks[target] = fallback;
+                queue.append(target);
+            }
+        }
+    }
+}
+
+// Runs the automaton on [from, end) of the haystack, and returns the
+// position after the first unit that reaches a state with matches, or
+// \a end. The state is kept in \a state.
+template <typename ClassMap, typename UnitAt>
+qsizetype advance(const Automaton<ClassMap> &automaton, qint32 &state, qsizetype from,
+                  qsizetype end, UnitAt unitAt)
+{
+    for (qsizetype i = from; i < end; ++i) {
+        state = automaton.next(state, unitAt(i));
+        if (Q_UNLIKELY(automaton.hasMatches(state)))
+            return i + 1;
+    }
+    return end;
+}
+
+// Returns the leftmost match, the longest one if several start there
+template <typename ClassMap, typename UnitAt>
+QMultiStringMatcher::Match
+leftmostMatch(const Automaton<ClassMap> &automaton, qsizetype size, qsizetype from, UnitAt unitAt)
+{
+    QMultiStringMatcher::Match best;
+    qint32 state = 0;
+    qsizetype end = size;
+    qsizetype i = qMax(from, qsizetype(0));
+    while (i < end) {
+        i = advance(automaton, state, i, end, unitAt);
+        if (!automaton.hasMatches(state))
+            break;
+        automaton.forEachMatch(state, i, [&](const QMultiStringMatcher::Match &m) {
+            if (!best.isValid() || m.position < best.position
+                    || (m.position == best.position && m.length > best.length)) {
+                best = m;
+            }
+        });
+        // a match that starts earlier, or as early but is longer, must end
+        // within the longest pattern
+        end = qMin(size, best.position + automaton.maximumPatternLength);
+    }
+    return best;
+}
+
+template <typename ClassMap, typename UnitAt>
+QList<QMultiStringMatcher::Match>
+allMatches(const Automaton<ClassMap> &automaton, qsizetype size, qsizetype from, UnitAt unitAt)
+{
+    QList<QMultiStringMatcher::Match> result;
+    qint32 state = 0;
+    qsizetype i = qMax(from, qsizetype(0));
+    while (i < size) {
+        i = advance(automaton, state, i, size, unitAt);
+        if (automaton.hasMatches(state)) {
+            automaton.forEachMatch(state, i, [&result](const QMultiStringMatcher::Match &m) {
+                result.append(m);
+            });
+        }
+    }
+    return result;
+}
+
+// The classes take care of the case folding, except for the surrogate
+// pairs, which fold together
+char16_t foldUtf16(char16_t unit)
+{
+    if (QChar::isSurrogate(unit))
+        return unit;
+    const char32_t folded = QChar::toCaseFolded(char32_t(unit));
+    return QChar::requiresSurrogates(folded) ? unit : char16_t(folded);
+}
+
+char16_t foldedUtf16At(const char16_t *units, qsizetype size, qsizetype i)
+{
+    const char16_t unit = units[i];
+    if (QChar::isHighSurrogate(unit) && i + 1 < size && QChar::isLowSurrogate(units[i + 1])) {
+        const char32_t folded = QChar::toCaseFolded(QChar::surrogateToUcs4(unit, units[i + 1]));
+        return QChar::highSurrogate(folded);
+    }
+    if (QChar::isLowSurrogate(unit) && i > 0 && QChar::isHighSurrogate(units[i - 1])) {
+        const char32_t folded = QChar::toCaseFolded(QChar::surrogateToUcs4(units[i - 1], unit));
+        return QChar::lowSurrogate(folded);
+    }
+    return unit;
+}
+
+uchar foldLatin1(uchar unit)
+{
+    return uchar(QtPrivate::QCaseInsensitiveLatin1Hash()(char(unit)));
+}
+} // unnamed namespace
+
+class QMultiStringMatcherPrivate : public QSharedData
+{
+public:
+    QMultiStringMatcherPrivate(const QStringList &patterns, Qt::CaseSensitivity cs)
+        : patterns(patterns), cs(cs)
+    {
+        QList<QList<char16_t>> units;
+        units.reserve(patterns.size());
+        for (const QString &pattern : patterns) {
+            const QStringView view(pattern);
+            QList<char16_t> &folded = units.emplace_back(view.utf16(), view.utf16() + view.size());
+            if (cs == Qt::CaseInsensitive) {
+                for (qsizetype i = 0; i < folded.size(); ++i) {
+                    const char16_t unit = folded.at(i);
+                    folded[i] = QChar::isSurrogate(unit)
+                            ? foldedUtf16At(view.utf16(), view.size(), i) : foldUtf16(unit);
+                }
+            }
+        }
+        automaton.build(units, cs == Qt::CaseInsensitive ? foldUtf16 : nullptr);
+    }
+
+    template <typename Function>
+    auto run(QStringView haystack, qsizetype from, Function function) const
+    {
+        const char16_t *units = haystack.utf16();
+        const qsizetype size = haystack.size();
+        if (cs == Qt::CaseSensitive)
+            return function(automaton, size, from, [units](qsizetype i) { return units[i]; });
+        return function(automaton, size, from, [units, size](qsizetype i) {
+            const char16_t unit = units[i];
+            return Q_UNLIKELY(QChar::isSurrogate(unit)) ? foldedUtf16At(units, size, i) : unit;
+        });
+    }
+
+    QStringList patterns;
+    Qt::CaseSensitivity cs;
+    Automaton<Utf16ClassMap> automaton;
+};
+
+class QMultiByteArrayMatcherPrivate : public QSharedData
+{
+public:
+    QMultiByteArrayMatcherPrivate(const QByteArrayList &patterns, Qt::CaseSensitivity cs)
+        : patterns(patterns)
+    {
+        QList<QList<uchar>> units;
+        units.reserve(patterns.size());
+        for (const QByteArray &pattern : patterns) {
+            QList<uchar> &folded = units.emplace_back(pattern.begin(), pattern.end());
+            if (cs == Qt::CaseInsensitive)
+                std::transform(folded.begin(), folded.end(), folded.begin(), foldLatin1);
+        }
+        automaton.build(units, cs == Qt::CaseInsensitive ? foldLatin1 : nullptr);
+    }
+
+    template <typename Function>
+    auto run(QByteArrayView haystack, qsizetype from, Function function) const
+    {
+        const uchar *units = reinterpret_cast<const uchar *>(haystack.data());
+        return function(automaton, haystack.size(), from,
+                        [units](qsizetype i) { return units[i]; });
+    }
+
+    QByteArrayList patterns;
+    Automaton<ByteClassMap> automaton;
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QMultiStringMatcherPrivate)
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QMultiByteArrayMatcherPrivate)
+
+/*!
+    \class QMultiStringMatcher
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMultiStringMatcher class finds many strings at once in
+    Unicode strings.
+
+    \ingroup tools
+    \ingroup string-processing
+
+    QMultiStringMatcher searches a string for any of a set of literal
+    patterns, for instance a list of keywords. It reads each character of
+    the searched string only once, however many patterns there are, using
+    the Aho-Corasick algorithm. This is much faster than searching for each
+    pattern with QStringMatcher, or with a QRegularExpression that
+    alternates between the patterns, when there are more than a few
+    patterns.
+
+    Creating the matcher prepares the search, which takes time and memory
+    proportional to the total length of the patterns multiplied by the
+    number of distinct characters in them; the matcher should therefore be
+    reused for all the strings to search.
+
+    \snippet code/src_corelib_text_qmultistringmatcher.cpp 0
+
+    match() returns the leftmost match in a string, and matchAll() returns
+    all the matches, including the ones that overlap. When searching
+    case-insensitively, the characters are compared after case folding,
+    like QStringMatcher does; the matches are then as long as the patterns.
+
+    Empty patterns never match.
+
+    QMultiStringMatcher is \l{implicitly shared}.
+
+    \sa QMultiByteArrayMatcher, QStringMatcher
+*/
+
+/*!
+    \class QMultiStringMatcher::Match
+    \inmodule QtCore
+    \since 6.9
+    \brief The Match struct describes where a QMultiStringMatcher or a
+    QMultiByteArrayMatcher found a pattern.
+
+    \compares equality
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::position
+
+    The position of the match in the searched string, or -1 for a
+    default-constructed Match, which means that nothing was found.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::length
+
+    The length of the match, which is the length of the pattern.
+*/
+
+/*!
+    \variable QMultiStringMatcher::Match::patternIndex
+
+    The index of the pattern that matched in the list of patterns of the
+    matcher.
+*/
+
+/*!
+    \fn bool QMultiStringMatcher::Match::isValid() const
+
+    Returns \c true if this object describes a match, that is if its
+    position is not negative; otherwise returns \c false.
+*/
+
+/*!
+    \fn bool QMultiStringMatcher::Match::operator==(const QMultiStringMatcher::Match &lhs, const QMultiStringMatcher::Match &rhs)
+    \fn bool QMultiStringMatcher::Match::operator!=(const QMultiStringMatcher::Match &lhs, const QMultiStringMatcher::Match &rhs)
+
+    Returns whether \a lhs and \a rhs have the same position, length and
+    pattern index.
+*/
+
+/*!
+    Constructs a matcher without patterns, which finds nothing.
+*/
+QMultiStringMatcher::QMultiStringMatcher() noexcept
+    = default;
+
+/*!
+    Constructs a matcher that searches for \a patterns, with the case
+    sensitivity \a cs.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QStringList &patterns, Qt::CaseSensitivity cs)
+    : d(new QMultiStringMatcherPrivate(patterns, cs)), m_cs(cs)
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QMultiStringMatcher::QMultiStringMatcher(const QMultiStringMatcher &other) noexcept
+    = default;
+
+/*!
+    \fn QMultiStringMatcher::QMultiStringMatcher(QMultiStringMatcher &&other)
+
+    Move-constructs a matcher from \a other.
+*/
+
+/*!
+    \fn QMultiStringMatcher &QMultiStringMatcher::operator=(QMultiStringMatcher &&other)
+
+    Move-assigns \a other to this matcher.
+*/
+
+/*!
+    Assigns \a other to this matcher, and returns a reference to this
+    matcher.
+*/
+QMultiStringMatcher &QMultiStringMatcher::operator=(const QMultiStringMatcher &other) noexcept
+    = default;
+
+/*!
+    Destroys the matcher.
+*/
+QMultiStringMatcher::~QMultiStringMatcher()
+    = default;
+
+/*!
+    \fn void QMultiStringMatcher::swap(QMultiStringMatcher &other)
+    \memberswap{matcher}
+*/
+
+/*!
+    Makes this matcher search for \a patterns.
+
+    \sa patterns()
+*/
+void QMultiStringMatcher::setPatterns(const QStringList &patterns)
+{
+    d = new QMultiStringMatcherPrivate(patterns, m_cs);
+}
+
+/*!
+    Returns the patterns that this matcher searches for.
+
+    \sa setPatterns()
+*/
+QStringList QMultiStringMatcher::patterns() const
+{
+    return d ? d->patterns : QStringList();
+}
+
+/*!
+    Sets the case sensitivity of the search to \a cs.
+
+    \sa caseSensitivity()
+*/
+void QMultiStringMatcher::setCaseSensitivity(Qt::CaseSensitivity cs)
+{
+    if (cs == m_cs)
+        return;
+    m_cs = cs;
+    if (d)
+        d = new QMultiStringMatcherPrivate(d->patterns, cs);
+}
+
+/*!
+    \fn Qt::CaseSensitivity QMultiStringMatcher::caseSensitivity() const
+
+    Returns the case sensitivity of the search.
+
+    \sa setCaseSensitivity()
+*/
+
+/*!
+    Returns the position of the first match of any of the patterns in
+    \a haystack, starting from the position \a from, or -1 if none of
+    them was found.
+
+    \sa match()
+*/
+qsizetype QMultiStringMatcher::indexIn(QStringView haystack, qsizetype from) const noexcept
+{
+    return match(haystack, from).position;
+}
+
+/*!
+    Returns the first match of any of the patterns in \a haystack, starting
+    from the position \a from. If several patterns match at that position,
+    the longest one is returned, or the first one in the list of patterns if
+    they have the same length. If none of the patterns was found, the
+    returned match is not valid.
+
+    \sa matchAll(), indexIn()
+*/
+QMultiStringMatcher::Match
+QMultiStringMatcher::match(QStringView haystack, qsizetype from) const noexcept
+{
+    if (!d)
+        return {};
+    return d->run(haystack, from, [](const auto &...args) { return leftmostMatch(args...); });
+}
+
+/*!
+    Returns all the matches of all the patterns in \a haystack, starting from
+    the position \a from, including the ones that overlap. The matches are
+    sorted by their end: for each position, the longest patterns ending
+    there come first, and patterns that are the same string come in the
+    order of the list of patterns.
+
+    \sa match()
+*/
+QList<QMultiStringMatcher::Match>
+QMultiStringMatcher::matchAll(QStringView haystack, qsizetype from) const
+{
+    if (!d)
+        return {};
+    return d->run(haystack, from, [](const auto &...args) { return allMatches(args...); });
+}
+
+/*!
+    \class QMultiByteArrayMatcher
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMultiByteArrayMatcher class finds many byte sequences at
+    once in byte arrays.
+
+    \ingroup tools
+    \ingroup string-processing
+
+    QMultiByteArrayMatcher is the counterpart of QMultiStringMatcher for
+    byte arrays and Latin-1 strings. It searches them for any of a set of
+    patterns, reading each byte only once, however many patterns there
+    are.
+
+    \snippet code/src_corelib_text_qmultistringmatcher.cpp 1
+
+    When searching case-insensitively, the bytes are compared as Latin-1
+    characters, like QLatin1StringMatcher does.
+
+    Empty patterns never match.
+
+    QMultiByteArrayMatcher is \l{implicitly shared}.
+
+    \sa QMultiStringMatcher, QByteArrayMatcher
+*/
+
+/*!
+    \typedef QMultiByteArrayMatcher::Match
+
+    A synonym for QMultiStringMatcher::Match.
+*/
+
+/*!
+    Constructs a matcher without patterns, which finds nothing.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher() noexcept
+    = default;
+
+/*!
+    Constructs a matcher that searches for \a patterns, with the case
+    sensitivity \a cs.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QByteArrayList &patterns,
+                                               Qt::CaseSensitivity cs)
+    : d(new QMultiByteArrayMatcherPrivate(patterns, cs)), m_cs(cs)
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QMultiByteArrayMatcher::QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other) noexcept
+    = default;
+
+/*!
+    \fn QMultiByteArrayMatcher::QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other)
+
+    Move-constructs a matcher from \a other.
+*/
+
+/*!
+    \fn QMultiByteArrayMatcher &QMultiByteArrayMatcher::operator=(QMultiByteArrayMatcher &&other)
+
+    Move-assigns \a other to this matcher.
+*/
+
+/*!
+    Assigns \a other to this matcher, and returns a reference to this
+    matcher.
+*/
+QMultiByteArrayMatcher &
+QMultiByteArrayMatcher::operator=(const QMultiByteArrayMatcher &other) noexcept
+    = default;
+
+/*!
+    Destroys the matcher.
+*/
+QMultiByteArrayMatcher::~QMultiByteArrayMatcher()
+    = default;
+
+/*!
+    \fn void QMultiByteArrayMatcher::swap(QMultiByteArrayMatcher &other)
+    \memberswap{matcher}
+*/
+
+/*!
+    Makes this matcher search for \a patterns.
+
+    \sa patterns()
+*/
+void QMultiByteArrayMatcher::setPatterns(const QByteArrayList &patterns)
+{
+    d = new QMultiByteArrayMatcherPrivate(patterns, m_cs);
+}
+
+/*!
+    Returns the patterns that this matcher searches for.
+
+    \sa setPatterns()
+*/
+QByteArrayList QMultiByteArrayMatcher::patterns() const
+{
+    return d ? d->patterns : QByteArrayList();
+}
+
+/*!
+    Sets the case sensitivity of the search to \a cs.
+
+    \sa caseSensitivity()
+*/
+void QMultiByteArrayMatcher::setCaseSensitivity(Qt::CaseSensitivity cs)
+{
+    if (cs == m_cs)
+        return;
+    m_cs = cs;
+    if (d)
+        d = new QMultiByteArrayMatcherPrivate(d->patterns, cs);
+}
+
+/*!
+    \fn Qt::CaseSensitivity QMultiByteArrayMatcher::caseSensitivity() const
+
+    Returns the case sensitivity of the search.
+
+    \sa setCaseSensitivity()
+*/
+
+/*!
+    \fn qsizetype QMultiByteArrayMatcher::indexIn(QLatin1StringView haystack, qsizetype from) const
+    \overload
+
+    Returns the position of the first match of any of the patterns in
+    \a haystack, starting from the position \a from, or -1 if none of
+    them was found.
+*/
+
+/*!
+    Returns the position of the first match of any of the patterns in
+    \a haystack, starting from the position \a from, or -1 if none of
+    them was found.
+
+    \sa match()
+*/
+qsizetype QMultiByteArrayMatcher::indexIn(QByteArrayView haystack, qsizetype from) const noexcept
+{
+    return match(haystack, from).position;
+}
+
+/*!
+    \fn QMultiByteArrayMatcher::Match QMultiByteArrayMatcher::match(QLatin1StringView haystack, qsizetype from) const
+    \overload
+*/
+
+/*!
+    Returns the first match of any of the patterns in \a haystack, starting
+    from the position \a from. If several patterns match at that position,
+    the longest one is returned, or the first one in the list of patterns if
+    they have the same length. If none of the patterns was found, the
+    returned match is not valid.
+
+    \sa matchAll(), indexIn()
+*/
+QMultiByteArrayMatcher::Match
+QMultiByteArrayMatcher::match(QByteArrayView haystack, qsizetype from) const noexcept
+{
+    if (!d)
+        return {};
+    return d->run(haystack, from, [](const auto &...args) { return leftmostMatch(args...); });
+}
+
+/*!
+    \fn QList<QMultiByteArrayMatcher::Match> QMultiByteArrayMatcher::matchAll(QLatin1StringView haystack, qsizetype from) const
+    \overload
+*/
+
+/*!
+    Returns all the matches of all the patterns in \a haystack, starting from
+    the position \a from, including the ones that overlap. The matches are
+    sorted by their end: for each position, the longest patterns ending
+    there come first, and patterns that are the same string come in the
+    order of the list of patterns.
+
+    \sa match()
+*/
+QList<QMultiByteArrayMatcher::Match>
+QMultiByteArrayMatcher::matchAll(QByteArrayView haystack, qsizetype from) const
+{
+    if (!d)
+        return {};
+    return d->run(haystack, from, [](const auto &...args) { return allMatches(args...); });
+}
+
+QT_END_NAMESPACE
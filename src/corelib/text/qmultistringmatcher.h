@@ -0,0 +1,116 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMULTISTRINGMATCHER_H
+#define QMULTISTRINGMATCHER_H
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearraylist.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+QT_BEGIN_NAMESPACE
+
+class QMultiStringMatcherPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QMultiStringMatcherPrivate, Q_CORE_EXPORT)
+class QMultiByteArrayMatcherPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QMultiByteArrayMatcherPrivate, Q_CORE_EXPORT)
+
+class QMultiStringMatcher
+{
+public:
+    struct Match
+    {
+        qsizetype position = -1;
+        qsizetype length = 0;
+        qsizetype patternIndex = -1;
+
+        constexpr bool isValid() const noexcept { return position >= 0; }
+
+    private:
+        friend constexpr bool comparesEqual(const Match &lhs, const Match &rhs) noexcept
+        {
+            return lhs.position == rhs.position && lhs.length == rhs.length
+                    && lhs.patternIndex == rhs.patternIndex;
+        }
+        Q_DECLARE_EQUALITY_COMPARABLE_LITERAL_TYPE(Match)
+    };
+
+    Q_CORE_EXPORT QMultiStringMatcher() noexcept;
+    Q_CORE_EXPORT explicit QMultiStringMatcher(const QStringList &patterns,
+                                               Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    Q_CORE_EXPORT QMultiStringMatcher(const QMultiStringMatcher &other) noexcept;
+    QMultiStringMatcher(QMultiStringMatcher &&other) noexcept = default;
+    Q_CORE_EXPORT QMultiStringMatcher &operator=(const QMultiStringMatcher &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QMultiStringMatcher)
+    Q_CORE_EXPORT ~QMultiStringMatcher();
+
+    void swap(QMultiStringMatcher &other) noexcept
+    {
+        d.swap(other.d);
+        std::swap(m_cs, other.m_cs);
+    }
+
+    Q_CORE_EXPORT void setPatterns(const QStringList &patterns);
+    Q_CORE_EXPORT QStringList patterns() const;
+    Q_CORE_EXPORT void setCaseSensitivity(Qt::CaseSensitivity cs);
+    Qt::CaseSensitivity caseSensitivity() const noexcept { return m_cs; }
+
+    Q_CORE_EXPORT qsizetype indexIn(QStringView haystack, qsizetype from = 0) const noexcept;
+    Q_CORE_EXPORT Match match(QStringView haystack, qsizetype from = 0) const noexcept;
+    Q_CORE_EXPORT QList<Match> matchAll(QStringView haystack, qsizetype from = 0) const;
+
+private:
+    QExplicitlySharedDataPointer<QMultiStringMatcherPrivate> d;
+    Qt::CaseSensitivity m_cs = Qt::CaseSensitive;
+};
+
+Q_DECLARE_SHARED(QMultiStringMatcher)
+
+class QMultiByteArrayMatcher
+{
+public:
+    using Match = QMultiStringMatcher::Match;
+
+    Q_CORE_EXPORT QMultiByteArrayMatcher() noexcept;
+    Q_CORE_EXPORT explicit QMultiByteArrayMatcher(const QByteArrayList &patterns,
+                                                  Qt::CaseSensitivity cs = Qt::CaseSensitive);
+    Q_CORE_EXPORT QMultiByteArrayMatcher(const QMultiByteArrayMatcher &other) noexcept;
+    QMultiByteArrayMatcher(QMultiByteArrayMatcher &&other) noexcept = default;
+    Q_CORE_EXPORT QMultiByteArrayMatcher &operator=(const QMultiByteArrayMatcher &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QMultiByteArrayMatcher)
+    Q_CORE_EXPORT ~QMultiByteArrayMatcher();
+
+    void swap(QMultiByteArrayMatcher &other) noexcept
+    {
+        d.swap(other.d);
+        std::swap(m_cs, other.m_cs);
+    }
+
+    Q_CORE_EXPORT void setPatterns(const QByteArrayList &patterns);
+    Q_CORE_EXPORT QByteArrayList patterns() const;
+    Q_CORE_EXPORT void setCaseSensitivity(Qt::CaseSensitivity cs);
+    Qt::CaseSensitivity caseSensitivity() const noexcept { return m_cs; }
+
+    Q_CORE_EXPORT qsizetype indexIn(QByteArrayView haystack, qsizetype from = 0) const noexcept;
+    qsizetype indexIn(QLatin1StringView haystack, qsizetype from = 0) const noexcept
+    { return indexIn(QByteArrayView(haystack.data(), haystack.size()), from); }
+    Q_CORE_EXPORT Match match(QByteArrayView haystack, qsizetype from = 0) const noexcept;
+    Match match(QLatin1StringView haystack, qsizetype from = 0) const noexcept
+    { return match(QByteArrayView(haystack.data(), haystack.size()), from); }
+    Q_CORE_EXPORT QList<Match> matchAll(QByteArrayView haystack, qsizetype from = 0) const;
+    QList<Match> matchAll(QLatin1StringView haystack, qsizetype from = 0) const
+    { return matchAll(QByteArrayView(haystack.data(), haystack.size()), from); }
+
+private:
+    QExplicitlySharedDataPointer<QMultiByteArrayMatcherPrivate> d;
+    Qt::CaseSensitivity m_cs = Qt::CaseSensitive;
+};
+
+Q_DECLARE_SHARED(QMultiByteArrayMatcher)
+
+QT_END_NAMESPACE
+
+#endif // QMULTISTRINGMATCHER_H
@@ -0,0 +1,816 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qnumberformatter.h"
+
+#include "qlocale_p.h"
+#include "qlocale_tools_p.h"
+
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qtools_p.h>
+
+#include <array>
+#include <charconv>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+
+/*
+    The numbers are first laid out as in the C locale, in a small buffer of
+    ASCII characters, and then translated to the locale's symbols while being
+    appended to the output. The characters of the layout are the markers
+    below; anything else (the letters of "inf" and "nan") is copied as is.
+    This keeps all the decisions about the shape of the number, which follow
+    QLocaleData::doubleToString() and friends, away from the output encoding.
+*/
+class QNumberFormatterPrivate : public QSharedData
+{
+public:
+    enum Symbol { Decimal = 10, Group, Minus, Plus, Exponent, SymbolCount };
+
+    struct Symbols
+    {
+        std::array<QString, SymbolCount> utf16;
+        std::array<QByteArray, SymbolCount> utf8;
+        bool plain = false; // every symbol is its own marker
+    };
+
+    using Layout = QVarLengthArray<char, 128>;
+
+    explicit QNumberFormatterPrivate(const QLocale &locale);
+
+    void setDoubleFormat(char format, int precision);
+
+    void layoutInteger(Layout &layout, qulonglong magnitude, bool negative) const;
+    bool layoutDouble(Layout &layout, double d) const;
+    template <typename String>
+    void appendInteger(String &str, qulonglong magnitude, bool negative) const;
+    template <typename String>
+    void appendDouble(String &str, double d) const;
+
+    QLocale locale;
+    const QLocaleData *data;
+    Symbols symbols;
+    Symbols upperSymbols; // for 'E', 'F' and 'G'
+    int zeroWidth = 1;
+    bool groupDigits = true;
+    bool zeroPadExponent = true;
+    bool addTrailingZeroes = false;
+
+    char format = 'g';
+    int precision = 6;
+    QLocaleData::DoubleForm form = QLocaleData::DFSignificantDigits;
+    bool capital = false;
+
+private:
+    enum PrecisionMode { PMDecimalDigits, PMSignificantDigits, PMChopTrailingZeros };
+
+    void appendGrouped(Layout &layout, const char *digits, qsizetype count) const;
+    void decimalForm(Layout &layout, const char *digits, qsizetype length, int decpt,
+                     int precision, PrecisionMode pm) const;
+    void exponentForm(Layout &layout, const char *digits, qsizetype length, int decpt,
+                      int precision, PrecisionMode pm) const;
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QNumberFormatterPrivate)
+
+static int symbolIndex(char c)
+{
+    if (isAsciiDigit(c))
+        return c - '0';
+    switch (c) {
+    case '.':
+        return QNumberFormatterPrivate::Decimal;
+    case ',':
+        return QNumberFormatterPrivate::Group;
+    case '-':
+        return QNumberFormatterPrivate::Minus;
+    case '+':
+        return QNumberFormatterPrivate::Plus;
+    case 'e':
+    case 'E':
+        return QNumberFormatterPrivate::Exponent;
+    }
+    return -1;
+}
+
+static void setSymbols(QNumberFormatterPrivate::Symbols &symbols,
+                       std::array<QString, QNumberFormatterPrivate::SymbolCount> &&utf16,
+                       char exponentMarker)
+{
+    static constexpr char markers[] = "0123456789.,-+";
+    symbols.utf16 = std::move(utf16);
+    symbols.plain = true;
+    for (int i = 0; i < QNumberFormatterPrivate::SymbolCount; ++i) {
+        symbols.utf8[i] = symbols.utf16[i].toUtf8();
+        const char marker = i == QNumberFormatterPrivate::Exponent ? exponentMarker : markers[i];
+        if (symbols.utf8[i].size() != 1 || symbols.utf8[i].front() != marker)
+            symbols.plain = false;
+    }
+}
+
+QNumberFormatterPrivate::QNumberFormatterPrivate(const QLocale &locale)
+    : locale(locale), data(QLocalePrivate::get(locale)->m_data)
+{
+    const QLocale::NumberOptions options = locale.numberOptions();
+    groupDigits = !(options & QLocale::OmitGroupSeparator);
+    zeroPadExponent = !(options & QLocale::OmitLeadingZeroInExponent);
+    addTrailingZeroes = options.testFlag(QLocale::IncludeTrailingZeroesAfterDot);
+
+    // These may query the system locale, which is what we want to do only once.
+    std::array<QString, SymbolCount> utf16;
+    const QString zero = data->zeroDigit();
+    zeroWidth = int(zero.size());
+    if (zero == u"0") {
+        for (char16_t digit = 0; digit < 10; ++digit)
+            utf16[digit] = QChar(u'0' + digit);
+    } else {
+        Q_ASSERT(zeroWidth == 1 || (zeroWidth == 2 && zero.at(0).isHighSurrogate()));
+        const char32_t zeroUcs4 = zeroWidth == 1
+                ? char32_t(zero.at(0).unicode())
+                : QChar::surrogateToUcs4(zero.at(0), zero.at(1));
+        for (uint digit = 0; digit < 10; ++digit)
+            utf16[digit] = QStringView(QChar::fromUcs4(unicodeForDigit(digit, zeroUcs4))).toString();
+    }
+    utf16[Decimal] = data->decimalPoint();
+    utf16[Group] = data->groupSeparator();
+    utf16[Minus] = data->negativeSign();
+    utf16[Plus] = data->positiveSign();
+    utf16[Exponent] = data->exponentSeparator();
+
+    // QLocale::toString() upper-cases everything but the leading sign for the
+    // capital formats.
+    std::array<QString, SymbolCount> upper;
+    for (int i = 0; i < SymbolCount; ++i)
+        upper[i] = utf16[i].toUpper();
+    setSymbols(upperSymbols, std::move(upper), 'E');
+    setSymbols(symbols, std::move(utf16), 'e');
+}
+
+void QNumberFormatterPrivate::setDoubleFormat(char format, int precision)
+{
+    this->format = format;
+    this->precision = precision;
+    capital = isAsciiUpper(format);
+    switch (toAsciiLower(format)) {
+    case 'e':
+        form = QLocaleData::DFExponent;
+        break;
+    case 'g':
+        form = QLocaleData::DFSignificantDigits;
+        break;
+    default: // like QLocale::toString()
+        form = QLocaleData::DFDecimal;
+        break;
+    }
+}
+
+// Appends the first count digits, with separators where
+// QLocaleData::applyIntegerFormatting() and decimalForm() put them.
+void QNumberFormatterPrivate::appendGrouped(Layout &layout, const char *digits,
+                                            qsizetype count) const
+{
+    qsizetype first = -1;
+    if (groupDigits && count - data->m_grouping_least >= data->m_grouping_top)
+        first = count - data->m_grouping_least;
+    for (qsizetype i = 0; i < count; ++i) {
+        if (i == first || (i > 0 && i < first && (first - i) % data->m_grouping_higher == 0))
+            layout.append(',');
+        layout.append(digits[i]);
+    }
+}
+
+void QNumberFormatterPrivate::layoutInteger(Layout &layout, qulonglong magnitude,
+                                            bool negative) const
+{
+    char digits[std::numeric_limits<qulonglong>::digits10 + 1];
+    const auto r = std::to_chars(digits, digits + sizeof digits, magnitude);
+    Q_ASSERT(r.ec == std::errc{});
+    if (negative)
+        layout.append('-');
+    appendGrouped(layout, digits, r.ptr - digits);
+}
+
+void QNumberFormatterPrivate::decimalForm(Layout &layout, const char *digits, qsizetype length,
+                                          int decpt, int precision, PrecisionMode pm) const
+{
+    // Pad with zeros so that the separator goes at index decpt:
+    QVarLengthArray<char, 128> padded;
+    for (; decpt < 0; ++decpt)
+        padded.append('0');
+    padded.append(digits, length);
+    while (padded.size() < decpt)
+        padded.append('0');
+
+    switch (pm) {
+    case PMDecimalDigits:
+        while (padded.size() - decpt < precision)
+            padded.append('0');
+        break;
+    case PMSignificantDigits:
+        while (padded.size() < precision)
+            padded.append('0');
+        break;
+    case PMChopTrailingZeros:
+        break;
+    }
+
+    if (decpt == 0)
+        layout.append('0');
+    appendGrouped(layout, padded.data(), decpt);
+    if (decpt < padded.size()) {
+        layout.append('.');
+        layout.append(padded.data() + decpt, padded.size() - decpt);
+    }
+}
+
+void QNumberFormatterPrivate::exponentForm(Layout &layout, const char *digits, qsizetype length,
+                                           int decpt, int precision, PrecisionMode pm) const
+{
+    qsizetype padding = 0;
+    switch (pm) {
+    case PMDecimalDigits:
+        padding = precision + 1 - length;
+        break;
+    case PMSignificantDigits:
+        padding = precision - length;
+        break;
+    case PMChopTrailingZeros:
+        break;
+    }
+
+    layout.append(digits[0]);
+    if (length + qMax(padding, 0) > 1) {
+        layout.append('.');
+        layout.append(digits + 1, length - 1);
+        for (; padding > 0; --padding)
+            layout.append('0');
+    }
+
+    layout.append(capital ? 'E' : 'e');
+    const int exponent = decpt - 1;
+    layout.append(exponent < 0 ? '-' : '+');
+    // As longLongToString() pads it, which counts UTF-16 code units:
+    const int minExponentDigits = zeroPadExponent ? 2 : 1;
+    if (exponent == 0) {
+        for (int i = 0; i < minExponentDigits; ++i)
+            layout.append('0');
+    } else {
+        char expDigits[8];
+        const auto r = std::to_chars(expDigits, expDigits + sizeof expDigits, qAbs(exponent));
+        const qsizetype count = r.ptr - expDigits;
+        for (qsizetype i = count * zeroWidth; i < minExponentDigits; ++i)
+            layout.append('0');
+        layout.append(expDigits, count);
+    }
+}
+
+// Lays out d as QLocaleData::doubleToString() does, except for the sign, and
+// returns whether it needs a minus sign.
+bool QNumberFormatterPrivate::layoutDouble(Layout &layout, double d) const
+{
+    int precision = this->precision;
+    if (precision != QLocale::FloatingPointShortest && precision < 0)
+        precision = 6;
+
+    QVarLengthArray<char> digits;
+    bool negative;
+    int length;
+    int decpt;
+    QLocaleData::doubleToDigits(digits, d, precision, form, negative, length, decpt);
+
+    if (!qt_is_finite(d)) {
+        const char *text = qt_is_nan(d) ? (capital ? "NAN" : "nan") : (capital ? "INF" : "inf");
+        layout.append(text, 3);
+        return negative;
+    }
+
+    switch (form) {
+    case QLocaleData::DFExponent:
+        exponentForm(layout, digits.data(), length, decpt, precision, PMDecimalDigits);
+        break;
+    case QLocaleData::DFDecimal:
+        decimalForm(layout, digits.data(), length, decpt, precision, PMDecimalDigits);
+        break;
+    case QLocaleData::DFSignificantDigits: {
+        const PrecisionMode mode = addTrailingZeroes ? PMSignificantDigits : PMChopTrailingZeros;
+        const unsigned flags = (groupDigits ? QLocaleData::GroupDigits : 0)
+                | (zeroPadExponent ? QLocaleData::ZeroPadExponent : 0);
+        if (data->useDecimalForm(decpt, length, precision, flags))
+            decimalForm(layout, digits.data(), length, decpt, precision, mode);
+        else
+            exponentForm(layout, digits.data(), length, decpt, precision, mode);
+        break;
+    }
+    }
+    return negative && !isZero(d);
+}
+
+static void appendSymbols(QString &str, QByteArrayView layout,
+                          const QNumberFormatterPrivate::Symbols &symbols)
+{
+    if (symbols.plain) {
+        str.append(QLatin1StringView(layout));
+        return;
+    }
+    QVarLengthArray<char16_t, 256> buffer;
+    for (char c : layout) {
+        if (const int i = symbolIndex(c); i >= 0) {
+            const QString &symbol = symbols.utf16[i];
+            buffer.append(reinterpret_cast<const char16_t *>(symbol.constData()), symbol.size());
+        } else {
+            buffer.append(uchar(c));
+        }
+    }
+    str.append(QStringView(buffer.constData(), buffer.size()));
+}
+
+static void appendSymbols(QByteArray &utf8, QByteArrayView layout,
+                          const QNumberFormatterPrivate::Symbols &symbols)
+{
+    if (symbols.plain) {
+        utf8.append(layout);
+        return;
+    }
+    QVarLengthArray<char, 256> buffer;
+    for (char c : layout) {
+        if (const int i = symbolIndex(c); i >= 0)
+            buffer.append(symbols.utf8[i].constData(), symbols.utf8[i].size());
+        else
+            buffer.append(c);
+    }
+    utf8.append(buffer.constData(), buffer.size());
+}
+
+template <typename String>
+void QNumberFormatterPrivate::appendInteger(String &str, qulonglong magnitude,
+                                            bool negative) const
+{
+    Layout layout;
+    layoutInteger(layout, magnitude, negative);
+    appendSymbols(str, layout, symbols);
+}
+
+template <typename String>
+void QNumberFormatterPrivate::appendDouble(String &str, double d) const
+{
+    Layout layout;
+    if (layoutDouble(layout, d))
+        appendSymbols(str, "-", symbols);
+    appendSymbols(str, layout, capital ? upperSymbols : symbols);
+}
+
+static qulonglong magnitude(qlonglong i)
+{
+    // Negating the minimum hits undefined behavior, so take a slight detour:
+    return i < 0 ? 1u + qulonglong(-(i + 1)) : qulonglong(i);
+}
+
+template <typename String, typename T>
+static void appendAll(const QNumberFormatterPrivate *d, String &str, QSpan<const T> values,
+                      QAnyStringView separator)
+{
+    String sep;
+    if constexpr (std::is_same_v<String, QString>)
+        sep = separator.toString();
+    else
+        sep = separator.toString().toUtf8();
+
+    bool first = true;
+    for (T value : values) {
+        if (!first)
+            str.append(sep);
+        first = false;
+        if constexpr (std::is_same_v<T, double>)
+            d->appendDouble(str, value);
+        else
+            d->appendInteger(str, magnitude(value), value < 0);
+    }
+}
+
+/*!
+    \class QNumberFormatter
+    \inmodule QtCore
+    \since 6.9
+    \brief The QNumberFormatter class formats many numbers according to a
+    locale.
+
+    \ingroup i18n
+    \ingroup string-processing
+    \ingroup shared
+    \reentrant
+
+    QNumberFormatter produces the same text as QLocale::toString() does for
+    numbers, but is meant for formatting many of them, for instance a column
+    of a table being exported. It looks up the locale's digits, separators
+    and signs once, when it is created, where QLocale::toString() does so
+    for every number, and it appends the text directly to a QString, or to a
+    QByteArray as UTF-8, which can be reused from one row to the next.
+
+    \snippet code/src_corelib_text_qnumberformatter.cpp 0
+
+    The format of floating-point numbers is set with setDoubleFormat(). The
+    \l{QLocale::NumberOptions}{number options} of the locale are taken into
+    account, except for the ones that only concern parsing.
+
+    QNumberFormatter takes a snapshot of the locale: later changes to the
+    system locale's settings are not reflected until setLocale() is called
+    again.
+
+    \sa QLocale::toString(), QCollator
+*/
+
+/*!
+    Constructs a formatter for the default locale.
+
+    \sa QLocale::setDefault()
+*/
+QNumberFormatter::QNumberFormatter()
+    : QNumberFormatter(QLocale())
+{
+}
+
+/*!
+    Constructs a formatter for \a locale.
+*/
+QNumberFormatter::QNumberFormatter(const QLocale &locale)
+    : d(new QNumberFormatterPrivate(locale))
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QNumberFormatter::QNumberFormatter(const QNumberFormatter &other) noexcept
+    = default;
+
+/*!
+    \fn QNumberFormatter::QNumberFormatter(QNumberFormatter &&other)
+
+    Move-constructs a formatter from \a other.
+
+    \note The moved-from object \a other is placed in a partially-formed
+    state, in which the only valid operations are destruction and
+    assignment of a new value.
+*/
+
+/*!
+    \fn QNumberFormatter &QNumberFormatter::operator=(QNumberFormatter &&other)
+
+    Move-assigns \a other to this formatter.
+*/
+
+/*!
+    Assigns \a other to this formatter, and returns a reference to this
+    formatter.
+*/
+QNumberFormatter &QNumberFormatter::operator=(const QNumberFormatter &other) noexcept
+    = default;
+
+/*!
+    Destroys the formatter.
+*/
+QNumberFormatter::~QNumberFormatter()
+    = default;
+
+/*!
+    \fn void QNumberFormatter::swap(QNumberFormatter &other)
+    \memberswap{formatter}
+*/
+
+/*!
+    Makes this formatter format numbers for \a locale. The format set with
+    setDoubleFormat() is kept.
+
+    \sa locale()
+*/
+void QNumberFormatter::setLocale(const QLocale &locale)
+{
+    QExplicitlySharedDataPointer<QNumberFormatterPrivate> x(new QNumberFormatterPrivate(locale));
+    x->setDoubleFormat(d->format, d->precision);
+    d.swap(x);
+}
+
+/*!
+    Returns the locale of this formatter.
+
+    \sa setLocale()
+*/
+QLocale QNumberFormatter::locale() const
+{
+    return d->locale;
+}
+
+/*!
+    Makes this formatter format floating-point numbers as
+    QLocale::toString(double, char, int) does with \a format and
+    \a precision. The default is \c{'g'} with a precision of 6.
+
+    \sa doubleFormat(), doublePrecision(), {QLocale::}{FloatingPointPrecisionOption}
+*/
+void QNumberFormatter::setDoubleFormat(char format, int precision)
+{
+    d.detach();
+    d->setDoubleFormat(format, precision);
+}
+
+/*!
+    Returns the format of floating-point numbers.
+
+    \sa setDoubleFormat(), doublePrecision()
+*/
+char QNumberFormatter::doubleFormat() const
+{
+    return d->format;
+}
+
+/*!
+    Returns the precision of floating-point numbers.
+
+    \sa setDoubleFormat(), doubleFormat()
+*/
+int QNumberFormatter::doublePrecision() const
+{
+    return d->precision;
+}
+
+/*!
+    \fn QString QNumberFormatter::toString(int i) const
+
+    Returns a localized string representation of \a i, as
+    QLocale::toString() does.
+*/
+
+/*!
+    \fn QString QNumberFormatter::toString(short i) const
+    \overload
+*/
+
+/*!
+    \fn QString QNumberFormatter::toString(ushort i) const
+    \overload
+*/
+
+/*!
+    \fn QString QNumberFormatter::toString(uint i) const
+    \overload
+*/
+
+/*!
+    \fn QString QNumberFormatter::toString(long i) const
+    \overload
+*/
+
+/*!
+    \fn QString QNumberFormatter::toString(ulong i) const
+    \overload
+*/
+
+/*!
+    \overload
+*/
+QString QNumberFormatter::toString(qlonglong i) const
+{
+    QString result;
+    appendTo(result, i);
+    return result;
+}
+
+/*!
+    \overload
+*/
+QString QNumberFormatter::toString(qulonglong i) const
+{
+    QString result;
+    appendTo(result, i);
+    return result;
+}
+
+/*!
+    \fn QString QNumberFormatter::toString(float f) const
+    \overload
+
+    Returns a localized string representation of \a f, in the format set
+    with setDoubleFormat().
+*/
+
+/*!
+    \overload
+
+    Returns a localized string representation of \a d, in the format set
+    with setDoubleFormat().
+*/
+QString QNumberFormatter::toString(double d) const
+{
+    QString result;
+    appendTo(result, d);
+    return result;
+}
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, int i) const
+
+    Appends the localized string representation of \a i to \a str.
+
+    \sa toString()
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, short i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, ushort i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, uint i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, long i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, ulong i) const
+    \overload
+*/
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QString &str, qlonglong i) const
+{
+    d->appendInteger(str, magnitude(i), i < 0);
+}
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QString &str, qulonglong i) const
+{
+    d->appendInteger(str, i, false);
+}
+
+/*!
+    \fn void QNumberFormatter::appendTo(QString &str, float f) const
+    \overload
+
+    Appends the localized string representation of \a f to \a str, in the
+    format set with setDoubleFormat().
+*/
+
+/*!
+    \overload
+
+    Appends the localized string representation of \a d to \a str, in the
+    format set with setDoubleFormat().
+*/
+void QNumberFormatter::appendTo(QString &str, double d) const
+{
+    this->d->appendDouble(str, d);
+}
+
+/*!
+    \overload
+
+    Appends the localized string representations of \a values to \a str,
+    with \a separator between them.
+*/
+void QNumberFormatter::appendTo(QString &str, QSpan<const int> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), str, values, separator);
+}
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QString &str, QSpan<const qlonglong> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), str, values, separator);
+}
+
+/*!
+    \overload
+
+    Appends the localized string representations of \a values to \a str,
+    with \a separator between them, in the format set with
+    setDoubleFormat().
+*/
+void QNumberFormatter::appendTo(QString &str, QSpan<const double> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), str, values, separator);
+}
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, int i) const
+    \overload
+
+    Appends the localized string representation of \a i to \a utf8, encoded
+    in UTF-8.
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, short i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, ushort i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, uint i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, long i) const
+    \overload
+*/
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, ulong i) const
+    \overload
+*/
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, qlonglong i) const
+{
+    d->appendInteger(utf8, magnitude(i), i < 0);
+}
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, qulonglong i) const
+{
+    d->appendInteger(utf8, i, false);
+}
+
+/*!
+    \fn void QNumberFormatter::appendTo(QByteArray &utf8, float f) const
+    \overload
+
+    Appends the localized string representation of \a f to \a utf8, encoded
+    in UTF-8, in the format set with setDoubleFormat().
+*/
+
+/*!
+    \overload
+
+    Appends the localized string representation of \a d to \a utf8, encoded
+    in UTF-8, in the format set with setDoubleFormat().
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, double d) const
+{
+    this->d->appendDouble(utf8, d);
+}
+
+/*!
+    \overload
+
+    Appends the localized string representations of \a values to \a utf8,
+    encoded in UTF-8, with \a separator between them.
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, QSpan<const int> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), utf8, values, separator);
+}
+
+/*!
+    \overload
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, QSpan<const qlonglong> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), utf8, values, separator);
+}
+
+/*!
+    \overload
+
+    Appends the localized string representations of \a values to \a utf8,
+    encoded in UTF-8, with \a separator between them, in the format set with
+    setDoubleFormat().
+*/
+void QNumberFormatter::appendTo(QByteArray &utf8, QSpan<const double> values,
+                                QAnyStringView separator) const
+{
+    appendAll(d.data(), utf8, values, separator);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,88 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QNUMBERFORMATTER_H
+#define QNUMBERFORMATTER_H
+
+#include <QtCore/qanystringview.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qspan.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+class QNumberFormatterPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QNumberFormatterPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QNumberFormatter
+{
+public:
+    QNumberFormatter();
+    explicit QNumberFormatter(const QLocale &locale);
+    QNumberFormatter(const QNumberFormatter &other) noexcept;
+    QNumberFormatter(QNumberFormatter &&other) noexcept = default;
+    QNumberFormatter &operator=(const QNumberFormatter &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QNumberFormatter)
+    ~QNumberFormatter();
+
+    void swap(QNumberFormatter &other) noexcept
+    { d.swap(other.d); }
+
+    void setLocale(const QLocale &locale);
+    QLocale locale() const;
+
+    void setDoubleFormat(char format, int precision = 6);
+    char doubleFormat() const;
+    int doublePrecision() const;
+
+    QString toString(short i) const { return toString(qlonglong(i)); }
+    QString toString(ushort i) const { return toString(qulonglong(i)); }
+    QString toString(int i) const { return toString(qlonglong(i)); }
+    QString toString(uint i) const { return toString(qulonglong(i)); }
+    QString toString(long i) const { return toString(qlonglong(i)); }
+    QString toString(ulong i) const { return toString(qulonglong(i)); }
+    QString toString(qlonglong i) const;
+    QString toString(qulonglong i) const;
+    QString toString(float f) const { return toString(double(f)); }
+    QString toString(double d) const;
+
+    void appendTo(QString &str, short i) const { appendTo(str, qlonglong(i)); }
+    void appendTo(QString &str, ushort i) const { appendTo(str, qulonglong(i)); }
+    void appendTo(QString &str, int i) const { appendTo(str, qlonglong(i)); }
+    void appendTo(QString &str, uint i) const { appendTo(str, qulonglong(i)); }
+    void appendTo(QString &str, long i) const { appendTo(str, qlonglong(i)); }
+    void appendTo(QString &str, ulong i) const { appendTo(str, qulonglong(i)); }
+    void appendTo(QString &str, qlonglong i) const;
+    void appendTo(QString &str, qulonglong i) const;
+    void appendTo(QString &str, float f) const { appendTo(str, double(f)); }
+    void appendTo(QString &str, double d) const;
+    void appendTo(QString &str, QSpan<const int> values, QAnyStringView separator) const;
+    void appendTo(QString &str, QSpan<const qlonglong> values, QAnyStringView separator) const;
+    void appendTo(QString &str, QSpan<const double> values, QAnyStringView separator) const;
+
+    void appendTo(QByteArray &utf8, short i) const { appendTo(utf8, qlonglong(i)); }
+    void appendTo(QByteArray &utf8, ushort i) const { appendTo(utf8, qulonglong(i)); }
+    void appendTo(QByteArray &utf8, int i) const { appendTo(utf8, qlonglong(i)); }
+    void appendTo(QByteArray &utf8, uint i) const { appendTo(utf8, qulonglong(i)); }
+    void appendTo(QByteArray &utf8, long i) const { appendTo(utf8, qlonglong(i)); }
+    void appendTo(QByteArray &utf8, ulong i) const { appendTo(utf8, qulonglong(i)); }
+    void appendTo(QByteArray &utf8, qlonglong i) const;
+    void appendTo(QByteArray &utf8, qulonglong i) const;
+    void appendTo(QByteArray &utf8, float f) const { appendTo(utf8, double(f)); }
+    void appendTo(QByteArray &utf8, double d) const;
+    void appendTo(QByteArray &utf8, QSpan<const int> values, QAnyStringView separator) const;
+    void appendTo(QByteArray &utf8, QSpan<const qlonglong> values,
+                  QAnyStringView separator) const;
+    void appendTo(QByteArray &utf8, QSpan<const double> values, QAnyStringView separator) const;
+
+private:
+    QExplicitlySharedDataPointer<QNumberFormatterPrivate> d;
+};
+
+Q_DECLARE_SHARED(QNumberFormatter)
+
+QT_END_NAMESPACE
+
+#endif // QNUMBERFORMATTER_H
@@ -0,0 +1,304 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qsmallstring.h"
+
+#include "private/qstringconverter_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QSmallString
+    \inmodule QtCore
+    \since 6.9
+    \brief The QSmallString class is an immutable Unicode string that stores
+    short strings without allocating memory.
+    \reentrant
+    \ingroup tools
+    \ingroup shared
+    \ingroup string-processing
+
+    \compares strong
+    \compareswith strong QStringView QLatin1StringView
+    \endcompareswith
+
+    QSmallString holds a UTF-16 string, like QString. Strings of up to
+    InlineCapacity code units are stored inside the QSmallString object
+    itself, so constructing, copying and destroying them never allocates
+    memory, nor touches a reference count shared with other threads.
+    Longer strings are held in a QString, and are \l{implicitly shared}.
+    A QSmallString is as large as four pointers on 64-bit platforms.
+
+    This makes QSmallString a good choice for storing many short strings,
+    such as identifiers, keys of hashes, or the fields of parsed records,
+    for which the allocation done by QString dominates the cost.
+
+    \snippet code/src_corelib_text_qsmallstring.cpp 0
+
+    QSmallString has no modifying functions. It converts implicitly to
+    QStringView, through which the whole read-only API of QString is
+    available; use toString() to get a QString.
+
+    Unlike QString, the data() of a QSmallString is not guaranteed to be
+    null-terminated.
+
+    \sa QString, QStringView, QVarLengthArray
+*/
+
+/*!
+    \variable QSmallString::InlineCapacity
+
+    The maximum number of UTF-16 code units that a QSmallString stores
+    without allocating memory.
+*/
+
+/*!
+    \typedef QSmallString::value_type
+    \typedef QSmallString::storage_type
+    \typedef QSmallString::size_type
+    \typedef QSmallString::difference_type
+    \typedef QSmallString::const_reference
+    \typedef QSmallString::const_pointer
+    \typedef QSmallString::const_iterator
+    \typedef QSmallString::iterator
+    \typedef QSmallString::const_reverse_iterator
+    \typedef QSmallString::reverse_iterator
+
+    Provided for compatibility with the STL. QSmallString only has
+    constant iterators.
+*/
+
+/*!
+    \fn QSmallString::QSmallString()
+
+    Constructs an empty string.
+*/
+
+/*!
+    \fn QSmallString::QSmallString(QStringView str)
+
+    Constructs a string holding a copy of \a str.
+*/
+
+/*!
+    Constructs a string holding the Latin-1 string \a str converted to
+    UTF-16.
+*/
+QSmallString::QSmallString(QLatin1StringView str)
+{
+    if (str.size() <= InlineCapacity) {
+        s.size = qint16(str.size());
+        QLatin1::convertToUnicode(s.chars, str);
+    } else {
+        new (&l) Large{ LargeTag, QString(str) };
+    }
+}
+
+/*!
+    \fn QSmallString::QSmallString(const QString &str)
+    \fn QSmallString::QSmallString(QString &&str)
+
+    Constructs a string holding \a str. If \a str is longer than
+    InlineCapacity, it is shared instead of copied.
+*/
+
+/*!
+    \fn QSmallString::QSmallString(const QSmallString &other)
+
+    Constructs a copy of \a other.
+*/
+
+/*!
+    \fn QSmallString::QSmallString(QSmallString &&other)
+
+    Move-constructs a QSmallString from \a other, which is left empty.
+*/
+
+/*!
+    \fn QSmallString &QSmallString::operator=(const QSmallString &other)
+    \fn QSmallString &QSmallString::operator=(QSmallString &&other)
+
+    Assigns \a other to this string and returns a reference to it.
+*/
+
+/*!
+    \fn QSmallString::~QSmallString()
+
+    Destroys the string.
+*/
+
+/*!
+    \fn void QSmallString::swap(QSmallString &other)
+    \memberswap{string}
+*/
+
+/*!
+    Returns a string holding the UTF-8 string \a utf8 converted to UTF-16.
+
+    \sa QString::fromUtf8()
+*/
+QSmallString QSmallString::fromUtf8(QByteArrayView utf8)
+{
+    // a UTF-8 string never has fewer code units than its UTF-16 conversion
+    if (utf8.size() > InlineCapacity)
+        return QSmallString(QString::fromUtf8(utf8));
+    QSmallString result;
+    const char16_t *end = QUtf8::convertToUnicode(result.s.chars, utf8);
+    result.s.size = qint16(end - result.s.chars);
+    return result;
+}
+
+/*!
+    \fn QSmallString QSmallString::fromLatin1(QLatin1StringView latin1)
+
+    Returns a string holding the Latin-1 string \a latin1 converted to
+    UTF-16.
+*/
+
+/*!
+    \fn bool QSmallString::isInline() const
+
+    Returns \c true if the string is stored inside the QSmallString object;
+    otherwise returns \c false. This is the case of all the strings that are
+    not longer than InlineCapacity, and of no other string.
+*/
+
+/*!
+    \fn qsizetype QSmallString::size() const
+    \fn qsizetype QSmallString::length() const
+
+    Returns the number of UTF-16 code units in this string.
+*/
+
+/*!
+    \fn bool QSmallString::isEmpty() const
+    \fn bool QSmallString::empty() const
+
+    Returns \c true if this string has no characters; otherwise returns
+    \c false.
+*/
+
+/*!
+    \fn const char16_t *QSmallString::utf16() const
+    \fn const QChar *QSmallString::data() const
+    \fn const QChar *QSmallString::constData() const
+    \fn const QChar *QSmallString::unicode() const
+
+    Returns a pointer to the data of this string, which is not
+    null-terminated. The pointer remains valid as long as the string is
+    neither modified nor destroyed; moving or swapping the string
+    invalidates it too.
+*/
+
+/*!
+    \fn QChar QSmallString::at(qsizetype i) const
+    \fn QChar QSmallString::operator[](qsizetype i) const
+
+    Returns the character at index position \a i, which must be a valid
+    index position in the string.
+*/
+
+/*!
+    \fn QChar QSmallString::front() const
+    \fn QChar QSmallString::back() const
+
+    Returns the first, respectively the last, character of the string,
+    which must not be empty.
+*/
+
+/*!
+    \fn QSmallString::const_iterator QSmallString::begin() const
+    \fn QSmallString::const_iterator QSmallString::cbegin() const
+    \fn QSmallString::const_iterator QSmallString::constBegin() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing to
+    the first character in the string.
+*/
+
+/*!
+    \fn QSmallString::const_iterator QSmallString::end() const
+    \fn QSmallString::const_iterator QSmallString::cend() const
+    \fn QSmallString::const_iterator QSmallString::constEnd() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing
+    just after the last character in the string.
+*/
+
+/*!
+    \fn QSmallString::const_reverse_iterator QSmallString::rbegin() const
+    \fn QSmallString::const_reverse_iterator QSmallString::crbegin() const
+    \fn QSmallString::const_reverse_iterator QSmallString::rend() const
+    \fn QSmallString::const_reverse_iterator QSmallString::crend() const
+
+    Return const reverse iterators pointing to the last character in the
+    string, respectively just before the first one.
+*/
+
+/*!
+    \fn QStringView QSmallString::view() const
+
+    Returns a QStringView on this string.
+*/
+
+/*!
+    \fn QSmallString::operator QStringView() const
+
+    Returns a QStringView on this string.
+
+    \sa view()
+*/
+
+/*!
+    \fn QString QSmallString::toString() const &
+    \fn QString QSmallString::toString() &&
+
+    Returns this string as a QString. If the string is not inline, the
+    QString it holds is returned, without copying the characters.
+*/
+
+/*!
+    \fn QByteArray QSmallString::toUtf8() const
+
+    Returns this string converted to UTF-8.
+*/
+
+/*!
+    \fn void QSmallString::clear()
+
+    Makes this string empty.
+*/
+
+/*!
+    \fn bool QSmallString::operator==(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator!=(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator<(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator<=(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator>(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator>=(const QSmallString &lhs, const QSmallString &rhs)
+    \fn bool QSmallString::operator==(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator!=(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator<(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator<=(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator>(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator>=(const QSmallString &lhs, QStringView rhs)
+    \fn bool QSmallString::operator==(const QSmallString &lhs, QLatin1StringView rhs)
+    \fn bool QSmallString::operator!=(const QSmallString &lhs, QLatin1StringView rhs)
+    \fn bool QSmallString::operator<(const QSmallString &lhs, QLatin1StringView rhs)
+    \fn bool QSmallString::operator<=(const QSmallString &lhs, QLatin1StringView rhs)
+    \fn bool QSmallString::operator>(const QSmallString &lhs, QLatin1StringView rhs)
+    \fn bool QSmallString::operator>=(const QSmallString &lhs, QLatin1StringView rhs)
+
+    Compare \a lhs and \a rhs by the numerical values of their UTF-16 code
+    units, like the corresponding QString operators.
+*/
+
+/*!
+    \fn size_t qHash(const QSmallString &key, size_t seed = 0)
+    \relates QSmallString
+
+    Returns the hash value for the \a key, using \a seed to seed the
+    calculation. The result is the same as for a QString or QStringView
+    holding the same characters.
+*/
+
+QT_END_NAMESPACE
@@ -0,0 +1,195 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSMALLSTRING_H
+#define QSMALLSTRING_H
+
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/qstring.h>
+
+#include <cstring>
+#include <new>
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QSmallString
+{
+public:
+    typedef QChar value_type;
+    typedef char16_t storage_type;
+    typedef qsizetype size_type;
+    typedef qptrdiff difference_type;
+    typedef const QChar &const_reference;
+    typedef const QChar *const_pointer;
+    typedef const QChar *const_iterator;
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    static constexpr qsizetype InlineCapacity = 15;
+
+    QSmallString() noexcept : s{} {}
+    explicit QSmallString(QStringView str) { assign(str); }
+    explicit QSmallString(QLatin1StringView str);
+    explicit QSmallString(const QString &str)
+    {
+        if (str.size() <= InlineCapacity)
+            assign(str);
+        else
+            new (&l) Large{ LargeTag, str };
+    }
+    explicit QSmallString(QString &&str)
+    {
+        if (str.size() <= InlineCapacity)
+            assign(str);
+        else
+            new (&l) Large{ LargeTag, std::move(str) };
+    }
+
+    QSmallString(const QSmallString &other)
+    {
+        if (other.isInline())
+            s = other.s;
+        else
+            new (&l) Large{ LargeTag, other.l.str };
+    }
+    QSmallString(QSmallString &&other) noexcept
+    {
+        if (other.isInline()) {
+            s = other.s;
+        } else {
+            new (&l) Large{ LargeTag, std::move(other.l.str) };
+            other.l.~Large();
+        }
+        other.s.size = 0;
+    }
+    QSmallString &operator=(const QSmallString &other)
+    {
+        QSmallString copy(other);
+        swap(copy);
+        return *this;
+    }
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QSmallString)
+    ~QSmallString()
+    {
+        if (!isInline())
+            l.~Large();
+    }
+
+    void swap(QSmallString &other) noexcept
+    {
+        // both layouts can be relocated with memcpy, as QString can
+        alignas(Large) unsigned char tmp[sizeof(Small)];
+        std::memcpy(tmp, static_cast<void *>(this), sizeof(Small));
+        std::memcpy(static_cast<void *>(this), static_cast<void *>(&other), sizeof(Small));
+        std::memcpy(static_cast<void *>(&other), tmp, sizeof(Small));
+    }
+
+    static QSmallString fromUtf8(QByteArrayView utf8);
+    static QSmallString fromLatin1(QLatin1StringView latin1) { return QSmallString(latin1); }
+
+    bool isInline() const noexcept { return s.size != LargeTag; }
+
+    qsizetype size() const noexcept { return isInline() ? qsizetype(s.size) : l.str.size(); }
+    qsizetype length() const noexcept { return size(); }
+    bool isEmpty() const noexcept { return size() == 0; }
+    [[nodiscard]] bool empty() const noexcept { return isEmpty(); }
+
+    const storage_type *utf16() const noexcept { return isInline() ? s.chars : QStringView(l.str).utf16(); }
+    const QChar *data() const noexcept { return reinterpret_cast<const QChar *>(utf16()); }
+    const QChar *constData() const noexcept { return data(); }
+    const QChar *unicode() const noexcept { return data(); }
+
+    QChar at(qsizetype i) const { Q_ASSERT(size_t(i) < size_t(size())); return data()[i]; }
+    QChar operator[](qsizetype i) const { return at(i); }
+    QChar front() const { return at(0); }
+    QChar back() const { return at(size() - 1); }
+
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator constBegin() const noexcept { return begin(); }
+    const_iterator end() const noexcept { return data() + size(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_iterator constEnd() const noexcept { return end(); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    QStringView view() const noexcept { return QStringView(utf16(), size()); }
+    // QStringView's constructor from containers cannot be used here: the
+    // comparison operators below check for it before the class is complete
+    operator QStringView() const noexcept { return view(); }
+    QString toString() const &
+    {
+        return isInline() ? QString(data(), size()) : l.str;
+    }
+    QString toString() &&
+    {
+        return isInline() ? QString(data(), size()) : std::move(l.str);
+    }
+    QByteArray toUtf8() const { return view().toUtf8(); }
+
+    void clear() noexcept { QSmallString().swap(*this); }
+
+    friend bool comparesEqual(const QSmallString &lhs, const QSmallString &rhs) noexcept
+    { return comparesEqual(lhs.view(), rhs.view()); }
+    friend Qt::strong_ordering compareThreeWay(const QSmallString &lhs, const QSmallString &rhs) noexcept
+    { return compareThreeWay(lhs.view(), rhs.view()); }
+    Q_DECLARE_STRONGLY_ORDERED(QSmallString)
+
+    friend bool comparesEqual(const QSmallString &lhs, QStringView rhs) noexcept
+    { return comparesEqual(lhs.view(), rhs); }
+    friend Qt::strong_ordering compareThreeWay(const QSmallString &lhs, QStringView rhs) noexcept
+    { return compareThreeWay(lhs.view(), rhs); }
+    Q_DECLARE_STRONGLY_ORDERED(QSmallString, QStringView)
+
+    friend bool comparesEqual(const QSmallString &lhs, QLatin1StringView rhs) noexcept
+    { return lhs.size() == rhs.size() && QtPrivate::equalStrings(lhs.view(), rhs); }
+    friend Qt::strong_ordering compareThreeWay(const QSmallString &lhs, QLatin1StringView rhs) noexcept
+    { return Qt::compareThreeWay(QtPrivate::compareStrings(lhs.view(), rhs), 0); }
+    Q_DECLARE_STRONGLY_ORDERED(QSmallString, QLatin1StringView)
+
+private:
+    static constexpr qint16 LargeTag = -1;
+
+    // Both layouts start with the same member, which tells them apart
+    struct Small
+    {
+        qint16 size;
+        char16_t chars[InlineCapacity];
+    };
+    struct Large
+    {
+        qint16 tag;
+        QString str;
+    };
+    static_assert(sizeof(Large) <= sizeof(Small));
+
+    void assign(QStringView str)
+    {
+        if (str.size() <= InlineCapacity) {
+            s.size = qint16(str.size());
+            if (!str.isEmpty())
+                std::memcpy(s.chars, str.utf16(), size_t(str.size()) * sizeof(char16_t));
+        } else {
+            new (&l) Large{ LargeTag, str.toString() };
+        }
+    }
+
+    union {
+        Small s;
+        Large l;
+    };
+};
+
+Q_DECLARE_SHARED(QSmallString)
+
+inline size_t qHash(const QSmallString &key, size_t seed = 0) noexcept
+{
+    return qHash(key.view(), seed);
+}
+
+QT_END_NAMESPACE
+
+#endif // QSMALLSTRING_H
@@ -2796,7 +2796,7 @@ void QString::reallocData(qsizetype alloc, QArrayData::AllocationOption option)
     const bool cannotUseReallocate = d.freeSpaceAtBegin() > 0;
 
     if (d->needsDetach() || cannotUseReallocate) {
-        DataPointer dd(alloc, qMin(alloc, d.size), option);
+        DataPointer dd(alloc, qMin(alloc, d.size), option, d.growthResource());
         Q_CHECK_PTR(dd.data());
         if (dd.size > 0)
             ::memcpy(dd.data(), d.data(), dd.size * sizeof(QChar));
@@ -2827,6 +2827,9 @@ void QString::reallocGrowData(qsizetype n)
 
     Clears the contents of the string and makes it null.
 
+    A string that allocates from a QMemoryResource keeps its array instead,
+    and becomes empty but not null.
+
     \sa resize(), isNull()
 */
 
@@ -9976,6 +9979,9 @@ qsizetype QtPrivate::findString(QStringView haystack, qsizetype from, QLatin1Str
     if (haystack.size() < needle.size())
         return -1;
 
+    if (needle.size() == 1)
+        return QtPrivate::findString(haystack, from, QChar(needle.front()), cs);
+
     QVarLengthArray<char16_t> s = qt_from_latin1_to_qvla(needle);
     return QtPrivate::findString(haystack, from, QStringView(reinterpret_cast<const QChar*>(s.constData()), s.size()), cs);
 }
@@ -1252,7 +1252,12 @@ void QString::detach()
 bool QString::isDetached() const
 { return !d->isShared(); }
 void QString::clear()
-{ if (!isNull()) *this = QString(); }
+{
+    if (Q_UNLIKELY(d.growthResource()))
+        resize(0); // keep the array from the memory resource
+    else if (!isNull())
+        *this = QString();
+}
 QString::QString(const QString &other) noexcept : d(other.d)
 { }
 qsizetype QString::capacity() const { return qsizetype(d->constAllocatedCapacity()); }
@@ -11,6 +11,7 @@
 #include "private/qtools_p.h"
 #include "qbytearraymatcher.h"
 #include "qcontainertools_impl.h"
+#include <QtCore/qalgorithms.h>
 #include <QtCore/qbytearraylist.h>
 
 #if QT_CONFIG(icu)
@@ -469,6 +470,829 @@ static void simdCompareAscii(const qchar8_t *&, const qchar8_t *, const char16_t
 }
 #endif
 
+// The ASCII functions above give up at the first non-ASCII character. The
+// kernels below transcode whole blocks of text in other scripts too: the
+// decoder handles the one-, two- and three-byte UTF-8 sequences (all of the
+// BMP), the encoder all the BMP characters that aren't surrogates, and the
+// validator checks any UTF-8 (it's the lookup algorithm from Keiser and
+// Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"). Blocks
+// with sequences that the kernels don't handle, be they invalid, four-byte or
+// cut by the end of the input, are left to the scalar code, which therefore
+// still does all the error and state handling.
+#if (defined(__SSE2__) && QT_COMPILER_SUPPORTS_HERE(SSE4_1)) \
+    || (defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64) && Q_BYTE_ORDER == Q_LITTLE_ENDIAN)
+#  define QT_UTF8_SIMD_TRANSCODING 1
+
+namespace {
+// Byte shuffles that move the 16-bit lanes selected by the bits of the index
+// to the front of a 128-bit register, dropping the decoded continuation bytes
+struct Utf16CompactTable
+{
+    alignas(16) uchar masks[256][16];
+
+    constexpr Utf16CompactTable() : masks{}
+    {
+        for (uint m = 0; m < 256; ++m) {
+            uint n = 0;
+            for (uint i = 0; i < 8; ++i) {
+                if (m & (1U << i)) {
+                    masks[m][n++] = uchar(2 * i);
+                    masks[m][n++] = uchar(2 * i + 1);
+                }
+            }
+            while (n < 16)
+                masks[m][n++] = 0x80;
+        }
+    }
+};
+
+// Byte shuffles that pack four 32-bit lanes, each holding the one to three
+// bytes of a UTF-8 sequence, into a contiguous string. The index has the
+// lanes that are one byte long in the low nibble, and those that are at most
+// two bytes long in the high one.
+struct Utf8PackTable
+{
+    alignas(16) uchar masks[256][16];
+    uchar lengths[256];
+
+    constexpr Utf8PackTable() : masks{}, lengths{}
+    {
+        for (uint m = 0; m < 256; ++m) {
+            uint n = 0;
+            for (uint i = 0; i < 4; ++i) {
+                const uint len = (m & (1U << i)) ? 1 : (m & (0x10U << i)) ? 2 : 3;
+                for (uint j = 0; j < len; ++j)
+                    masks[m][n++] = uchar(4 * i + j);
+            }
+            lengths[m] = uchar(n);
+            while (n < 16)
+                masks[m][n++] = 0x80;
+        }
+    }
+};
+} // unnamed namespace
+
+static constexpr Utf16CompactTable utf16CompactTable = {};
+static constexpr Utf8PackTable utf8PackTable = {};
+
+// The encoders below store each group of four code units packed into a full
+// 16-byte register, which may reach 4 bytes past the 12 bytes those four need
+// at most. Callers reserve only 3 bytes per code unit, so the loops without
+// masked stores keep two code units more than a block in the input.
+static constexpr qsizetype Utf8EncodeBlockSlack = 2;
+
+// Error classes of the validator, for a pair of consecutive bytes
+enum : uchar {
+    Utf8TooShort = 1 << 0,      // 11______ 0_______, 11______ 11______
+    Utf8TooLong = 1 << 1,       // 0_______ 10______
+    Utf8Overlong3 = 1 << 2,     // 11100000 100_____
+    Utf8TooLarge = 1 << 3,      // 11110100 1001____, 11110100 101_____, 11110101+ 1001____...
+    Utf8Surrogate = 1 << 4,     // 11101101 101_____
+    Utf8Overlong2 = 1 << 5,     // 1100000_ 10______
+    Utf8TooLarge1000 = 1 << 6,  // 11110101+ 1000____
+    Utf8Overlong4 = 1 << 6,     // 11110000 1000____
+    Utf8TwoConts = 1 << 7,      // 10______ 10______
+    Utf8Carry = Utf8TooShort | Utf8TooLong | Utf8TwoConts,
+};
+
+// Errors possible for the high nibble of the first byte of the pair...
+alignas(16) static constexpr uchar utf8Byte1HighTable[16] = {
+    Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong,
+    Utf8TooLong, Utf8TooLong, Utf8TooLong, Utf8TooLong,
+    Utf8TwoConts, Utf8TwoConts, Utf8TwoConts, Utf8TwoConts,
+    Utf8TooShort | Utf8Overlong2,
+    Utf8TooShort,
+    Utf8TooShort | Utf8Overlong3 | Utf8Surrogate,
+    Utf8TooShort | Utf8TooLarge | Utf8TooLarge1000 | Utf8Overlong4
+};
+
+// ... for its low nibble ...
+alignas(16) static constexpr uchar utf8Byte1LowTable[16] = {
+    Utf8Carry | Utf8Overlong3 | Utf8Overlong2 | Utf8Overlong4,
+    Utf8Carry | Utf8Overlong2,
+    Utf8Carry,
+    Utf8Carry,
+    Utf8Carry | Utf8TooLarge,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000 | Utf8Surrogate,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000,
+    Utf8Carry | Utf8TooLarge | Utf8TooLarge1000
+};
+
+// ... and for the high nibble of the second byte. A pair is invalid if the
+// three lookups have a class in common, except for the two continuation bytes
+// that are expected after a three- or four-byte leading byte.
+alignas(16) static constexpr uchar utf8Byte2HighTable[16] = {
+    Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort,
+    Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort,
+    Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Overlong3 | Utf8TooLarge1000 | Utf8Overlong4,
+    Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Overlong3 | Utf8TooLarge,
+    Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Surrogate | Utf8TooLarge,
+    Utf8TooLong | Utf8Overlong2 | Utf8TwoConts | Utf8Surrogate | Utf8TooLarge,
+    Utf8TooShort, Utf8TooShort, Utf8TooShort, Utf8TooShort
+};
+
+// The last bytes of a block that may not end a character: the block is
+// followed by continuation bytes if one of them is larger than this
+alignas(16) static constexpr uchar utf8IncompleteMax[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+// The validators stop at the end of a block, which can be in the middle of a
+// character: back up to its leading byte, so the scalar code checks it whole
+static inline const uchar *utf8CharacterStart(const uchar *p, const uchar *begin)
+{
+    for (int i = 0; i < 3 && p > begin && (p[-1] & 0xc0) == 0x80; ++i)
+        --p;
+    if (p > begin && p[-1] >= 0xc0)
+        --p;
+    return p;
+}
+#else
+#  define QT_UTF8_SIMD_TRANSCODING 0
+#endif
+
+#if QT_UTF8_SIMD_TRANSCODING && defined(__SSE2__)
+// Checks that the bytes of \a in0 (the sixteen bytes at \a src; \a in1 holds
+// those at \a src + 1) are made of one-, two- and three-byte sequences only,
+// and that none is overlong or encodes a surrogate. Returns the number of
+// bytes the characters starting in the block span, including the
+// continuation bytes of the last ones that are past the block, or 0 if the
+// block can't be decoded by the kernels. On success, \a keep has the
+// positions of the leading bytes, and \a lead2 and \a lead3 flag the two- and
+// three-byte sequences.
+static inline qsizetype simdCheckUtf8Block(__m128i in0, __m128i in1, const uchar *src,
+                                           qsizetype available, __m128i &lead2, __m128i &lead3,
+                                           uint &keep)
+{
+    const __m128i cont = _mm_cmpeq_epi8(_mm_and_si128(in0, _mm_set1_epi8(char(0xc0))),
+                                        _mm_set1_epi8(char(0x80)));
+    lead2 = _mm_cmpeq_epi8(_mm_and_si128(in0, _mm_set1_epi8(char(0xe0))),
+                           _mm_set1_epi8(char(0xc0)));
+    lead3 = _mm_cmpeq_epi8(_mm_and_si128(in0, _mm_set1_epi8(char(0xf0))),
+                           _mm_set1_epi8(char(0xe0)));
+    const __m128i lead = _mm_or_si128(lead2, lead3);
+
+    // each continuation byte must follow a leading byte that expects it
+    __m128i error = _mm_xor_si128(cont, _mm_or_si128(_mm_slli_si128(lead, 1),
+                                                     _mm_slli_si128(lead3, 2)));
+    // four-byte sequences and the invalid 0xf8-0xff bytes
+    error = _mm_or_si128(error, _mm_cmpeq_epi8(_mm_and_si128(in0, _mm_set1_epi8(char(0xf0))),
+                                               _mm_set1_epi8(char(0xf0))));
+    // overlong two-byte sequences (0xc0 and 0xc1)
+    error = _mm_or_si128(error, _mm_cmpeq_epi8(_mm_and_si128(in0, _mm_set1_epi8(char(0xfe))),
+                                               _mm_set1_epi8(char(0xc0))));
+    // overlong three-byte sequences (0xe0 0x80-0x9f) and surrogates (0xed 0xa0-0xbf)
+    const __m128i upperHalf = _mm_cmpeq_epi8(_mm_and_si128(in1, _mm_set1_epi8(0x20)),
+                                             _mm_set1_epi8(0x20));
+    error = _mm_or_si128(error, _mm_andnot_si128(upperHalf,
+                                                 _mm_cmpeq_epi8(in0, _mm_set1_epi8(char(0xe0)))));
+    error = _mm_or_si128(error, _mm_and_si128(upperHalf,
+                                              _mm_cmpeq_epi8(in0, _mm_set1_epi8(char(0xed)))));
+    if (_mm_movemask_epi8(error))
+        return 0;
+
+    keep = ~uint(_mm_movemask_epi8(cont)) & 0xffff;
+    if (available < 16) {
+        // the bytes past the end were loaded as NULs (and a character cut
+        // by the end was flagged as an error above)
+        keep &= (1U << available) - 1;
+        return available;
+    }
+
+    const uint leadMask = _mm_movemask_epi8(lead);
+    const uint lead3Mask = _mm_movemask_epi8(lead3);
+    const qsizetype size = 16 + (((leadMask >> 15) | (lead3Mask >> 14)) & 1) + (lead3Mask >> 15);
+    if (size > available)
+        return 0;
+    for (qsizetype i = 16; i < size; ++i) {
+        if ((src[i] & 0xc0) != 0x80)
+            return 0;
+    }
+    return size;
+}
+
+// Decodes the characters of eight consecutive positions, assuming each is a
+// leading byte. \a b0, \a b1 and \a b2 hold the bytes at the positions and the
+// two following ones, zero-extended to 16 bits.
+static inline QT_FUNCTION_TARGET(SSE4_1)
+__m128i simdDecodeUtf8Lanes_sse4(__m128i b0, __m128i b1, __m128i b2, __m128i lead2, __m128i lead3)
+{
+    const __m128i c1 = _mm_and_si128(b1, _mm_set1_epi16(0x3f));
+    const __m128i c2 = _mm_and_si128(b2, _mm_set1_epi16(0x3f));
+    const __m128i two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1f)), 6), c1);
+    // the shift by 12 drops the 1110 marker of the leading byte
+    const __m128i three = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(c1, 6)), c2);
+    const __m128i result = _mm_blendv_epi8(b0, two, lead2);
+    return _mm_blendv_epi8(result, three, lead3);
+}
+
+static inline QT_FUNCTION_TARGET(SSE4_1)
+void simdCompactUtf16_sse4(char16_t *&dst, __m128i data, uint keep)
+{
+    const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i *>(utf16CompactTable.masks[keep]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(data, shuffle));
+    dst += qPopulationCount(quint8(keep));
+}
+
+static QT_FUNCTION_TARGET(SSE4_1)
+void simdDecodeUtf8_sse4(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    // two more bytes for the continuation bytes of the last characters
+    while (end - src >= 18) {
+        const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if (!_mm_movemask_epi8(in0)) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_cvtepu8_epi16(in0));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst) + 1, _mm_cvtepu8_epi16(_mm_srli_si128(in0, 8)));
+            src += 16;
+            dst += 16;
+            continue;
+        }
+
+        const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 1));
+        const __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2));
+        __m128i lead2, lead3;
+        uint keep;
+        const qsizetype size = simdCheckUtf8Block(in0, in1, src, end - src, lead2, lead3, keep);
+        if (!size)
+            return;
+
+        __m128i lo = simdDecodeUtf8Lanes_sse4(_mm_cvtepu8_epi16(in0), _mm_cvtepu8_epi16(in1),
+                                              _mm_cvtepu8_epi16(in2), _mm_cvtepi8_epi16(lead2),
+                                              _mm_cvtepi8_epi16(lead3));
+        __m128i hi = simdDecodeUtf8Lanes_sse4(_mm_cvtepu8_epi16(_mm_srli_si128(in0, 8)),
+                                              _mm_cvtepu8_epi16(_mm_srli_si128(in1, 8)),
+                                              _mm_cvtepu8_epi16(_mm_srli_si128(in2, 8)),
+                                              _mm_cvtepi8_epi16(_mm_srli_si128(lead2, 8)),
+                                              _mm_cvtepi8_epi16(_mm_srli_si128(lead3, 8)));
+        simdCompactUtf16_sse4(dst, lo, keep & 0xff);
+        simdCompactUtf16_sse4(dst, hi, keep >> 8);
+        src += size;
+    }
+}
+
+static inline QT_FUNCTION_TARGET(SSE4_1)
+void simdEncodeUtf8Lanes_sse4(uchar *&dst, __m128i u)
+{
+    const __m128i low6 = _mm_set1_epi32(0x3f);
+    const __m128i contMarker = _mm_set1_epi32(0x80);
+    const __m128i last = _mm_or_si128(_mm_and_si128(u, low6), contMarker);
+    const __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(u, 6), low6), contMarker);
+    const __m128i two = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(u, 6), _mm_set1_epi32(0xc0)),
+                                     _mm_slli_epi32(last, 8));
+    const __m128i three = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(u, 12), _mm_set1_epi32(0xe0)),
+                                       _mm_or_si128(_mm_slli_epi32(middle, 8), _mm_slli_epi32(last, 16)));
+    const __m128i isOne = _mm_cmplt_epi32(u, _mm_set1_epi32(0x80));
+    const __m128i isTwo = _mm_cmplt_epi32(u, _mm_set1_epi32(0x800));  // or one
+    __m128i bytes = _mm_blendv_epi8(three, two, isTwo);
+    bytes = _mm_blendv_epi8(bytes, u, isOne);
+
+    const uint key = _mm_movemask_ps(_mm_castsi128_ps(isOne))
+            | (_mm_movemask_ps(_mm_castsi128_ps(isTwo)) << 4);
+    const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8PackTable.masks[key]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(bytes, shuffle));
+    dst += utf8PackTable.lengths[key];
+}
+
+static QT_FUNCTION_TARGET(SSE4_1)
+void simdEncodeUtf8_sse4(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    for ( ; end - src >= 8 + Utf8EncodeBlockSlack; src += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(data, _mm_set1_epi16(short(0xf800))),
+                                                   _mm_set1_epi16(short(0xd800)));
+        if (_mm_movemask_epi8(surrogates))
+            return;
+        if (_mm_testz_si128(data, _mm_set1_epi16(short(0xff80)))) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(data, data));
+            dst += 8;
+            continue;
+        }
+        simdEncodeUtf8Lanes_sse4(dst, _mm_cvtepu16_epi32(data));
+        simdEncodeUtf8Lanes_sse4(dst, _mm_cvtepu16_epi32(_mm_srli_si128(data, 8)));
+    }
+}
+
+static QT_FUNCTION_TARGET(SSE4_1)
+bool simdValidateUtf8_sse4(const uchar *&src, const uchar *end, bool &isAscii)
+{
+    const __m128i byte1High = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1HighTable));
+    const __m128i byte1Low = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1LowTable));
+    const __m128i byte2High = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte2HighTable));
+    const __m128i incompleteMax = _mm_load_si128(reinterpret_cast<const __m128i *>(utf8IncompleteMax));
+    const __m128i lowNibble = _mm_set1_epi8(0x0f);
+    const uchar *const begin = src;
+    __m128i prev = _mm_setzero_si128();
+    __m128i prevIncomplete = _mm_setzero_si128();
+
+    for ( ; end - src >= 16; src += 16) {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i error = prevIncomplete;
+        if (_mm_movemask_epi8(input)) {
+            isAscii = false;
+            const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+            const __m128i special = _mm_and_si128(
+                        _mm_and_si128(_mm_shuffle_epi8(byte1High, _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibble)),
+                                      _mm_shuffle_epi8(byte1Low, _mm_and_si128(prev1, lowNibble))),
+                        _mm_shuffle_epi8(byte2High, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibble)));
+            // third and fourth bytes of sequences, which are the only
+            // continuation bytes that may follow one
+            const __m128i must23 = _mm_or_si128(
+                        _mm_subs_epu8(_mm_alignr_epi8(input, prev, 14), _mm_set1_epi8(char(0xe0 - 0x80))),
+                        _mm_subs_epu8(_mm_alignr_epi8(input, prev, 13), _mm_set1_epi8(char(0xf0 - 0x80))));
+            error = _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8(char(0x80))), special);
+            prevIncomplete = _mm_subs_epu8(input, incompleteMax);
+        }
+        if (!_mm_testz_si128(error, error))
+            return false;
+        prev = input;
+    }
+
+    src = utf8CharacterStart(src, begin);
+    return true;
+}
+
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+// Same as simdDecodeUtf8Lanes_sse4, for the sixteen positions of the block at once
+static inline QT_FUNCTION_TARGET(AVX2)
+__m256i simdDecodeUtf8Lanes_avx2(__m128i in0, __m128i in1, __m128i in2, __m128i lead2, __m128i lead3)
+{
+    const __m256i b0 = _mm256_cvtepu8_epi16(in0);
+    const __m256i c1 = _mm256_and_si256(_mm256_cvtepu8_epi16(in1), _mm256_set1_epi16(0x3f));
+    const __m256i c2 = _mm256_and_si256(_mm256_cvtepu8_epi16(in2), _mm256_set1_epi16(0x3f));
+    const __m256i two = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, _mm256_set1_epi16(0x1f)), 6), c1);
+    const __m256i three = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(b0, 12),
+                                                          _mm256_slli_epi16(c1, 6)), c2);
+    const __m256i result = _mm256_blendv_epi8(b0, two, _mm256_cvtepi8_epi16(lead2));
+    return _mm256_blendv_epi8(result, three, _mm256_cvtepi8_epi16(lead3));
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+void simdDecodeUtf8_avx2(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    while (end - src >= 18) {
+        const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        if (!_mm_movemask_epi8(in0)) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_cvtepu8_epi16(in0));
+            src += 16;
+            dst += 16;
+            continue;
+        }
+
+        const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 1));
+        const __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2));
+        __m128i lead2, lead3;
+        uint keep;
+        const qsizetype size = simdCheckUtf8Block(in0, in1, src, end - src, lead2, lead3, keep);
+        if (!size)
+            return;
+
+        const __m256i data = simdDecodeUtf8Lanes_avx2(in0, in1, in2, lead2, lead3);
+        simdCompactUtf16_sse4(dst, _mm256_castsi256_si128(data), keep & 0xff);
+        simdCompactUtf16_sse4(dst, _mm256_extracti128_si256(data, 1), keep >> 8);
+        src += size;
+    }
+}
+
+// Encodes eight code units, packing the bytes of each group of four at the
+// start of its 128-bit lane
+static inline QT_FUNCTION_TARGET(AVX2)
+__m256i simdEncodeUtf8Lanes_avx2(__m128i data, uint &keyLo, uint &keyHi)
+{
+    const __m256i low6 = _mm256_set1_epi32(0x3f);
+    const __m256i contMarker = _mm256_set1_epi32(0x80);
+    const __m256i u = _mm256_cvtepu16_epi32(data);
+    const __m256i last = _mm256_or_si256(_mm256_and_si256(u, low6), contMarker);
+    const __m256i middle = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(u, 6), low6), contMarker);
+    const __m256i two = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(u, 6), _mm256_set1_epi32(0xc0)),
+                                        _mm256_slli_epi32(last, 8));
+    const __m256i three = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(u, 12), _mm256_set1_epi32(0xe0)),
+                                          _mm256_or_si256(_mm256_slli_epi32(middle, 8),
+                                                          _mm256_slli_epi32(last, 16)));
+    const __m256i isOne = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x80), u);
+    const __m256i isTwo = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x800), u);  // or one
+    __m256i bytes = _mm256_blendv_epi8(three, two, isTwo);
+    bytes = _mm256_blendv_epi8(bytes, u, isOne);
+
+    const uint ones = _mm256_movemask_ps(_mm256_castsi256_ps(isOne));
+    const uint twos = _mm256_movemask_ps(_mm256_castsi256_ps(isTwo));
+    keyLo = (ones & 0xf) | ((twos & 0xf) << 4);
+    keyHi = (ones >> 4) | ((twos >> 4) << 4);
+    const __m256i shuffle = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(utf8PackTable.masks[keyLo]))),
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf8PackTable.masks[keyHi])), 1);
+    return _mm256_shuffle_epi8(bytes, shuffle);
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+void simdEncodeUtf8_avx2(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    for ( ; end - src >= 8 + Utf8EncodeBlockSlack; src += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(data, _mm_set1_epi16(short(0xf800))),
+                                                   _mm_set1_epi16(short(0xd800)));
+        if (_mm_movemask_epi8(surrogates))
+            return;
+        if (_mm_testz_si128(data, _mm_set1_epi16(short(0xff80)))) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(data, data));
+            dst += 8;
+            continue;
+        }
+
+        uint keyLo, keyHi;
+        const __m256i bytes = simdEncodeUtf8Lanes_avx2(data, keyLo, keyHi);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(bytes));
+        dst += utf8PackTable.lengths[keyLo];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_extracti128_si256(bytes, 1));
+        dst += utf8PackTable.lengths[keyHi];
+    }
+}
+
+// Returns the 32 bytes that end N bytes before the end of the current block
+template <int N> static inline QT_FUNCTION_TARGET(AVX2)
+__m256i simdPrevBytes_avx2(__m256i input, __m256i prev)
+{
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+}
+
+static QT_FUNCTION_TARGET(AVX2)
+bool simdValidateUtf8_avx2(const uchar *&src, const uchar *end, bool &isAscii)
+{
+    const __m256i byte1High = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1HighTable)));
+    const __m256i byte1Low = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte1LowTable)));
+    const __m256i byte2High = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf8Byte2HighTable)));
+    const __m256i incompleteMax = _mm256_inserti128_si256(
+                _mm256_set1_epi8(char(0xff)),
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf8IncompleteMax)), 1);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    const uchar *const begin = src;
+    __m256i prev = _mm256_setzero_si256();
+    __m256i prevIncomplete = _mm256_setzero_si256();
+
+    for ( ; end - src >= 32; src += 32) {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        __m256i error = prevIncomplete;
+        if (_mm256_movemask_epi8(input)) {
+            isAscii = false;
+            const __m256i prev1 = simdPrevBytes_avx2<1>(input, prev);
+            const __m256i special = _mm256_and_si256(
+                        _mm256_and_si256(_mm256_shuffle_epi8(byte1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibble)),
+                                         _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(prev1, lowNibble))),
+                        _mm256_shuffle_epi8(byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble)));
+            const __m256i must23 = _mm256_or_si256(
+                        _mm256_subs_epu8(simdPrevBytes_avx2<2>(input, prev), _mm256_set1_epi8(char(0xe0 - 0x80))),
+                        _mm256_subs_epu8(simdPrevBytes_avx2<3>(input, prev), _mm256_set1_epi8(char(0xf0 - 0x80))));
+            error = _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8(char(0x80))), special);
+            prevIncomplete = _mm256_subs_epu8(input, incompleteMax);
+        }
+        if (!_mm256_testz_si256(error, error))
+            return false;
+        prev = input;
+    }
+
+    src = utf8CharacterStart(src, begin);
+    return true;
+}
+#  endif // AVX2
+
+#  if QT_COMPILER_SUPPORTS_HERE(AVX512VL) && QT_COMPILER_SUPPORTS_HERE(AVX512BW)
+// Same as simdDecodeUtf8_avx2, but with masked loads and stores to decode the
+// end of the input too
+static QT_FUNCTION_TARGET(ARCH_SKYLAKE_AVX512)
+void simdDecodeUtf8_avx512(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    auto loadMask = [](qsizetype n) {
+        return n >= 16 ? __mmask16(0xffff) : __mmask16((1U << qMax<qsizetype>(n, 0)) - 1);
+    };
+    while (src < end) {
+        const qsizetype available = end - src;
+        const __mmask16 mask = loadMask(available);
+        const __m128i in0 = _mm_maskz_loadu_epi8(mask, src);
+        if (!_mm_movemask_epi8(in0)) {
+            _mm256_mask_storeu_epi16(dst, mask, _mm256_cvtepu8_epi16(in0));
+            const qsizetype n = qMin<qsizetype>(available, 16);
+            src += n;
+            dst += n;
+            continue;
+        }
+
+        const __m128i in1 = _mm_maskz_loadu_epi8(loadMask(available - 1), src + 1);
+        const __m128i in2 = _mm_maskz_loadu_epi8(loadMask(available - 2), src + 2);
+        __m128i lead2, lead3;
+        uint keep;
+        const qsizetype size = simdCheckUtf8Block(in0, in1, src, available, lead2, lead3, keep);
+        if (!size)
+            return;
+
+        const __m256i data = simdDecodeUtf8Lanes_avx2(in0, in1, in2, lead2, lead3);
+        const __m128i lo = _mm_shuffle_epi8(_mm256_castsi256_si128(data),
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf16CompactTable.masks[keep & 0xff])));
+        const __m128i hi = _mm_shuffle_epi8(_mm256_extracti128_si256(data, 1),
+                _mm_load_si128(reinterpret_cast<const __m128i *>(utf16CompactTable.masks[keep >> 8])));
+        const uint loCount = qPopulationCount(quint8(keep));
+        const uint hiCount = qPopulationCount(quint8(keep >> 8));
+        _mm_mask_storeu_epi16(dst, __mmask8(_bzhi_u32(~0u, loCount)), lo);
+        dst += loCount;
+        _mm_mask_storeu_epi16(dst, __mmask8(_bzhi_u32(~0u, hiCount)), hi);
+        dst += hiCount;
+        src += size;
+    }
+}
+
+// Same as simdEncodeUtf8_avx2, but with masked loads and stores to encode
+// what it leaves at the end of the input too
+static QT_FUNCTION_TARGET(ARCH_SKYLAKE_AVX512)
+void simdEncodeUtf8_avx512(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    simdEncodeUtf8_avx2(dst, src, end);
+    if (end - src >= 8 + Utf8EncodeBlockSlack)
+        return;     // stopped at a surrogate
+
+    while (src < end) {
+        const qsizetype size = qMin<qsizetype>(end - src, 8);
+        const __mmask8 mask = __mmask8(_bzhi_u32(0xff, uint(size)));
+        const __m128i data = _mm_maskz_loadu_epi16(mask, src);
+        if (_mm_mask_cmpeq_epi16_mask(mask, _mm_and_si128(data, _mm_set1_epi16(short(0xf800))),
+                                      _mm_set1_epi16(short(0xd800)))) {
+            return;
+        }
+
+        // The zeroes loaded past the end encode as one byte each at the end
+        // of their group; don't store those
+        uint keyLo, keyHi;
+        const __m256i bytes = simdEncodeUtf8Lanes_avx2(data, keyLo, keyHi);
+        const uint lengthLo = utf8PackTable.lengths[keyLo] - uint(4 - qMin<qsizetype>(size, 4));
+        const uint lengthHi = utf8PackTable.lengths[keyHi] - uint(4 - qMax<qsizetype>(size - 4, 0));
+        _mm_mask_storeu_epi8(dst, __mmask16(_bzhi_u32(~0u, lengthLo)), _mm256_castsi256_si128(bytes));
+        dst += lengthLo;
+        _mm_mask_storeu_epi8(dst, __mmask16(_bzhi_u32(~0u, lengthHi)), _mm256_extracti128_si256(bytes, 1));
+        dst += lengthHi;
+        src += size;
+    }
+}
+#  endif // AVX512
+
+static inline bool simdDecodeUtf8Kernel(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+#  if QT_COMPILER_SUPPORTS_HERE(AVX512VL) && QT_COMPILER_SUPPORTS_HERE(AVX512BW)
+    if (qCpuHasFeature(ArchSkylakeAvx512)) {
+        simdDecodeUtf8_avx512(dst, src, end);
+        return true;
+    }
+#  endif
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (qCpuHasFeature(AVX2)) {
+        simdDecodeUtf8_avx2(dst, src, end);
+        return true;
+    }
+#  endif
+    if (qCpuHasFeature(SSE4_1)) {
+        simdDecodeUtf8_sse4(dst, src, end);
+        return true;
+    }
+    return false;
+}
+
+static inline bool simdEncodeUtf8Kernel(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+#  if QT_COMPILER_SUPPORTS_HERE(AVX512VL) && QT_COMPILER_SUPPORTS_HERE(AVX512BW)
+    if (qCpuHasFeature(ArchSkylakeAvx512)) {
+        simdEncodeUtf8_avx512(dst, src, end);
+        return true;
+    }
+#  endif
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (qCpuHasFeature(AVX2)) {
+        simdEncodeUtf8_avx2(dst, src, end);
+        return true;
+    }
+#  endif
+    if (qCpuHasFeature(SSE4_1)) {
+        simdEncodeUtf8_sse4(dst, src, end);
+        return true;
+    }
+    return false;
+}
+
+static inline bool simdValidateUtf8(const uchar *&src, const uchar *end, bool &isAscii)
+{
+#  if QT_COMPILER_SUPPORTS_HERE(AVX2)
+    if (qCpuHasFeature(AVX2))
+        return simdValidateUtf8_avx2(src, end, isAscii);
+#  endif
+    if (qCpuHasFeature(SSE4_1))
+        return simdValidateUtf8_sse4(src, end, isAscii);
+    return true;
+}
+#elif QT_UTF8_SIMD_TRANSCODING
+// NEON has no movemask: weigh the lanes and add them up instead
+static inline uint neonMovemask(uint8x16_t mask)
+{
+    const uint8x16_t weights = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7,
+                                 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    mask = vandq_u8(mask, weights);
+    return vaddv_u8(vget_low_u8(mask)) | (uint(vaddv_u8(vget_high_u8(mask))) << 8);
+}
+
+static inline uint16x8_t neonDecodeUtf8Lanes(uint8x8_t in0, uint8x8_t in1, uint8x8_t in2,
+                                             uint8x8_t lead2, uint8x8_t lead3)
+{
+    const uint16x8_t b0 = vmovl_u8(in0);
+    const uint16x8_t c1 = vmovl_u8(vand_u8(in1, vdup_n_u8(0x3f)));
+    const uint16x8_t c2 = vmovl_u8(vand_u8(in2, vdup_n_u8(0x3f)));
+    const uint16x8_t two = vorrq_u16(vshlq_n_u16(vandq_u16(b0, vdupq_n_u16(0x1f)), 6), c1);
+    // the shift by 12 drops the 1110 marker of the leading byte
+    const uint16x8_t three = vorrq_u16(vorrq_u16(vshlq_n_u16(b0, 12), vshlq_n_u16(c1, 6)), c2);
+    const uint16x8_t result = vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(lead2))), two, b0);
+    return vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(lead3))), three, result);
+}
+
+static inline void neonCompactUtf16(char16_t *&dst, uint16x8_t data, uint keep)
+{
+    const uint8x16_t shuffled = vqtbl1q_u8(vreinterpretq_u8_u16(data), vld1q_u8(utf16CompactTable.masks[keep]));
+    vst1q_u16(reinterpret_cast<uint16_t *>(dst), vreinterpretq_u16_u8(shuffled));
+    dst += qPopulationCount(quint8(keep));
+}
+
+// See the SSE version for the details
+static inline bool simdDecodeUtf8Kernel(char16_t *&dst, const uchar *&src, const uchar *end)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+    while (end - src >= 18) {
+        const uint8x16_t in0 = vld1q_u8(src);
+        if (vmaxvq_u8(in0) < 0x80) {
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst), vmovl_u8(vget_low_u8(in0)));
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst) + 8, vmovl_u8(vget_high_u8(in0)));
+            src += 16;
+            dst += 16;
+            continue;
+        }
+
+        const uint8x16_t in1 = vld1q_u8(src + 1);
+        const uint8x16_t in2 = vld1q_u8(src + 2);
+        const uint8x16_t cont = vceqq_u8(vandq_u8(in0, vdupq_n_u8(0xc0)), vdupq_n_u8(0x80));
+        const uint8x16_t lead2 = vceqq_u8(vandq_u8(in0, vdupq_n_u8(0xe0)), vdupq_n_u8(0xc0));
+        const uint8x16_t lead3 = vceqq_u8(vandq_u8(in0, vdupq_n_u8(0xf0)), vdupq_n_u8(0xe0));
+        const uint8x16_t lead = vorrq_u8(lead2, lead3);
+        uint8x16_t error = veorq_u8(cont, vorrq_u8(vextq_u8(zero, lead, 15), vextq_u8(zero, lead3, 14)));
+        error = vorrq_u8(error, vcgeq_u8(in0, vdupq_n_u8(0xf0)));
+        error = vorrq_u8(error, vceqq_u8(vandq_u8(in0, vdupq_n_u8(0xfe)), vdupq_n_u8(0xc0)));
+        const uint8x16_t upperHalf = vtstq_u8(in1, vdupq_n_u8(0x20));
+        error = vorrq_u8(error, vbicq_u8(vceqq_u8(in0, vdupq_n_u8(0xe0)), upperHalf));
+        error = vorrq_u8(error, vandq_u8(vceqq_u8(in0, vdupq_n_u8(0xed)), upperHalf));
+        if (vmaxvq_u8(error))
+            return true;
+
+        const qsizetype size = 16 + ((vgetq_lane_u8(lead, 15) | vgetq_lane_u8(lead3, 14)) & 1)
+                + (vgetq_lane_u8(lead3, 15) & 1);
+        for (qsizetype i = 16; i < size; ++i) {
+            if ((src[i] & 0xc0) != 0x80)
+                return true;
+        }
+
+        const uint keep = ~neonMovemask(cont) & 0xffff;
+        neonCompactUtf16(dst, neonDecodeUtf8Lanes(vget_low_u8(in0), vget_low_u8(in1), vget_low_u8(in2),
+                                                  vget_low_u8(lead2), vget_low_u8(lead3)),
+                         keep & 0xff);
+        neonCompactUtf16(dst, neonDecodeUtf8Lanes(vget_high_u8(in0), vget_high_u8(in1), vget_high_u8(in2),
+                                                  vget_high_u8(lead2), vget_high_u8(lead3)),
+                         keep >> 8);
+        src += size;
+    }
+    return true;
+}
+
+static inline void neonEncodeUtf8Lanes(uchar *&dst, uint32x4_t u)
+{
+    const uint32x4_t low6 = vdupq_n_u32(0x3f);
+    const uint32x4_t contMarker = vdupq_n_u32(0x80);
+    const uint32x4_t last = vorrq_u32(vandq_u32(u, low6), contMarker);
+    const uint32x4_t middle = vorrq_u32(vandq_u32(vshrq_n_u32(u, 6), low6), contMarker);
+    const uint32x4_t two = vorrq_u32(vorrq_u32(vshrq_n_u32(u, 6), vdupq_n_u32(0xc0)),
+                                     vshlq_n_u32(last, 8));
+    const uint32x4_t three = vorrq_u32(vorrq_u32(vshrq_n_u32(u, 12), vdupq_n_u32(0xe0)),
+                                       vorrq_u32(vshlq_n_u32(middle, 8), vshlq_n_u32(last, 16)));
+    const uint32x4_t isOne = vcltq_u32(u, vdupq_n_u32(0x80));
+    const uint32x4_t isTwo = vcltq_u32(u, vdupq_n_u32(0x800));   // or one
+    const uint32x4_t bytes = vbslq_u32(isOne, u, vbslq_u32(isTwo, two, three));
+
+    const uint32x4_t weights = { 1, 1 << 1, 1 << 2, 1 << 3 };
+    const uint key = vaddvq_u32(vandq_u32(isOne, weights))
+            | (vaddvq_u32(vandq_u32(isTwo, weights)) << 4);
+    vst1q_u8(dst, vqtbl1q_u8(vreinterpretq_u8_u32(bytes), vld1q_u8(utf8PackTable.masks[key])));
+    dst += utf8PackTable.lengths[key];
+}
+
+static inline bool simdEncodeUtf8Kernel(uchar *&dst, const char16_t *&src, const char16_t *end)
+{
+    for ( ; end - src >= 8 + Utf8EncodeBlockSlack; src += 8) {
+        const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(src));
+        const uint16x8_t surrogates = vceqq_u16(vandq_u16(data, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800));
+        if (vmaxvq_u16(surrogates))
+            return true;
+        if (vmaxvq_u16(data) < 0x80) {
+            vst1_u8(dst, vmovn_u16(data));
+            dst += 8;
+            continue;
+        }
+        neonEncodeUtf8Lanes(dst, vmovl_u16(vget_low_u16(data)));
+        neonEncodeUtf8Lanes(dst, vmovl_u16(vget_high_u16(data)));
+    }
+    return true;
+}
+
+static inline bool simdValidateUtf8(const uchar *&src, const uchar *end, bool &isAscii)
+{
+    const uint8x16_t byte1High = vld1q_u8(utf8Byte1HighTable);
+    const uint8x16_t byte1Low = vld1q_u8(utf8Byte1LowTable);
+    const uint8x16_t byte2High = vld1q_u8(utf8Byte2HighTable);
+    const uint8x16_t incompleteMax = vld1q_u8(utf8IncompleteMax);
+    const uint8x16_t lowNibble = vdupq_n_u8(0x0f);
+    const uchar *const begin = src;
+    uint8x16_t prev = vdupq_n_u8(0);
+    uint8x16_t prevIncomplete = vdupq_n_u8(0);
+
+    for ( ; end - src >= 16; src += 16) {
+        const uint8x16_t input = vld1q_u8(src);
+        uint8x16_t error = prevIncomplete;
+        if (vmaxvq_u8(input) >= 0x80) {
+            isAscii = false;
+            const uint8x16_t prev1 = vextq_u8(prev, input, 15);
+            const uint8x16_t special = vandq_u8(
+                        vandq_u8(vqtbl1q_u8(byte1High, vshrq_n_u8(prev1, 4)),
+                                 vqtbl1q_u8(byte1Low, vandq_u8(prev1, lowNibble))),
+                        vqtbl1q_u8(byte2High, vshrq_n_u8(input, 4)));
+            const uint8x16_t must23 = vorrq_u8(
+                        vqsubq_u8(vextq_u8(prev, input, 14), vdupq_n_u8(0xe0 - 0x80)),
+                        vqsubq_u8(vextq_u8(prev, input, 13), vdupq_n_u8(0xf0 - 0x80)));
+            error = veorq_u8(vandq_u8(must23, vdupq_n_u8(0x80)), special);
+            prevIncomplete = vqsubq_u8(input, incompleteMax);
+        }
+        if (vmaxvq_u8(error))
+            return false;
+        prev = input;
+    }
+
+    src = utf8CharacterStart(src, begin);
+    return true;
+}
+#endif
+
+#if QT_UTF8_SIMD_TRANSCODING
+// Like simdDecodeAscii, but continues past the non-ASCII characters. If it
+// returns false, src points to a block the kernels don't handle and nextAscii
+// to where they should be tried again.
+static inline bool simdDecodeUtf8(char16_t *&dst, const uchar *&nextAscii, const uchar *&src, const uchar *end)
+{
+    if (simdDecodeAscii(dst, nextAscii, src, end))
+        return true;
+    if (!simdDecodeUtf8Kernel(dst, src, end))
+        return false;
+    if (src == end)
+        return true;
+    nextAscii = src + qMin<qsizetype>(end - src, 16);
+    return false;
+}
+
+static inline bool simdEncodeUtf8(uchar *&dst, const char16_t *&nextAscii, const char16_t *&src, const char16_t *end)
+{
+    if (simdEncodeAscii(dst, nextAscii, src, end))
+        return true;
+    if (!simdEncodeUtf8Kernel(dst, src, end))
+        return false;
+    if (src == end)
+        return true;
+    nextAscii = src + qMin<qsizetype>(end - src, 8);
+    return false;
+}
+#else
+static inline bool simdDecodeUtf8(char16_t *&dst, const uchar *&nextAscii, const uchar *&src, const uchar *end)
+{
+    return simdDecodeAscii(dst, nextAscii, src, end);
+}
+
+static inline bool simdEncodeUtf8(uchar *&dst, const char16_t *&nextAscii, const char16_t *&src, const char16_t *end)
+{
+    return simdEncodeAscii(dst, nextAscii, src, end);
+}
+
+static inline bool simdValidateUtf8(const uchar *&, const uchar *, bool &)
+{
+    return true;
+}
+#endif
+
 enum { HeaderDone = 1 };
 
 QByteArray QUtf8::convertFromUnicode(QStringView in)
@@ -483,7 +1307,7 @@ QByteArray QUtf8::convertFromUnicode(QStringView in)
 
     while (src != end) {
         const char16_t *nextAscii = end;
-        if (simdEncodeAscii(dst, nextAscii, src, end))
+        if (simdEncodeUtf8(dst, nextAscii, src, end))
             break;
 
         do {
@@ -549,7 +1373,7 @@ char *QUtf8::convertFromUnicode(char *out, QStringView in, QStringConverter::Sta
 
     while (src != end) {
         const char16_t *nextAscii = end;
-        if (simdEncodeAscii(cursor, nextAscii, src, end))
+        if (simdEncodeUtf8(cursor, nextAscii, src, end))
             break;
 
         do {
@@ -652,7 +1476,7 @@ char16_t *QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in) noexcept
 
         while (src < end) {
             nextAscii = end;
-            if (simdDecodeAscii(dst, nextAscii, src, end))
+            if (simdDecodeUtf8(dst, nextAscii, src, end))
                 break;
 
             do {
@@ -755,7 +1579,7 @@ char16_t *QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in, QStringConve
     res = 0;
     const uchar *nextAscii = src;
     while (res >= 0 && src < end) {
-        if (src >= nextAscii && simdDecodeAscii(dst, nextAscii, src, end))
+        if (src >= nextAscii && simdDecodeUtf8(dst, nextAscii, src, end))
             break;
 
         ch = *src++;
@@ -800,9 +1624,11 @@ QUtf8::ValidUtf8Result QUtf8::isValidUtf8(QByteArrayView in)
 {
     const uchar *src = reinterpret_cast<const uchar *>(in.data());
     const uchar *end = src + in.size();
-    const uchar *nextAscii = src;
     bool isValidAscii = true;
+    if (!simdValidateUtf8(src, end, isValidAscii))
+        return { false, false };
 
+    const uchar *nextAscii = src;
     while (src < end) {
         if (src >= nextAscii)
             src = simdFindNonAscii(src, end, nextAscii);
@@ -4,6 +4,9 @@
 
 #include "qstringmatcher.h"
 
+#include <private/qmatchersimd_p.h>
+#include <QtCore/qalgorithms.h>
+
 QT_BEGIN_NAMESPACE
 
 static constexpr qsizetype FoldBufferCapacity = 256;
@@ -42,6 +45,20 @@ static inline qsizetype bm_find(QStringView haystack, qsizetype index, QStringVi
         return index > l ? -1 : index;
 
     if (cs == Qt::CaseSensitive) {
+        if (index > l - pl)
+            return -1;
+        if (pl == 1) {
+            const char16_t *found = QtPrivate::qustrchr(haystack.sliced(index), *puc);
+            return found == uc + l ? -1 : found - uc;
+        }
+#ifdef __SSE2__
+        if (pl <= SimdFilterMaxNeedleLength) {
+            const qsizetype found = simd_find(uc, l, index, puc, pl);
+            if (found >= 0)
+                return found;
+            // the rest is shorter than a vector, if there is any
+        }
+#endif
         const qsizetype pl_minus_one = pl - 1;
         const char16_t *current = uc + index + pl_minus_one;
         const char16_t *end = uc + l;
@@ -3,9 +3,127 @@
 
 #include "qstringtokenizer.h"
 #include "qstringalgorithms.h"
+#include "qstring.h"
+
+#include <private/qsimd_p.h>
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+template <typename View, typename Char>
+struct TokenSink
+{
+    const Char *tokenStart;
+    View *out;
+    qsizetype capacity;
+    bool skipEmpty;
+    qsizetype count = 0;
+
+    void add(const Char *tokenEnd) noexcept
+    {
+        if (!skipEmpty || tokenEnd != tokenStart) {
+            if (count < capacity)
+                out[count] = View(tokenStart, tokenEnd - tokenStart);
+            ++count;
+        }
+        tokenStart = tokenEnd + 1;
+    }
+
+    // mask has one bit per character of the block, set for the separators
+    void addMatches(const Char *block, uint mask) noexcept
+    {
+        for ( ; mask; mask &= mask - 1)
+            add(block + qCountTrailingZeroBits(mask));
+    }
+};
+} // unnamed namespace
+
+/*!
+    \internal
+
+    Splits \a haystack wherever \a separator occurs and stores the first
+    \a capacity tokens in \a out, skipping empty ones if \a sb is
+    Qt::SkipEmptyParts. Returns the number of tokens in \a haystack, which is
+    larger than \a capacity if not all of them could be stored.
+
+    Unlike iterating over a QStringTokenizer, which searches for the next
+    separator once per token, this compares a whole block of characters at a
+    time and produces all the tokens that end in it, which is what makes the
+    difference for CSV-like data with many short fields.
+*/
+qsizetype QtPrivate::Tok::tokenizeInto(QStringView haystack, char16_t separator,
+                                       Qt::SplitBehavior sb,
+                                       QStringView *out, qsizetype capacity) noexcept
+{
+    const char16_t *ptr = haystack.utf16();
+    const char16_t *const end = ptr + haystack.size();
+    TokenSink<QStringView, char16_t> sink{ptr, out, capacity, bool(sb & Qt::SkipEmptyParts)};
+
+#if defined(__SSE2__)
+    // PACKSSWB turns the two 0x0000/0xffff comparison results into one byte
+    // per character, so PMOVMSKB gives us one bit per character
+    const __m128i mch = _mm_set1_epi16(short(separator));
+    for ( ; end - ptr >= 16; ptr += 16) {
+        const __m128i data1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        const __m128i data2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 8));
+        const __m128i result = _mm_packs_epi16(_mm_cmpeq_epi16(data1, mch),
+                                               _mm_cmpeq_epi16(data2, mch));
+        sink.addMatches(ptr, uint(_mm_movemask_epi8(result)));
+    }
+#elif defined(__ARM_NEON__)
+    const uint16x8_t vmask = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    const uint16x8_t ch_vec = vdupq_n_u16(separator);
+    for ( ; end - ptr >= 8; ptr += 8) {
+        const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(ptr));
+        sink.addMatches(ptr, vaddvq_u16(vandq_u16(vceqq_u16(data, ch_vec), vmask)));
+    }
+#endif
+
+    for ( ; ptr != end; ++ptr) {
+        if (*ptr == separator)
+            sink.add(ptr);
+    }
+    sink.add(end);
+    return sink.count;
+}
+
+/*!
+    \internal
+    \overload
+*/
+qsizetype QtPrivate::Tok::tokenizeInto(QLatin1StringView haystack, char separator,
+                                       Qt::SplitBehavior sb,
+                                       QLatin1StringView *out, qsizetype capacity) noexcept
+{
+    const char *ptr = haystack.data();
+    const char *const end = ptr + haystack.size();
+    TokenSink<QLatin1StringView, char> sink{ptr, out, capacity, bool(sb & Qt::SkipEmptyParts)};
+
+#if defined(__SSE2__)
+    const __m128i mch = _mm_set1_epi8(separator);
+    for ( ; end - ptr >= 16; ptr += 16) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+        sink.addMatches(ptr, uint(_mm_movemask_epi8(_mm_cmpeq_epi8(data, mch))));
+    }
+#elif defined(__ARM_NEON__)
+    const uint8x8_t vmask = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    const uint8x16_t ch_vec = vdupq_n_u8(uchar(separator));
+    for ( ; end - ptr >= 16; ptr += 16) {
+        const uint8x16_t result = vceqq_u8(vld1q_u8(reinterpret_cast<const uchar *>(ptr)), ch_vec);
+        const uint mask = vaddv_u8(vand_u8(vget_low_u8(result), vmask))
+                | (uint(vaddv_u8(vand_u8(vget_high_u8(result), vmask))) << 8);
+        sink.addMatches(ptr, mask);
+    }
+#endif
+
+    for ( ; ptr != end; ++ptr) {
+        if (*ptr == separator)
+            sink.add(ptr);
+    }
+    sink.add(end);
+    return sink.count;
+}
+
 /*!
     \class QStringTokenizer
     \inmodule QtCore
@@ -307,6 +425,52 @@ QT_BEGIN_NAMESPACE
     filled, and returned by value.
 */
 
+/*!
+    \fn template <typename Haystack, typename Needle> template<typename LSpan> qsizetype QStringTokenizer<Haystack, Needle>::tokenizeInto(LSpan &&out) const &
+    \since 6.9
+
+    Stores the tokens in the pre-sized contiguous range \a out, such as a
+    QSpan, a QVarLengthArray or a std::array of value_type, and returns the
+    number of tokens. No memory is allocated.
+
+    If there are more tokens than fit in \a out, only the first
+    \c{std::size(out)} tokens are stored, but the return value is still the
+    total number of tokens, so you can detect that case and try again with a
+    bigger range:
+
+    \code
+    QVarLengthArray<QStringView, 32> fields(32);
+    for (QStringView line : QStringTokenizer{text, u'\n'}) {
+        const qsizetype n = QStringTokenizer{line, u','}.tokenizeInto(fields);
+        if (n > fields.size()) {
+            fields.resize(n);
+            QStringTokenizer{line, u','}.tokenizeInto(fields);
+        }
+        process(QSpan(fields).first(n));
+    }
+    \endcode
+
+    When the separator is a single character matched case-sensitively, the
+    haystack is scanned for it in blocks of several characters at a time,
+    which is considerably faster than iterating over the tokenizer when the
+    tokens are short.
+
+    This function is only available if \c{std::data(out)} is a pointer to
+    this tokenizer's value_type.
+
+    \sa toContainer()
+*/
+
+/*!
+    \fn template <typename Haystack, typename Needle> template<typename RSpan> qsizetype QStringTokenizer<Haystack, Needle>::tokenizeInto(RSpan &&out) const &&
+    \since 6.9
+    \overload
+
+    Like toContainer(), this rvalue-this overload is only available when this
+    QStringTokenizer does not store the haystack internally, as that would
+    leave \a out full of dangling references.
+*/
+
 /*!
     \fn template <typename Haystack, typename Needle, typename...Flags> auto qTokenize(Haystack &&haystack, Needle &&needle, Flags...flags)
     \relates QStringTokenizer
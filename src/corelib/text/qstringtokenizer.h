@@ -42,6 +42,8 @@ class QStringTokenizerBase : protected QStringTokenizerBaseBase
     };
     inline next_result next(tokenizer_state state) const noexcept;
     inline next_result toFront() const noexcept { return next({}); }
+protected:
+    inline qsizetype tokenizeIntoImpl(Haystack *out, qsizetype capacity) const noexcept;
 public:
     constexpr explicit QStringTokenizerBase(Haystack haystack, Needle needle, Qt::SplitBehavior sb, Qt::CaseSensitivity cs) noexcept
         : QStringTokenizerBaseBase{sb, cs}, m_haystack{haystack}, m_needle{needle} {}
@@ -131,6 +133,20 @@ namespace Tok {
     template <typename String>
     constexpr qsizetype size(const String &s) noexcept { return static_cast<qsizetype>(s.size()); }
 
+    constexpr char16_t front(QChar c) noexcept { return c.unicode(); }
+    template <typename String>
+    constexpr char16_t front(const String &s) noexcept { return s.front().unicode(); }
+
+    // Split the whole haystack along a single, case-sensitively matched
+    // character, storing at most capacity tokens in out; returns the total
+    // number of tokens.
+    Q_CORE_EXPORT qsizetype tokenizeInto(QStringView haystack, char16_t separator,
+                                         Qt::SplitBehavior sb,
+                                         QStringView *out, qsizetype capacity) noexcept;
+    Q_CORE_EXPORT qsizetype tokenizeInto(QLatin1StringView haystack, char separator,
+                                         Qt::SplitBehavior sb,
+                                         QLatin1StringView *out, qsizetype capacity) noexcept;
+
     template <typename String> struct ViewForImpl {};
     template <> struct ViewForImpl<QStringView>   { using type = QStringView; };
     template <> struct ViewForImpl<QLatin1StringView> { using type = QLatin1StringView; };
@@ -263,6 +279,11 @@ class QStringTokenizer
             >::value,
             bool
         >::type;
+    template <typename Span, typename Pointer = decltype(std::data(std::declval<Span &>()))>
+    using if_compatible_span = typename std::enable_if<
+            std::is_same<Pointer, typename Base::value_type *>::value,
+            bool
+        >::type;
 public:
     using value_type      = typename Base::value_type;
     using difference_type = typename Base::difference_type;
@@ -327,6 +348,23 @@ public:
         return std::forward<Container>(c);
     }
 #endif
+
+#ifdef Q_QDOC
+    template<typename LSpan> qsizetype tokenizeInto(LSpan &&out) const & {}
+    template<typename RSpan> qsizetype tokenizeInto(RSpan &&out) const && {}
+#else
+    template<typename Span, if_compatible_span<Span> = true>
+    qsizetype tokenizeInto(Span &&out) const & noexcept
+    {
+        return this->tokenizeIntoImpl(std::data(out), qsizetype(std::size(out)));
+    }
+    template<typename Span, if_compatible_span<Span> = true,
+             if_haystack_not_pinned<Span> = true>
+    qsizetype tokenizeInto(Span &&out) const && noexcept
+    {
+        return this->tokenizeIntoImpl(std::data(out), qsizetype(std::size(out)));
+    }
+#endif
 };
 
 namespace QtPrivate {
@@ -413,6 +451,29 @@ auto QStringTokenizerBase<Haystack, Needle>::next(tokenizer_state state) const n
     }
 }
 
+template <typename Haystack, typename Needle>
+qsizetype QStringTokenizerBase<Haystack, Needle>::tokenizeIntoImpl(Haystack *out, qsizetype capacity) const noexcept
+{
+    if (m_cs == Qt::CaseSensitive && QtPrivate::Tok::size(m_needle) == 1) {
+        const char16_t separator = QtPrivate::Tok::front(m_needle);
+        if constexpr (std::is_same_v<Haystack, QStringView>) {
+            return QtPrivate::Tok::tokenizeInto(m_haystack, separator, m_sb, out, capacity);
+        } else {
+            // a separator outside Latin-1 can't match; fall through
+            if (separator <= 0xff)
+                return QtPrivate::Tok::tokenizeInto(m_haystack, char(separator), m_sb, out, capacity);
+        }
+    }
+
+    qsizetype count = 0;
+    for (auto token : *this) {
+        if (count < capacity)
+            out[count] = token;
+        ++count;
+    }
+    return count;
+}
+
 QT_END_NAMESPACE
 
 #endif /* QSTRINGTOKENIZER_H */
@@ -0,0 +1,197 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qcoroutine.h"
+
+#include <QtCore/qabstracteventdispatcher.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QCoroTask
+    \inmodule QtCore
+    \ingroup thread
+    \since 6.9
+
+    \brief The QCoroTask class is the return type of coroutines that
+    await futures, signals or other tasks.
+
+    A function returning QCoroTask<T> is a C++20 coroutine: it may use
+    \c co_await on a QFuture, on a signal wrapped by qAwaitSignal() or on
+    another QCoroTask, and ends with \c co_return. The coroutine starts
+    running as soon as it is called, and runs until it first has to wait.
+
+    \snippet code/src_corelib_thread_qcoroutine.cpp 0
+
+    A coroutine always continues on the thread it was suspended on. When
+    the awaited future finishes, or the awaited signal is emitted, on a
+    different thread, the coroutine is resumed from the event loop of its
+    own thread, so the code between two \c co_await expressions behaves
+    like the body of a slot. If they happen on the same thread, the
+    coroutine is resumed right away. A thread that has no event dispatcher
+    cannot be returned to; in that case the coroutine continues on the
+    thread that finished the future or emitted the signal.
+
+    Compared to a chain of QFuture::then() continuations, a coroutine
+    allocates only its own frame: awaiting a future stores one small
+    continuation in it and, unless the future finishes on another thread,
+    allocates nothing else. All the steps of the computation also show up
+    as one function in a profiler.
+
+    Awaiting a task returns the value the coroutine passed to
+    \c co_return, or rethrows the exception that left it. A task can be
+    awaited only once. Destroying a QCoroTask object does not stop the
+    coroutine; it runs to its end and then frees its frame.
+
+    Awaiting a future attaches a continuation to it, in the same way as
+    QFuture::then() does, so a future must not be both awaited and given a
+    continuation. Awaiting a future that was canceled without a result has
+    the same effect as calling QFuture::result() on it.
+
+    Coroutine support requires a compiler in C++20 mode that implements
+    coroutines; the header provides nothing else otherwise.
+
+    \sa QFuture, QPromise, qAwaitSignal()
+*/
+
+/*!
+    \fn template <typename T> QCoroTask<T>::QCoroTask()
+
+    Constructs an invalid task, which is not associated with a coroutine.
+*/
+
+/*!
+    \fn template <typename T> QCoroTask<T>::QCoroTask(QCoroTask &&other)
+
+    Move-constructs a task from \a other, which becomes invalid.
+*/
+
+/*!
+    \fn template <typename T> QCoroTask<T> &QCoroTask<T>::operator=(QCoroTask &&other)
+
+    Move-assigns \a other to this task and returns a reference to it.
+*/
+
+/*!
+    \fn template <typename T> QCoroTask<T>::~QCoroTask()
+
+    Destroys the task. If the coroutine has not finished, it keeps running
+    and frees itself once it returns.
+*/
+
+/*!
+    \fn template <typename T> void QCoroTask<T>::swap(QCoroTask &other)
+
+    Swaps this task with \a other.
+*/
+
+/*!
+    \fn template <typename T> bool QCoroTask<T>::isValid() const
+
+    Returns \c true if this task is associated with a coroutine.
+*/
+
+/*!
+    \fn template <typename T> bool QCoroTask<T>::isFinished() const
+
+    Returns \c true if the coroutine has returned, or has left with an
+    exception.
+*/
+
+/*!
+    \fn template <typename T> auto QCoroTask<T>::operator co_await() const
+
+    Suspends the awaiting coroutine until this task has finished, and
+    returns its result.
+*/
+
+/*!
+    \fn template <typename T> auto operator co_await(QFuture<T> future)
+    \relates QCoroTask
+    \since 6.9
+
+    Makes \a future awaitable. The awaiting coroutine is suspended until
+    the future has finished. The expression then evaluates to the result of
+    the future, or nothing for QFuture<void>; if the computation reported
+    an exception, it is rethrown.
+*/
+
+/*!
+    \fn template <typename Sender, typename Signal> auto qAwaitSignal(Sender *sender, Signal signal)
+    \relates QCoroTask
+    \since 6.9
+
+    Returns an object that can be awaited in a coroutine until \a sender
+    next emits \a signal. The expression evaluates to nothing if the signal
+    has no arguments, to the argument if it has one, and to a \c std::tuple
+    of the arguments otherwise, exactly as for QtFuture::connect().
+
+    \a sender must not be \nullptr. If it is destroyed before it emits the
+    signal, the coroutine is never resumed.
+*/
+
+namespace QtPrivate {
+
+enum ResumerState { Suspending, Suspended, Ready };
+
+void CoroutineResumer::prepare(ResumeFunction function, void *address)
+{
+    resumeFunction = function;
+    frame = address;
+    QAbstractEventDispatcher *eventDispatcher = QAbstractEventDispatcher::instance();
+    dispatcher = eventDispatcher;
+    threadId = eventDispatcher ? QThread::currentThreadId() : nullptr;
+    state.storeRelaxed(Suspending);
+}
+
+bool CoroutineResumer::canResumeInline() const
+{
+    return !threadId || threadId == QThread::currentThreadId();
+}
+
+void CoroutineResumer::resume()
+{
+    if (canResumeInline()) {
+        resumeFunction(frame);
+        return;
+    }
+
+    QObject *context = dispatcher.data();
+    if (!context) {
+        qWarning("QCoroTask: cannot resume a coroutine whose thread has finished");
+        return;
+    }
+    QMetaObject::invokeMethod(context, [this] { resumeFunction(frame); }, Qt::QueuedConnection);
+}
+
+/*
+    Attaches a continuation to \a fi that resumes the coroutine. Returns
+    false if the future finished before the coroutine could be suspended,
+    in which case it must not be suspended at all. The continuation only
+    captures this object, which lives in the suspended coroutine's frame,
+    so storing it in the future does not allocate.
+*/
+bool CoroutineResumer::suspendUntilFinished(QFutureInterfaceBase &fi)
+{
+    fi.setContinuation([this](const QFutureInterfaceBase &) { continuationReady(); });
+    return state.testAndSetOrdered(Suspending, Suspended);
+}
+
+void CoroutineResumer::continuationReady()
+{
+    // if suspendUntilFinished() has not returned yet, it keeps the
+    // coroutine running
+    if (state.fetchAndStoreOrdered(Ready) == Suspending)
+        return;
+    resume();
+}
+
+QObject *CoroutineResumer::currentThreadContext()
+{
+    return QAbstractEventDispatcher::instance();
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
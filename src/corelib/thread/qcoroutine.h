@@ -0,0 +1,359 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCOROUTINE_H
+#define QCOROUTINE_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qfuture.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qpointer.h>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#endif
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <utility>
+
+QT_REQUIRE_CONFIG(future);
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+// Resumes a suspended coroutine on the thread that suspended it. Kept free
+// of the coroutine types, so that it can be implemented in QtCore.
+class Q_CORE_EXPORT CoroutineResumer
+{
+    Q_DISABLE_COPY_MOVE(CoroutineResumer)
+public:
+    using ResumeFunction = void (*)(void *address);
+
+    CoroutineResumer() = default;
+
+    void prepare(ResumeFunction function, void *address);
+    bool canResumeInline() const;
+    void resume();
+
+    bool suspendUntilFinished(QFutureInterfaceBase &fi);
+
+    static QObject *currentThreadContext();
+
+private:
+    void continuationReady();
+
+    ResumeFunction resumeFunction = nullptr;
+    void *frame = nullptr;
+    QPointer<QObject> dispatcher;
+    Qt::HANDLE threadId = nullptr;
+    QAtomicInt state;
+};
+
+} // namespace QtPrivate
+
+#if (defined(__cpp_impl_coroutine) && __has_include(<coroutine>)) || defined(Q_QDOC)
+
+template <typename T = void>
+class QCoroTask;
+
+namespace QtPrivate {
+
+inline void resumeCoroutine(void *address)
+{
+    std::coroutine_handle<>::from_address(address).resume();
+}
+
+template <typename T>
+class FutureAwaiter
+{
+    Q_DISABLE_COPY_MOVE(FutureAwaiter)
+public:
+    explicit FutureAwaiter(QFuture<T> &&f) : future(std::move(f)) {}
+
+    bool await_ready() const { return future.isFinished(); }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        resumer.prepare(&resumeCoroutine, handle.address());
+        QFutureInterfaceBase fi = QFutureInterfaceBase::get(future);
+        return resumer.suspendUntilFinished(fi);
+    }
+
+    T await_resume()
+    {
+        if constexpr (std::is_void_v<T>)
+            future.waitForFinished();
+        else if constexpr (std::is_copy_constructible_v<T>)
+            return future.result();
+        else
+            return future.takeResult();
+    }
+
+private:
+    QFuture<T> future;
+    CoroutineResumer resumer;
+};
+
+template <typename Sender, typename Signal>
+class SignalAwaiter
+{
+    Q_DISABLE_COPY_MOVE(SignalAwaiter)
+public:
+    using Result = QtFuture::ArgsType<Signal>;
+
+    SignalAwaiter(Sender *s, Signal sig) : sender(s), signal(sig) { Q_ASSERT(sender); }
+    ~SignalAwaiter() { QObject::disconnect(connection); }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        QObject *context = CoroutineResumer::currentThreadContext();
+        if (!context)
+            context = sender;
+
+        if constexpr (std::is_void_v<Result>) {
+            connection = QObject::connect(sender, signal, context, [handle] {
+                handle.resume();
+            }, Qt::SingleShotConnection);
+        } else if constexpr (QtPrivate::ArgResolver<Signal>::HasExtraArgs) {
+            connection = QObject::connect(sender, signal, context, [this, handle](auto... values) {
+                result.emplace(QtPrivate::createTuple(std::move(values)...));
+                handle.resume();
+            }, Qt::SingleShotConnection);
+        } else {
+            connection = QObject::connect(sender, signal, context, [this, handle](Result value) {
+                result.emplace(std::move(value));
+                handle.resume();
+            }, Qt::SingleShotConnection);
+        }
+        Q_ASSERT(connection);
+    }
+
+    Result await_resume()
+    {
+        if constexpr (!std::is_void_v<Result>)
+            return std::move(*result);
+    }
+
+private:
+    Sender *sender;
+    Signal signal;
+    QMetaObject::Connection connection;
+    std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>> result = {};
+};
+
+class TaskAwaiterBase
+{
+public:
+    std::coroutine_handle<> continuation;
+    CoroutineResumer resumer;
+};
+
+class CoroTaskPromiseBase
+{
+    Q_DISABLE_COPY_MOVE(CoroTaskPromiseBase)
+public:
+    CoroTaskPromiseBase() = default;
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            return handle.promise().finish(handle);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept
+    {
+#ifndef QT_NO_EXCEPTIONS
+        exception = std::current_exception();
+#else
+        std::terminate();
+#endif
+    }
+
+    bool isFinished() const noexcept
+    {
+        return awaiter.load(std::memory_order_acquire) == finishedMarker();
+    }
+
+    // Returns false if the coroutine finished in the meantime.
+    bool setAwaiter(TaskAwaiterBase *waiting) noexcept
+    {
+        void *expected = nullptr;
+        return awaiter.compare_exchange_strong(expected, waiting, std::memory_order_acq_rel);
+    }
+
+    // The task object and the running coroutine each hold a reference to
+    // the coroutine frame; whichever lets go last destroys it.
+    void release(std::coroutine_handle<> self) noexcept
+    {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            self.destroy();
+    }
+
+    std::coroutine_handle<> finish(std::coroutine_handle<> self) noexcept
+    {
+        void *waiting = awaiter.exchange(finishedMarker(), std::memory_order_acq_rel);
+        // once the reference is given up, the task may destroy the frame
+        // from another thread; only locals are used below
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            self.destroy();
+            return std::noop_coroutine();
+        }
+        if (!waiting)
+            return std::noop_coroutine();
+        auto *w = static_cast<TaskAwaiterBase *>(waiting);
+        if (w->resumer.canResumeInline())
+            return w->continuation;
+        w->resumer.resume();
+        return std::noop_coroutine();
+    }
+
+protected:
+    void rethrowPossibleException()
+    {
+#ifndef QT_NO_EXCEPTIONS
+        if (exception)
+            std::rethrow_exception(exception);
+#endif
+    }
+
+private:
+    void *finishedMarker() const noexcept { return const_cast<CoroTaskPromiseBase *>(this); }
+
+    std::exception_ptr exception;
+    std::atomic<void *> awaiter = nullptr;
+    std::atomic<int> refs = 2;
+};
+
+template <typename T>
+class CoroTaskPromise : public CoroTaskPromiseBase
+{
+public:
+    QCoroTask<T> get_return_object() noexcept;
+
+    template <typename U = T, std::enable_if_t<std::is_convertible_v<U, T>, bool> = true>
+    void return_value(U &&v) { value.emplace(std::forward<U>(v)); }
+
+    T result()
+    {
+        rethrowPossibleException();
+        Q_ASSERT(value);
+        return std::move(*value);
+    }
+
+private:
+    std::optional<T> value;
+};
+
+template <>
+class CoroTaskPromise<void> : public CoroTaskPromiseBase
+{
+public:
+    QCoroTask<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void result() { rethrowPossibleException(); }
+};
+
+template <typename T>
+class TaskAwaiter : public TaskAwaiterBase
+{
+    Q_DISABLE_COPY_MOVE(TaskAwaiter)
+public:
+    explicit TaskAwaiter(std::coroutine_handle<CoroTaskPromise<T>> h) : task(h) {}
+
+    bool await_ready() const noexcept { return task.promise().isFinished(); }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        continuation = handle;
+        resumer.prepare(&resumeCoroutine, handle.address());
+        return task.promise().setAwaiter(this);
+    }
+
+    T await_resume() { return task.promise().result(); }
+
+private:
+    std::coroutine_handle<CoroTaskPromise<T>> task;
+};
+
+} // namespace QtPrivate
+
+template <typename T>
+class QCoroTask
+{
+    static_assert(!std::is_reference_v<T>, "QCoroTask does not support reference types");
+public:
+    using promise_type = QtPrivate::CoroTaskPromise<T>;
+
+    QCoroTask() noexcept = default;
+    QCoroTask(QCoroTask &&other) noexcept : handle(std::exchange(other.handle, {})) {}
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_MOVE_AND_SWAP(QCoroTask)
+    ~QCoroTask()
+    {
+        if (handle)
+            handle.promise().release(handle);
+    }
+
+    void swap(QCoroTask &other) noexcept { std::swap(handle, other.handle); }
+
+    bool isValid() const noexcept { return bool(handle); }
+    bool isFinished() const noexcept { return handle && handle.promise().isFinished(); }
+
+    QtPrivate::TaskAwaiter<T> operator co_await() const noexcept
+    {
+        Q_ASSERT(handle);
+        return QtPrivate::TaskAwaiter<T>(handle);
+    }
+
+private:
+    Q_DISABLE_COPY(QCoroTask)
+    friend promise_type;
+
+    explicit QCoroTask(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T>
+QCoroTask<T> QtPrivate::CoroTaskPromise<T>::get_return_object() noexcept
+{
+    return QCoroTask<T>(std::coroutine_handle<CoroTaskPromise<T>>::from_promise(*this));
+}
+
+inline QCoroTask<void> QtPrivate::CoroTaskPromise<void>::get_return_object() noexcept
+{
+    return QCoroTask<void>(std::coroutine_handle<CoroTaskPromise<void>>::from_promise(*this));
+}
+
+template <typename T>
+QtPrivate::FutureAwaiter<T> operator co_await(QFuture<T> future)
+{
+    return QtPrivate::FutureAwaiter<T>(std::move(future));
+}
+
+template <typename Sender, typename Signal,
+          typename = QtPrivate::EnableIfInvocable<Sender, Signal>>
+QtPrivate::SignalAwaiter<Sender, Signal> qAwaitSignal(Sender *sender, Signal signal)
+{
+    return QtPrivate::SignalAwaiter<Sender, Signal>(sender, signal);
+}
+
+#endif // __cpp_impl_coroutine
+
+QT_END_NAMESPACE
+
+#endif // QCOROUTINE_H
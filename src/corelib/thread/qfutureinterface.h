@@ -43,6 +43,8 @@ class FailureHandler;
 void Q_CORE_EXPORT watchContinuationImpl(const QObject *context,
                                          QtPrivate::QSlotObjectBase *slotObj,
                                          QFutureInterfaceBase &fi);
+
+class CoroutineResumer;
 }
 
 class Q_CORE_EXPORT QFutureInterfaceBase
@@ -187,6 +189,8 @@ private:
     template<class T>
     friend class QPromise;
 
+    friend class QtPrivate::CoroutineResumer;
+
 protected:
     void setContinuation(std::function<void(const QFutureInterfaceBase &)> func);
     void setContinuation(std::function<void(const QFutureInterfaceBase &)> func,
@@ -9,6 +9,7 @@
 #include "qthread.h"
 #include "qreadwritelock_p.h"
 #include "private/qfreelist_p.h"
+#include "private/qfutex_p.h"
 #include "private/qlocking_p.h"
 
 #include <algorithm>
@@ -25,9 +26,25 @@ QT_BEGIN_NAMESPACE
  *    are waiting, and the lock is not recursive.
  *  - when d_ptr == 0x2: We are locked for write and nobody is waiting. (no contention)
  *  - In any other case, d_ptr points to an actual QReadWriteLockPrivate.
+ *
+ * On platforms with futexes, a non-recursive lock never uses a
+ * QReadWriteLockPrivate. d_ptr holds the whole state of the lock, and
+ * threads that have to wait sleep on it. Besides StateLockedForRead and
+ * StateLockedForWrite, which mean the same as above, it has:
+ *  - FutexReadersWaiting: readers are sleeping, or about to.
+ *  - FutexPreferReaders: the lock uses ContentionPolicy::PreferReaders.
+ *  - FutexWritersWaiting: writers are waiting; their number is stored in the
+ *    FutexWaitingWritersMask bits.
+ *  - when locked for read, the number of reading threads minus 1, from bit
+ *    FutexReaderShift up.
+ * The uncontended states are the same in both cases, so the fast paths are
+ * shared. A recursive lock always points to its QReadWriteLockPrivate, which
+ * is aligned so that none of the FutexStateMask bits is set; any other value
+ * but 0x0 has at least one of them set.
  */
 
 using namespace QReadWriteLockStates;
+using namespace QtFutex;
 namespace {
 
 using steady_clock = std::chrono::steady_clock;
@@ -36,12 +53,21 @@ const auto dummyLockedForRead = reinterpret_cast<QReadWriteLockPrivate *>(quintp
 const auto dummyLockedForWrite = reinterpret_cast<QReadWriteLockPrivate *>(quintptr(StateLockedForWrite));
 inline bool isUncontendedLocked(const QReadWriteLockPrivate *d)
 { return quintptr(d) & StateMask; }
+inline bool isFutexState(const QReadWriteLockPrivate *d)
+{ return !d || (quintptr(d) & FutexStateMask); }
+inline QReadWriteLockPrivate *futexState(quintptr value)
+{ return reinterpret_cast<QReadWriteLockPrivate *>(value); }
 }
 
 static bool contendedTryLockForRead(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
                                     QDeadlineTimer timeout, QReadWriteLockPrivate *d);
 static bool contendedTryLockForWrite(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
                                      QDeadlineTimer timeout, QReadWriteLockPrivate *d);
+static bool futexTryLockForRead(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
+                                QDeadlineTimer timeout, QReadWriteLockPrivate *d);
+static bool futexTryLockForWrite(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
+                                 QDeadlineTimer timeout, QReadWriteLockPrivate *d);
+static void futexUnlock(QAtomicPointer<QReadWriteLockPrivate> &d_ptr, QReadWriteLockPrivate *d);
 
 /*! \class QReadWriteLock
     \inmodule QtCore
@@ -71,7 +97,14 @@ static bool contendedTryLockForWrite(QAtomicPointer<QReadWriteLockPrivate> &d_pt
     writer waiting for access, even if the lock is currently only
     accessed by other readers. Also, if the lock is accessed by a
     writer and another writer comes in, that writer will have
-    priority over any readers that might also be waiting.
+    priority over any readers that might also be waiting. A lock
+    constructed with ContentionPolicy::PreferReaders instead lets
+    readers in as long as no writer holds the lock.
+
+    On platforms that provide futexes (Linux, Windows, FreeBSD and
+    macOS), a non-recursive QReadWriteLock does not allocate anything,
+    not even under contention, and a reader only has to wait if a
+    writer holds or waits for the lock.
 
     Like QMutex, a QReadWriteLock can be recursively locked by the
     same thread when constructed with \l{QReadWriteLock::Recursive} as
@@ -109,6 +142,46 @@ static bool contendedTryLockForWrite(QAtomicPointer<QReadWriteLockPrivate> &d_pt
 
     \sa lockForRead(), lockForWrite(), RecursionMode
 */
+
+/*!
+    \enum QReadWriteLock::ContentionPolicy
+    \since 6.9
+
+    This enum describes who gets the lock when readers and writers
+    compete for it.
+
+    \value PreferWriters A reader waits while a writer is waiting for
+    the lock, even if the lock is only held by other readers. Writers
+    cannot be starved by a steady stream of readers. This is the
+    default.
+
+    \value PreferReaders A reader gets the lock as long as no writer
+    holds it. This gives the highest read throughput, but writers may
+    wait for as long as readers keep overlapping. On platforms without
+    futexes, only recursive locks support this policy.
+
+    \sa QReadWriteLock()
+*/
+
+/*!
+    \since 6.9
+
+    Constructs a QReadWriteLock object in the given \a recursionMode that
+    arbitrates between readers and writers according to \a policy.
+
+    \sa RecursionMode, ContentionPolicy
+*/
+QReadWriteLock::QReadWriteLock(RecursionMode recursionMode, ContentionPolicy policy)
+    : d_ptr(recursionMode == Recursive ? initRecursive() : nullptr)
+{
+    if (policy != ContentionPolicy::PreferReaders)
+        return;
+    if (QReadWriteLockPrivate *d = d_ptr.loadRelaxed())
+        d->preferReaders = true;
+    else if (futexAvailable())
+        d_ptr.storeRelaxed(futexState(FutexPreferReaders));
+}
+
 QReadWriteLockPrivate *QReadWriteLock::initRecursive()
 {
     auto d = new QReadWriteLockPrivate(true);
@@ -129,6 +202,8 @@ void QReadWriteLock::destroyRecursive(QReadWriteLockPrivate *d)
         qWarning("QReadWriteLock: destroying locked QReadWriteLock");
         return;
     }
+    if (futexAvailable() && isFutexState(d))
+        return;     // an unlocked lock with ContentionPolicy::PreferReaders
     delete d;
 }
 
@@ -187,6 +262,8 @@ bool QReadWriteLock::tryLockForRead(QDeadlineTimer timeout)
     QReadWriteLockPrivate *d = d_ptr.loadRelaxed();
     if (d == nullptr && d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead, d))
         return true;
+    if (futexAvailable() && isFutexState(d))
+        return futexTryLockForRead(d_ptr, timeout, d);
     return contendedTryLockForRead(d_ptr, timeout, d);
 }
 
@@ -302,6 +379,8 @@ bool QReadWriteLock::tryLockForWrite(QDeadlineTimer timeout)
     QReadWriteLockPrivate *d = d_ptr.loadRelaxed();
     if (d == nullptr && d_ptr.testAndSetAcquire(nullptr, dummyLockedForWrite, d))
         return true;
+    if (futexAvailable() && isFutexState(d))
+        return futexTryLockForWrite(d_ptr, timeout, d);
     return contendedTryLockForWrite(d_ptr, timeout, d);
 }
 
@@ -361,6 +440,8 @@ Q_NEVER_INLINE static bool contendedTryLockForWrite(QAtomicPointer<QReadWriteLoc
 void QReadWriteLock::unlock()
 {
     QReadWriteLockPrivate *d = d_ptr.loadAcquire();
+    if (futexAvailable() && isFutexState(d))
+        return futexUnlock(d_ptr, d);
     while (true) {
         Q_ASSERT_X(d, "QReadWriteLock::unlock()", "Cannot unlock an unlocked lock");
 
@@ -410,11 +491,138 @@ void QReadWriteLock::unlock()
     }
 }
 
+static bool futexWaitUntil(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
+                           QReadWriteLockPrivate *expected, QDeadlineTimer timeout)
+{
+    if (timeout.isForever()) {
+        futexWait(d_ptr, expected);
+        return true;
+    }
+    return futexWait(d_ptr, expected, timeout);
+}
+
+Q_NEVER_INLINE static bool futexTryLockForRead(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
+                                               QDeadlineTimer timeout, QReadWriteLockPrivate *d)
+{
+    while (true) {
+        Q_ASSERT(isFutexState(d));
+        const quintptr state = quintptr(d);
+        const bool writerFirst = (state & FutexWritersWaiting) && !(state & FutexPreferReaders);
+        if (!(state & StateLockedForWrite) && !writerFirst) {
+            quintptr val = state | StateLockedForRead;
+            if (state & StateLockedForRead) {
+                val = state + FutexReaderIncrement;
+                Q_ASSERT_X(val > state, "QReadWriteLock::tryLockForRead()",
+                           "Overflow in lock counter");
+            }
+            if (d_ptr.testAndSetAcquire(d, futexState(val), d))
+                return true;
+            continue;
+        }
+
+        if (timeout.hasExpired())
+            return false;
+
+        // tell the thread unlocking that there is someone to wake up
+        const quintptr waiting = state | FutexReadersWaiting;
+        if (waiting != state && !d_ptr.testAndSetRelaxed(d, futexState(waiting), d))
+            continue;
+        futexWaitUntil(d_ptr, futexState(waiting), timeout);
+        d = d_ptr.loadRelaxed();
+    }
+}
+
+static quintptr removeWaitingWriter(quintptr state)
+{
+    Q_ASSERT(state & FutexWaitingWritersMask);
+    state -= FutexWriterIncrement;
+    if (!(state & FutexWaitingWritersMask))
+        state &= ~quintptr(FutexWritersWaiting);
+    return state;
+}
+
+Q_NEVER_INLINE static bool futexTryLockForWrite(QAtomicPointer<QReadWriteLockPrivate> &d_ptr,
+                                                QDeadlineTimer timeout, QReadWriteLockPrivate *d)
+{
+    bool waiting = false;
+    while (true) {
+        Q_ASSERT(isFutexState(d));
+        const quintptr state = quintptr(d);
+        if (!(state & (StateLockedForRead | StateLockedForWrite))) {
+            quintptr val = state | StateLockedForWrite;
+            if (waiting)
+                val = removeWaitingWriter(val);
+            if (d_ptr.testAndSetAcquire(d, futexState(val), d))
+                return true;
+            continue;
+        }
+
+        if (timeout.hasExpired()) {
+            if (!waiting)
+                return false;
+
+            quintptr val;
+            do {
+                val = removeWaitingWriter(quintptr(d));
+                if (!(val & StateLockedForWrite))
+                    val &= ~quintptr(FutexReadersWaiting);
+            } while (!d_ptr.testAndSetRelaxed(d, futexState(val), d));
+
+            // Readers may have been waiting only because of us, and we may
+            // have consumed a wake-up meant for another writer.
+            const bool readersReleased = (quintptr(d) & FutexReadersWaiting)
+                    && !(val & FutexReadersWaiting);
+            const bool writersStuck = (val & FutexWritersWaiting)
+                    && !(val & (StateLockedForRead | StateLockedForWrite));
+            if (readersReleased || writersStuck)
+                futexWakeAll(d_ptr);
+            return false;
+        }
+
+        if (!waiting) {
+            const quintptr val = (state + FutexWriterIncrement) | FutexWritersWaiting;
+            Q_ASSERT_X(val & FutexWaitingWritersMask, "QReadWriteLock::tryLockForWrite()",
+                       "Overflow in waiting writer counter");
+            if (!d_ptr.testAndSetRelaxed(d, futexState(val), d))
+                continue;
+            waiting = true;
+            d = futexState(val);
+        }
+        futexWaitUntil(d_ptr, d, timeout);
+        d = d_ptr.loadRelaxed();
+    }
+}
+
+static void futexUnlock(QAtomicPointer<QReadWriteLockPrivate> &d_ptr, QReadWriteLockPrivate *d)
+{
+    quintptr state;
+    quintptr val;
+    do {
+        state = quintptr(d);
+        Q_ASSERT_X(state & (StateLockedForRead | StateLockedForWrite),
+                   "QReadWriteLock::unlock()", "Cannot unlock an unlocked lock");
+        if ((state & StateLockedForRead) && (state >> FutexReaderShift))
+            val = state - FutexReaderIncrement;     // other readers remain
+        else
+            val = state & ~quintptr(StateLockedForRead | StateLockedForWrite | FutexReadersWaiting);
+    } while (!d_ptr.testAndSetRelease(d, futexState(val), d));
+
+    if (val & StateLockedForRead)
+        return;
+
+    // Sleeping readers always have FutexReadersWaiting set, so if it is
+    // not, waking one thread wakes a writer.
+    if (state & FutexReadersWaiting)
+        futexWakeAll(d_ptr);
+    else if (state & FutexWritersWaiting)
+        futexWakeOne(d_ptr);
+}
+
 bool QReadWriteLockPrivate::lockForRead(std::unique_lock<std::mutex> &lock, QDeadlineTimer timeout)
 {
     Q_ASSERT(!mutex.try_lock()); // mutex must be locked when entering this function
 
-    while (waitingWriters || writerCount) {
+    while ((waitingWriters && !preferReaders) || writerCount) {
         if (timeout.hasExpired())
             return false;
         if (!timeout.isForever()) {
@@ -463,7 +671,9 @@ bool QReadWriteLockPrivate::lockForWrite(std::unique_lock<std::mutex> &lock, QDe
 void QReadWriteLockPrivate::unlock()
 {
     Q_ASSERT(!mutex.try_lock()); // mutex must be locked when entering this function
-    if (waitingWriters)
+    if (waitingReaders && preferReaders)
+        readerCond.notify_all();
+    else if (waitingWriters)
         writerCond.notify_one();
     else if (waitingReaders)
         readerCond.notify_all();
@@ -17,9 +17,11 @@ class Q_CORE_EXPORT QReadWriteLock
 {
 public:
     enum RecursionMode { NonRecursive, Recursive };
+    enum class ContentionPolicy { PreferWriters, PreferReaders };
 
     QT_CORE_INLINE_SINCE(6, 6)
     explicit QReadWriteLock(RecursionMode recursionMode = NonRecursive);
+    QReadWriteLock(RecursionMode recursionMode, ContentionPolicy policy);
     QT_CORE_INLINE_SINCE(6, 6)
     ~QReadWriteLock();
 
@@ -31,6 +31,17 @@ enum {
     StateLockedForRead = 0x1,
     StateLockedForWrite = 0x2,
 };
+// the state of a non-recursive lock on platforms with futexes
+enum : quintptr {
+    FutexReadersWaiting = 0x4,
+    FutexPreferReaders = 0x8,
+    FutexWritersWaiting = 0x10,
+    FutexStateMask = 0x1f,
+    FutexWriterIncrement = 0x20,
+    FutexWaitingWritersMask = 0xffe0,
+    FutexReaderShift = 16,
+    FutexReaderIncrement = quintptr(1) << FutexReaderShift,
+};
 enum StateForWaitCondition {
     LockedForRead,
     LockedForWrite,
@@ -39,7 +50,8 @@ enum StateForWaitCondition {
 };
 }
 
-class QReadWriteLockPrivate
+// aligned so that a pointer to it never has any of the FutexStateMask bits set
+class alignas(QReadWriteLockStates::FutexStateMask + 1) QReadWriteLockPrivate
 {
 public:
     explicit QReadWriteLockPrivate(bool isRecursive = false)
@@ -54,6 +66,7 @@ public:
     int waitingReaders = 0;
     int waitingWriters = 0;
     const bool recursive;
+    bool preferReaders = false;
 
     //Called with the mutex locked
     bool lockForWrite(std::unique_lock<std::mutex> &lock, QDeadlineTimer timeout);
@@ -96,7 +109,7 @@ QReadWriteLockPrivate::stateForWaitCondition(const QReadWriteLock *q)
     case StateLockedForWrite: return LockedForWrite;
     }
 
-    if (!d)
+    if (!d || (quintptr(d) & FutexStateMask))
         return Unlocked;
     const auto lock = qt_scoped_lock(d->mutex);
     if (d->writerCount > 1)
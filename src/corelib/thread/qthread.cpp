@@ -24,6 +24,10 @@ QT_BEGIN_NAMESPACE
 
 void QPostEventList::addEvent(const QPostEvent &ev)
 {
+    // queued calls can no longer be appended to a batch posted before this
+    // event without delivering them out of order
+    openBatch = nullptr;
+
     int priority = ev.priority;
     if (isEmpty() ||
             constLast().priority >= priority ||
@@ -40,6 +44,165 @@ void QPostEventList::addEvent(const QPostEvent &ev)
     }
 }
 
+/*
+    Moves the events in the incoming queue to the list. This must be called
+    with the mutex locked before the list is inspected, so that it holds all
+    events posted so far, in the order in which they were posted.
+*/
+qsizetype QPostEventList::takeIncoming()
+{
+    qsizetype count = 0;
+    QObject *receiver;
+    QEvent *event;
+    while (incoming.dequeue(&receiver, &event)) {
+        addEvent(QPostEvent(receiver, event, Qt::NormalEventPriority));
+        ++count;
+    }
+    return count;
+}
+
+/*
+    Returns the batch that queued calls to its receiver can be appended to,
+    or \nullptr if a new one has to be posted. Every event added after the
+    batch resets openBatch, so a batch stays open only as long as it is the
+    last event in the list and has not been taken out of it for delivery. A
+    batch that has been delivered and deleted cannot be confused with a
+    later event at the same address, as that would have reset openBatch
+    when it was added. This must be called with the mutex locked, after
+    takeIncoming().
+*/
+QMetaCallBatchEvent *QPostEventList::openMetaCallBatch() const
+{
+    if (!openBatch || isEmpty() || constLast().event != openBatch)
+        return nullptr;
+    return openBatch;
+}
+
+/*
+    QPostEventQueue
+
+    The cells form a ring in which each cell's sequence number tells whether
+    it is free for the producer claiming position \c{sequence}, or holds the
+    event at position \c{sequence - 1} (see Dmitry Vyukov's bounded MPMC
+    queue). When the ring is full, enqueue() fails and the event is posted
+    through the list as usual.
+*/
+
+QPostEventQueue::~QPostEventQueue()
+{
+    delete[] cells.load(std::memory_order_relaxed);
+}
+
+auto QPostEventQueue::ensureCells() noexcept -> Cell *
+{
+    Cell *current = cells.load(std::memory_order_acquire);
+    if (current)
+        return current;
+
+    Cell *fresh = new (std::nothrow) Cell[Capacity];
+    if (!fresh)
+        return nullptr;
+    for (quint64 i = 0; i < Capacity; ++i)
+        fresh[i].sequence.store(i, std::memory_order_relaxed);
+
+    if (cells.compare_exchange_strong(current, fresh, std::memory_order_acq_rel))
+        return fresh;
+    delete[] fresh;
+    return current;
+}
+
+/*
+    Registers the calling thread as a producer, unless the queue is closed.
+    Together with close(), this lets QObject::moveToThread() know that no
+    event for an object it is moving can arrive in the queue afterwards.
+*/
+bool QPostEventQueue::beginEnqueue() noexcept
+{
+    producers.fetch_add(1);
+    if (closed.load()) {
+        endEnqueue();
+        return false;
+    }
+    return true;
+}
+
+bool QPostEventQueue::enqueue(QObject *receiver, QEvent *event) noexcept
+{
+    Cell *ring = ensureCells();
+    if (!ring)
+        return false;
+
+    // counted before the cell is claimed, so that waitForProducers() cannot
+    // miss a claimed cell
+    unpublished.fetch_add(1);
+    quint64 pos = tail.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell &cell = ring[pos % Capacity];
+        const qint64 diff = qint64(cell.sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.receiver = receiver;
+                cell.event = event;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                unpublished.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            unpublished.fetch_sub(1, std::memory_order_release);
+            return false; // full
+        } else {
+            pos = tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool QPostEventQueue::dequeue(QObject **receiver, QEvent **event) noexcept
+{
+    Cell *ring = cells.load(std::memory_order_acquire);
+    if (!ring)
+        return false;
+
+    // Stop at a cell that a producer claimed but hasn't filled yet, as events
+    // must be taken in order: it wakes the dispatcher up once it is done, so
+    // the next call takes it. Waiting for it here would hold up the threads
+    // blocked on the mutex; callers that need all the events posted so far
+    // call waitForProducers() before locking it.
+    Cell &cell = ring[head % Capacity];
+    if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+        return false;
+
+    *receiver = cell.receiver;
+    *event = cell.event;
+    cell.sequence.store(head + Capacity, std::memory_order_release);
+    ++head;
+    return true;
+}
+
+/*
+    Waits until the producers that claimed a cell so far have filled it, so
+    that dequeue() can take all the events posted before this call. Cells
+    claimed meanwhile are waited for too, but they are filled right after
+    being claimed. This must be called without the mutex locked, as a
+    producer may be preempted between claiming and filling its cell.
+*/
+void QPostEventQueue::waitForProducers() const noexcept
+{
+    while (unpublished.load(std::memory_order_acquire) != 0)
+        QThread::yieldCurrentThread();
+}
+
+/*
+    Makes beginEnqueue() fail until reopen() is called, and waits for the
+    current producers to finish. This must be called before locking the
+    mutex, as the producers may be preempted while enqueuing.
+*/
+void QPostEventQueue::close() noexcept
+{
+    closed.fetch_add(1);
+    while (producers.load() != 0)
+        QThread::yieldCurrentThread();
+}
+
 
 /*
   QThreadData
@@ -47,7 +210,7 @@ void QPostEventList::addEvent(const QPostEvent &ev)
 
 QThreadData::QThreadData(int initialRefCount)
     : _ref(initialRefCount), loopLevel(0), scopeLevel(0),
-      eventDispatcher(nullptr),
+      eventDispatcher(nullptr), batchQueuedCalls(false), metaCallEventPool(nullptr),
       quitNow(false), canWait(true), isAdopted(false), requiresCoreApplication(true)
 {
     // fprintf(stderr, "QThreadData %p created\n", this);
@@ -82,6 +245,7 @@ QThreadData::~QThreadData()
     thread.storeRelease(nullptr);
     delete t;
 
+    postEventList.takeIncoming();
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
@@ -91,6 +255,8 @@ QThreadData::~QThreadData()
         }
     }
 
+    QMetaCallEventPool::threadFinished(std::exchange(metaCallEventPool, nullptr));
+
     // fprintf(stderr, "QThreadData %p destroyed\n", this);
 }
 
@@ -337,6 +503,32 @@ QThreadPrivate::~QThreadPrivate()
     hardware change).
 */
 
+/*!
+    \fn int QThread::numaNodeCount()
+    \since 6.9
+
+    Returns the number of NUMA (non-uniform memory access) nodes of the
+    system. Memory attached to a node is accessed faster by the processors
+    of that node than by the others. Systems without NUMA, and platforms on
+    which the topology cannot be determined, have one node.
+
+    On Linux, the nodes are numbered as in \c{/sys/devices/system/node}; if
+    that numbering has gaps, the missing nodes have no processors.
+
+    \sa numaNodeCpus(), QThreadPool::numaNodeInstance()
+*/
+
+/*!
+    \fn QList<int> QThread::numaNodeCpus(int node)
+    \since 6.9
+
+    Returns the logical processors of the NUMA node \a node, in the
+    numbering used by setCpuAffinity(), or an empty list if there is no such
+    node. On systems with a single node, node 0 has all online processors.
+
+    \sa numaNodeCount(), setCpuAffinity()
+*/
+
 /*!
     \fn void QThread::yieldCurrentThread()
 
@@ -568,6 +760,51 @@ uint QThread::stackSize() const
     return d->stackSize;
 }
 
+/*!
+    \since 6.9
+
+    Restricts the thread to run on the logical processors (CPUs) listed in
+    \a cpus, numbered from 0. If \a cpus is empty, the restriction is
+    lifted and the thread may again run on the processors it was allowed to
+    use before, which it inherits from the thread that started it or, for
+    instance, from \c taskset.
+
+    If the thread is running, the affinity is changed immediately;
+    otherwise it is applied when the thread is started. Keeping a thread on
+    the processors of one NUMA node, see numaNodeCpus(), keeps it close to
+    the memory it allocates and avoids the cost of migrating between caches.
+
+    This function is supported on Linux and Windows. On Windows, the
+    processors must all belong to the same processor group, and the
+    processor number \e n of group \e g is given as 64 * \e g + \e n. On
+    other platforms, a warning is printed when the affinity is applied.
+
+    \sa cpuAffinity(), numaNodeCpus(), QThreadPool::setThreadCpuAffinity()
+*/
+void QThread::setCpuAffinity(const QList<int> &cpus)
+{
+    Q_D(QThread);
+    QMutexLocker locker(&d->mutex);
+    d->cpuAffinity = cpus;
+    if (d->threadState == QThreadPrivate::Running)
+        d->applyCpuAffinity();
+}
+
+/*!
+    \since 6.9
+
+    Returns the processors the thread is restricted to, as set with
+    setCpuAffinity(), or an empty list if it is not restricted.
+
+    \sa setCpuAffinity()
+*/
+QList<int> QThread::cpuAffinity() const
+{
+    Q_D(const QThread);
+    QMutexLocker locker(&d->mutex);
+    return d->cpuAffinity;
+}
+
 /*!
     \internal
     Transitions BindingStatusOrList to the binding status state. If we had a list of
@@ -1047,6 +1284,28 @@ int QThread::idealThreadCount() noexcept
     return 1;
 }
 
+int QThread::numaNodeCount()
+{
+    return 1;
+}
+
+QList<int> QThread::numaNodeCpus(int node)
+{
+    if (node != 0)
+        return {};
+    return { 0 };
+}
+
+void QThread::setCpuAffinity(const QList<int> &cpus)
+{
+    Q_UNUSED(cpus);
+}
+
+QList<int> QThread::cpuAffinity() const
+{
+    return {};
+}
+
 void QThread::yieldCurrentThread()
 {
 
@@ -1175,6 +1434,58 @@ void QThread::setEventDispatcher(QAbstractEventDispatcher *eventDispatcher)
     }
 }
 
+/*!
+    \since 6.9
+
+    Enables batching of queued calls to the objects living in this thread if
+    \a enable is true, and disables it otherwise. Batching is disabled by
+    default.
+
+    Normally, every emission of a signal over a Qt::QueuedConnection posts a
+    separate event to the receiver's thread. With batching enabled, queued
+    emissions to a receiver in this thread are instead appended to an event
+    that is already waiting in the thread's event queue for that receiver,
+    as long as no other event has been posted after it. The event stores
+    the calls and copies of their arguments in a few contiguous blocks of
+    memory and invokes the slots one after another, in the order in which
+    the signals were emitted, when it is delivered. This saves an
+    allocation and an event delivery per emission when one or more threads
+    emit signals to an object in this thread at a high rate.
+
+    Batching does not change the order in which queued calls and other
+    posted events are delivered. QObject::sender() and
+    QObject::senderSignalIndex() return the sender of the call being
+    invoked. If a call deletes the receiver, the calls after it are
+    discarded, just like the events posted to a deleted object. Removing
+    the posted QEvent::MetaCall events of an object removes all calls of a
+    batch.
+
+    Arguments of trivially copyable types and of some implicitly shared Qt
+    types are copied while the event queue of this thread is locked; the
+    others are copied before it is locked, as without batching.
+
+    \sa isQueuedCallBatchingEnabled(), Qt::QueuedConnection
+*/
+void QThread::setQueuedCallBatchingEnabled(bool enable)
+{
+    Q_D(QThread);
+    d->data->batchQueuedCalls.storeRelaxed(enable);
+}
+
+/*!
+    \since 6.9
+
+    Returns whether queued calls to the objects living in this thread are
+    batched.
+
+    \sa setQueuedCallBatchingEnabled()
+*/
+bool QThread::isQueuedCallBatchingEnabled() const
+{
+    Q_D(const QThread);
+    return d->data->batchQueuedCalls.loadRelaxed();
+}
+
 /*!
     \fn bool QThread::wait(unsigned long time)
 
@@ -33,6 +33,8 @@ public:
     static bool isMainThread() noexcept;
     static int idealThreadCount() noexcept;
     static void yieldCurrentThread();
+    static int numaNodeCount();
+    static QList<int> numaNodeCpus(int node);
 
     explicit QThread(QObject *parent = nullptr);
     ~QThread();
@@ -63,9 +65,15 @@ public:
     void setStackSize(uint stackSize);
     uint stackSize() const;
 
+    void setCpuAffinity(const QList<int> &cpus);
+    QList<int> cpuAffinity() const;
+
     QAbstractEventDispatcher *eventDispatcher() const;
     void setEventDispatcher(QAbstractEventDispatcher *eventDispatcher);
 
+    void setQueuedCallBatchingEnabled(bool enable);
+    bool isQueuedCallBatchingEnabled() const;
+
     bool event(QEvent *event) override;
     int loopLevel() const;
 
@@ -34,6 +34,8 @@
 QT_BEGIN_NAMESPACE
 
 class QAbstractEventDispatcher;
+class QMetaCallBatchEvent;
+class QMetaCallEventPool;
 class QEventLoop;
 
 class QPostEvent
@@ -56,6 +58,50 @@ inline bool operator<(const QPostEvent &first, const QPostEvent &second)
     return first.priority > second.priority;
 }
 
+// Events posted at normal priority without taking the mutex of the
+// QPostEventList. This is a bounded queue of recycled cells that any number
+// of threads may enqueue to; it is only dequeued by whoever holds the mutex,
+// who moves the events into the list.
+class QPostEventQueue
+{
+    Q_DISABLE_COPY_MOVE(QPostEventQueue)
+public:
+    QPostEventQueue() = default;
+    ~QPostEventQueue();
+
+    // producers call enqueue() between beginEnqueue() and endEnqueue()
+    bool beginEnqueue() noexcept;
+    void endEnqueue() noexcept { producers.fetch_sub(1, std::memory_order_release); }
+    bool enqueue(QObject *receiver, QEvent *event) noexcept;
+
+    // this requires the mutex of the list to be locked
+    bool dequeue(QObject **receiver, QEvent **event) noexcept;
+    // and this must be called without it
+    void waitForProducers() const noexcept;
+
+    // nestable; close() must be called without the mutex locked
+    void close() noexcept;
+    void reopen() noexcept { closed.fetch_sub(1, std::memory_order_release); }
+
+private:
+    struct Cell
+    {
+        std::atomic<quint64> sequence;
+        QObject *receiver;
+        QEvent *event;
+    };
+    static constexpr quint64 Capacity = 1024;
+
+    Cell *ensureCells() noexcept;
+
+    std::atomic<Cell *> cells = nullptr;        // allocated on first use
+    std::atomic<quint64> tail = 0;              // the next cell to claim
+    quint64 head = 0;                           // the next cell to dequeue
+    std::atomic<int> unpublished = 0;           // cells claimed but not filled yet
+    std::atomic<int> producers = 0;
+    std::atomic<int> closed = 0;                // by how many close() calls
+};
+
 // This class holds the list of posted events.
 //  The list has to be kept sorted by priority
 // It's used in a virtual in QCoreApplication, so ELFVERSION:ignore-next
@@ -72,9 +118,20 @@ public:
 
     QMutex mutex;
 
-    inline QPostEventList() : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0) { }
+    // events posted by QCoreApplicationPrivate::tryPostEventLockFree()
+    QPostEventQueue incoming;
+
+    // the batch that queued calls may still be appended to; it is only valid
+    // while it is the last event in the list, see openMetaCallBatch()
+    QMetaCallBatchEvent *openBatch;
+
+    inline QPostEventList()
+        : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0), openBatch(nullptr)
+    { }
 
     void addEvent(const QPostEvent &ev);
+    qsizetype takeIncoming();
+    QMetaCallBatchEvent *openMetaCallBatch() const;
 
 private:
     //hides because they do not keep that list sorted. addEvent must be used
@@ -200,6 +257,9 @@ public:
 
     uint stackSize = 0;
     std::underlying_type_t<QThread::Priority> priority = QThread::InheritPriority;
+    QList<int> cpuAffinity;
+    QList<int> inheritedCpuAffinity; // restored when cpuAffinity is cleared
+    void applyCpuAffinity();
 
 #ifdef Q_OS_UNIX
     QWaitCondition thread_done;
@@ -314,6 +374,8 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
+        if (postEventList.takeIncoming())
+            canWait = false;
         return canWait;
     }
 
@@ -330,6 +392,8 @@ public:
     QAtomicPointer<void> threadId;
     QAtomicPointer<QAbstractEventDispatcher> eventDispatcher;
     QList<void *> tls;
+    QAtomicInteger<bool> batchQueuedCalls;
+    QMetaCallEventPool *metaCallEventPool;
 
     bool quitNow;
     bool canWait;
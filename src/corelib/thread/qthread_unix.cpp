@@ -18,6 +18,12 @@
 #  if !defined(QT_NO_GLIB)
 #    include "../kernel/qeventdispatcher_glib_p.h"
 #  endif
+#  if QT_CONFIG(epoll)
+#    include <private/qeventdispatcher_epoll_p.h>
+#  endif
+#  if QT_CONFIG(io_uring)
+#    include <private/qeventdispatcher_io_uring_p.h>
+#  endif
 #endif
 
 #if !defined(Q_OS_WASM)
@@ -225,15 +231,22 @@ QAbstractEventDispatcher *QThreadPrivate::createEventDispatcher(QThreadData *dat
         return new QEventDispatcherUNIX;
 #elif defined(Q_OS_WASM)
     return new QEventDispatcherWasm();
-#elif !defined(QT_NO_GLIB)
+#else
+#  if QT_CONFIG(io_uring)
+    if (QEventDispatcherIoUring::isEnabledByEnvironment() && QEventDispatcherIoUring::isSupported())
+        return new QEventDispatcherIoUring;
+#  endif
+#  if QT_CONFIG(epoll)
+    if (QEventDispatcherEpoll::isEnabledByEnvironment())
+        return new QEventDispatcherEpoll;
+#  endif
+#  if !defined(QT_NO_GLIB)
     const bool isQtMainThread = data->thread.loadAcquire() == QCoreApplicationPrivate::mainThread();
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB")
         && (isQtMainThread || qEnvironmentVariableIsEmpty("QT_NO_THREADED_GLIB"))
         && QEventDispatcherGlib::versionSupported())
         return new QEventDispatcherGlib;
-    else
-        return new QEventDispatcherUNIX;
-#else
+#  endif
     return new QEventDispatcherUNIX;
 #endif
 }
@@ -303,6 +316,9 @@ void *QThreadPrivate::start(void *arg)
                 thr->d_func()->setPriority(QThread::Priority(thr->d_func()->priority & ~ThreadPriorityResetFlag));
             }
 
+            if (!thr->d_func()->cpuAffinity.isEmpty())
+                thr->d_func()->applyCpuAffinity();
+
             // threadId is set in QThread::start()
             Q_ASSERT(pthread_equal(from_HANDLE<pthread_t>(data->threadId.loadRelaxed()),
                                    pthread_self()));
@@ -375,6 +391,7 @@ void QThreadPrivate::finish(void *arg)
 
         d->threadState = QThreadPrivate::Finished;
         d->interruptionRequested.store(false, std::memory_order_relaxed);
+        d->inheritedCpuAffinity.clear();
 
         d->data->threadId.storeRelaxed(nullptr);
 
@@ -496,6 +513,73 @@ void QThread::yieldCurrentThread()
     sched_yield();
 }
 
+#if defined(Q_OS_LINUX)
+static QByteArray readSysfsFile(const char *path)
+{
+    const int fd = qt_safe_open(path, O_RDONLY);
+    if (fd < 0)
+        return {};
+    char buffer[4096];
+    const qint64 size = qt_safe_read(fd, buffer, sizeof(buffer));
+    qt_safe_close(fd);
+    return size > 0 ? QByteArray(buffer, size).trimmed() : QByteArray();
+}
+
+// parses a list in the sysfs format, like "0-3,8,10-11"
+static QList<int> parseSysfsList(const QByteArray &list)
+{
+    QList<int> values;
+    for (const QByteArray &range : list.split(',')) {
+        const qsizetype dash = range.indexOf('-');
+        bool ok = false, lastOk = false;
+        const int first = range.left(dash).toInt(&ok);
+        const int last = dash < 0 ? first : range.mid(dash + 1).toInt(&lastOk);
+        if (!ok || (dash >= 0 && !lastOk) || last < first)
+            continue;
+        for (int value = first; value <= last; ++value)
+            values.append(value);
+    }
+    return values;
+}
+#endif
+
+int QThread::numaNodeCount()
+{
+#if defined(Q_OS_LINUX)
+    const QList<int> nodes = parseSysfsList(readSysfsFile("/sys/devices/system/node/online"));
+    if (!nodes.isEmpty())
+        return nodes.constLast() + 1;
+#endif
+    return 1;
+}
+
+QList<int> QThread::numaNodeCpus(int node)
+{
+    if (node < 0)
+        return {};
+
+#if defined(Q_OS_LINUX)
+    const QByteArray path = "/sys/devices/system/node/node" + QByteArray::number(node) + "/cpulist";
+    QList<int> cpus = parseSysfsList(readSysfsFile(path.constData()));
+    if (!cpus.isEmpty() || node != 0 || numaNodeCount() > 1)
+        return cpus;
+
+    // the kernel was built without NUMA support
+    cpus = parseSysfsList(readSysfsFile("/sys/devices/system/cpu/online"));
+    if (!cpus.isEmpty())
+        return cpus;
+#else
+    if (node != 0)
+        return {};
+    QList<int> cpus;
+#endif
+
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int cpu = 0; cpu < qMax(count, 1L); ++cpu)
+        cpus.append(cpu);
+    return cpus;
+}
+
 #endif // QT_CONFIG(thread)
 
 static void qt_nanosleep(timespec amount)
@@ -841,6 +925,58 @@ void QThreadPrivate::setPriority(QThread::Priority threadPriority)
 #endif
 }
 
+// Caller must lock the mutex
+void QThreadPrivate::applyCpuAffinity()
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    const pthread_t thread = from_HANDLE<pthread_t>(data->threadId.loadRelaxed());
+    int cpuCount = int(sysconf(_SC_NPROCESSORS_CONF));
+    for (int cpu : std::as_const(cpuAffinity))
+        cpuCount = qMax(cpuCount, cpu + 1);
+
+    cpu_set_t *set = CPU_ALLOC(cpuCount);
+    if (!set) {
+        qWarning("QThread::setCpuAffinity: Out of memory");
+        return;
+    }
+    auto freeSet = qScopeGuard([set] { CPU_FREE(set); });
+    const size_t size = CPU_ALLOC_SIZE(cpuCount);
+
+    if (inheritedCpuAffinity.isEmpty()) {
+        // save the processors the thread may use before its first change,
+        // which may be restricted by taskset or a cpuset, to restore them
+        CPU_ZERO_S(size, set);
+        if (pthread_getaffinity_np(thread, size, set) == 0) {
+            for (int cpu = 0; cpu < cpuCount; ++cpu) {
+                if (CPU_ISSET_S(cpu, size, set))
+                    inheritedCpuAffinity.append(cpu);
+            }
+        }
+    }
+
+    CPU_ZERO_S(size, set);
+    if (!cpuAffinity.isEmpty()) {
+        for (int cpu : std::as_const(cpuAffinity)) {
+            if (cpu >= 0)
+                CPU_SET_S(cpu, size, set);
+        }
+    } else if (!inheritedCpuAffinity.isEmpty()) {
+        for (int cpu : std::as_const(inheritedCpuAffinity))
+            CPU_SET_S(cpu, size, set);
+    } else {
+        // the kernel removes the processors not available to the process
+        for (int cpu = 0; cpu < cpuCount; ++cpu)
+            CPU_SET_S(cpu, size, set);
+    }
+
+    const int error = pthread_setaffinity_np(thread, size, set);
+    if (error != 0)
+        qErrnoWarning(error, "QThread::setCpuAffinity: Cannot set the CPU affinity");
+#else
+    qWarning("QThread::setCpuAffinity: Not supported on this platform");
+#endif
+}
+
 #endif // QT_CONFIG(thread)
 
 QT_END_NAMESPACE
@@ -254,6 +254,8 @@ unsigned int __stdcall QT_ENSURE_STACK_ALIGNED_FOR_SSE QThreadPrivate::start(voi
     {
         QMutexLocker locker(&thr->d_func()->mutex);
         data->quitNow = thr->d_func()->exited;
+        if (!thr->d_func()->cpuAffinity.isEmpty())
+            thr->d_func()->applyCpuAffinity();
     }
 
     data->ensureEventDispatcher();
@@ -345,6 +347,28 @@ void QThread::yieldCurrentThread()
     SwitchToThread();
 }
 
+int QThread::numaNodeCount()
+{
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode))
+        return 1;
+    return int(highestNode) + 1;
+}
+
+QList<int> QThread::numaNodeCpus(int node)
+{
+    GROUP_AFFINITY affinity = {};
+    if (node < 0 || node > USHRT_MAX || !GetNumaNodeProcessorMaskEx(USHORT(node), &affinity))
+        return {};
+
+    QList<int> cpus;
+    for (int cpu = 0; cpu < 64; ++cpu) {
+        if (affinity.Mask & (KAFFINITY(1) << cpu))
+            cpus.append(affinity.Group * 64 + cpu);
+    }
+    return cpus;
+}
+
 #endif // QT_CONFIG(thread)
 
 void QThread::sleep(std::chrono::nanoseconds nsecs)
@@ -586,6 +610,33 @@ void QThreadPrivate::setPriority(QThread::Priority threadPriority)
     }
 }
 
+// Caller must hold the mutex
+void QThreadPrivate::applyCpuAffinity()
+{
+    if (cpuAffinity.isEmpty()) {
+        DWORD_PTR processMask = 0;
+        DWORD_PTR systemMask = 0;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)
+            || !SetThreadAffinityMask(handle, processMask)) {
+            qErrnoWarning("QThread::setCpuAffinity: Failed to reset the CPU affinity");
+        }
+        return;
+    }
+
+    // a thread can only be restricted to processors of a single group
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = WORD(cpuAffinity.constFirst() / 64);
+    for (int cpu : std::as_const(cpuAffinity)) {
+        if (cpu < 0 || cpu / 64 != affinity.Group) {
+            qWarning("QThread::setCpuAffinity: The processors must belong to one processor group");
+            return;
+        }
+        affinity.Mask |= KAFFINITY(1) << (cpu % 64);
+    }
+    if (!SetThreadGroupAffinity(handle, &affinity, nullptr))
+        qErrnoWarning("QThread::setCpuAffinity: Failed to set the CPU affinity");
+}
+
 #endif // QT_CONFIG(thread)
 
 QT_END_NAMESPACE
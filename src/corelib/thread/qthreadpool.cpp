@@ -25,12 +25,17 @@ public:
     QThreadPoolThread(QThreadPoolPrivate *manager);
     void run() override;
     void registerThreadInactive();
+    uint nextVictim();
 
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    uint workQueueIndex = 0;
+    quint32 stealState = 0;
 };
 
+Q_CONSTINIT static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
 /*
     QThreadPool private class.
 */
@@ -50,6 +55,7 @@ QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
 */
 void QThreadPoolThread::run()
 {
+    currentPoolThread = this;
     QMutexLocker locker(&manager->mutex);
     for(;;) {
         QRunnable *r = runnable;
@@ -57,33 +63,59 @@ void QThreadPoolThread::run()
 
         do {
             if (r) {
-                // If autoDelete() is false, r might already be deleted after run(), so check status now.
-                const bool del = r->autoDelete();
-
-                // run the task
                 locker.unlock();
+                do {
+                    // If autoDelete() is false, r might already be deleted after run(), so check status now.
+                    const bool del = r->autoDelete();
+
+                    // run the task
 #ifndef QT_NO_EXCEPTIONS
-                try {
+                    try {
 #endif
-                    r->run();
+                        r->run();
 #ifndef QT_NO_EXCEPTIONS
-                } catch (...) {
-                    qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
-                             "This is not supported, exceptions thrown in worker threads must be\n"
-                             "caught before control returns to Qt Concurrent.");
-                    registerThreadInactive();
-                    throw;
-                }
+                    } catch (...) {
+                        qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
+                                 "This is not supported, exceptions thrown in worker threads must be\n"
+                                 "caught before control returns to Qt Concurrent.");
+                        registerThreadInactive();
+                        throw;
+                    }
 #endif
 
-                if (del)
-                    delete r;
+                    if (del)
+                        delete r;
+
+                    // unless a runnable of a higher priority is queued, take the
+                    // next one from the work queues without locking the mutex
+                    r = nullptr;
+                    if (manager->queuedPriority.load(std::memory_order_relaxed) < 0
+                        && !manager->threadLimitLowered.load(std::memory_order_relaxed)) {
+                        r = manager->takeLocalTask(this);
+                    }
+                } while (r);
                 locker.relock();
             }
 
             // if too many threads are active, stop working in this one
             if (manager->tooManyThreadsActive())
                 break;
+            manager->threadLimitLowered.store(false, std::memory_order_relaxed);
+
+            if (manager->workQueueCount.load(std::memory_order_relaxed)
+                && (manager->queue.isEmpty() || manager->queue.constFirst()->priority() < 0)) {
+                if (manager->queue.isEmpty()) {
+                    // This thread may be about to wait. Clear the flag before
+                    // looking at the work queues a last time: either we find
+                    // what start() puts there, or start() sees the flag cleared
+                    // and takes the mutex to hand the runnable to a thread.
+                    manager->allThreadsBusy.store(false, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                }
+                r = manager->takeLocalTask(this);
+                if (r)
+                    continue;
+            }
 
             // all work is done, time to wait for more
             if (manager->queue.isEmpty())
@@ -96,6 +128,7 @@ void QThreadPoolThread::run()
                 manager->queue.removeFirst();
                 delete page;
             }
+            manager->updateQueuedPriority();
         } while (true);
 
         // this thread is about to be deleted, do not wait or expire
@@ -133,6 +166,99 @@ void QThreadPoolThread::registerThreadInactive()
         manager->noActiveThreads.wakeAll();
 }
 
+/*
+    Returns the index of the work queue to try stealing from first, picked at
+    random so that idle threads do not all go after the same victim.
+*/
+uint QThreadPoolThread::nextVictim()
+{
+    // xorshift32, seeded per thread
+    if (!stealState)
+        stealState = 2654435769u * (workQueueIndex + 1);
+    stealState ^= stealState << 13;
+    stealState ^= stealState >> 17;
+    stealState ^= stealState << 5;
+    return stealState;
+}
+
+/*!
+    \internal
+    \class QWorkStealingQueue
+    \inmodule QtCore
+
+    A queue of runnables of the QThreadPool::SchedulingPolicy::WorkStealing
+    scheduling policy. Each worker thread of the pool has one (or shares one
+    when there are more threads than queues) and takes runnables from its
+    front without contending on the pool's mutex. Threads that run out of
+    work steal half of the runnables from the back of another queue.
+*/
+
+void QWorkStealingQueue::push(QRunnable *runnable)
+{
+    QMutexLocker locker(&mutex);
+    runnables.append(runnable);
+    size.store(runnables.size(), std::memory_order_relaxed);
+}
+
+QRunnable *QWorkStealingQueue::pop()
+{
+    if (isEmpty())
+        return nullptr;
+
+    QMutexLocker locker(&mutex);
+    if (runnables.isEmpty())
+        return nullptr;
+    QRunnable *runnable = runnables.takeFirst();
+    size.store(runnables.size(), std::memory_order_relaxed);
+    return runnable;
+}
+
+/*
+    Moves the newer half of the runnables of this queue to \a thief and
+    returns the first of them to be run by the calling thread, or \nullptr if
+    this queue is empty. Taking more than one runnable at a time keeps
+    threads from stealing again after every tiny task.
+*/
+QRunnable *QWorkStealingQueue::stealInto(QWorkStealingQueue &thief)
+{
+    Q_ASSERT(&thief != this);
+    QList<QRunnable *> stolen;
+    {
+        QMutexLocker locker(&mutex);
+        const qsizetype count = (runnables.size() + 1) / 2;
+        if (count == 0)
+            return nullptr;
+        stolen = runnables.sliced(runnables.size() - count);
+        runnables.resize(runnables.size() - count);
+        size.store(runnables.size(), std::memory_order_relaxed);
+    }
+
+    // only one queue is locked at a time, so thieves never deadlock
+    QRunnable *runnable = stolen.takeFirst();
+    if (!stolen.isEmpty()) {
+        QMutexLocker locker(&thief.mutex);
+        thief.runnables.append(stolen);
+        thief.size.store(thief.runnables.size(), std::memory_order_relaxed);
+    }
+    return runnable;
+}
+
+bool QWorkStealingQueue::tryTake(QRunnable *runnable)
+{
+    QMutexLocker locker(&mutex);
+    if (!runnables.removeOne(runnable))
+        return false;
+    size.store(runnables.size(), std::memory_order_relaxed);
+    return true;
+}
+
+QList<QRunnable *> QWorkStealingQueue::takeAll()
+{
+    QMutexLocker locker(&mutex);
+    size.store(0, std::memory_order_relaxed);
+    return std::exchange(runnables, {});
+}
+
 
 /*
     \internal
@@ -168,6 +294,7 @@ bool QThreadPoolPrivate::tryStart(QRunnable *task)
         ++activeThreads;
 
         thread->runnable = task;
+        thread->setCpuAffinity(threadCpuAffinity);
 
         // Ensure that the thread has actually finished, otherwise the following
         // start() has no effect.
@@ -198,6 +325,92 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     }
     auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
+    updateQueuedPriority();
+}
+
+/*!
+    \internal
+
+    Publishes the priority of the first runnable in the queue, so that worker
+    threads can check without the mutex whether they need to take it before
+    the runnables in the work queues. Must be called after any change to the
+    queue.
+*/
+void QThreadPoolPrivate::updateQueuedPriority()
+{
+    const int priority = queue.isEmpty() ? INT_MIN : queue.constFirst()->priority();
+    queuedPriority.store(priority, std::memory_order_relaxed);
+}
+
+/*!
+    \internal
+
+    Puts \a runnable into a work queue: the one of the calling thread if it
+    belongs to this pool, so that runnables started from a runnable stay on
+    its thread, or otherwise the next one in turn. The mutex is only locked
+    if not all threads are busy, to hand the runnable to an idle thread.
+*/
+void QThreadPoolPrivate::enqueueLocalTask(QRunnable *runnable)
+{
+    const int count = workQueueCount.load(std::memory_order_acquire);
+    Q_ASSERT(count > 0);
+
+    QThreadPoolThread *thread = currentPoolThread;
+    const uint index = thread && thread->manager == this
+            ? thread->workQueueIndex
+            : nextWorkQueue.fetch_add(1, std::memory_order_relaxed);
+    workQueues[index % uint(count)].push(runnable);
+
+    // pairs with the fence in QThreadPoolThread::run()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (allThreadsBusy.load(std::memory_order_relaxed))
+        return;
+
+    QMutexLocker locker(&mutex);
+    tryToStartMoreThreads();
+}
+
+/*!
+    \internal
+
+    Takes a runnable from the work queues: for a worker \a thread from its own
+    queue if possible, or else by stealing from another queue, starting at a
+    random one. If \a thread is \nullptr, the runnable is just taken from the
+    first non-empty queue. Returns \nullptr if all work queues are empty.
+*/
+QRunnable *QThreadPoolPrivate::takeLocalTask(QThreadPoolThread *thread)
+{
+    const int count = workQueueCount.load(std::memory_order_acquire);
+    if (count == 0)
+        return nullptr;
+
+    QWorkStealingQueue *home = nullptr;
+    uint first = 0;
+    if (thread) {
+        home = &workQueues[thread->workQueueIndex % uint(count)];
+        if (QRunnable *runnable = home->pop())
+            return runnable;
+        first = thread->nextVictim();
+    }
+
+    for (int i = 0; i < count; ++i) {
+        QWorkStealingQueue &victim = workQueues[(first + uint(i)) % uint(count)];
+        if (&victim == home || victim.isEmpty())
+            continue;
+        if (QRunnable *runnable = home ? victim.stealInto(*home) : victim.pop())
+            return runnable;
+    }
+    return nullptr;
+}
+
+bool QThreadPoolPrivate::hasLocalTasks() const
+{
+    const int count = workQueueCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; ++i) {
+        if (!workQueues[i].isEmpty())
+            return true;
+    }
+    return false;
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -222,7 +435,23 @@ void QThreadPoolPrivate::tryToStartMoreThreads()
             queue.removeFirst();
             delete page;
         }
+        updateQueuedPriority();
+    }
+
+    if (workQueueCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    // then hand the runnables waiting in the work queues to idle threads
+    while (!areAllThreadsActive()) {
+        QRunnable *runnable = takeLocalTask(nullptr);
+        if (!runnable)
+            break;
+        if (!tryStart(runnable)) {
+            enqueueTask(runnable);
+            break;
+        }
     }
+    allThreadsBusy.store(areAllThreadsActive(), std::memory_order_relaxed);
 }
 
 bool QThreadPoolPrivate::areAllThreadsActive() const
@@ -247,6 +476,8 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     if (objectName.isEmpty())
         objectName = u"Thread (pooled)"_s;
     thread->setObjectName(objectName);
+    thread->setCpuAffinity(threadCpuAffinity);
+    thread->workQueueIndex = uint(threadSequence++);
     Q_ASSERT(!allThreads.contains(thread.get())); // if this assert hits, we have an ABA problem (deleted threads don't get removed here)
     allThreads.insert(thread.get());
     ++activeThreads;
@@ -268,6 +499,7 @@ void QThreadPoolPrivate::reset()
     auto allThreadsCopy = std::exchange(allThreads, {});
     expiredThreads.clear();
     waitingThreads.clear();
+    allThreadsBusy.store(false, std::memory_order_relaxed);
 
     mutex.unlock();
 
@@ -290,10 +522,10 @@ void QThreadPoolPrivate::reset()
 bool QThreadPoolPrivate::waitForDone(const QDeadlineTimer &timer)
 {
     QMutexLocker locker(&mutex);
-    while (!(queue.isEmpty() && activeThreads == 0) && !timer.hasExpired())
+    while (!(queue.isEmpty() && !hasLocalTasks() && activeThreads == 0) && !timer.hasExpired())
         noActiveThreads.wait(&mutex, timer);
 
-    if (!queue.isEmpty() || activeThreads)
+    if (!queue.isEmpty() || hasLocalTasks() || activeThreads)
         return false;
 
     reset();
@@ -318,6 +550,18 @@ void QThreadPoolPrivate::clear()
         }
         delete page;
     }
+    updateQueuedPriority();
+
+    const int count = workQueueCount.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; ++i) {
+        const QList<QRunnable *> runnables = workQueues[i].takeAll();
+        locker.unlock();
+        for (QRunnable *r : runnables) {
+            if (r->autoDelete())
+                delete r;
+        }
+        locker.relock();
+    }
 }
 
 /*!
@@ -350,11 +594,18 @@ bool QThreadPool::tryTake(QRunnable *runnable)
             if (page->isFinished()) {
                 d->queue.removeOne(page);
                 delete page;
+                d->updateQueuedPriority();
             }
             return true;
         }
     }
 
+    const int count = d->workQueueCount.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; ++i) {
+        if (d->workQueues[i].tryTake(runnable))
+            return true;
+    }
+
     return false;
 }
 
@@ -471,6 +722,76 @@ QThreadPool *QThreadPool::globalInstance()
     return theInstance;
 }
 
+namespace {
+struct NumaNodeInstances
+{
+    QMutex mutex;
+    QList<QPointer<QThreadPool>> pools;    // indexed by node
+};
+}
+Q_GLOBAL_STATIC(NumaNodeInstances, numaNodeInstancesData)
+
+/*!
+    \since 6.9
+
+    Returns a thread pool whose threads are restricted to the processors of
+    the NUMA node \a node, or \nullptr if there is no such node or it has no
+    processors. Its maxThreadCount() is the number of processors of the
+    node. Like globalInstance(), the pool is created on first use and
+    deleted by QCoreApplication.
+
+    Pass the pool to QtConcurrent::run() or QtConcurrent::map() to keep a
+    computation, and the memory it allocates and first writes to, on one
+    node of a multi-socket machine.
+
+    \sa QThread::numaNodeCount(), QThread::numaNodeCpus(), setThreadCpuAffinity()
+*/
+QThreadPool *QThreadPool::numaNodeInstance(int node)
+{
+    NumaNodeInstances *instances = numaNodeInstancesData();
+    if (!instances || node < 0)
+        return nullptr;
+
+    const QMutexLocker locker(&instances->mutex);
+    if (instances->pools.isEmpty())
+        instances->pools.resize(QThread::numaNodeCount());
+    if (node >= instances->pools.size())
+        return nullptr;
+
+    QPointer<QThreadPool> &pool = instances->pools[node];
+    if (pool.isNull() && !QCoreApplication::closingDown()) {
+        const QList<int> cpus = QThread::numaNodeCpus(node);
+        if (cpus.isEmpty())
+            return nullptr;
+        pool = new QThreadPool();
+        pool->setObjectName(u"Thread (pooled, NUMA node %1)"_s.arg(node));
+        pool->setMaxThreadCount(int(cpus.size()));
+        pool->setThreadCpuAffinity(cpus);
+    }
+    return pool;
+}
+
+/*!
+    \internal
+
+    Returns the thread pools created by QThreadPool::numaNodeInstance(), for
+    QCoreApplication to delete them.
+*/
+QList<QThreadPool *> QThreadPoolPrivate::numaNodeInstances()
+{
+    QList<QThreadPool *> result;
+    NumaNodeInstances *instances = numaNodeInstancesData();
+    if (!instances)
+        return result;
+
+    const QMutexLocker locker(&instances->mutex);
+    for (const QPointer<QThreadPool> &pool : std::as_const(instances->pools)) {
+        if (pool)
+            result.append(pool);
+    }
+    return result;
+}
+
 /*!
     Returns the QThreadPool instance for Qt Gui.
     \internal
@@ -507,6 +828,9 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         return;
 
     Q_D(QThreadPool);
+    if (priority == 0 && d->workStealing.load(std::memory_order_acquire))
+        return d->enqueueLocalTask(runnable);
+
     QMutexLocker locker(&d->mutex);
 
     if (!d->tryStart(runnable))
@@ -633,6 +957,9 @@ void QThreadPool::setMaxThreadCount(int maxThreadCount)
     if (maxThreadCount == d->requestedMaxThreadCount)
         return;
 
+    // make threads running runnables from the work queues check the limit
+    if (maxThreadCount < d->requestedMaxThreadCount)
+        d->threadLimitLowered.store(true, std::memory_order_relaxed);
     d->requestedMaxThreadCount = maxThreadCount;
     d->tryToStartMoreThreads();
 }
@@ -674,6 +1001,7 @@ void QThreadPool::reserveThread()
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     ++d->reservedThreads;
+    d->threadLimitLowered.store(true, std::memory_order_relaxed);
 }
 
 /*! \property QThreadPool::stackSize
@@ -730,6 +1058,103 @@ QThread::Priority QThreadPool::threadPriority() const
     return d->threadPriority;
 }
 
+/*!
+    \since 6.9
+
+    Restricts the worker threads to run on the logical processors listed in
+    \a cpus, see QThread::setCpuAffinity(). If \a cpus is empty, which is the
+    default, the threads may run on all processors.
+
+    Like threadPriority, the affinity is applied when the pool starts a
+    thread; threads that are already running keep theirs.
+
+    \sa threadCpuAffinity(), numaNodeInstance()
+*/
+void QThreadPool::setThreadCpuAffinity(const QList<int> &cpus)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    d->threadCpuAffinity = cpus;
+}
+
+/*!
+    \since 6.9
+
+    Returns the processors the worker threads started by the pool are
+    restricted to, or an empty list if they are not restricted.
+
+    \sa setThreadCpuAffinity()
+*/
+QList<int> QThreadPool::threadCpuAffinity() const
+{
+    Q_D(const QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    return d->threadCpuAffinity;
+}
+
+/*!
+    \enum QThreadPool::SchedulingPolicy
+    \since 6.9
+
+    This enum describes how the thread pool distributes runnables among its
+    threads.
+
+    \value SharedQueue All runnables that cannot be started right away are
+    kept in one queue, ordered by priority. Every thread takes the next
+    runnable from it. This is the default.
+
+    \value WorkStealing Runnables of the default priority (0) are kept in
+    per-thread work queues. A runnable started from one of the pool's threads
+    goes into that thread's queue, and runnables started from other threads
+    are spread over the queues in turn. A thread that runs out of work steals
+    runnables from the queue of another thread. Runnables of any other
+    priority are kept in the shared queue; those of a higher priority are
+    still run before, and those of a lower priority after the runnables in
+    the work queues. Runnables of the default priority are no longer started
+    strictly in the order of the start() calls.
+
+    Starting a runnable and picking the next one to run lock a mutex shared
+    by the whole pool with the \c SharedQueue policy. With many threads and
+    many small runnables, for instance when \l{QtConcurrent::map()} is used
+    with a cheap function, this lock can become contended and limit the
+    throughput. The \c WorkStealing policy avoids it when all threads are
+    busy.
+
+    \sa schedulingPolicy
+*/
+
+/*! \property QThreadPool::schedulingPolicy
+    \brief how the thread pool distributes runnables among its threads.
+    \since 6.9
+
+    The default value is SchedulingPolicy::SharedQueue. The policy can be
+    changed at any time; runnables already queued are still run.
+
+    \sa SchedulingPolicy
+*/
+
+void QThreadPool::setSchedulingPolicy(SchedulingPolicy policy)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (policy == SchedulingPolicy::WorkStealing
+        && d->workQueueCount.load(std::memory_order_relaxed) == 0) {
+        // threads beyond this count share the work queues
+        const int count = qMax(d->maxThreadCount(), QThread::idealThreadCount());
+        d->workQueues = std::make_unique<QWorkStealingQueue[]>(count);
+        d->workQueueCount.store(count, std::memory_order_release);
+    }
+    d->workStealing.store(policy == SchedulingPolicy::WorkStealing, std::memory_order_release);
+}
+
+QThreadPool::SchedulingPolicy QThreadPool::schedulingPolicy() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.load(std::memory_order_relaxed)
+            ? SchedulingPolicy::WorkStealing
+            : SchedulingPolicy::SharedQueue;
+}
+
 /*!
     Releases a thread previously reserved by a call to reserveThread().
 
@@ -27,13 +27,21 @@ class Q_CORE_EXPORT QThreadPool : public QObject
     Q_PROPERTY(int activeThreadCount READ activeThreadCount)
     Q_PROPERTY(uint stackSize READ stackSize WRITE setStackSize)
     Q_PROPERTY(QThread::Priority threadPriority READ threadPriority WRITE setThreadPriority)
+    Q_PROPERTY(SchedulingPolicy schedulingPolicy READ schedulingPolicy WRITE setSchedulingPolicy)
     friend class QFutureInterfaceBase;
 
 public:
+    enum class SchedulingPolicy {
+        SharedQueue,
+        WorkStealing,
+    };
+    Q_ENUM(SchedulingPolicy)
+
     QThreadPool(QObject *parent = nullptr);
     ~QThreadPool();
 
     static QThreadPool *globalInstance();
+    static QThreadPool *numaNodeInstance(int node);
 
     void start(QRunnable *runnable, int priority = 0);
     bool tryStart(QRunnable *runnable);
@@ -69,6 +77,12 @@ public:
     void setThreadPriority(QThread::Priority priority);
     QThread::Priority threadPriority() const;
 
+    void setSchedulingPolicy(SchedulingPolicy policy);
+    SchedulingPolicy schedulingPolicy() const;
+
+    void setThreadCpuAffinity(const QList<int> &cpus);
+    QList<int> threadCpuAffinity() const;
+
     void reserveThread();
     void releaseThread();
 
@@ -24,6 +24,10 @@
 #include "QtCore/qqueue.h"
 #include "private/qobject_p.h"
 
+#include <atomic>
+#include <climits>
+#include <memory>
+
 QT_REQUIRE_CONFIG(thread);
 
 QT_BEGIN_NAMESPACE
@@ -107,6 +111,25 @@ private:
     QRunnable *m_entries[MaxPageSize];
 };
 
+// A work queue of the work stealing scheduling policy. The worker thread
+// owning it takes runnables from the front; other threads steal from the back.
+class alignas(64) QWorkStealingQueue
+{
+public:
+    void push(QRunnable *runnable);
+    QRunnable *pop();
+    QRunnable *stealInto(QWorkStealingQueue &thief);
+    bool tryTake(QRunnable *runnable);
+    QList<QRunnable *> takeAll();
+
+    bool isEmpty() const { return size.load(std::memory_order_relaxed) == 0; }
+
+private:
+    QBasicMutex mutex;
+    QList<QRunnable *> runnables;
+    std::atomic<qsizetype> size = 0;    // of runnables, readable without the mutex
+};
+
 class QThreadPoolThread;
 class Q_CORE_EXPORT QThreadPoolPrivate : public QObjectPrivate
 {
@@ -132,8 +155,14 @@ public:
     void clear();
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
+    void updateQueuedPriority();
+
+    void enqueueLocalTask(QRunnable *runnable);
+    QRunnable *takeLocalTask(QThreadPoolThread *thread);
+    bool hasLocalTasks() const;
 
     static QThreadPool *qtGuiInstance();
+    static QList<QThreadPool *> numaNodeInstances();
 
     mutable QMutex mutex;
     QSet<QThreadPoolThread *> allThreads;
@@ -149,6 +178,20 @@ public:
     int activeThreads = 0;
     uint stackSize = 0;
     QThread::Priority threadPriority = QThread::InheritPriority;
+    QList<int> threadCpuAffinity;
+    int threadSequence = 0;
+
+    // Work stealing: runnables of the default priority started while all
+    // threads are busy go into per-thread work queues instead of the queue.
+    // The work queues are created the first time the policy is enabled and
+    // live as long as the pool, so they can be used without the mutex.
+    std::unique_ptr<QWorkStealingQueue[]> workQueues;
+    std::atomic<int> workQueueCount = 0;
+    std::atomic<uint> nextWorkQueue = 0;
+    std::atomic<bool> workStealing = false;
+    std::atomic<bool> allThreadsBusy = false;       // areAllThreadsActive(), as a hint
+    std::atomic<bool> threadLimitLowered = false;   // tooManyThreadsActive() may be true
+    std::atomic<int> queuedPriority = INT_MIN;      // of the first page in queue
 };
 
 QT_END_NAMESPACE
@@ -29,6 +29,7 @@
 #endif
 
 #include <cmath>
+#include <optional>
 #ifdef Q_OS_WIN
 #  include <qt_windows.h>
 #endif
@@ -5667,6 +5668,98 @@ QDateTime QDateTime::fromSecsSinceEpoch(qint64 secs)
 
 #if QT_CONFIG(datestring) // depends on, so implies, textdate
 
+/*
+    Fast path for the RFC 3339 profile of ISO 8601 that logs and network
+    protocols produce: "yyyy-MM-ddThh:mm[:ss[.fff]][Z|±hh:mm]", with 't' or
+    space allowed in place of 'T' and 'z' for 'Z'.
+
+    The fixed-position prefix is validated in one pass without branching per
+    character, so the loop vectorizes. Anything unusual - 24:00, fractions of
+    minutes, more than nine fractional digits, milliseconds that round up to a
+    whole second, other offset spellings, and every invalid input - is left to
+    the generic parser, so the result always matches that parser's.
+*/
+static std::optional<QDateTime> fromRfc3339String(QStringView string)
+{
+    constexpr qsizetype PrefixSize = 16; // "yyyy-MM-ddThh:mm"
+    const qsizetype size = string.size();
+    if (size < PrefixSize)
+        return std::nullopt;
+
+    const char16_t *const s = string.utf16();
+    constexpr char16_t pattern[PrefixSize + 1] = u"0000-00-00T00:00";
+    bool matches = true;
+    for (qsizetype i = 0; i < PrefixSize; ++i) {
+        const bool isDigit = char16_t(s[i] - u'0') < 10;
+        matches &= pattern[i] == u'0' ? isDigit : i == 10 || s[i] == pattern[i];
+    }
+    matches &= s[10] == u'T' || s[10] == u't' || s[10] == u' ';
+    if (!matches)
+        return std::nullopt;
+
+    const auto twoDigits = [s](qsizetype i) { return (s[i] - u'0') * 10 + (s[i + 1] - u'0'); };
+    const int year = twoDigits(0) * 100 + twoDigits(2);
+    const int month = twoDigits(5);
+    const int day = twoDigits(8);
+    const int hour = twoDigits(11);
+    const int minute = twoDigits(14);
+    if (year == 0 || hour >= 24 || minute >= MINS_PER_HOUR)
+        return std::nullopt;
+
+    const auto isDigitAt = [s, size](qsizetype i) {
+        return i < size && char16_t(s[i] - u'0') < 10;
+    };
+    qsizetype pos = PrefixSize;
+    int second = 0;
+    int msec = 0;
+    if (pos < size && s[pos] == u':') {
+        if (!isDigitAt(pos + 1) || !isDigitAt(pos + 2))
+            return std::nullopt;
+        second = twoDigits(pos + 1);
+        if (second >= SECS_PER_MIN)
+            return std::nullopt;
+        pos += 3;
+
+        if (pos < size && (s[pos] == u'.' || s[pos] == u',')) {
+            qulonglong frac = 0;
+            const qsizetype start = ++pos;
+            while (isDigitAt(pos) && pos - start < 10)
+                frac = frac * 10 + (s[pos++] - u'0');
+            const qsizetype digits = pos - start;
+            if (digits == 0 || digits > 9)
+                return std::nullopt;
+            // Same arithmetic as fromIsoTimeString(), for identical rounding:
+            const double fraction = frac * std::pow(0.1, digits);
+            msec = qRound(MSECS_PER_SEC * fraction);
+            if (msec == MSECS_PER_SEC)
+                return std::nullopt;
+        }
+    }
+
+    QTimeZone zone = QTimeZone::LocalTime;
+    if (const qsizetype rest = size - pos; rest == 1 && (s[pos] == u'Z' || s[pos] == u'z')) {
+        zone = QTimeZone::UTC;
+    } else if (rest == 6) {
+        if ((s[pos] != u'+' && s[pos] != u'-') || s[pos + 3] != u':' || !isDigitAt(pos + 1)
+            || !isDigitAt(pos + 2) || !isDigitAt(pos + 4) || !isDigitAt(pos + 5)) {
+            return std::nullopt;
+        }
+        const int offsetHours = twoDigits(pos + 1);
+        const int offsetMinutes = twoDigits(pos + 4);
+        if (offsetHours > 23 || offsetMinutes >= MINS_PER_HOUR)
+            return std::nullopt;
+        const int offset = int((offsetHours * MINS_PER_HOUR + offsetMinutes) * SECS_PER_MIN);
+        zone = QTimeZone::fromSecondsAheadOfUtc(s[pos] == u'-' ? -offset : offset);
+    } else if (rest != 0) {
+        return std::nullopt;
+    }
+
+    const QDate date(year, month, day);
+    if (!date.isValid())
+        return std::nullopt;
+    return QDateTime(date, QTime(hour, minute, second, msec), zone);
+}
+
 /*!
     \fn QDateTime QDateTime::fromString(const QString &string, Qt::DateFormat format)
 
@@ -5701,6 +5794,9 @@ QDateTime QDateTime::fromString(QStringView string, Qt::DateFormat format)
     }
     case Qt::ISODate:
     case Qt::ISODateWithMs: {
+        if (const auto rfc3339 = fromRfc3339String(string))
+            return *rfc3339;
+
         const int size = string.size();
         if (size < 10)
             return QDateTime();
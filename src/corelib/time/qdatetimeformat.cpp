@@ -0,0 +1,614 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qdatetimeformat.h"
+
+#include "private/qlocale_p.h"
+#if QT_CONFIG(datetimeparser)
+#include "private/qdatetimeparser_p.h"
+#endif
+
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+#if QT_CONFIG(datestring)
+
+namespace {
+
+struct FormatToken
+{
+    char16_t field; // the pattern letter, '\'' for quoted text, or 0 for other text
+    int count;      // how many times field is repeated
+    qsizetype next; // where the following token starts
+};
+
+/*
+    Splits the token that starts at \a i off \a format, grouping and clamping
+    repeated pattern letters as QCalendarBackend::dateTimeToString() does.
+    Letters that are not fields come back as plain text, as does a lone 'y'.
+    This only looks at the format, so that literal formats can be tokenized at
+    compile time.
+*/
+constexpr FormatToken nextToken(QStringView format, qsizetype i) noexcept
+{
+    const qsizetype size = format.size();
+    const char16_t c = format[i].unicode();
+    if (c == u'\'') {
+        qsizetype j = i + 1;
+        if (j < size && format[j] == u'\'') // "''" outside of a quoted string
+            return { c, 0, j + 1 };
+        while (j < size) {
+            if (format[j] != u'\'')
+                ++j;
+            else if (j + 1 < size && format[j + 1] == u'\'') // "''" inside a quoted string
+                j += 2;
+            else
+                break;
+        }
+        return { c, 0, j < size ? j + 1 : j };
+    }
+
+    qsizetype repeat = 1;
+    while (i + repeat < size && format[i + repeat] == c)
+        ++repeat;
+    switch (c) {
+    case u'y':
+        if (repeat < 2)
+            return { 0, 1, i + 1 };
+        repeat = repeat >= 4 ? 4 : 2;
+        break;
+    case u'M':
+    case u'd':
+    case u't':
+        repeat = qMin(repeat, qsizetype(4));
+        break;
+    case u'h':
+    case u'H':
+    case u'm':
+    case u's':
+        repeat = qMin(repeat, qsizetype(2));
+        break;
+    case u'z':
+        repeat = qMin(repeat, qsizetype(3));
+        break;
+    case u'a':
+    case u'A':
+        repeat = i + 1 < size && (format[i + 1] == u'p' || format[i + 1] == u'P') ? 2 : 1;
+        break;
+    default:
+        return { 0, int(repeat), i + repeat };
+    }
+    return { c, int(repeat), i + repeat };
+}
+
+static_assert(nextToken(u"yyyyy", 0).count == 4);
+static_assert(nextToken(u"yyy-MM", 0).count == 2);
+static_assert(nextToken(u"y", 0).field == 0);
+static_assert(nextToken(u"zzzz", 0).count == 3);
+static_assert(nextToken(u"aP", 0).count == 2 && nextToken(u"aa", 0).count == 1);
+static_assert(nextToken(u"'o''clock' h", 0).next == 10);
+static_assert(nextToken(u"''", 0).next == 2);
+static_assert(nextToken(u"'open", 0).next == 5);
+static_assert(nextToken(u"xxx:", 0).field == 0 && nextToken(u"xxx:", 0).next == 3);
+
+constexpr bool isDateField(char16_t field) noexcept
+{
+    return field == u'y' || field == u'M' || field == u'd';
+}
+
+} // namespace
+
+class QDateTimeFormatPrivate : public QSharedData
+{
+public:
+    struct Token
+    {
+        char16_t field; // as in FormatToken, but 0 for all text
+        quint8 count;
+        quint8 letterCase; // for am/pm: LocaleCase, UpperCase or LowerCase
+        qsizetype begin;   // of the text in literals, or of the token in format
+        qsizetype size;
+    };
+    enum { LocaleCase, UpperCase, LowerCase };
+
+    QDateTimeFormatPrivate(QStringView format, const QLocale &locale, QCalendar cal);
+
+    void appendTo(QString &str, const QDateTime &datetime, QDate dateOnly, QTime timeOnly) const;
+    void appendNumber(QString &str, int value, int width) const;
+
+    QString format;
+    QLocale locale;
+    QCalendar calendar;
+    const QLocaleData *data;
+    QString literals;
+    QList<Token> tokens;
+    QString zeroDigit;
+    QString amText[3];
+    QString pmText[3];
+    qsizetype sizeHint = 0;
+    bool asciiDigits = false;
+    bool hasAmPm = false;
+
+#if QT_CONFIG(datetimeparser)
+    // Copied for each use, as their parsing state is mutable:
+    QDateTimeParser dateTimeParser;
+    QDateTimeParser dateParser;
+    QDateTimeParser timeParser;
+    bool dateTimeFormatOk;
+    bool dateFormatOk;
+    bool timeFormatOk;
+#endif
+};
+
+QT_DEFINE_QESDP_SPECIALIZATION_DTOR(QDateTimeFormatPrivate)
+
+QDateTimeFormatPrivate::QDateTimeFormatPrivate(QStringView format, const QLocale &locale,
+                                               QCalendar cal)
+    : format(format.toString()),
+      locale(locale),
+      calendar(cal),
+      data(QLocalePrivate::get(locale)->m_data)
+#if QT_CONFIG(datetimeparser)
+      , dateTimeParser(QMetaType::QDateTime, QDateTimeParser::FromString, cal),
+      dateParser(QMetaType::QDate, QDateTimeParser::FromString, cal),
+      timeParser(QMetaType::QTime, QDateTimeParser::FromString, QCalendar())
+#endif
+{
+    qsizetype i = 0;
+    while (i < format.size()) {
+        const FormatToken token = nextToken(format, i);
+        Token t = { token.field, quint8(token.count), LocaleCase, i, token.next - i };
+        if (token.field == u'\'' || token.field == 0) {
+            t.field = 0;
+            t.begin = literals.size();
+            if (token.field == u'\'') {
+                literals.append(qt_readEscapedFormatString(format, &i));
+                Q_ASSERT(i == token.next);
+            } else {
+                literals.append(format.sliced(i, token.count));
+            }
+            t.size = literals.size() - t.begin;
+            // Merge adjacent pieces of text:
+            if (!tokens.isEmpty() && tokens.last().field == 0)
+                tokens.last().size += t.size;
+            else if (t.size > 0)
+                tokens.append(t);
+            sizeHint += t.size;
+        } else {
+            if (token.field == u'a' || token.field == u'A') {
+                hasAmPm = true;
+                const char16_t next = token.count == 2 ? format[i + 1].unicode() : 0;
+                if (token.field == u'A' && (token.count == 1 || next == u'P'))
+                    t.letterCase = UpperCase;
+                else if (token.field == u'a' && (token.count == 1 || next == u'p'))
+                    t.letterCase = LowerCase;
+            }
+            tokens.append(t);
+            sizeHint += token.field == u'M' || token.field == u'd' ? 10 : token.count + 1;
+        }
+        i = token.next;
+    }
+
+    // These may query the system locale, which is what we want to do only once.
+    zeroDigit = locale.zeroDigit();
+    asciiDigits = data->zeroDigit() == u"0";
+    if (hasAmPm) {
+        amText[LocaleCase] = locale.amText();
+        amText[UpperCase] = amText[LocaleCase].toUpper();
+        amText[LowerCase] = amText[LocaleCase].toLower();
+        pmText[LocaleCase] = locale.pmText();
+        pmText[UpperCase] = pmText[LocaleCase].toUpper();
+        pmText[LowerCase] = pmText[LocaleCase].toLower();
+    }
+
+#if QT_CONFIG(datetimeparser)
+    dateTimeParser.setDefaultLocale(locale);
+    dateTimeFormatOk = dateTimeParser.parseFormat(format);
+    dateParser.setDefaultLocale(locale);
+    dateFormatOk = dateParser.parseFormat(format);
+    timeParser.setDefaultLocale(locale);
+    timeFormatOk = timeParser.parseFormat(format);
+#endif
+}
+
+void QDateTimeFormatPrivate::appendNumber(QString &str, int value, int width) const
+{
+    if (asciiDigits && value >= 0) {
+        char16_t buffer[12];
+        char16_t *const end = std::end(buffer);
+        char16_t *p = end;
+        do {
+            *--p = u'0' + value % 10;
+            value /= 10;
+        } while (value);
+        while (end - p < width)
+            *--p = u'0';
+        str.append(QStringView(p, end));
+    } else if (width > 1) {
+        str.append(data->longLongToString(value, -1, 10, width, QLocaleData::ZeroPadded));
+    } else {
+        str.append(data->longLongToString(value));
+    }
+}
+
+// Produces the same text as QCalendarBackend::dateTimeToString() does.
+void QDateTimeFormatPrivate::appendTo(QString &str, const QDateTime &datetime, QDate dateOnly,
+                                      QTime timeOnly) const
+{
+    QDate date;
+    QTime time;
+    bool formatDate = false;
+    bool formatTime = false;
+    if (datetime.isValid()) {
+        date = datetime.date();
+        time = datetime.time();
+        formatDate = true;
+        formatTime = true;
+    } else if (dateOnly.isValid()) {
+        date = dateOnly;
+        formatDate = true;
+    } else if (timeOnly.isValid()) {
+        time = timeOnly;
+        formatTime = true;
+    } else {
+        return;
+    }
+
+    QCalendar::YearMonthDay parts;
+    if (formatDate) {
+        parts = calendar.partsFromDate(date);
+        if (!parts.isValid())
+            return;
+    }
+
+    for (const Token &token : tokens) {
+        const int count = token.count;
+        if (token.field == 0) {
+            str.append(QStringView(literals).sliced(token.begin, token.size));
+            continue;
+        }
+        if (!(isDateField(token.field) ? formatDate : formatTime)) {
+            str.append(QStringView(format).sliced(token.begin, token.size));
+            continue;
+        }
+        switch (token.field) {
+        case u'y':
+            if (count == 4)
+                appendNumber(str, parts.year, parts.year < 0 ? 5 : 4);
+            else
+                appendNumber(str, parts.year % 100, 2);
+            break;
+        case u'M':
+            if (count <= 2) {
+                appendNumber(str, parts.month, count);
+            } else {
+                str.append(calendar.monthName(locale, parts.month, parts.year,
+                                              count == 3 ? QLocale::ShortFormat
+                                                         : QLocale::LongFormat));
+            }
+            break;
+        case u'd':
+            if (count <= 2) {
+                appendNumber(str, parts.day, count);
+            } else {
+                str.append(locale.dayName(calendar.dayOfWeek(date),
+                                          count == 3 ? QLocale::ShortFormat
+                                                     : QLocale::LongFormat));
+            }
+            break;
+        case u'h': {
+            int hour = time.hour();
+            if (hasAmPm) {
+                if (hour > 12)
+                    hour -= 12;
+                else if (hour == 0)
+                    hour = 12;
+            }
+            appendNumber(str, hour, count);
+            break;
+        }
+        case u'H':
+            appendNumber(str, time.hour(), count);
+            break;
+        case u'm':
+            appendNumber(str, time.minute(), count);
+            break;
+        case u's':
+            appendNumber(str, time.second(), count);
+            break;
+        case u'a':
+        case u'A':
+            str.append(time.hour() < 12 ? amText[token.letterCase] : pmText[token.letterCase]);
+            break;
+        case u'z':
+            appendNumber(str, time.msec(), 3);
+            if (count != 3) {
+                if (str.endsWith(zeroDigit))
+                    str.chop(1);
+                if (str.endsWith(zeroDigit))
+                    str.chop(1);
+            }
+            break;
+        case u't':
+            // Time zone names are rare enough in bulk output to not be worth caching:
+            str.append(calendar.dateTimeToString(QStringView(format).sliced(token.begin,
+                                                                            token.size),
+                                                 datetime, dateOnly, timeOnly, locale));
+            break;
+        default:
+            Q_UNREACHABLE();
+        }
+    }
+}
+
+/*!
+    \class QDateTimeFormat
+    \inmodule QtCore
+    \since 6.9
+    \brief The QDateTimeFormat class formats and parses many dates and times
+    with the same format.
+
+    \ingroup i18n
+    \ingroup string-processing
+    \ingroup shared
+    \reentrant
+
+    QDateTimeFormat produces the same text as QDateTime::toString() and
+    QLocale::toString() do for a format string, and reads the same strings
+    as QDateTime::fromString() and QLocale::toDateTime() do, but splits the
+    format into its fields only once, when it is created, where those
+    functions do it for every call. This makes a difference when many
+    values share a format, as when writing or reading a log.
+
+    \snippet code/src_corelib_time_qdatetimeformat.cpp 0
+
+    See QDateTime::fromString() and QDateTime::toString() for the
+    expressions that can be used in the format. Without a locale, the C
+    locale is used, as QDateTime::toString() and QDateTime::fromString() do.
+
+    QDateTimeFormat takes a snapshot of the locale: later changes to the
+    system locale's settings are not reflected.
+
+    Timestamps in the ISO 8601 format, and its RFC 3339 profile in
+    particular, are best read with QDateTime::fromString() and Qt::ISODate,
+    which has a fast path for them.
+
+    \sa QDateTime::toString(), QLocale::toString(), QNumberFormatter
+*/
+
+/*!
+    Constructs an object with an empty format, for the C locale.
+*/
+QDateTimeFormat::QDateTimeFormat()
+    : QDateTimeFormat(QStringView())
+{
+}
+
+/*!
+    Constructs an object for \a format, in the C locale and the calendar
+    \a cal. If \a cal is not supplied, the Gregorian calendar is used.
+*/
+QDateTimeFormat::QDateTimeFormat(QStringView format, QCalendar cal)
+    : QDateTimeFormat(format, QLocale::c(), cal)
+{
+}
+
+/*!
+    Constructs an object for \a format, in \a locale and the calendar
+    \a cal. If \a cal is not supplied, the Gregorian calendar is used.
+*/
+QDateTimeFormat::QDateTimeFormat(QStringView format, const QLocale &locale, QCalendar cal)
+    : d(new QDateTimeFormatPrivate(format, locale, cal))
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QDateTimeFormat::QDateTimeFormat(const QDateTimeFormat &other) noexcept
+    = default;
+
+/*!
+    \fn QDateTimeFormat::QDateTimeFormat(QDateTimeFormat &&other)
+
+    Move-constructs an object from \a other.
+
+    \note The moved-from object \a other is placed in a partially-formed
+    state, in which the only valid operations are destruction and
+    assignment of a new value.
+*/
+
+/*!
+    \fn QDateTimeFormat &QDateTimeFormat::operator=(QDateTimeFormat &&other)
+
+    Move-assigns \a other to this object.
+*/
+
+/*!
+    Assigns \a other to this object, and returns a reference to this object.
+*/
+QDateTimeFormat &QDateTimeFormat::operator=(const QDateTimeFormat &other) noexcept
+    = default;
+
+/*!
+    Destroys the object.
+*/
+QDateTimeFormat::~QDateTimeFormat()
+    = default;
+
+/*!
+    \fn void QDateTimeFormat::swap(QDateTimeFormat &other)
+    \memberswap{object}
+*/
+
+/*!
+    Returns the format string.
+*/
+QString QDateTimeFormat::format() const
+{
+    return d->format;
+}
+
+/*!
+    Returns the locale used for names, digits and the AM/PM indicator.
+*/
+QLocale QDateTimeFormat::locale() const
+{
+    return d->locale;
+}
+
+/*!
+    Returns the calendar used for the date fields.
+*/
+QCalendar QDateTimeFormat::calendar() const
+{
+    return d->calendar;
+}
+
+/*!
+    Returns \a dateTime as a string in the format of this object, or an
+    empty string if \a dateTime is invalid.
+
+    \sa appendTo(), toDateTime(), QDateTime::toString()
+*/
+QString QDateTimeFormat::toString(const QDateTime &dateTime) const
+{
+    QString result;
+    result.reserve(d->sizeHint);
+    d->appendTo(result, dateTime, QDate(), QTime());
+    return result;
+}
+
+/*!
+    \overload
+
+    Returns \a date as a string. Time fields of the format are copied as
+    they are.
+
+    \sa toDate(), QDate::toString()
+*/
+QString QDateTimeFormat::toString(QDate date) const
+{
+    QString result;
+    result.reserve(d->sizeHint);
+    d->appendTo(result, QDateTime(), date, QTime());
+    return result;
+}
+
+/*!
+    \overload
+
+    Returns \a time as a string. Date fields of the format are copied as
+    they are.
+
+    \sa toTime(), QTime::toString()
+*/
+QString QDateTimeFormat::toString(QTime time) const
+{
+    QString result;
+    result.reserve(d->sizeHint);
+    d->appendTo(result, QDateTime(), QDate(), time);
+    return result;
+}
+
+/*!
+    Appends \a dateTime to \a str, in the format of this object. Nothing is
+    appended if \a dateTime is invalid.
+
+    \sa toString()
+*/
+void QDateTimeFormat::appendTo(QString &str, const QDateTime &dateTime) const
+{
+    d->appendTo(str, dateTime, QDate(), QTime());
+}
+
+/*!
+    \overload
+*/
+void QDateTimeFormat::appendTo(QString &str, QDate date) const
+{
+    d->appendTo(str, QDateTime(), date, QTime());
+}
+
+/*!
+    \overload
+*/
+void QDateTimeFormat::appendTo(QString &str, QTime time) const
+{
+    d->appendTo(str, QDateTime(), QDate(), time);
+}
+
+/*!
+    Reads \a string as a date-time in the format of this object, as
+    QLocale::toDateTime() does, and returns it. Returns an invalid
+    date-time if \a string cannot be parsed.
+
+    \include qlocale.cpp base-year-for-two-digit
+
+    \sa toString(), QDateTime::fromString()
+*/
+QDateTime QDateTimeFormat::toDateTime(const QString &string, int baseYear) const
+{
+#if QT_CONFIG(datetimeparser)
+    QDateTime datetime;
+    if (d->dateTimeFormatOk) {
+        const QDateTimeParser parser = d->dateTimeParser;
+        if (parser.fromString(string, &datetime, baseYear) || !datetime.isValid())
+            return datetime;
+    }
+#else
+    Q_UNUSED(string);
+    Q_UNUSED(baseYear);
+#endif
+    return QDateTime();
+}
+
+/*!
+    Reads \a string as a date in the format of this object, as
+    QLocale::toDate() does, and returns it. Returns an invalid date if
+    \a string cannot be parsed.
+
+    \include qlocale.cpp base-year-for-two-digit
+
+    \sa toString(), QDate::fromString()
+*/
+QDate QDateTimeFormat::toDate(const QString &string, int baseYear) const
+{
+    QDate date;
+#if QT_CONFIG(datetimeparser)
+    if (d->dateFormatOk) {
+        const QDateTimeParser parser = d->dateParser;
+        parser.fromString(string, &date, nullptr, baseYear);
+    }
+#else
+    Q_UNUSED(string);
+    Q_UNUSED(baseYear);
+#endif
+    return date;
+}
+
+/*!
+    Reads \a string as a time in the format of this object, as
+    QLocale::toTime() does, and returns it. Returns an invalid time if
+    \a string cannot be parsed.
+
+    \sa toString(), QTime::fromString()
+*/
+QTime QDateTimeFormat::toTime(const QString &string) const
+{
+    QTime time;
+#if QT_CONFIG(datetimeparser)
+    if (d->timeFormatOk) {
+        const QDateTimeParser parser = d->timeParser;
+        parser.fromString(string, nullptr, &time);
+    }
+#else
+    Q_UNUSED(string);
+#endif
+    return time;
+}
+
+#endif // datestring
+
+QT_END_NAMESPACE
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QDATETIMEFORMAT_H
+#define QDATETIMEFORMAT_H
+
+#include <QtCore/qcalendar.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+#if QT_CONFIG(datestring)
+
+class QDateTimeFormatPrivate;
+QT_DECLARE_QESDP_SPECIALIZATION_DTOR_WITH_EXPORT(QDateTimeFormatPrivate, Q_CORE_EXPORT)
+
+class Q_CORE_EXPORT QDateTimeFormat
+{
+public:
+    QDateTimeFormat();
+    explicit QDateTimeFormat(QStringView format, QCalendar cal = QCalendar());
+    QDateTimeFormat(QStringView format, const QLocale &locale, QCalendar cal = QCalendar());
+    QDateTimeFormat(const QDateTimeFormat &other) noexcept;
+    QDateTimeFormat(QDateTimeFormat &&other) noexcept = default;
+    QDateTimeFormat &operator=(const QDateTimeFormat &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QDateTimeFormat)
+    ~QDateTimeFormat();
+
+    void swap(QDateTimeFormat &other) noexcept
+    { d.swap(other.d); }
+
+    QString format() const;
+    QLocale locale() const;
+    QCalendar calendar() const;
+
+    QString toString(const QDateTime &dateTime) const;
+    QString toString(QDate date) const;
+    QString toString(QTime time) const;
+
+    void appendTo(QString &str, const QDateTime &dateTime) const;
+    void appendTo(QString &str, QDate date) const;
+    void appendTo(QString &str, QTime time) const;
+
+    QDateTime toDateTime(const QString &string,
+                         int baseYear = QLocale::DefaultTwoDigitBaseYear) const;
+    QDate toDate(const QString &string, int baseYear = QLocale::DefaultTwoDigitBaseYear) const;
+    QTime toTime(const QString &string) const;
+
+private:
+    QExplicitlySharedDataPointer<QDateTimeFormatPrivate> d;
+};
+
+Q_DECLARE_SHARED(QDateTimeFormat)
+
+#endif // datestring
+
+QT_END_NAMESPACE
+
+#endif // QDATETIMEFORMAT_H
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <QtCore/qarraydata.h>
+#include <QtCore/qmemoryresource.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/private/qtools_p.h>
 #include <QtCore/qmath.h>
@@ -10,6 +11,7 @@
 #include <QtCore/qbytearray.h>  // QBA::value_type
 #include <QtCore/qstring.h>  // QString::value_type
 
+#include <new>
 #include <stdlib.h>
 
 QT_BEGIN_NAMESPACE
@@ -134,12 +136,53 @@ calculateBlockSize(qsizetype capacity, qsizetype objectSize, qsizetype headerSiz
     }
 }
 
-static QArrayData *allocateData(qsizetype allocSize)
+namespace {
+// Precedes the header of the blocks allocated from a QMemoryResource, which
+// need to be returned to it with their size
+struct alignas(QtPrivate::MaxPrimitiveAlignment) ResourceBlockPrefix
+{
+    QMemoryResource *resource;
+    qsizetype size;     // not including this prefix
+};
+}
+
+static ResourceBlockPrefix *resourcePrefix(QArrayData *header) noexcept
 {
-    QArrayData *header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+    return reinterpret_cast<ResourceBlockPrefix *>(header) - 1;
+}
+
+static QArrayData *allocateFromResource(QMemoryResource *resource, qsizetype allocSize) noexcept
+{
+    qsizetype blockSize;
+    if (Q_UNLIKELY(qAddOverflow(allocSize, qsizetype(sizeof(ResourceBlockPrefix)), &blockSize)))
+        return nullptr;
+    void *block = resource->allocate(blockSize, alignof(ResourceBlockPrefix));
+    if (!block)
+        return nullptr;
+    auto prefix = new (block) ResourceBlockPrefix{ resource, allocSize };
+    return reinterpret_cast<QArrayData *>(prefix + 1);
+}
+
+static void deallocateFromResource(QArrayData *header) noexcept
+{
+    ResourceBlockPrefix *prefix = resourcePrefix(header);
+    prefix->resource->deallocate(prefix, prefix->size + qsizetype(sizeof(ResourceBlockPrefix)),
+                                 alignof(ResourceBlockPrefix));
+}
+
+static QArrayData *allocateData(qsizetype allocSize, QMemoryResource *resource)
+{
+    QArrayData *header;
+    QArrayData::ArrayOptions flags = {};
+    if (resource) {
+        header = allocateFromResource(resource, allocSize);
+        flags = QArrayData::AllocatedFromResource;
+    } else {
+        header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+    }
     if (header) {
         header->ref_.storeRelaxed(1);
-        header->flags = {};
+        header->flags = flags;
         header->alloc = 0;
     }
     return header;
@@ -155,7 +198,7 @@ using QtPrivate::AlignedQArrayData;
 
 static inline AllocationResult
 allocateHelper(qsizetype objectSize, qsizetype alignment, qsizetype capacity,
-               QArrayData::AllocationOption option) noexcept
+               QArrayData::AllocationOption option, QMemoryResource *resource = nullptr) noexcept
 {
     if (capacity == 0)
         return {};
@@ -178,7 +221,7 @@ allocateHelper(qsizetype objectSize, qsizetype alignment, qsizetype capacity,
     if (Q_UNLIKELY(allocSize < 0))      // handle overflow. cannot allocate reliably
         return {};
 
-    QArrayData *header = allocateData(allocSize);
+    QArrayData *header = allocateData(allocSize, resource);
     void *data = nullptr;
     if (header) {
         // find where offset should point to so that data() is aligned to alignment bytes
@@ -203,6 +246,30 @@ void *QArrayData::allocate(QArrayData **dptr, qsizetype objectSize, qsizetype al
     return r.data;
 }
 
+// Allocation from a memory resource. This is only reached by code that opted
+// in with QMemoryResource::reserve(), never by the code inlined in binaries
+// compiled against earlier versions, which free the arrays with free().
+void *QArrayData::allocate(QArrayData **dptr, qsizetype objectSize, qsizetype alignment,
+                           qsizetype capacity, AllocationOption option,
+                           QMemoryResource *resource) noexcept
+{
+    Q_ASSERT(dptr);
+    // Alignment is a power of two
+    Q_ASSERT(alignment >= qsizetype(alignof(QArrayData))
+            && !(alignment & (alignment - 1)));
+
+    auto r = allocateHelper(objectSize, alignment, capacity, option, resource);
+    *dptr = r.header;
+    return r.data;
+}
+
+QMemoryResource *QArrayData::memoryResource(const QArrayData *data) noexcept
+{
+    if (!data || !(data->flags & AllocatedFromResource))
+        return nullptr;
+    return resourcePrefix(const_cast<QArrayData *>(data))->resource;
+}
+
 // Fixed size and alignment allocation functions
 void *QArrayData::allocate1(QArrayData **dptr, qsizetype capacity, AllocationOption option) noexcept
 {
@@ -241,7 +308,18 @@ QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer,
     Q_ASSERT(offset > 0);
     Q_ASSERT(offset <= allocSize); // equals when all free space is at the beginning
 
-    QArrayData *header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    QArrayData *header;
+    if (data && (data->flags & AllocatedFromResource)) {
+        // stay in the same resource, which cannot resize blocks
+        ResourceBlockPrefix *prefix = resourcePrefix(data);
+        header = allocateFromResource(prefix->resource, allocSize);
+        if (header) {
+            ::memcpy(static_cast<void *>(header), data, size_t(qMin(prefix->size, allocSize)));
+            deallocateFromResource(data);
+        }
+    } else {
+        header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
+    }
     if (header) {
         header->alloc = capacity;
         dataPointer = reinterpret_cast<char *>(header) + offset;
@@ -260,7 +338,10 @@ void QArrayData::deallocate(QArrayData *data, qsizetype objectSize,
     Q_UNUSED(objectSize);
     Q_UNUSED(alignment);
 
-    ::free(data);
+    if (data && (data->flags & AllocatedFromResource))
+        deallocateFromResource(data);
+    else
+        ::free(data);
 }
 
 QT_END_NAMESPACE
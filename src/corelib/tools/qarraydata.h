@@ -19,6 +19,7 @@ QT_BEGIN_NAMESPACE
 #  define Q_DECL_MALLOCLIKE [[nodiscard]]
 #endif
 
+class QMemoryResource;
 template <class T> struct QTypedArrayData;
 
 struct QArrayData
@@ -35,7 +36,8 @@ struct QArrayData
 
    enum ArrayOption {
         ArrayOptionDefault = 0,
-        CapacityReserved     = 0x1  //!< the capacity was reserved by the user, try to keep it
+        CapacityReserved     = 0x1,  //!< the capacity was reserved by the user, try to keep it
+        AllocatedFromResource = 0x2  //!< the block comes from a QMemoryResource, not from malloc()
     };
     Q_DECLARE_FLAGS(ArrayOptions, ArrayOption)
 
@@ -90,6 +92,9 @@ struct QArrayData
     static Q_CORE_EXPORT void *allocate(QArrayData **pdata, qsizetype objectSize, qsizetype alignment,
             qsizetype capacity, AllocationOption option = QArrayData::KeepSize) noexcept;
     Q_DECL_MALLOCLIKE
+    static Q_CORE_EXPORT void *allocate(QArrayData **pdata, qsizetype objectSize, qsizetype alignment,
+            qsizetype capacity, AllocationOption option, QMemoryResource *resource) noexcept;
+    Q_DECL_MALLOCLIKE
     static Q_CORE_EXPORT void *allocate1(QArrayData **pdata, qsizetype capacity,
                                          AllocationOption option = QArrayData::KeepSize) noexcept;
     Q_DECL_MALLOCLIKE
@@ -100,6 +105,7 @@ struct QArrayData
             qsizetype objectSize, qsizetype newCapacity, AllocationOption option) noexcept;
     static Q_CORE_EXPORT void deallocate(QArrayData *data, qsizetype objectSize,
             qsizetype alignment) noexcept;
+    static Q_CORE_EXPORT QMemoryResource *memoryResource(const QArrayData *data) noexcept;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QArrayData::ArrayOptions)
@@ -147,6 +153,19 @@ struct QTypedArrayData
         return {static_cast<QTypedArrayData *>(d), static_cast<T *>(result)};
     }
 
+    [[nodiscard]] static std::pair<QTypedArrayData *, T *>
+    allocate(qsizetype capacity, AllocationOption option, QMemoryResource *resource)
+    {
+        static_assert(sizeof(QTypedArrayData) == sizeof(QArrayData));
+        QArrayData *d;
+        void *result = QArrayData::allocate(&d, sizeof(T), alignof(AlignmentDummy), capacity,
+                                            option, resource);
+#if __has_builtin(__builtin_assume_aligned)
+        result = __builtin_assume_aligned(result, Q_ALIGNOF(AlignmentDummy));
+#endif
+        return {static_cast<QTypedArrayData *>(d), static_cast<T *>(result)};
+    }
+
     static std::pair<QTypedArrayData *, T *>
     reallocateUnaligned(QTypedArrayData *data, T *dataPointer, qsizetype capacity, AllocationOption option)
     {
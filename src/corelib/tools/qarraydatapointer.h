@@ -59,6 +59,13 @@ public:
     {
     }
 
+    Q_NODISCARD_CTOR explicit
+    QArrayDataPointer(qsizetype alloc, qsizetype n, QArrayData::AllocationOption option,
+                      QMemoryResource *resource)
+        : QArrayDataPointer(Data::allocate(alloc, option, resource), n)
+    {
+    }
+
     Q_NODISCARD_CTOR
     static QArrayDataPointer fromRawData(const T *rawData, qsizetype length) noexcept
     {
@@ -107,7 +114,10 @@ public:
     {
         if (!deref()) {
             (*this)->destroyAll();
-            free(d);
+            if (Q_UNLIKELY(d->flags & QArrayData::AllocatedFromResource))
+                Data::deallocate(d);
+            else
+                free(d);
         }
     }
 
@@ -446,6 +456,18 @@ public:
     void setFlag(typename Data::ArrayOptions f) noexcept { Q_ASSERT(d); d->flags |= f; }
     void clearFlag(typename Data::ArrayOptions f) noexcept { if (d) d->flags &= ~f; }
 
+    /*! \internal
+        Returns the memory resource that a new array replacing this one must
+        come from, or \nullptr for \c malloc(). An array from a memory
+        resource grows in it, but a copy that detaches from it does not.
+    */
+    QMemoryResource *growthResource() const noexcept
+    {
+        if (Q_UNLIKELY(flags() & QArrayData::AllocatedFromResource) && !isShared())
+            return QArrayData::memoryResource(d);
+        return nullptr;
+    }
+
     Data *d_ptr() noexcept { return d; }
     void setBegin(T *begin) noexcept { ptr = begin; }
 
@@ -476,7 +498,10 @@ public:
         minimalCapacity -= (position == QArrayData::GrowsAtEnd) ? from.freeSpaceAtEnd() : from.freeSpaceAtBegin();
         qsizetype capacity = from.detachCapacity(minimalCapacity);
         const bool grows = capacity > from.constAllocatedCapacity();
-        auto [header, dataPtr] = Data::allocate(capacity, grows ? QArrayData::Grow : QArrayData::KeepSize);
+        const QArrayData::AllocationOption option = grows ? QArrayData::Grow : QArrayData::KeepSize;
+        QMemoryResource *resource = from.growthResource();
+        auto [header, dataPtr] = resource ? Data::allocate(capacity, option, resource)
+                                          : Data::allocate(capacity, option);
         const bool valid = header != nullptr && dataPtr != nullptr;
         if (!valid)
             return QArrayDataPointer(header, dataPtr);
@@ -486,7 +511,9 @@ public:
         dataPtr += (position == QArrayData::GrowsAtBeginning)
                 ? n + qMax(0, (header->alloc - from.size - n) / 2)
                 : from.freeSpaceAtBegin();
-        header->flags = from.flags();
+        // the new block keeps its own allocator
+        header->flags = (header->flags & QArrayData::AllocatedFromResource)
+                | (from.flags() & ~QArrayData::ArrayOptions(QArrayData::AllocatedFromResource));
         return QArrayDataPointer(header, dataPtr);
     }
 
@@ -0,0 +1,307 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTCACHE_H
+#define QCONCURRENTCACHE_H
+
+#include <QtCore/qcache.h>
+#include <QtCore/qconcurrenthash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+
+#include <memory>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+template <class Key, class T>
+class QConcurrentCache
+{
+public:
+    struct Statistics
+    {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 coalescedMisses = 0;
+        qint64 insertions = 0;
+        qint64 evictions = 0;
+
+        double hitRatio() const noexcept
+        {
+            const qint64 lookups = hits + misses;
+            return lookups ? double(hits) / double(lookups) : 0.0;
+        }
+
+        Statistics &operator+=(const Statistics &other) noexcept
+        {
+            hits += other.hits;
+            misses += other.misses;
+            coalescedMisses += other.coalescedMisses;
+            insertions += other.insertions;
+            evictions += other.evictions;
+            return *this;
+        }
+    };
+
+private:
+    // a value being computed by getOrCompute(), shared with the threads
+    // waiting for it
+    struct Pending
+    {
+        std::optional<T> value;
+        bool finished = false;
+    };
+
+    struct alignas(64) Shard
+    {
+        mutable QMutex mutex;
+        QWaitCondition computed;
+        QCache<Key, T> cache;
+        QHash<Key, std::shared_ptr<Pending>> pending;
+        Statistics stats;
+        qsizetype budget = 0; // the part of maxCost() of this shard
+
+        // The QCache has the maxCost() of the whole cache, so that it only
+        // rejects values costing more than that. Evict down to the budget
+        // afterwards, keeping the new value even if it alone exceeds it.
+        // QCache does not report which items it evicts, count them.
+        bool insert(const Key &key, T *object, qsizetype cost)
+        {
+            const qsizetype before = cache.size() - (cache.contains(key) ? 1 : 0);
+            const bool inserted = cache.insert(key, object, cost);
+            if (inserted) {
+                ++stats.insertions;
+                if (cache.totalCost() > budget)
+                    trim(qMax(budget, cost));
+            }
+            stats.evictions += before + (inserted ? 1 : 0) - cache.size();
+            return inserted;
+        }
+
+        void trim(qsizetype cost)
+        {
+            const qsizetype m = cache.maxCost();
+            cache.setMaxCost(cost);
+            cache.setMaxCost(m);
+        }
+    };
+
+public:
+    static constexpr qsizetype DefaultShardCount = 16;
+
+    explicit QConcurrentCache(qsizetype maxCost = 100, qsizetype shardCount = DefaultShardCount)
+        : numShards(QConcurrentHashPrivate::shardCountFor(shardCount)),
+          d(new Shard[size_t(numShards)])
+    {
+        setMaxCost(maxCost);
+    }
+
+    Q_DISABLE_COPY_MOVE(QConcurrentCache)
+
+    qsizetype shardCount() const noexcept { return numShards; }
+
+    qsizetype maxCost() const noexcept { return mx.loadRelaxed(); }
+
+    void setMaxCost(qsizetype m)
+    {
+        mx.storeRelaxed(m);
+        // the budgets add up to m exactly
+        for (qsizetype i = 0; i < numShards; ++i) {
+            const qsizetype budget = m / numShards + (i < m % numShards ? 1 : 0);
+            Shard &s = d[i];
+            QMutexLocker locker(&s.mutex);
+            const qsizetype before = s.cache.size();
+            s.budget = budget;
+            s.cache.setMaxCost(m);
+            s.trim(budget);
+            s.stats.evictions += before - s.cache.size();
+        }
+    }
+
+    qsizetype totalCost() const
+    {
+        qsizetype n = 0;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QMutexLocker locker(&d[i].mutex);
+            n += d[i].cache.totalCost();
+        }
+        return n;
+    }
+
+    qsizetype size() const
+    {
+        qsizetype n = 0;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QMutexLocker locker(&d[i].mutex);
+            n += d[i].cache.size();
+        }
+        return n;
+    }
+    qsizetype count() const { return size(); }
+    bool isEmpty() const { return size() == 0; }
+
+    void clear()
+    {
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QMutexLocker locker(&d[i].mutex);
+            d[i].cache.clear();
+        }
+    }
+
+    bool contains(const Key &key) const
+    {
+        const Shard &s = shardFor(key);
+        QMutexLocker locker(&s.mutex);
+        return s.cache.contains(key);
+    }
+
+    std::optional<T> value(const Key &key)
+    {
+        Shard &s = shardFor(key);
+        QMutexLocker locker(&s.mutex);
+        if (const T *t = s.cache.object(key)) {
+            ++s.stats.hits;
+            return *t;
+        }
+        ++s.stats.misses;
+        return std::nullopt;
+    }
+
+    T value(const Key &key, const T &defaultValue)
+    {
+        std::optional<T> t = value(key);
+        return t ? std::move(*t) : defaultValue;
+    }
+
+    bool insert(const Key &key, const T &value, qsizetype cost = 1)
+    {
+        Shard &s = shardFor(key);
+        T *object = new T(value);
+        QMutexLocker locker(&s.mutex);
+        return s.insert(key, object, cost);
+    }
+
+    bool insert(const Key &key, T &&value, qsizetype cost = 1)
+    {
+        Shard &s = shardFor(key);
+        T *object = new T(std::move(value));
+        QMutexLocker locker(&s.mutex);
+        return s.insert(key, object, cost);
+    }
+
+    template <typename Compute>
+    T getOrCompute(const Key &key, Compute compute)
+    {
+        return getOrCompute(key, std::move(compute), [](const T &) { return qsizetype(1); });
+    }
+
+    template <typename Compute, typename CostFunction>
+    T getOrCompute(const Key &key, Compute compute, CostFunction cost)
+    {
+        Shard &s = shardFor(key);
+        QMutexLocker locker(&s.mutex);
+        if (const T *t = s.cache.object(key)) {
+            ++s.stats.hits;
+            return *t;
+        }
+        ++s.stats.misses;
+
+        // if another thread is computing the value, wait for its result
+        bool coalesced = false;
+        for (auto it = s.pending.constFind(key); it != s.pending.cend();
+             it = s.pending.constFind(key)) {
+            const std::shared_ptr<Pending> p = it.value();
+            if (!std::exchange(coalesced, true))
+                ++s.stats.coalescedMisses;
+            while (!p->finished)
+                s.computed.wait(&s.mutex);
+            if (p->value)
+                return *p->value;
+            // the computation failed, try again
+            if (const T *t = s.cache.object(key))
+                return *t;
+        }
+
+        const auto p = std::make_shared<Pending>();
+        s.pending.insert(key, p);
+        locker.unlock();
+
+        std::optional<T> result;
+        qsizetype c = 0;
+        T *object = nullptr;
+        QT_TRY {
+            result.emplace(compute());
+            c = cost(*result);
+            object = new T(*result);
+        } QT_CATCH(...) {
+            locker.relock();
+            s.pending.remove(key);
+            p->finished = true;
+            s.computed.wakeAll();
+            QT_RETHROW;
+        }
+
+        locker.relock();
+        s.insert(key, object, c);
+        s.pending.remove(key);
+        if (p.use_count() > 1) // someone is waiting for it
+            p->value = result;
+        p->finished = true;
+        s.computed.wakeAll();
+        return std::move(*result);
+    }
+
+    bool remove(const Key &key)
+    {
+        Shard &s = shardFor(key);
+        QMutexLocker locker(&s.mutex);
+        return s.cache.remove(key);
+    }
+
+    std::optional<T> take(const Key &key)
+    {
+        Shard &s = shardFor(key);
+        std::unique_ptr<T> t;
+        {
+            QMutexLocker locker(&s.mutex);
+            t.reset(s.cache.take(key));
+        }
+        if (!t)
+            return std::nullopt;
+        return std::move(*t);
+    }
+
+    Statistics statistics() const
+    {
+        Statistics result;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QMutexLocker locker(&d[i].mutex);
+            result += d[i].stats;
+        }
+        return result;
+    }
+
+    void resetStatistics()
+    {
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QMutexLocker locker(&d[i].mutex);
+            d[i].stats = Statistics();
+        }
+    }
+
+private:
+    Shard &shardFor(const Key &key) const
+    {
+        const size_t h = QHashPrivate::calculateHash(key, seed);
+        return d[QConcurrentHashPrivate::shardBits(h) & size_t(numShards - 1)];
+    }
+
+    const qsizetype numShards;
+    const std::unique_ptr<Shard[]> d;
+    const size_t seed = QHashSeed::globalSeed();
+    QAtomicInteger<qsizetype> mx;
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTCACHE_H
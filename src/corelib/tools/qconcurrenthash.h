@@ -0,0 +1,382 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTHASH_H
+#define QCONCURRENTHASH_H
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qreadwritelock.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+namespace QConcurrentHashPrivate {
+
+constexpr qsizetype MaxShardCount = qsizetype(1) << 16;
+
+// QHash picks buckets with the low bits of the hash, so pick shards with
+// the high bits of a mixed one, which are independent from them
+inline size_t shardBits(size_t hash) noexcept
+{
+    if constexpr (sizeof(size_t) == 8)
+        hash *= size_t(0x9e3779b97f4a7c15ULL);
+    else
+        hash *= size_t(0x9e3779b9U);
+    return hash >> (sizeof(size_t) * 8 - 16);
+}
+
+inline qsizetype shardCountFor(qsizetype requested) noexcept
+{
+    qsizetype n = 1;
+    while (n < requested && n < MaxShardCount)
+        n *= 2;
+    return n;
+}
+
+} // namespace QConcurrentHashPrivate
+
+template <typename Key, typename T>
+class QConcurrentHash
+{
+    struct alignas(64) Shard // keep the locks of different shards on different cache lines
+    {
+        mutable QReadWriteLock lock;
+        QHash<Key, T> hash;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using size_type = qsizetype;
+
+    static constexpr qsizetype DefaultShardCount = 64;
+
+    class Snapshot
+    {
+    public:
+        class const_iterator
+        {
+            using ShardIterator = typename QHash<Key, T>::const_iterator;
+
+            const QHash<Key, T> *shard = nullptr;
+            const QHash<Key, T> *shardsEnd = nullptr;
+            ShardIterator it;
+
+            friend class Snapshot;
+            const_iterator(const QHash<Key, T> *s, const QHash<Key, T> *e) noexcept
+                : shard(s), shardsEnd(e)
+            {
+                if (shard != shardsEnd)
+                    it = shard->cbegin();
+                skipEmptyShards();
+            }
+            void skipEmptyShards() noexcept
+            {
+                while (shard != shardsEnd && it == shard->cend()) {
+                    if (++shard != shardsEnd)
+                        it = shard->cbegin();
+                }
+                if (shard == shardsEnd)
+                    it = ShardIterator();
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = qptrdiff;
+            using value_type = T;
+            using pointer = const T *;
+            using reference = const T &;
+
+            constexpr const_iterator() noexcept = default;
+
+            const Key &key() const noexcept { return it.key(); }
+            const T &value() const noexcept { return it.value(); }
+            const T &operator*() const noexcept { return it.value(); }
+            const T *operator->() const noexcept { return &it.value(); }
+            bool operator==(const const_iterator &o) const noexcept
+            { return shard == o.shard && it == o.it; }
+            bool operator!=(const const_iterator &o) const noexcept { return !(*this == o); }
+
+            const_iterator &operator++() noexcept
+            {
+                ++it;
+                skipEmptyShards();
+                return *this;
+            }
+            const_iterator operator++(int) noexcept
+            {
+                const_iterator r = *this;
+                ++*this;
+                return r;
+            }
+        };
+
+        Snapshot() noexcept = default;
+
+        qsizetype size() const noexcept
+        {
+            qsizetype n = 0;
+            for (const QHash<Key, T> &h : shards)
+                n += h.size();
+            return n;
+        }
+        qsizetype count() const noexcept { return size(); }
+        bool isEmpty() const noexcept { return size() == 0; }
+
+        bool contains(const Key &key) const
+        {
+            return !shards.isEmpty() && shards.at(indexOf(key)).contains(key);
+        }
+        T value(const Key &key) const
+        {
+            return shards.isEmpty() ? T() : shards.at(indexOf(key)).value(key);
+        }
+        T value(const Key &key, const T &defaultValue) const
+        {
+            return shards.isEmpty() ? defaultValue : shards.at(indexOf(key)).value(key, defaultValue);
+        }
+
+        QHash<Key, T> toHash() const
+        {
+            QHash<Key, T> result;
+            result.reserve(size());
+            for (const QHash<Key, T> &h : shards) {
+                for (auto it = h.cbegin(), end = h.cend(); it != end; ++it)
+                    result.insert(it.key(), it.value());
+            }
+            return result;
+        }
+
+        const_iterator begin() const noexcept { return const_iterator(shards.constData(), shardsEnd()); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator constBegin() const noexcept { return begin(); }
+        const_iterator end() const noexcept { return const_iterator(shardsEnd(), shardsEnd()); }
+        const_iterator cend() const noexcept { return end(); }
+        const_iterator constEnd() const noexcept { return end(); }
+
+    private:
+        friend class QConcurrentHash;
+
+        const QHash<Key, T> *shardsEnd() const noexcept { return shards.constData() + shards.size(); }
+        qsizetype indexOf(const Key &key) const
+        {
+            return qsizetype(QConcurrentHashPrivate::shardBits(QHashPrivate::calculateHash(key, seed))
+                             & size_t(shards.size() - 1));
+        }
+
+        QList<QHash<Key, T>> shards;
+        size_t seed = 0;
+    };
+
+    explicit QConcurrentHash(qsizetype shardCount = DefaultShardCount)
+        : numShards(QConcurrentHashPrivate::shardCountFor(shardCount)),
+          d(new Shard[size_t(numShards)])
+    {
+    }
+
+    Q_DISABLE_COPY_MOVE(QConcurrentHash)
+
+    qsizetype shardCount() const noexcept { return numShards; }
+
+    qsizetype size() const
+    {
+        qsizetype n = 0;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QReadLocker locker(&d[i].lock);
+            n += d[i].hash.size();
+        }
+        return n;
+    }
+    qsizetype count() const { return size(); }
+
+    bool isEmpty() const
+    {
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QReadLocker locker(&d[i].lock);
+            if (!d[i].hash.isEmpty())
+                return false;
+        }
+        return true;
+    }
+
+    void reserve(qsizetype size)
+    {
+        const qsizetype perShard = (size + numShards - 1) / numShards;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QWriteLocker locker(&d[i].lock);
+            d[i].hash.reserve(perShard);
+        }
+    }
+
+    void clear()
+    {
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QHash<Key, T> old;
+            {
+                QWriteLocker locker(&d[i].lock);
+                old.swap(d[i].hash);
+            }
+            // old is destroyed outside of the lock
+        }
+    }
+
+    bool contains(const Key &key) const
+    {
+        const Shard &s = shardFor(key);
+        QReadLocker locker(&s.lock);
+        return s.hash.contains(key);
+    }
+
+    T value(const Key &key) const
+    {
+        const Shard &s = shardFor(key);
+        QReadLocker locker(&s.lock);
+        return s.hash.value(key);
+    }
+
+    T value(const Key &key, const T &defaultValue) const
+    {
+        const Shard &s = shardFor(key);
+        QReadLocker locker(&s.lock);
+        return s.hash.value(key, defaultValue);
+    }
+
+    template <typename Function>
+    bool visit(const Key &key, Function f) const
+    {
+        const Shard &s = shardFor(key);
+        QReadLocker locker(&s.lock);
+        const auto it = s.hash.constFind(key);
+        if (it == s.hash.cend())
+            return false;
+        f(it.value());
+        return true;
+    }
+
+    void insert(const Key &key, const T &value)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        s.hash.insert(key, value);
+    }
+
+    void insert(const Key &key, T &&value)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        s.hash.insert(key, std::move(value));
+    }
+
+    bool tryInsert(const Key &key, const T &value)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        if (s.hash.contains(key))
+            return false;
+        s.hash.insert(key, value);
+        return true;
+    }
+
+    template <typename Function>
+    bool insertOrUpdate(const Key &key, const T &value, Function update)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        const auto it = s.hash.find(key);
+        if (it != s.hash.end()) {
+            update(it.value());
+            return false;
+        }
+        s.hash.insert(key, value);
+        return true;
+    }
+
+    template <typename Function>
+    bool update(const Key &key, Function update)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        const auto it = s.hash.find(key);
+        if (it == s.hash.end())
+            return false;
+        update(it.value());
+        return true;
+    }
+
+    template <typename Factory>
+    T valueOrInsert(const Key &key, Factory create)
+    {
+        Shard &s = shardFor(key);
+        {
+            QReadLocker locker(&s.lock);
+            const auto it = s.hash.constFind(key);
+            if (it != s.hash.cend())
+                return it.value();
+        }
+        QWriteLocker locker(&s.lock);
+        const auto it = s.hash.find(key);
+        if (it != s.hash.end())
+            return it.value();
+        return s.hash.insert(key, create()).value();
+    }
+
+    bool remove(const Key &key)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        return s.hash.remove(key);
+    }
+
+    T take(const Key &key)
+    {
+        Shard &s = shardFor(key);
+        QWriteLocker locker(&s.lock);
+        return s.hash.take(key);
+    }
+
+    template <typename Predicate>
+    qsizetype removeIf(Predicate pred)
+    {
+        qsizetype n = 0;
+        for (qsizetype i = 0; i < numShards; ++i) {
+            QWriteLocker locker(&d[i].lock);
+            n += d[i].hash.removeIf(pred);
+        }
+        return n;
+    }
+
+    Snapshot snapshot() const
+    {
+        Snapshot result;
+        result.seed = seed;
+        result.shards.reserve(numShards);
+        // lock all shards, always in the same order, to copy a consistent state;
+        // the copies share their data with the shards until those are modified
+        for (qsizetype i = 0; i < numShards; ++i)
+            d[i].lock.lockForRead();
+        for (qsizetype i = 0; i < numShards; ++i)
+            result.shards.append(d[i].hash);
+        for (qsizetype i = numShards; i > 0; --i)
+            d[i - 1].lock.unlock();
+        return result;
+    }
+
+    QHash<Key, T> toHash() const { return snapshot().toHash(); }
+
+private:
+    Shard &shardFor(const Key &key) const
+    {
+        const size_t h = QHashPrivate::calculateHash(key, seed);
+        return d[QConcurrentHashPrivate::shardBits(h) & size_t(numShards - 1)];
+    }
+
+    const qsizetype numShards;
+    const std::unique_ptr<Shard[]> d;
+    const size_t seed = QHashSeed::globalSeed();
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTHASH_H
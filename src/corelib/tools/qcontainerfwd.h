@@ -19,6 +19,9 @@
 QT_BEGIN_NAMESPACE
 
 template <typename Key, typename T> class QCache;
+template <typename Key, typename T> class QConcurrentCache;
+template <typename Key, typename T> class QConcurrentHash;
+template <typename Key, typename T> class QFlatHash;
 template <typename Key, typename T> class QHash;
 template <typename Key, typename T> class QMap;
 template <typename Key, typename T> class QMultiHash;
@@ -0,0 +1,805 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QFLATHASH_H
+#define QFLATHASH_H
+
+#include <QtCore/qhash.h>
+#include <QtCore/qsimd.h>
+
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFlatHashPrivate {
+
+// One control byte per slot. A full slot stores the low seven bits of the
+// key's hash (its "tag"), so the high bit tells free slots from full ones.
+enum : uchar {
+    EmptySlot = 0x80,
+    DeletedSlot = 0xfe,
+    TagMask = 0x7f,
+};
+
+// A set of slots in a group, one (or, with NEON, four) bits per slot.
+template <typename Mask, int Shift>
+struct BitMask
+{
+    Mask bits;
+
+    explicit operator bool() const noexcept { return bits != 0; }
+    uint lowest() const noexcept { return qCountTrailingZeroBits(bits) >> Shift; }
+    void next() noexcept { bits &= bits - 1; }
+    void skip(uint count) noexcept { bits &= ~Mask(0) << (count << Shift); }
+};
+
+// The control bytes are probed one group at a time, comparing all of them
+// against the tag of the key that is looked up in a single SIMD operation.
+struct Group
+{
+    static constexpr size_t Width = 16;
+
+#if QT_COMPILER_USES(sse2)
+    using Mask = BitMask<quint32, 0>;
+
+    static __m128i load(const uchar *ctrl) noexcept
+    { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl)); }
+    static Mask match(const uchar *ctrl, uchar tag) noexcept
+    {
+        const __m128i cmp = _mm_cmpeq_epi8(load(ctrl), _mm_set1_epi8(char(tag)));
+        return Mask{ quint32(_mm_movemask_epi8(cmp)) };
+    }
+    static Mask matchFree(const uchar *ctrl) noexcept
+    { return Mask{ quint32(_mm_movemask_epi8(load(ctrl))) }; }
+    static Mask matchFull(const uchar *ctrl) noexcept
+    { return Mask{ quint32(_mm_movemask_epi8(load(ctrl))) ^ 0xffffu }; }
+#elif QT_COMPILER_USES(neon)
+    using Mask = BitMask<quint64, 2>;
+
+    static Mask toMask(uint8x16_t cmp) noexcept
+    {
+        // narrowing shift: four bits per byte, keep one of them
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+        return Mask{ vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & Q_UINT64_C(0x8888888888888888) };
+    }
+    static Mask match(const uchar *ctrl, uchar tag) noexcept
+    { return toMask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(tag))); }
+    static Mask matchFree(const uchar *ctrl) noexcept
+    { return toMask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), vdupq_n_s8(0))); }
+    static Mask matchFull(const uchar *ctrl) noexcept
+    { return toMask(vcgeq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), vdupq_n_s8(0))); }
+#else
+    using Mask = BitMask<quint32, 0>;
+
+    template <typename Predicate>
+    static Mask matchIf(const uchar *ctrl, Predicate pred) noexcept
+    {
+        quint32 bits = 0;
+        for (size_t i = 0; i < Width; ++i)
+            bits |= quint32(pred(ctrl[i])) << i;
+        return Mask{ bits };
+    }
+    static Mask match(const uchar *ctrl, uchar tag) noexcept
+    { return matchIf(ctrl, [tag](uchar c) { return c == tag; }); }
+    static Mask matchFree(const uchar *ctrl) noexcept
+    { return matchIf(ctrl, [](uchar c) { return (c & EmptySlot) != 0; }); }
+    static Mask matchFull(const uchar *ctrl) noexcept
+    { return matchIf(ctrl, [](uchar c) { return (c & EmptySlot) == 0; }); }
+#endif
+
+    static Mask matchEmpty(const uchar *ctrl) noexcept { return match(ctrl, EmptySlot); }
+};
+
+// Triangular probing over the groups: with a power of two number of
+// groups, it visits every group exactly once.
+class ProbeSequence
+{
+    size_t group;
+    size_t groupMask;
+    size_t step = 0;
+public:
+    ProbeSequence(size_t hash, size_t numGroups) noexcept
+        : group((hash >> 7) & (numGroups - 1)), groupMask(numGroups - 1)
+    {}
+    size_t offset() const noexcept { return group * Group::Width; }
+    void next() noexcept
+    {
+        ++step;
+        group = (group + step) & groupMask;
+    }
+};
+
+inline constexpr uchar tagForHash(size_t hash) noexcept { return uchar(hash & TagMask); }
+
+// The table is kept at most 7/8 full, counting deleted slots.
+inline constexpr size_t growthCapacity(size_t numSlots) noexcept
+{
+    return numSlots - numSlots / 8;
+}
+
+inline constexpr size_t slotsForCapacity(size_t requestedCapacity) noexcept
+{
+    if (requestedCapacity == 0)
+        return 0;
+    constexpr int SizeDigits = std::numeric_limits<size_t>::digits;
+    const size_t needed = requestedCapacity + (requestedCapacity + 6) / 7;
+    if (needed <= Group::Width)
+        return Group::Width;
+    const int count = qCountLeadingZeroBits(needed - 1);
+    if (count < 1)
+        return (std::numeric_limits<size_t>::max)();    // will cause std::bad_alloc
+    return size_t(1) << (SizeDigits - count);
+}
+
+template <typename Node>
+struct Data
+{
+    struct Slot
+    {
+        alignas(Node) unsigned char storage[sizeof(Node)];
+        Node &node() noexcept { return *reinterpret_cast<Node *>(&storage); }
+    };
+
+    QtPrivate::RefCount ref = {{1}};
+    size_t size = 0;
+    size_t numSlots = 0;
+    size_t growthLeft = 0;
+    size_t seed = 0;
+    uchar *ctrl = nullptr;
+    Slot *entries = nullptr;
+
+    explicit Data(size_t reserve = 0)
+        : seed(QHashSeed::globalSeed())
+    {
+        allocate(slotsForCapacity(reserve));
+    }
+
+    Data(const Data &other)
+        : size(other.size), seed(other.seed)
+    {
+        allocate(other.numSlots);
+        growthLeft = other.growthLeft;
+        if (!numSlots)
+            return;
+        memcpy(ctrl, other.ctrl, numSlots);
+        for (size_t i = 0; i < numSlots; ++i) {
+            if (isFull(i))
+                new (&entries[i].node()) Node(other.entries[i].node());
+        }
+    }
+
+    Data(const Data &other, size_t reserved)
+        : size(other.size), seed(other.seed)
+    {
+        allocate(slotsForCapacity(qMax(size, reserved)));
+        for (size_t i = 0; i < other.numSlots; ++i) {
+            if (!other.isFull(i))
+                continue;
+            const Node &n = other.entries[i].node();
+            const size_t hash = QHashPrivate::calculateHash(n.key, seed);
+            const size_t to = findFreeSlot(hash);
+            new (&entries[to].node()) Node(n);
+            setFull(to, hash);
+        }
+    }
+
+    ~Data()
+    {
+        destroyNodes();
+        release();
+    }
+
+    static Data *detached(Data *d)
+    {
+        if (!d)
+            return new Data;
+        Data *dd = new Data(*d);
+        if (!d->ref.deref())
+            delete d;
+        return dd;
+    }
+    static Data *detached(Data *d, size_t size)
+    {
+        if (!d)
+            return new Data(size);
+        Data *dd = new Data(*d, size);
+        if (!d->ref.deref())
+            delete d;
+        return dd;
+    }
+
+    void allocate(size_t n)
+    {
+        if (n > size_t((std::numeric_limits<qsizetype>::max)()) / (sizeof(Slot) + 1))
+            qBadAlloc();
+        numSlots = n;
+        growthLeft = growthCapacity(n);
+        if (!n)
+            return;
+        ctrl = new uchar[n];
+        memset(ctrl, EmptySlot, n);
+        entries = new Slot[n];
+    }
+
+    void release() noexcept
+    {
+        delete[] ctrl;
+        delete[] entries;
+        ctrl = nullptr;
+        entries = nullptr;
+    }
+
+    void destroyNodes() noexcept(std::is_nothrow_destructible_v<Node>)
+    {
+        if constexpr (!std::is_trivially_destructible_v<Node>) {
+            for (size_t i = 0; i < numSlots; ++i) {
+                if (isFull(i))
+                    entries[i].node().~Node();
+            }
+        }
+    }
+
+    bool isFull(size_t i) const noexcept { return (ctrl[i] & EmptySlot) == 0; }
+    void setFull(size_t i, size_t hash) noexcept
+    {
+        if (ctrl[i] == EmptySlot)
+            --growthLeft;
+        ctrl[i] = tagForHash(hash);
+    }
+    bool shouldGrow() const noexcept { return growthLeft == 0; }
+    float loadFactor() const noexcept { return numSlots ? float(size) / float(numSlots) : 0; }
+
+    size_t nextFull(size_t i) const noexcept
+    {
+        while (i < numSlots) {
+            const size_t groupStart = i & ~(Group::Width - 1);
+            auto mask = Group::matchFull(ctrl + groupStart);
+            mask.skip(uint(i - groupStart));
+            if (mask)
+                return groupStart + mask.lowest();
+            i = groupStart + Group::Width;
+        }
+        return numSlots;
+    }
+
+    // Returns the slot holding \a key, or numSlots if there is none.
+    template <typename K>
+    size_t findSlot(const K &key, size_t hash) const noexcept
+    {
+        if (!numSlots)
+            return 0;
+        const uchar tag = tagForHash(hash);
+        for (ProbeSequence probe(hash, numSlots / Group::Width); ; probe.next()) {
+            const uchar *group = ctrl + probe.offset();
+            for (auto mask = Group::match(group, tag); mask; mask.next()) {
+                const size_t i = probe.offset() + mask.lowest();
+                if (qHashEquals(entries[i].node().key, key))
+                    return i;
+            }
+            // the key would have been stored in the first free slot
+            if (Group::matchEmpty(group))
+                return numSlots;
+        }
+    }
+
+    template <typename K>
+    size_t findSlot(const K &key) const noexcept
+    {
+        return numSlots ? findSlot(key, QHashPrivate::calculateHash(key, seed)) : 0;
+    }
+
+    template <typename K>
+    Node *findNode(const K &key) const noexcept
+    {
+        const size_t i = findSlot(key);
+        return i < numSlots ? &entries[i].node() : nullptr;
+    }
+
+    size_t findFreeSlot(size_t hash) const noexcept
+    {
+        Q_ASSERT(numSlots);
+        for (ProbeSequence probe(hash, numSlots / Group::Width); ; probe.next()) {
+            if (auto mask = Group::matchFree(ctrl + probe.offset()))
+                return probe.offset() + mask.lowest();
+        }
+    }
+
+    struct InsertionResult
+    {
+        size_t slot;
+        bool initialized;
+    };
+
+    // Finds the slot for \a key, marking a new one as used if there is
+    // none. The caller must construct the node in an uninitialized slot.
+    template <typename K>
+    InsertionResult findOrInsert(const K &key)
+    {
+        const size_t hash = QHashPrivate::calculateHash(key, seed);
+        if (numSlots) {
+            const size_t i = findSlot(key, hash);
+            if (i < numSlots)
+                return { i, true };
+        }
+        size_t i = numSlots ? findFreeSlot(hash) : 0;
+        if (!numSlots || (shouldGrow() && ctrl[i] == EmptySlot)) {
+            rehashForInsertion();
+            i = findFreeSlot(hash);
+        }
+        setFull(i, hash);
+        ++size;
+        return { i, false };
+    }
+
+    void rehashForInsertion()
+    {
+        // with enough deleted slots, reclaim them instead of growing
+        if (numSlots > Group::Width && size <= numSlots / 32 * 25)
+            rehashToSlots(numSlots);
+        else
+            rehashToSlots(numSlots ? numSlots * 2 : Group::Width);
+    }
+
+    void rehash(size_t sizeHint)
+    {
+        rehashToSlots(slotsForCapacity(qMax(size, sizeHint)));
+    }
+
+    void rehashToSlots(size_t newNumSlots)
+    {
+        uchar *oldCtrl = ctrl;
+        Slot *oldEntries = entries;
+        const size_t oldNumSlots = numSlots;
+        ctrl = nullptr;
+        entries = nullptr;
+        allocate(newNumSlots);
+        for (size_t i = 0; i < oldNumSlots; ++i) {
+            if (oldCtrl[i] & EmptySlot)
+                continue;
+            Node &n = oldEntries[i].node();
+            const size_t hash = QHashPrivate::calculateHash(n.key, seed);
+            const size_t to = findFreeSlot(hash);
+            new (&entries[to].node()) Node(std::move(n));
+            n.~Node();
+            setFull(to, hash);
+        }
+        delete[] oldCtrl;
+        delete[] oldEntries;
+    }
+
+    // Nodes never move when one is erased, so only iterators to the erased
+    // node are invalidated.
+    void erase(size_t i) noexcept(std::is_nothrow_destructible_v<Node>)
+    {
+        Q_ASSERT(isFull(i));
+        entries[i].node().~Node();
+        --size;
+        // A lookup only stops at a group with an empty slot. If this group
+        // already has one, no probe sequence goes past it and the slot can
+        // become empty again; otherwise, it has to stay in the way.
+        const size_t groupStart = i & ~(Group::Width - 1);
+        if (Group::matchEmpty(ctrl + groupStart)) {
+            ctrl[i] = EmptySlot;
+            ++growthLeft;
+        } else {
+            ctrl[i] = DeletedSlot;
+        }
+    }
+
+    void clear() noexcept(std::is_nothrow_destructible_v<Node>)
+    {
+        destroyNodes();
+        if (numSlots)
+            memset(ctrl, EmptySlot, numSlots);
+        size = 0;
+        growthLeft = growthCapacity(numSlots);
+    }
+};
+
+} // namespace QFlatHashPrivate
+
+template <typename Key, typename T>
+class QFlatHash
+{
+    using Node = QHashPrivate::Node<Key, T>;
+    using Data = QFlatHashPrivate::Data<Node>;
+
+    Data *d = nullptr;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = T;
+    using size_type = qsizetype;
+    using difference_type = qsizetype;
+    using reference = T &;
+    using const_reference = const T &;
+
+    QFlatHash() noexcept = default;
+    inline QFlatHash(std::initializer_list<std::pair<Key, T>> list)
+        : d(new Data(list.size()))
+    {
+        for (typename std::initializer_list<std::pair<Key, T>>::const_iterator it = list.begin(); it != list.end(); ++it)
+            insert(it->first, it->second);
+    }
+    QFlatHash(const QFlatHash &other) noexcept
+        : d(other.d)
+    {
+        if (d)
+            d->ref.ref();
+    }
+    ~QFlatHash()
+    {
+        static_assert(std::is_nothrow_destructible_v<Key>, "Types with throwing destructors are not supported in Qt containers.");
+        static_assert(std::is_nothrow_destructible_v<T>, "Types with throwing destructors are not supported in Qt containers.");
+
+        if (d && !d->ref.deref())
+            delete d;
+    }
+
+    QFlatHash &operator=(const QFlatHash &other) noexcept(std::is_nothrow_destructible<Node>::value)
+    {
+        if (d != other.d) {
+            Data *o = other.d;
+            if (o)
+                o->ref.ref();
+            if (d && !d->ref.deref())
+                delete d;
+            d = o;
+        }
+        return *this;
+    }
+
+    QFlatHash(QFlatHash &&other) noexcept
+        : d(std::exchange(other.d, nullptr))
+    {
+    }
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_MOVE_AND_SWAP(QFlatHash)
+
+#ifdef Q_QDOC
+    template <typename InputIterator>
+    QFlatHash(InputIterator f, InputIterator l);
+#else
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasKeyAndValue<InputIterator> = true>
+    QFlatHash(InputIterator f, InputIterator l)
+        : QFlatHash()
+    {
+        QtPrivate::reserveIfForwardIterator(this, f, l);
+        for (; f != l; ++f)
+            insert(f.key(), f.value());
+    }
+
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasFirstAndSecond<InputIterator> = true>
+    QFlatHash(InputIterator f, InputIterator l)
+        : QFlatHash()
+    {
+        QtPrivate::reserveIfForwardIterator(this, f, l);
+        for (; f != l; ++f)
+            insert(f->first, f->second);
+    }
+#endif
+    void swap(QFlatHash &other) noexcept { qt_ptr_swap(d, other.d); }
+
+#ifndef Q_QDOC
+    template <typename AKey = Key, typename AT = T>
+    QTypeTraits::compare_eq_result_container<QFlatHash, AKey, AT> operator==(const QFlatHash &other) const noexcept
+    {
+        if (d == other.d)
+            return true;
+        if (size() != other.size())
+            return false;
+
+        for (const_iterator it = other.begin(); it != other.end(); ++it) {
+            const Node *n = d->findNode(it.key());
+            if (!n || !n->valuesEqual(&it.node()))
+                return false;
+        }
+        // all values must be the same as size is the same
+        return true;
+    }
+    template <typename AKey = Key, typename AT = T>
+    QTypeTraits::compare_eq_result_container<QFlatHash, AKey, AT> operator!=(const QFlatHash &other) const noexcept
+    { return !(*this == other); }
+#else
+    bool operator==(const QFlatHash &other) const;
+    bool operator!=(const QFlatHash &other) const;
+#endif // Q_QDOC
+
+    inline qsizetype size() const noexcept { return d ? qsizetype(d->size) : 0; }
+    inline qsizetype count() const noexcept { return size(); }
+    inline bool isEmpty() const noexcept { return !d || d->size == 0; }
+
+    inline qsizetype capacity() const noexcept
+    { return d ? qsizetype(QFlatHashPrivate::growthCapacity(d->numSlots)) : 0; }
+    void reserve(qsizetype size)
+    {
+        // reserve(0) is used in squeeze()
+        if (size && (this->capacity() >= size))
+            return;
+        if (isDetached())
+            d->rehash(size_t(size));
+        else
+            d = Data::detached(d, size_t(size));
+    }
+    inline void squeeze()
+    {
+        if (capacity())
+            reserve(0);
+    }
+
+    inline void detach() { if (!d || d->ref.isShared()) d = Data::detached(d); }
+    inline bool isDetached() const noexcept { return d && !d->ref.isShared(); }
+    bool isSharedWith(const QFlatHash &other) const noexcept { return d == other.d; }
+
+    void clear() noexcept(std::is_nothrow_destructible<Node>::value)
+    {
+        if (d && !d->ref.deref())
+            delete d;
+        d = nullptr;
+    }
+
+    bool remove(const Key &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return false;
+        const size_t i = d->findSlot(key);
+        if (i >= d->numSlots)
+            return false;
+        detach();
+        d->erase(i);
+        return true;
+    }
+
+    template <typename Predicate>
+    qsizetype removeIf(Predicate pred)
+    {
+        return QtPrivate::associative_erase_if(*this, pred);
+    }
+
+    T take(const Key &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return T();
+        const size_t i = d->findSlot(key);
+        if (i >= d->numSlots)
+            return T();
+        detach();
+        T value = d->entries[i].node().takeValue();
+        d->erase(i);
+        return value;
+    }
+
+    bool contains(const Key &key) const noexcept
+    {
+        if (!d)
+            return false;
+        return d->findNode(key) != nullptr;
+    }
+    qsizetype count(const Key &key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    T value(const Key &key) const noexcept
+    {
+        if (d) {
+            if (const Node *n = d->findNode(key))
+                return n->value;
+        }
+        return T();
+    }
+    T value(const Key &key, const T &defaultValue) const noexcept
+    {
+        if (d) {
+            if (const Node *n = d->findNode(key))
+                return n->value;
+        }
+        return defaultValue;
+    }
+
+    T &operator[](const Key &key)
+    {
+        const auto copy = isDetached() ? QFlatHash() : *this; // keep 'key' alive across the detach
+        detach();
+        auto result = d->findOrInsert(key);
+        Node &n = d->entries[result.slot].node();
+        if (!result.initialized)
+            Node::createInPlace(&n, Key(key), T());
+        return n.value;
+    }
+    const T operator[](const Key &key) const noexcept
+    {
+        return value(key);
+    }
+
+    QList<Key> keys() const
+    {
+        QList<Key> res;
+        res.reserve(size());
+        for (const_iterator it = begin(); it != end(); ++it)
+            res.append(it.key());
+        return res;
+    }
+    QList<T> values() const { return QList<T>(begin(), end()); }
+
+    class const_iterator;
+
+    class iterator
+    {
+        friend class const_iterator;
+        friend class QFlatHash<Key, T>;
+        const Data *d = nullptr;
+        size_t slot = 0;
+        iterator(const Data *data, size_t i) noexcept : d(data), slot(i) {}
+        Node &node() const noexcept { return d->entries[slot].node(); }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        constexpr iterator() noexcept = default;
+
+        inline const Key &key() const noexcept { return node().key; }
+        inline T &value() const noexcept { return node().value; }
+        inline T &operator*() const noexcept { return node().value; }
+        inline T *operator->() const noexcept { return &node().value; }
+        inline bool operator==(const iterator &o) const noexcept { return d == o.d && slot == o.slot; }
+        inline bool operator!=(const iterator &o) const noexcept { return !(*this == o); }
+
+        inline iterator &operator++() noexcept
+        {
+            slot = d->nextFull(slot + 1);
+            return *this;
+        }
+        inline iterator operator++(int) noexcept
+        {
+            iterator r = *this;
+            ++(*this);
+            return r;
+        }
+
+        inline bool operator==(const const_iterator &o) const noexcept { return d == o.d && slot == o.slot; }
+        inline bool operator!=(const const_iterator &o) const noexcept { return !(*this == o); }
+    };
+    friend class iterator;
+
+    class const_iterator
+    {
+        friend class iterator;
+        friend class QFlatHash<Key, T>;
+        const Data *d = nullptr;
+        size_t slot = 0;
+        const_iterator(const Data *data, size_t i) noexcept : d(data), slot(i) {}
+        const Node &node() const noexcept { return d->entries[slot].node(); }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        constexpr const_iterator() noexcept = default;
+        inline const_iterator(const iterator &o) noexcept : d(o.d), slot(o.slot) { }
+
+        inline const Key &key() const noexcept { return node().key; }
+        inline const T &value() const noexcept { return node().value; }
+        inline const T &operator*() const noexcept { return node().value; }
+        inline const T *operator->() const noexcept { return &node().value; }
+        inline bool operator==(const const_iterator &o) const noexcept { return d == o.d && slot == o.slot; }
+        inline bool operator!=(const const_iterator &o) const noexcept { return !(*this == o); }
+
+        inline const_iterator &operator++() noexcept
+        {
+            slot = d->nextFull(slot + 1);
+            return *this;
+        }
+        inline const_iterator operator++(int) noexcept
+        {
+            const_iterator r = *this;
+            ++(*this);
+            return r;
+        }
+    };
+    friend class const_iterator;
+
+    // STL style
+    inline iterator begin() { if (!d) return iterator(); detach(); return iterator(d, d->nextFull(0)); }
+    inline const_iterator begin() const noexcept { return d ? const_iterator(d, d->nextFull(0)) : const_iterator(); }
+    inline const_iterator cbegin() const noexcept { return begin(); }
+    inline const_iterator constBegin() const noexcept { return begin(); }
+    inline iterator end() noexcept { return d ? iterator(d, d->numSlots) : iterator(); }
+    inline const_iterator end() const noexcept { return d ? const_iterator(d, d->numSlots) : const_iterator(); }
+    inline const_iterator cend() const noexcept { return end(); }
+    inline const_iterator constEnd() const noexcept { return end(); }
+
+    iterator erase(const_iterator it)
+    {
+        Q_ASSERT(it != constEnd());
+        detach();
+        // ensure a valid iterator across the detach:
+        iterator i(d, it.slot);
+        d->erase(i.slot);
+        return ++i;
+    }
+
+    iterator find(const Key &key)
+    {
+        if (isEmpty()) // prevents detaching shared null
+            return end();
+        const size_t i = d->findSlot(key);
+        if (i >= d->numSlots)
+            return end();
+        detach();
+        return iterator(d, i);
+    }
+    const_iterator find(const Key &key) const noexcept
+    {
+        return constFind(key);
+    }
+    const_iterator constFind(const Key &key) const noexcept
+    {
+        if (isEmpty())
+            return end();
+        return const_iterator(d, d->findSlot(key));
+    }
+
+    iterator insert(const Key &key, const T &value)
+    {
+        return emplace(key, value);
+    }
+
+    template <typename ...Args>
+    iterator emplace(const Key &key, Args &&... args)
+    {
+        Key copy = key; // Needs to be explicit for MSVC 2019
+        return emplace(std::move(copy), std::forward<Args>(args)...);
+    }
+
+    template <typename ...Args>
+    iterator emplace(Key &&key, Args &&... args)
+    {
+        if (isDetached()) {
+            if (d->shouldGrow()) // Construct the value now so that no dangling references are used
+                return emplace_helper(std::move(key), T(std::forward<Args>(args)...));
+            return emplace_helper(std::move(key), std::forward<Args>(args)...);
+        }
+        // else: we must detach
+        const auto copy = *this; // keep 'args' alive across the detach/growth
+        detach();
+        return emplace_helper(std::move(key), std::forward<Args>(args)...);
+    }
+
+    float load_factor() const noexcept { return d ? d->loadFactor() : 0; }
+    static float max_load_factor() noexcept { return 0.875; }
+
+    inline bool empty() const noexcept { return isEmpty(); }
+
+private:
+    template <typename ...Args>
+    iterator emplace_helper(Key &&key, Args &&... args)
+    {
+        auto result = d->findOrInsert(key);
+        Node &n = d->entries[result.slot].node();
+        if (!result.initialized)
+            Node::createInPlace(&n, std::move(key), std::forward<Args>(args)...);
+        else
+            n.emplaceValue(std::forward<Args>(args)...);
+        return iterator(d, result.slot);
+    }
+};
+
+template <typename Key, typename T, typename Predicate>
+qsizetype erase_if(QFlatHash<Key, T> &hash, Predicate pred)
+{
+    return QtPrivate::associative_erase_if(hash, pred);
+}
+
+QT_END_NAMESPACE
+
+#endif // QFLATHASH_H
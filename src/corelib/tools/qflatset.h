@@ -0,0 +1,293 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QFLATSET_H
+#define QFLATSET_H
+
+#include <QtCore/qflatmap.h>
+
+QT_BEGIN_NAMESPACE
+
+template <class Key, class Compare = std::less<Key>, class KeyContainer = QList<Key>>
+class QFlatSet : private Compare
+{
+    static_assert(std::is_nothrow_destructible_v<Key>, "Types with throwing destructors are not supported in Qt containers.");
+
+    template <class, class = void>
+    struct is_marked_transparent_type : std::false_type { };
+
+    template <class X>
+    struct is_marked_transparent_type<X, std::void_t<typename X::is_transparent>> : std::true_type { };
+
+    template <class X>
+    using is_marked_transparent = typename std::enable_if<
+        is_marked_transparent_type<X>::value>::type *;
+
+    template <typename It>
+    using is_compatible_iterator = typename std::enable_if<
+        std::is_same<Key, typename std::iterator_traits<It>::value_type>::value>::type *;
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using container_type = KeyContainer;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using reference = const Key &;
+    using const_reference = const Key &;
+    // the elements of a set cannot be modified in place
+    using iterator = typename container_type::const_iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    QFlatSet() = default;
+
+    explicit QFlatSet(const Compare &compare)
+        : Compare(compare)
+    {
+    }
+
+    explicit QFlatSet(const container_type &keys, const Compare &compare = Compare())
+        : Compare(compare), c(keys)
+    {
+        ensureOrderedUnique();
+    }
+
+    explicit QFlatSet(container_type &&keys, const Compare &compare = Compare())
+        : Compare(compare), c(std::move(keys))
+    {
+        ensureOrderedUnique();
+    }
+
+    explicit QFlatSet(std::initializer_list<Key> lst, const Compare &compare = Compare())
+        : QFlatSet(lst.begin(), lst.end(), compare)
+    {
+    }
+
+    template <class InputIt, is_compatible_iterator<InputIt> = nullptr>
+    explicit QFlatSet(InputIt first, InputIt last, const Compare &compare = Compare())
+        : Compare(compare)
+    {
+        QtPrivate::reserveIfForwardIterator(&c, first, last);
+        std::copy(first, last, std::back_inserter(c));
+        ensureOrderedUnique();
+    }
+
+    explicit QFlatSet(Qt::OrderedUniqueRange_t, const container_type &keys,
+                      const Compare &compare = Compare())
+        : Compare(compare), c(keys)
+    {
+    }
+
+    explicit QFlatSet(Qt::OrderedUniqueRange_t, container_type &&keys,
+                      const Compare &compare = Compare())
+        : Compare(compare), c(std::move(keys))
+    {
+    }
+
+    explicit QFlatSet(Qt::OrderedUniqueRange_t, std::initializer_list<Key> lst,
+                      const Compare &compare = Compare())
+        : Compare(compare), c(lst.begin(), lst.end())
+    {
+    }
+
+    size_type count() const noexcept { return c.size(); }
+    size_type size() const noexcept { return c.size(); }
+    size_type capacity() const noexcept { return c.capacity(); }
+    bool isEmpty() const noexcept { return c.empty(); }
+    bool empty() const noexcept { return c.empty(); }
+    container_type extract() && { return std::move(c); }
+    const container_type &values() const noexcept { return c; }
+
+    void reserve(size_type s) { c.reserve(s); }
+    void clear() { c.clear(); }
+
+    std::pair<iterator, bool> insert(const Key &key)
+    {
+        const auto it = lower_bound(key);
+        if (it != end() && !key_compare::operator()(key, *it))
+            return { it, false };
+        return { c.insert(it, key), true };
+    }
+
+    std::pair<iterator, bool> insert(Key &&key)
+    {
+        const auto it = lower_bound(key);
+        if (it != end() && !key_compare::operator()(key, *it))
+            return { it, false };
+        return { c.insert(it, std::move(key)), true };
+    }
+
+    template <class InputIt, is_compatible_iterator<InputIt> = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        const size_type s = c.size();
+        std::copy(first, last, std::back_inserter(c));
+        const auto middle = c.begin() + s;
+        std::stable_sort(middle, c.end(), key_comp());
+        std::inplace_merge(c.begin(), middle, c.end(), key_comp());
+        makeUnique();
+    }
+
+    template <class InputIt, is_compatible_iterator<InputIt> = nullptr>
+    void insert(Qt::OrderedUniqueRange_t, InputIt first, InputIt last)
+    {
+        const size_type s = c.size();
+        std::copy(first, last, std::back_inserter(c));
+        std::inplace_merge(c.begin(), c.begin() + s, c.end(), key_comp());
+        makeUnique();
+    }
+
+    bool remove(const Key &key)
+    {
+        return do_remove(find(key));
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    bool remove(const X &key)
+    {
+        return do_remove(find(key));
+    }
+
+    iterator erase(const_iterator it)
+    {
+        return c.erase(it);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return c.erase(first, last);
+    }
+
+    template <typename Predicate>
+    size_type remove_if(Predicate pred)
+    {
+        const auto it = std::remove_if(c.begin(), c.end(), pred);
+        const size_type r = size_type(std::distance(it, c.end()));
+        c.erase(it, c.end());
+        return r;
+    }
+
+    bool contains(const Key &key) const
+    {
+        return find(key) != end();
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    bool contains(const X &key) const
+    {
+        return find(key) != end();
+    }
+
+    const_iterator find(const Key &key) const
+    {
+        const auto it = lower_bound(key);
+        if (it != end() && !key_compare::operator()(key, *it))
+            return it;
+        return end();
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    const_iterator find(const X &key) const
+    {
+        const auto it = lower_bound(key);
+        if (it != end() && !key_compare::operator()(key, *it))
+            return it;
+        return end();
+    }
+
+    const_iterator lower_bound(const Key &key) const
+    {
+        if constexpr (QtPrivate::FlatMapHasFastLowerBound<Key, Compare, KeyContainer>)
+            return begin() + QtPrivate::flatMapLowerBound(c.data(), qsizetype(c.size()), key);
+        else
+            return std::lower_bound(begin(), end(), key, key_comp());
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    const_iterator lower_bound(const X &key) const
+    {
+        return std::lower_bound(begin(), end(), key, key_comp());
+    }
+
+    const_iterator upper_bound(const Key &key) const
+    {
+        return std::upper_bound(begin(), end(), key, key_comp());
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    const_iterator upper_bound(const X &key) const
+    {
+        return std::upper_bound(begin(), end(), key, key_comp());
+    }
+
+    const_iterator begin() const { return c.begin(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator constBegin() const { return begin(); }
+    const_iterator end() const { return c.end(); }
+    const_iterator cend() const { return end(); }
+    const_iterator constEnd() const { return end(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return rend(); }
+
+    key_compare key_comp() const noexcept
+    {
+        return static_cast<key_compare>(*this);
+    }
+
+    value_compare value_comp() const noexcept
+    {
+        return static_cast<value_compare>(*this);
+    }
+
+    friend bool operator==(const QFlatSet &lhs, const QFlatSet &rhs)
+    {
+        return lhs.c == rhs.c;
+    }
+
+    friend bool operator!=(const QFlatSet &lhs, const QFlatSet &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    bool do_remove(const_iterator it)
+    {
+        if (it != end()) {
+            erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    void ensureOrderedUnique()
+    {
+        // bulk input is often sorted already
+        if (!std::is_sorted(begin(), end(), key_comp()))
+            std::stable_sort(c.begin(), c.end(), key_comp());
+        makeUnique();
+    }
+
+    void makeUnique()
+    {
+        auto equivalent = [this](const Key &lhs, const Key &rhs) {
+            return !key_compare::operator()(lhs, rhs) && !key_compare::operator()(rhs, lhs);
+        };
+        const auto cb = std::as_const(c).begin();
+        const auto ce = std::as_const(c).end();
+        // don't detach if there is nothing to do
+        if (std::adjacent_find(cb, ce, equivalent) != ce)
+            c.erase(std::unique(c.begin(), c.end(), equivalent), c.end());
+    }
+
+    container_type c;
+};
+
+QT_END_NAMESPACE
+
+#endif // QFLATSET_H
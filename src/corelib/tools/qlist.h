@@ -80,6 +80,7 @@ class QList
     class DisableRValueRefs {};
 
     friend class ::tst_QList;
+    friend class QMemoryResource;
 
     DataPointer d;
 
@@ -764,7 +765,7 @@ void QList<T>::reserve(qsizetype asize)
         }
     }
 
-    DataPointer detached(qMax(asize, size()));
+    DataPointer detached(qMax(asize, size()), 0, QArrayData::KeepSize, d.growthResource());
     detached->copyAppend(d->begin(), d->end());
     if (detached.d_ptr())
         detached->setFlag(Data::CapacityReserved);
@@ -778,7 +779,7 @@ inline void QList<T>::squeeze()
         return;
     if (d->needsDetach() || size() < capacity()) {
         // must allocate memory
-        DataPointer detached(size());
+        DataPointer detached(size(), 0, QArrayData::KeepSize, d.growthResource());
         if (size()) {
             if (d.needsDetach())
                 detached->copyAppend(d.data(), d.data() + d.size);
@@ -0,0 +1,265 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qmemoryresource.h"
+
+#include <QtCore/private/qnumeric_p.h>
+
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QMemoryResource
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMemoryResource class is an interface for classes that
+    provide memory to Qt containers.
+
+    \ingroup tools
+
+    QList, QString, QByteArray, and the other containers that store their
+    elements in a contiguous array, allocate that array with \c malloc() by
+    default. QMemoryResource lets an application provide the memory
+    instead, for instance from an arena that is released at once at the end
+    of a request, or from a pool of huge pages. It is similar to
+    \c{std::pmr::memory_resource}.
+
+    Containers opt in one by one, with reserve(). Their other arrays,
+    including the ones that Qt allocates internally, keep using \c malloc().
+
+    \snippet code/src_corelib_tools_qmemoryresource.cpp 0
+
+    Each array remembers the resource it comes from, and returns its memory
+    to that resource when it is freed. When the container grows, reserves
+    room or is squeezed, its new array comes from the same resource too,
+    and clear() keeps the array. On the other hand, a copy of the container
+    shares the array only until one of them is modified: the one that
+    detaches then allocates its own array with \c malloc().
+
+    \section1 Lifetime of the arrays
+
+    A resource must outlive all the arrays it provided, wherever the
+    containers holding them end up: in a copy, in a data structure, or in
+    a queued signal. If these containers may be destroyed in other threads,
+    the doDeallocate() function must be thread-safe. When in doubt, hand
+    out a copy that is detached from the resource, for instance with
+    \c{QString(str.constData(), str.size())}.
+
+    The code that Qt containers inline into applications and libraries that
+    were compiled against a version of Qt earlier than 6.9 frees arrays
+    with \c free(). The containers that use a resource must not be passed
+    to such code, unless it only reads them.
+
+    Containers that do not store their elements in a single array, like
+    QHash and QMap, are not affected.
+
+    To implement a memory resource, reimplement doAllocate() and
+    doDeallocate().
+
+    \sa QMonotonicMemoryResource
+*/
+
+/*!
+    Destroys the memory resource.
+*/
+QMemoryResource::~QMemoryResource()
+    = default;
+
+/*!
+    \fn QMemoryResource::QMemoryResource()
+
+    Constructs a memory resource.
+*/
+
+/*!
+    \fn void *QMemoryResource::allocate(qsizetype size, qsizetype alignment)
+
+    Returns a block of at least \a size bytes, aligned to \a alignment
+    bytes, which must be a power of two, or \nullptr if the memory could not
+    be allocated.
+
+    \sa doAllocate()
+*/
+
+/*!
+    \fn void QMemoryResource::deallocate(void *p, qsizetype size, qsizetype alignment)
+
+    Returns the block \a p, allocated with allocate() with the same \a size
+    and \a alignment, to this resource.
+
+    \sa doDeallocate()
+*/
+
+/*!
+    \fn void *QMemoryResource::doAllocate(qsizetype size, qsizetype alignment)
+
+    Implement this function to return a block of at least \a size bytes,
+    aligned to \a alignment bytes, or \nullptr on failure. This function
+    must not throw exceptions.
+*/
+
+/*!
+    \fn void QMemoryResource::doDeallocate(void *p, qsizetype size, qsizetype alignment)
+
+    Implement this function to release the block \a p, which was returned by
+    doAllocate() with the same \a size and \a alignment.
+*/
+
+/*!
+    \fn template <typename Container> void QMemoryResource::reserve(Container &container, qsizetype capacity)
+
+    Moves the elements of \a container to an array allocated from this
+    resource, with room for at least \a capacity elements, and makes the
+    container keep allocating from this resource when it grows.
+
+    \a Container can be QList, QString or QByteArray.
+
+    See \l{Lifetime of the arrays} for how long the resource must live.
+*/
+
+/*!
+    \class QMonotonicMemoryResource
+    \inmodule QtCore
+    \since 6.9
+    \brief The QMonotonicMemoryResource class is a memory resource that
+    frees its memory only when it is destroyed or released.
+
+    \ingroup tools
+
+    QMonotonicMemoryResource hands out consecutive parts of large chunks of
+    memory, and only frees them all together, when release() is called or
+    when the resource is destroyed. This makes allocation very cheap, at the
+    price of not reusing the memory of the blocks that are deallocated. It is
+    meant for short-lived containers, for instance the ones used to handle
+    a request.
+
+    The chunks are allocated with \c malloc(), each one twice as large as the
+    previous one. The first one can be a buffer that is passed to the
+    constructor, which is not freed but reused after release().
+
+    QMonotonicMemoryResource is not thread-safe: it must only allocate
+    memory in one thread at a time. Deallocating is always safe, as it does
+    nothing.
+
+    \sa QMemoryResource::reserve()
+*/
+
+struct alignas(std::max_align_t) QMonotonicMemoryResource::Chunk
+{
+    Chunk *next;
+    qsizetype size;
+
+    char *begin() noexcept { return reinterpret_cast<char *>(this + 1); }
+    char *end() noexcept { return begin() + size; }
+};
+
+static constexpr qsizetype MinimumChunkSize = 256;
+
+/*!
+    Constructs a memory resource whose first chunk of memory is
+    \a initialSize bytes large.
+*/
+QMonotonicMemoryResource::QMonotonicMemoryResource(qsizetype initialSize) noexcept
+    : nextChunkSize(qMax(initialSize, MinimumChunkSize))
+{
+}
+
+/*!
+    Constructs a memory resource whose first chunk of memory is the
+    \a size bytes at \a buffer. The buffer must outlive the resource.
+*/
+QMonotonicMemoryResource::QMonotonicMemoryResource(void *buffer, qsizetype size) noexcept
+    : initialBuffer(static_cast<char *>(buffer)),
+      initialBufferSize(size),
+      cursor(initialBuffer),
+      limit(initialBuffer + size),
+      nextChunkSize(qMax(size * 2, MinimumChunkSize))
+{
+}
+
+/*!
+    Destroys the memory resource, and frees all the memory it allocated.
+
+    \sa release()
+*/
+QMonotonicMemoryResource::~QMonotonicMemoryResource()
+{
+    release();
+}
+
+/*!
+    Frees all the memory that this resource allocated at once, even if it
+    was not deallocated. No block returned by this resource must be used
+    afterwards.
+
+    The buffer passed to the constructor, if any, is used again for the
+    next allocations.
+*/
+void QMonotonicMemoryResource::release() noexcept
+{
+    qsizetype largest = 0;
+    while (Chunk *chunk = chunks) {
+        chunks = chunk->next;
+        largest = qMax(largest, chunk->size);
+        ::free(chunk);
+    }
+    // start again with the largest chunk, which is what the previous cycle
+    // ended up needing
+    if (largest)
+        nextChunkSize = largest;
+    cursor = initialBuffer;
+    limit = initialBuffer + initialBufferSize;
+    allocatedBytes = 0;
+}
+
+/*!
+    \fn qsizetype QMonotonicMemoryResource::bytesAllocated() const
+
+    Returns the number of bytes that this resource handed out since it was
+    constructed or last released, including the ones that were deallocated.
+*/
+
+/*!
+    \reimp
+*/
+void *QMonotonicMemoryResource::doAllocate(qsizetype size, qsizetype alignment) noexcept
+{
+    const auto tryAllocate = [&]() -> void * {
+        const quintptr p = (quintptr(cursor) + quintptr(alignment) - 1) & ~quintptr(alignment - 1);
+        if (!cursor || p > quintptr(limit) || size > qsizetype(quintptr(limit) - p))
+            return nullptr;
+        cursor = reinterpret_cast<char *>(p) + size;
+        allocatedBytes += size;
+        return reinterpret_cast<void *>(p);
+    };
+
+    if (void *p = tryAllocate())
+        return p;
+
+    // the block does not fit in the current chunk: leave the rest of it
+    // unused and start a new one
+    qsizetype chunkSize;
+    if (qAddOverflow(size, alignment, &chunkSize))
+        return nullptr;
+    chunkSize = qMax(chunkSize, nextChunkSize);
+    qsizetype blockSize;
+    if (qAddOverflow(chunkSize, qsizetype(sizeof(Chunk)), &blockSize))
+        return nullptr;
+    Chunk *chunk = static_cast<Chunk *>(::malloc(size_t(blockSize)));
+    if (!chunk)
+        return nullptr;
+    chunk->next = chunks;
+    chunk->size = chunkSize;
+    chunks = chunk;
+    cursor = chunk->begin();
+    limit = chunk->end();
+    if (!qMulOverflow(chunkSize, qsizetype(2), &nextChunkSize))
+        nextChunkSize = qMin(nextChunkSize, QtPrivate::MaxAllocSize / 2);
+    else
+        nextChunkSize = QtPrivate::MaxAllocSize / 2;
+
+    return tryAllocate();
+}
+
+QT_END_NAMESPACE
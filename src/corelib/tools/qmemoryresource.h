@@ -0,0 +1,103 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QMEMORYRESOURCE_H
+#define QMEMORYRESOURCE_H
+
+#include <QtCore/qarraydata.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qglobal.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+
+#include <cstddef>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QMemoryResource
+{
+public:
+    virtual ~QMemoryResource();
+
+    [[nodiscard]] void *allocate(qsizetype size,
+                                 qsizetype alignment = alignof(std::max_align_t)) noexcept
+    {
+        Q_ASSERT(size >= 0);
+        Q_ASSERT(alignment > 0 && !(alignment & (alignment - 1)));
+        return doAllocate(size, alignment);
+    }
+
+    void deallocate(void *p, qsizetype size,
+                    qsizetype alignment = alignof(std::max_align_t)) noexcept
+    {
+        doDeallocate(p, size, alignment);
+    }
+
+    template <typename Container>
+    void reserve(Container &container, qsizetype capacity = 0);
+
+protected:
+    QMemoryResource() noexcept = default;
+    Q_DISABLE_COPY_MOVE(QMemoryResource)
+
+    virtual void *doAllocate(qsizetype size, qsizetype alignment) noexcept = 0;
+    virtual void doDeallocate(void *p, qsizetype size, qsizetype alignment) noexcept = 0;
+
+private:
+    template <typename T>
+    static QArrayDataPointer<T> &dataPointer(QList<T> &list) noexcept { return list.d; }
+    static QArrayDataPointer<char16_t> &dataPointer(QString &str) noexcept { return str.data_ptr(); }
+    static QArrayDataPointer<char> &dataPointer(QByteArray &ba) noexcept { return ba.data_ptr(); }
+};
+
+class Q_CORE_EXPORT QMonotonicMemoryResource : public QMemoryResource
+{
+public:
+    explicit QMonotonicMemoryResource(qsizetype initialSize = 1024) noexcept;
+    QMonotonicMemoryResource(void *buffer, qsizetype size) noexcept;
+    ~QMonotonicMemoryResource() override;
+
+    void release() noexcept;
+    qsizetype bytesAllocated() const noexcept { return allocatedBytes; }
+
+protected:
+    void *doAllocate(qsizetype size, qsizetype alignment) noexcept override;
+    void doDeallocate(void *, qsizetype, qsizetype) noexcept override {}
+
+private:
+    struct Chunk;
+
+    Chunk *chunks = nullptr;
+    char *initialBuffer = nullptr;
+    qsizetype initialBufferSize = 0;
+    char *cursor = nullptr;
+    char *limit = nullptr;
+    qsizetype nextChunkSize;
+    qsizetype allocatedBytes = 0;
+};
+
+template <typename Container>
+void QMemoryResource::reserve(Container &container, qsizetype capacity)
+{
+    auto &d = dataPointer(container);
+    using DataPointer = std::remove_reference_t<decltype(d)>;
+    using T = std::remove_pointer_t<decltype(d.data())>;
+
+    DataPointer dd(qMax(qMax(capacity, d.size), qsizetype(1)), 0, QArrayData::KeepSize, this);
+    Q_CHECK_PTR(dd.data());
+    if (d.size) {
+        if (d.needsDetach())
+            dd->copyAppend(d.begin(), d.end());
+        else
+            dd->moveAppend(d.begin(), d.end());
+    }
+    if constexpr (std::is_same_v<T, char> || std::is_same_v<T, char16_t>)
+        dd.data()[dd.size] = T(0);
+    dd.setFlag(QArrayData::CapacityReserved);
+    d.swap(dd);
+}
+
+QT_END_NAMESPACE
+
+#endif // QMEMORYRESOURCE_H
@@ -511,6 +511,167 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+class SequenceEvent : public QEvent
+{
+public:
+    static constexpr Type SequenceEventType = Type(QEvent::User + 1);
+    explicit SequenceEvent(int n) : QEvent(SequenceEventType), n(n) { }
+    int n;
+};
+
+class SequenceRecorder : public QObject
+{
+public:
+    QList<int> sequence;
+
+    bool event(QEvent *event) override
+    {
+        if (event->type() == SequenceEvent::SequenceEventType) {
+            sequence.append(static_cast<SequenceEvent *>(event)->n);
+            return true;
+        }
+        return QObject::event(event);
+    }
+};
+
+void tst_QCoreApplication::lockFreePostingKeepsOrder()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    // Queued calls take the lock-free path (until its queue is full), other
+    // events the locked one; the receiver must see them in posting order.
+    constexpr int Count = 5000;
+    SequenceRecorder recorder;
+    QScopedPointer<QThread> thread(QThread::create([&recorder] {
+        for (int i = 0; i < Count; ++i) {
+            if (i % 7 == 3) {
+                QCoreApplication::postEvent(&recorder, new SequenceEvent(i));
+            } else {
+                QMetaObject::invokeMethod(&recorder, [&recorder, i] {
+                    recorder.sequence.append(i);
+                }, Qt::QueuedConnection);
+            }
+        }
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+#ifdef QT_BUILD_INTERNAL
+    QCOMPARE(qGlobalPostedEventsCount(), qsizetype(Count));
+#endif
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(recorder.sequence.size(), Count);
+    for (int i = 0; i < Count; ++i)
+        QCOMPARE(recorder.sequence.at(i), i);
+}
+
+void tst_QCoreApplication::removeAndSendWhilePosting()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    QObject receiver;
+    // every posted call holds a reference until it is delivered or removed
+    const auto token = std::make_shared<int>();
+
+    constexpr int ThreadCount = 3;
+    constexpr int Count = 20000;
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&, t] {
+            for (int i = 0; i < Count; ++i) {
+                if (i % 5 == t) {
+                    QCoreApplication::postEvent(&receiver, new QEvent(QEvent::User));
+                } else {
+                    QMetaObject::invokeMethod(&receiver, [token] { }, Qt::QueuedConnection);
+                }
+            }
+        }));
+        threads.back()->start();
+    }
+    const auto running = [&threads] {
+        return std::any_of(threads.begin(), threads.end(), [](const auto &thread) {
+            return !thread->isFinished();
+        });
+    };
+
+    for (int i = 0; i < 100 || running(); ++i) {
+        if (i % 2)
+            QCoreApplication::removePostedEvents(&receiver, QEvent::MetaCall);
+        else
+            QCoreApplication::sendPostedEvents(&receiver, QEvent::MetaCall);
+        QCoreApplication::processEvents();
+    }
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+
+    QCoreApplication::sendPostedEvents(&receiver, QEvent::MetaCall);
+    QCOMPARE(token.use_count(), 1);
+    QCoreApplication::removePostedEvents(&receiver);
+    QCoreApplication::sendPostedEvents();
+}
+
+void tst_QCoreApplication::postWhileMovingToThread()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    QThread worker;
+    worker.start();
+    auto cleanup = qScopeGuard([&worker] {
+        worker.quit();
+        worker.wait();
+    });
+
+    // Calls posted from each thread must reach the receiver once and in
+    // order, while it is being moved back and forth between threads.
+    constexpr int ThreadCount = 2;
+    constexpr int Count = 20000;
+    QObject receiver;
+    QList<int> last(ThreadCount, -1);
+    std::atomic<int> delivered = 0;
+    std::atomic<int> outOfOrder = 0;
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&, t] {
+            for (int i = 0; i < Count; ++i) {
+                QMetaObject::invokeMethod(&receiver, [&, t, i] {
+                    if (last[t] != i - 1)
+                        ++outOfOrder;
+                    last[t] = i;
+                    ++delivered;
+                }, Qt::QueuedConnection);
+            }
+        }));
+        threads.back()->start();
+    }
+    const auto running = [&threads] {
+        return std::any_of(threads.begin(), threads.end(), [](const auto &thread) {
+            return !thread->isFinished();
+        });
+    };
+
+    QThread *mainThread = QThread::currentThread();
+    for (int i = 0; i < 100 || running(); ++i) {
+        receiver.moveToThread(&worker);
+        QMetaObject::invokeMethod(&receiver, [&receiver, mainThread] {
+            receiver.moveToThread(mainThread);
+        }, Qt::BlockingQueuedConnection);
+        QCOMPARE(receiver.thread(), mainThread);
+        QCoreApplication::processEvents();
+    }
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+
+    QTRY_COMPARE(delivered.load(), ThreadCount * Count);
+    QCOMPARE(outOfOrder.load(), 0);
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
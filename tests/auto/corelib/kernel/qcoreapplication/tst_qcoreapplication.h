@@ -20,6 +20,9 @@ private slots:
     void removePostedEvents();
 #if QT_CONFIG(thread)
     void deliverInDefinedOrder();
+    void lockFreePostingKeepsOrder();
+    void removeAndSendWhilePosting();
+    void postWhileMovingToThread();
 #endif
     void applicationPid();
 #ifdef QT_BUILD_INTERNAL
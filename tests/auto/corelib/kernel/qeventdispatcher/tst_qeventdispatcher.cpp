@@ -18,6 +18,20 @@ static bool glibDisabled = []() {
 }();
 #endif
 
+#ifdef USE_EPOLL
+static bool epollEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_EPOLL", "1");
+    return true;
+}();
+#endif
+
+#ifdef USE_IO_URING
+static bool ioUringEnabled = []() {
+    qputenv("QT_EVENT_DISPATCHER_IO_URING", "1");
+    return true;
+}();
+#endif
+
 #include <chrono>
 
 #ifndef QTEST_THROW_ON_FAIL
@@ -112,6 +126,16 @@ bool tst_QEventDispatcher::event(QEvent *e)
 // drain the system event queue after the test starts to avoid destabilizing the test functions
 void tst_QEventDispatcher::initTestCase()
 {
+#ifdef USE_EPOLL
+    if (!isGuiEventDispatcher)
+        QVERIFY(eventDispatcher->inherits("QEventDispatcherEpoll"));
+#endif
+#ifdef USE_IO_URING
+    // the default dispatcher is used instead if the kernel lacks io_uring
+    if (!isGuiEventDispatcher && !eventDispatcher->inherits("QEventDispatcherIoUring"))
+        QSKIP("io_uring is not available");
+#endif
+
     QDeadlineTimer deadline(CoarseTimerInterval);
     while (!deadline.hasExpired() && eventDispatcher->processEvents(QEventLoop::AllEvents))
         ;
@@ -448,9 +472,12 @@ void tst_QEventDispatcher::postEventFromEventHandler()
 
     const QByteArrayView eventDispatcherName(QAbstractEventDispatcher::instance()->metaObject()->className());
     qDebug() << eventDispatcherName;
-    // QXcbUnixEventDispatcher and QEventDispatcherUNIX do not do this correctly on any platform;
-    // both Windows event dispatchers fail as well.
+    // QXcbUnixEventDispatcher and QEventDispatcherUNIX do not do this correctly on any platform,
+    // nor do QEventDispatcherEpoll and QEventDispatcherIoUring, which share
+    // their processEvents() logic; both Windows event dispatchers fail as well.
     const bool knownToFail = eventDispatcherName.contains("UNIX")
+                          || eventDispatcherName.contains("Epoll")
+                          || eventDispatcherName.contains("IoUring")
                           || eventDispatcherName.contains("Unix")
                           || eventDispatcherName.contains("Win32")
                           || eventDispatcherName.contains("WindowsGui")
@@ -299,6 +299,7 @@ private slots:
     void invokeQueuedMetaMember();
     void invokeQueuedMetaMemberNoMacro();
     void invokeQueuedPointer();
+    void invokeQueuedArgumentCopies();
     void invokeBlockingQueuedMetaMember();
     void invokeBlockingQueuedMetaMemberNoMacros();
     void invokeBlockingQueuedPointer();
@@ -482,6 +483,11 @@ struct CountedStruct
     ~CountedStruct() { --countedStructObjectsCount; }
 };
 
+struct LargeCountedStruct : CountedStruct
+{
+    char payload[256] = {};
+};
+
 #ifndef QT_NO_EXCEPTIONS
 class ObjectException : public std::exception { };
 #endif
@@ -1471,6 +1477,37 @@ void tst_QMetaObject::invokeQueuedPointer()
     QCOMPARE(obj.slotResult, u"sl1:bubu");
 }
 
+void tst_QMetaObject::invokeQueuedArgumentCopies()
+{
+    // small arguments are copied into the event, the others onto the heap
+    QObject context;
+    QString result;
+    const auto slot = [&result](const CountedStruct &, const LargeCountedStruct &large,
+                                double number, const QString &text) {
+        result = QString::number(number) + text + QString::number(sizeof(large.payload));
+    };
+    QCOMPARE(countedStructObjectsCount, 0);
+    {
+        CountedStruct small;
+        LargeCountedStruct large;
+        QVERIFY(QMetaObject::invokeMethod(&context, slot, Qt::QueuedConnection,
+                                          small, large, 1.5, u"x"_s));
+        QCOMPARE(countedStructObjectsCount, 4);
+    }
+    QCOMPARE(countedStructObjectsCount, 2);
+    qApp->processEvents(QEventLoop::AllEvents);
+    QCOMPARE(result, u"1.5x256"_s);
+    QCOMPARE(countedStructObjectsCount, 0);
+
+    // and destroyed with the event if it is not delivered
+    QVERIFY(QMetaObject::invokeMethod(&context, slot, Qt::QueuedConnection,
+                                      CountedStruct(), LargeCountedStruct(), 2.5, u"y"_s));
+    QCOMPARE(countedStructObjectsCount, 2);
+    QCoreApplication::removePostedEvents(&context, QEvent::MetaCall);
+    QCOMPARE(countedStructObjectsCount, 0);
+    QCOMPARE(result, u"1.5x256"_s);
+}
+
 // this test is duplicated below
 void tst_QMetaObject::invokeBlockingQueuedMetaMember()
 {
@@ -8,7 +8,8 @@
    and other timer-related matters, it is important to test it in that form, as
    well as in its GUI-less form. So this source file is reused by a build config
    in the GUI module. Similarly, testing with and without glib is supported,
-   where relevant (see DISABLE_GLIB below).
+   where relevant (see DISABLE_GLIB below), as is testing with the timer wheel
+   (see USE_TIMER_WHEEL).
 */
 #ifdef QT_GUI_LIB
 // When compiled as tests/auto/gui/kernel/qguitimer/'s source-code:
@@ -39,6 +40,13 @@ static bool glibDisabled = []() {
 }();
 #endif
 
+#ifdef USE_TIMER_WHEEL
+static bool timerWheelEnabled = []() {
+    qputenv("QT_TIMER_WHEEL", "1");
+    return true;
+}();
+#endif
+
 using namespace std::chrono_literals;
 
 class tst_QTimer : public QObject
@@ -13,6 +13,7 @@ QT_WARNING_DISABLE_DEPRECATED
 #include "qjsonobject.h"
 #include "qjsonvalue.h"
 #include "qjsondocument.h"
+#include "qjsonlazydocument.h"
 #include "qregularexpression.h"
 #include "private/qnumeric_p.h"
 #include <limits>
@@ -21,6 +22,8 @@ QT_WARNING_DISABLE_DEPRECATED
 #define UNICODE_NON_CHARACTER "\xEF\xBF\xBF"
 #define UNICODE_DJE "\320\202" // Character from the Serbian Cyrillic alphabet
 
+using namespace Qt::StringLiterals;
+
 class tst_QtJson: public QObject
 {
     Q_OBJECT
@@ -162,6 +165,13 @@ private Q_SLOTS:
     void noLeakOnNameClash_data();
     void noLeakOnNameClash();
 
+    void vectorizedScanning();
+    void lazyDocument();
+    void lazyDocumentFiles_data();
+    void lazyDocumentFiles();
+    void lazyDocumentErrors_data();
+    void lazyDocumentErrors();
+
 private:
     QString testDataDir;
 };
@@ -3997,5 +4007,222 @@ void tst_QtJson::noLeakOnNameClash()
     // In particular it should not forget to deref the container for the inner objects.
 }
 
+void tst_QtJson::vectorizedScanning()
+{
+    // The parsers look for the end of strings and of whitespace 16 bytes at
+    // a time, so put runs of backslashes, quotes and spaces across vectors.
+    for (int padding = 0; padding < 140; ++padding) {
+        for (int backslashes = 1; backslashes <= 4; ++backslashes) {
+            const QString expected = QString(padding, u'x') + QString(backslashes, u'\\')
+                    + u"\"y\""_s + QString(backslashes, u' ');
+            QByteArray json = "[ \"" + QByteArray(padding, 'x');
+            json += QByteArray(2 * backslashes, '\\') + "\\\"y\\\"" + QByteArray(backslashes, ' ');
+            json += "\",\n" + QByteArray(padding, ' ') + "\"" + QByteArray(padding / 2 * 2, '\\') + "\" ]";
+            if (padding % 2)
+                json.insert(json.indexOf('x'), "\\u00e9\\/");
+
+            QJsonParseError error;
+            const QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+            QVERIFY2(!doc.isNull(), json + " " + error.errorString().toUtf8());
+            QString first = expected;
+            if (padding % 2)
+                first.prepend(u"\u00e9/"_s);
+            QCOMPARE(doc.array().at(0).toString(), first);
+            QCOMPARE(doc.array().at(1).toString(), QString(padding / 2, u'\\'));
+
+            const QJsonLazyDocument lazy = QJsonLazyDocument::fromJson(json, &error);
+            QVERIFY2(!lazy.isNull(), json + " " + error.errorString().toUtf8());
+            QCOMPARE(lazy[0].toString(), first);
+            QCOMPARE(lazy[1].toString(), QString(padding / 2, u'\\'));
+            QCOMPARE(lazy.root().size(), 2);
+        }
+    }
+}
+
+void tst_QtJson::lazyDocument()
+{
+    const QByteArray json = R"({
+        "null": null, "true": true, "false": false,
+        "int": -42, "double": 1.5, "big": 1e300,
+        "string": "h\u00e9llo", "utf8": ")" "\xc3\xa9t\xc3\xa9" R"(", "escaped key\n": "\"",
+        "dup": 1, "array": [1, [2, {"a": 3}], {}, [], "4"], "dup": {"x": [true]}
+    })";
+
+    QJsonParseError error;
+    const QJsonLazyDocument doc = QJsonLazyDocument::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QVERIFY(!doc.isNull());
+    QVERIFY(doc.isObject());
+    QVERIFY(!doc.isArray());
+
+    QVERIFY(doc[u"null"].isNull());
+    QCOMPARE(doc[u"true"].toBool(), true);
+    QCOMPARE(doc[u"false"].toBool(true), false);
+    QCOMPARE(doc[u"int"].toInt(), -42);
+    QCOMPARE(doc[u"int"].toInteger(), -42);
+    QCOMPARE(doc[u"double"].toDouble(), 1.5);
+    QCOMPARE(doc[u"double"].toInteger(7), 7);
+    QCOMPARE(doc[u"big"].toDouble(), 1e300);
+    QCOMPARE(doc[u"big"].toInt(7), 7);
+    QCOMPARE(doc[u"string"].toString(), u"h\u00e9llo"_s);
+    QCOMPARE(doc[u"utf8"].toString(), u"\u00e9t\u00e9"_s);
+    QCOMPARE(doc[u"escaped key\n"].toString(), u"\""_s);
+    QCOMPARE(doc["string"_L1].toString(), u"h\u00e9llo"_s);
+    QCOMPARE(doc[u"string"].toInt(7), 7);
+    QCOMPARE(doc[u"int"].toString(u"default"_s), u"default"_s);
+
+    // the last of the duplicate keys wins
+    QVERIFY(doc[u"dup"].isObject());
+    QCOMPARE(doc[u"dup"][u"x"][0].toBool(), true);
+
+    const QJsonLazyValue array = doc[u"array"];
+    QVERIFY(array.isArray());
+    QCOMPARE(array.size(), 5);
+    QCOMPARE(array[0].toInt(), 1);
+    QCOMPARE(array[1][1]["a"_L1].toInt(), 3);
+    QCOMPARE(array[2].size(), 0);
+    QVERIFY(array[2].isObject());
+    QCOMPARE(array[3].size(), 0);
+    QVERIFY(array[3].isArray());
+    QCOMPARE(array[4].toString(), u"4"_s);
+    QVERIFY(array[5].isUndefined());
+    QVERIFY(array[-1].isUndefined());
+    QVERIFY(array[u"a"].isUndefined());
+    QVERIFY(doc[u"missing"].isUndefined());
+    QVERIFY(doc[0].isUndefined());
+    QVERIFY(doc[u"int"][0].isUndefined());
+    QCOMPARE(doc[u"int"].size(), 0);
+    QCOMPARE(doc[u"int"].begin(), doc[u"int"].end());
+
+    QStringList keys;
+    for (auto it = doc.root().begin(), end = doc.root().end(); it != end; ++it)
+        keys << it.key();
+    QCOMPARE(keys, QStringList({ u"null"_s, u"true"_s, u"false"_s, u"int"_s, u"double"_s,
+                                 u"big"_s, u"string"_s, u"utf8"_s, u"escaped key\n"_s, u"dup"_s,
+                                 u"array"_s, u"dup"_s }));
+    QCOMPARE(doc.root().size(), 12);
+
+    QList<QJsonValue::Type> types;
+    for (const QJsonLazyValue value : array)
+        types << value.type();
+    QCOMPARE(types, QList({ QJsonValue::Double, QJsonValue::Array, QJsonValue::Object,
+                            QJsonValue::Array, QJsonValue::String }));
+    QVERIFY(array.begin().key().isNull());
+
+    const QJsonDocument eager = QJsonDocument::fromJson(json);
+    QCOMPARE(doc.toDocument(), eager);
+    QCOMPARE(doc.root().toJsonValue(), QJsonValue(eager.object()));
+    QCOMPARE(array.toJsonValue(), eager.object().value(u"array"));
+    QCOMPARE(doc[u"big"].toJsonValue(), eager.object().value(u"big"));
+
+    // copies share the document
+    QJsonLazyDocument copy = doc;
+    QCOMPARE(copy[u"int"].toInt(), -42);
+    QJsonLazyDocument moved = std::move(copy);
+    QCOMPARE(moved[u"int"].toInt(), -42);
+
+    const QJsonLazyDocument null;
+    QVERIFY(null.isNull());
+    QVERIFY(null.root().isUndefined());
+    QVERIFY(null.toDocument().isNull());
+    QVERIFY(QJsonLazyValue().isUndefined());
+    QVERIFY(QJsonLazyValue().toJsonValue().isUndefined());
+}
+
+void tst_QtJson::lazyDocumentFiles_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QTest::newRow("test") << u"test.json"_s;
+    QTest::newRow("test2") << u"test2.json"_s;
+    QTest::newRow("test3") << u"test3.json"_s;
+    QTest::newRow("bom") << u"bom.json"_s;
+    QTest::newRow("duplicates") << u"test.duplicates.json"_s;
+}
+
+void tst_QtJson::lazyDocumentFiles()
+{
+    QFETCH(QString, fileName);
+
+    QFile file(testDataDir + u'/' + fileName);
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QByteArray json = file.readAll();
+
+    QJsonParseError error;
+    const QJsonDocument eager = QJsonDocument::fromJson(json, &error);
+    QVERIFY2(!eager.isNull(), qPrintable(error.errorString()));
+    const QJsonLazyDocument lazy = QJsonLazyDocument::fromJson(json, &error);
+    QVERIFY2(!lazy.isNull(), qPrintable(error.errorString()));
+
+    QCOMPARE(lazy.isArray(), eager.isArray());
+    QCOMPARE(lazy.isObject(), eager.isObject());
+    QCOMPARE(lazy.root().toJsonValue(),
+             eager.isArray() ? QJsonValue(eager.array()) : QJsonValue(eager.object()));
+
+    // decode it value by value
+    const auto decode = [](const QJsonLazyValue &value, auto &decode) -> QJsonValue {
+        if (value.isArray()) {
+            QJsonArray array;
+            for (const QJsonLazyValue element : value)
+                array.append(decode(element, decode));
+            return array;
+        }
+        if (value.isObject()) {
+            QJsonObject object;
+            for (auto it = value.begin(), end = value.end(); it != end; ++it)
+                object.insert(it.key(), decode(it.value(), decode));
+            return object;
+        }
+        return value.toJsonValue();
+    };
+    QCOMPARE(decode(lazy.root(), decode), lazy.root().toJsonValue());
+}
+
+void tst_QtJson::lazyDocumentErrors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("scalar") << QByteArray("42");
+    QTest::newRow("trailing comma in object") << QByteArray("{ \"value\": false, }");
+    QTest::newRow("trailing comma in array") << QByteArray("[ false, ]    ");
+    QTest::newRow("missing value") << QByteArray("{ \"value\": , } ");
+    QTest::newRow("missing name separator") << QByteArray("{ \"value\" false }");
+    QTest::newRow("missing value separator") << QByteArray("[ 1 2 ]");
+    QTest::newRow("quote after value") << QByteArray("[ 1 \"  ]");
+    QTest::newRow("unterminated array") << QByteArray("[ 1, 2   ");
+    QTest::newRow("unterminated object") << QByteArray("{ \"a\": 1   ");
+    QTest::newRow("unterminated string") << QByteArray("[ \"abc");
+    QTest::newRow("unterminated escape") << QByteArray("[ \"abc\\");
+    QTest::newRow("bad literal") << QByteArray("[ nul ]");
+    QTest::newRow("short literal") << QByteArray("[ fals");
+    QTest::newRow("termination by number") << QByteArray("[ 123");
+    QTest::newRow("illegal number") << QByteArray("[ 1e400 ]");
+    QTest::newRow("not a number") << QByteArray("[ - ]");
+    QTest::newRow("bad escape") << QByteArray("[ \"\\u12x4\" ]");
+    QTest::newRow("escaped non-ASCII") << QByteArray("[ \"\\\xc3\xa9\" ]");
+    QTest::newRow("bad UTF-8") << QByteArray("[ \"\xc3\" ]");
+    QTest::newRow("escaped bad UTF-8") << QByteArray("[ \"\\\xff\" ]");
+    QTest::newRow("garbage at end") << QByteArray("[ ]  x");
+    QTest::newRow("lenient number") << QByteArray("[ 1., .5, -0, 1E+2 ]");
+    QTest::newRow("lenient escape") << QByteArray("[ \"\\q\" ]");
+    QTest::newRow("deep") << QByteArray(1024, '[') + QByteArray(1024, ']');
+    QTest::newRow("too deep") << QByteArray(1025, '[') + QByteArray(1025, ']');
+}
+
+void tst_QtJson::lazyDocumentErrors()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    const QJsonDocument eager = QJsonDocument::fromJson(json, &expected);
+    QJsonParseError error;
+    const QJsonLazyDocument lazy = QJsonLazyDocument::fromJson(json, &error);
+
+    QCOMPARE(lazy.isNull(), eager.isNull());
+    QCOMPARE(error.error, expected.error);
+    QCOMPARE(error.offset, expected.offset);
+    QCOMPARE(lazy.toDocument(), eager);
+}
+
 QTEST_MAIN(tst_QtJson)
 #include "tst_qtjson.moc"
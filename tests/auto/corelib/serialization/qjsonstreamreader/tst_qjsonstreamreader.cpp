@@ -0,0 +1,423 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qjsonstreamreader.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QTest>
+#include <QBuffer>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void tokens_data();
+    void tokens();
+    void addData_byteByByte_data() { tokens_data(); }
+    void addData_byteByByte();
+    void device_data() { tokens_data(); }
+    void device();
+    void errors_data();
+    void errors();
+    void topLevelNumber();
+    void documentSequence();
+    void documentSequenceFromSocketLikeDevice();
+    void offsets();
+    void recursionLimit();
+    void roundTrip();
+};
+
+// Reads all the tokens and describes them in a compact form.
+static QStringList readTokens(QJsonStreamReader &reader)
+{
+    QStringList result;
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QJsonStreamReader::NoToken:
+            result << u"?"_s;
+            break;
+        case QJsonStreamReader::Invalid:
+            if (reader.error() == QJsonStreamReader::PrematureEndOfDocumentError)
+                result << u"premature"_s;
+            else
+                result << u"error: "_s + reader.errorString();
+            break;
+        case QJsonStreamReader::StartArray:
+            result << u"["_s;
+            break;
+        case QJsonStreamReader::EndArray:
+            result << u"]"_s;
+            break;
+        case QJsonStreamReader::StartObject:
+            result << u"{"_s;
+            break;
+        case QJsonStreamReader::EndObject:
+            result << u"}"_s;
+            break;
+        case QJsonStreamReader::Key:
+            result << reader.text().toString() + u':';
+            break;
+        case QJsonStreamReader::String:
+            result << u'"' + reader.text().toString() + u'"';
+            break;
+        case QJsonStreamReader::Number:
+            if (reader.isInteger())
+                result << QString::number(reader.toInteger());
+            else
+                result << QString::number(reader.toDouble()) + u'd';
+            break;
+        case QJsonStreamReader::Bool:
+            result << (reader.toBool() ? u"true"_s : u"false"_s);
+            break;
+        case QJsonStreamReader::Null:
+            result << u"null"_s;
+            break;
+        case QJsonStreamReader::EndDocument:
+            result << u"end"_s;
+            break;
+        }
+    }
+    return result;
+}
+
+static QString readAll(QJsonStreamReader &reader)
+{
+    return readTokens(reader).join(u' ');
+}
+
+static QString errorString(QJsonParseError::ParseError code)
+{
+    QJsonParseError error;
+    error.error = code;
+    return error.errorString();
+}
+
+void tst_QJsonStreamReader::basics()
+{
+    QJsonStreamReader reader;
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(reader.device(), nullptr);
+    QVERIFY(!reader.isDocumentSequence());
+    QVERIFY(!reader.atEnd());
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.depth(), 0);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.errorString().isEmpty());
+
+    reader.addData("[true");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QVERIFY(reader.isStartArray());
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QVERIFY(reader.toBool());
+    QCOMPARE(reader.value(), QJsonValue(true));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+
+    reader.addData("]");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    reader.clear();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QVERIFY(!reader.atEnd());
+    reader.addData("{}");
+    QCOMPARE(readAll(reader), u"{ } end"_s);
+}
+
+void tst_QJsonStreamReader::tokens_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("empty-object") << "{}"_ba << u"{ } end"_s;
+    QTest::newRow("empty-array") << "[]"_ba << u"[ ] end"_s;
+    QTest::newRow("whitespace") << " \t\r\n[ \n ] \n"_ba << u"[ ] end"_s;
+    QTest::newRow("bom") << "\xef\xbb\xbf[]"_ba << u"[ ] end"_s;
+    QTest::newRow("literals") << "[true,false,null]"_ba << u"[ true false null ] end"_s;
+    QTest::newRow("integers") << "[0,-1,9007199254740993,-9223372036854775808]"_ba
+                              << u"[ 0 -1 9007199254740993 -9223372036854775808 ] end"_s;
+    QTest::newRow("integral-doubles") << "[1.0,1e2,-0.000]"_ba << u"[ 1 100 0 ] end"_s;
+    QTest::newRow("doubles") << "[1.5,-2.5e-3]"_ba << u"[ 1.5d -0.0025d ] end"_s;
+    QTest::newRow("strings") << R"(["", "abc", "\"\\\/\b\f\n\r\t"])"_ba
+                             << u"[ \"\" \"abc\" \"\"\\/\b\f\n\r\t\" ] end"_s;
+    QTest::newRow("unicode") << "[\"\xc3\xa9\\u00e9\\ud83d\\ude00\"]"_ba
+                             << u"[ \"éé\U0001F600\" ] end"_s;
+    QTest::newRow("object") << R"({"a": 1, "b": [true, {}], "c": {"d": null}})"_ba
+                            << u"{ a: 1 b: [ true { } ] c: { d: null } } end"_s;
+    QTest::newRow("duplicate-keys") << R"({"a": 1, "a": 2})"_ba << u"{ a: 1 a: 2 } end"_s;
+    QTest::newRow("escaped-key") << R"({"a\"b": "c\\"})"_ba << u"{ a\"b: \"c\\\" } end"_s;
+    QTest::newRow("top-level-string") << "\"abc\""_ba << u"\"abc\" end"_s;
+    QTest::newRow("top-level-literal") << " null "_ba << u"null end"_s;
+    QTest::newRow("nested") << "[[[[]]],[[]]]"_ba << u"[ [ [ [ ] ] ] [ [ ] ] ] end"_s;
+}
+
+void tst_QJsonStreamReader::tokens()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(readAll(reader), expected);
+}
+
+void tst_QJsonStreamReader::addData_byteByByte()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    QJsonStreamReader reader;
+    QStringList result;
+    for (char c : std::as_const(json)) {
+        reader.addData(&c, 1);
+        result += readTokens(reader);
+        result.removeAll(u"premature"_s);
+    }
+    QCOMPARE(result.join(u' '), expected);
+}
+
+void tst_QJsonStreamReader::device()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QString, expected);
+
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QCOMPARE(readAll(reader), expected);
+}
+
+void tst_QJsonStreamReader::errors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("garbage-at-end") << "{} x"_ba;
+    QTest::newRow("missing-name-separator") << R"({"a" 1})"_ba;
+    QTest::newRow("missing-value-separator") << "[1 2]"_ba;
+    QTest::newRow("unterminated-object") << R"({"a": 1 "b": 2})"_ba;
+    QTest::newRow("unquoted-key") << "{a: 1}"_ba;
+    QTest::newRow("trailing-comma-object") << R"({"a": 1,})"_ba;
+    QTest::newRow("trailing-comma-array") << "[1,]"_ba;
+    QTest::newRow("leading-comma") << "[,1]"_ba;
+    QTest::newRow("missing-value") << R"({"a":,})"_ba;
+    QTest::newRow("illegal-literal") << "[tru]"_ba;
+    QTest::newRow("illegal-number") << "[-]"_ba;
+    QTest::newRow("illegal-value") << "[x]"_ba;
+    QTest::newRow("illegal-unicode-escape") << R"(["\u12"])"_ba;
+    QTest::newRow("illegal-utf8") << "[\"\xff\"]"_ba;
+    QTest::newRow("overlong-utf8") << "[\"\xc0\xaf\"]"_ba;
+}
+
+void tst_QJsonStreamReader::errors()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    QVERIFY(QJsonDocument::fromJson(json, &expected).isNull());
+
+    QJsonStreamReader reader(json);
+    const QString tokens = readAll(reader);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    QVERIFY2(tokens.endsWith(u"error: "_s + expected.errorString()), qPrintable(tokens));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+
+    // errors aren't recoverable
+    reader.addData("[]");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+}
+
+void tst_QJsonStreamReader::topLevelNumber()
+{
+    {
+        // the number may continue in the data yet to arrive
+        QJsonStreamReader reader("42"_ba);
+        QCOMPARE(readAll(reader), u"premature"_s);
+        reader.addData("1 ");
+        QCOMPARE(readAll(reader), u"421 end"_s);
+    }
+    {
+        // the end of a buffer is the end of the number
+        QByteArray json = "-1.5e3"_ba;
+        QBuffer buffer(&json);
+        QVERIFY(buffer.open(QIODevice::ReadOnly));
+        QJsonStreamReader reader(&buffer);
+        QCOMPARE(readAll(reader), u"-1500 end"_s);
+    }
+}
+
+void tst_QJsonStreamReader::documentSequence()
+{
+    QByteArray json = "{\"id\":1}\n{\"id\":2}\n[3]\n\"four\"\n5\nnull\n"_ba;
+
+    QJsonStreamReader reader(json);
+    reader.setDocumentSequence(true);
+    QVERIFY(reader.isDocumentSequence());
+    QCOMPARE(readAll(reader), u"{ id: 1 } { id: 2 } [ 3 ] \"four\" 5 null premature"_s);
+    QCOMPARE(reader.depth(), 0);
+
+    // without document sequences, anything after the first one is an error
+    QJsonStreamReader single(json);
+    QCOMPARE(readAll(single), u"{ id: 1 } error: "_s
+             + errorString(QJsonParseError::GarbageAtEnd));
+
+    // the end of a buffer is the end of the sequence
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    reader.setDevice(&buffer);
+    QVERIFY(reader.isDocumentSequence());
+    QCOMPARE(readAll(reader), u"{ id: 1 } { id: 2 } [ 3 ] \"four\" 5 null end"_s);
+
+    // a large sequence read through a device, which is never held in memory at once
+    QByteArray log;
+    for (int i = 0; i < 10000; ++i)
+        log += "{\"seq\":" + QByteArray::number(i) + ",\"msg\":\"" + QByteArray(i % 100, 'x') + "\"}\n";
+    QBuffer logBuffer(&log);
+    QVERIFY(logBuffer.open(QIODevice::ReadOnly));
+    reader.setDevice(&logBuffer);
+    qint64 count = 0;
+    qint64 sum = 0;
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QJsonStreamReader::Key && reader.text() == u"seq") {
+            QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+            sum += reader.toInteger();
+            ++count;
+        }
+    }
+    QCOMPARE(reader.error(), QJsonStreamReader::NoError);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndDocument);
+    QCOMPARE(count, 10000);
+    QCOMPARE(sum, 10000 * 9999 / 2);
+    QCOMPARE(reader.offset(), log.size());
+}
+
+void tst_QJsonStreamReader::documentSequenceFromSocketLikeDevice()
+{
+    // a sequential device that only has some of the data at a time
+    class Pipe : public QIODevice
+    {
+    public:
+        QByteArray data;
+        bool isSequential() const override { return true; }
+        qint64 bytesAvailable() const override { return data.size() + QIODevice::bytesAvailable(); }
+
+    protected:
+        qint64 readData(char *out, qint64 maxSize) override
+        {
+            const qint64 n = qMin(maxSize, qint64(data.size()));
+            memcpy(out, data.constData(), n);
+            data.remove(0, n);
+            return n;
+        }
+        qint64 writeData(const char *, qint64) override { return -1; }
+    } pipe;
+    QVERIFY(pipe.open(QIODevice::ReadOnly | QIODevice::Unbuffered));
+
+    QJsonStreamReader reader(&pipe);
+    reader.setDocumentSequence(true);
+    QString result;
+    const QByteArray chunks[] = { "{\"a\"", ": [1, 2", "2, \"x\\", "\"\"]}\n{", "}\n" };
+    for (const QByteArray &chunk : chunks) {
+        pipe.data += chunk;
+        result += readAll(reader) + u' ';
+    }
+    QCOMPARE(result, u"{ premature a: [ 1 premature 22 premature \"x\"\" ] } { premature "
+                     "} premature "_s);
+}
+
+void tst_QJsonStreamReader::offsets()
+{
+    QJsonStreamReader reader(R"( { "key" : [ 12 , "str" ] } x)"_ba);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.offset(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.offset(), 3);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.offset(), 11);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.offset(), 13);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.offset(), 18);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.offset(), 24);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.offset(), 26);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.offset(), 28);
+}
+
+void tst_QJsonStreamReader::recursionLimit()
+{
+    QJsonStreamReader reader(QByteArray(1024, '[') + QByteArray(1024, ']'));
+    while (!reader.atEnd())
+        reader.readNext();
+    QCOMPARE(reader.error(), QJsonStreamReader::NoError);
+
+    reader.clear();
+    reader.addData(QByteArray(1025, '['));
+    while (!reader.atEnd())
+        reader.readNext();
+    QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    QCOMPARE(reader.offset(), 1024);
+    QCOMPARE(reader.errorString(), errorString(QJsonParseError::DeepNesting));
+}
+
+static QJsonValue readValue(QJsonStreamReader &reader)
+{
+    switch (reader.tokenType()) {
+    case QJsonStreamReader::StartArray: {
+        QJsonArray array;
+        while (reader.readNext() != QJsonStreamReader::EndArray && !reader.hasError())
+            array.append(readValue(reader));
+        return array;
+    }
+    case QJsonStreamReader::StartObject: {
+        QJsonObject object;
+        while (reader.readNext() == QJsonStreamReader::Key) {
+            const QString key = reader.text().toString();
+            reader.readNext();
+            object.insert(key, readValue(reader));
+        }
+        return object;
+    }
+    default:
+        return reader.value();
+    }
+}
+
+void tst_QJsonStreamReader::roundTrip()
+{
+    QJsonObject object;
+    object[u"string"_s] = u"héllo \"world\"\n"_s;
+    object[u"integer"_s] = Q_INT64_C(-1234567890123);
+    object[u"double"_s] = 0.1;
+    object[u"bool"_s] = false;
+    object[u"null"_s] = QJsonValue::Null;
+    object[u"array"_s] = QJsonArray{ 1, u"two"_s, QJsonArray{ 3.5 }, QJsonObject{} };
+    object[u"object"_s] = QJsonObject{ { u"nested"_s, QJsonObject{ { u"x"_s, 1 } } } };
+
+    for (auto format : { QJsonDocument::Indented, QJsonDocument::Compact }) {
+        const QByteArray json = QJsonDocument(object).toJson(format);
+        QJsonStreamReader reader(json);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+        QCOMPARE(readValue(reader), QJsonValue(object));
+        QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    }
+}
+
+QTEST_MAIN(tst_QJsonStreamReader)
+
+#include "tst_qjsonstreamreader.moc"
@@ -0,0 +1,270 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qjsonstreamwriter.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qjsonstreamreader.h>
+#include <QTest>
+#include <QBuffer>
+
+#include <limits>
+
+using namespace Qt::StringLiterals;
+
+class tst_QJsonStreamWriter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void scalars_data();
+    void scalars();
+    void documents_data();
+    void documents();
+    void documentsWithWriteValue_data() { documents_data(); }
+    void documentsWithWriteValue();
+    void documentSequence();
+    void strings();
+    void misuse();
+    void deviceError();
+};
+
+// Writes value token by token rather than with writeValue().
+static void write(QJsonStreamWriter &writer, const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Array:
+        writer.startArray();
+        for (const QJsonValue element : value.toArray())
+            write(writer, element);
+        QVERIFY(writer.endArray());
+        break;
+    case QJsonValue::Object: {
+        const QJsonObject object = value.toObject();
+        writer.startObject();
+        for (auto it = object.begin(); it != object.end(); ++it) {
+            writer.writeKey(it.key());
+            write(writer, it.value());
+        }
+        QVERIFY(writer.endObject());
+        break;
+    }
+    case QJsonValue::String:
+        writer.writeString(value.toString());
+        break;
+    case QJsonValue::Double:
+        if (const qint64 i = value.toInteger(); value.toDouble() == double(i))
+            writer.writeInteger(i);
+        else
+            writer.writeDouble(value.toDouble());
+        break;
+    case QJsonValue::Bool:
+        writer.writeBool(value.toBool());
+        break;
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        writer.writeNull();
+        break;
+    }
+}
+
+void tst_QJsonStreamWriter::basics()
+{
+    QByteArray data = "prefix "_ba;
+    QJsonStreamWriter writer(&data);
+    QVERIFY(writer.device());
+    QCOMPARE(writer.format(), QJsonDocument::Compact);
+    writer.startArray();
+    writer.writeInteger(1);
+    writer.startObject();
+    writer.endObject();
+    QVERIFY(writer.endArray());
+    QVERIFY(!writer.hasError());
+    QCOMPARE(data, "prefix [1,{}]\n");
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    writer.setDevice(&buffer);
+    QCOMPARE(writer.device(), &buffer);
+    writer.setFormat(QJsonDocument::Indented);
+    QCOMPARE(writer.format(), QJsonDocument::Indented);
+    writer.writeNull();
+    QCOMPARE(buffer.data(), "null\n");
+}
+
+void tst_QJsonStreamWriter::scalars_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+    QTest::addColumn<QByteArray>("expected");
+
+    QTest::newRow("true") << QJsonValue(true) << "true"_ba;
+    QTest::newRow("false") << QJsonValue(false) << "false"_ba;
+    QTest::newRow("null") << QJsonValue(QJsonValue::Null) << "null"_ba;
+    QTest::newRow("undefined") << QJsonValue(QJsonValue::Undefined) << "null"_ba;
+    QTest::newRow("zero") << QJsonValue(0) << "0"_ba;
+    QTest::newRow("integer") << QJsonValue(Q_INT64_C(-1234567890123)) << "-1234567890123"_ba;
+    QTest::newRow("double") << QJsonValue(0.1) << "0.1"_ba;
+    QTest::newRow("large-double") << QJsonValue(1e300) << "1e+300"_ba;
+    QTest::newRow("infinity") << QJsonValue(qInf()) << "null"_ba;
+    QTest::newRow("nan") << QJsonValue(qQNaN()) << "null"_ba;
+    QTest::newRow("string") << QJsonValue(u"a\"b\\c\n\u0001é"_s) << "\"a\\\"b\\\\c\\n\\u0001\xc3\xa9\""_ba;
+}
+
+void tst_QJsonStreamWriter::scalars()
+{
+    QFETCH(QJsonValue, value);
+    QFETCH(QByteArray, expected);
+
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.writeValue(value);
+    QCOMPARE(data, expected + '\n');
+
+    QByteArray tokenData;
+    QJsonStreamWriter tokenWriter(&tokenData);
+    write(tokenWriter, value);
+    QCOMPARE(tokenData, expected + '\n');
+}
+
+void tst_QJsonStreamWriter::documents_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+
+    QTest::newRow("empty-array") << QJsonValue(QJsonArray());
+    QTest::newRow("empty-object") << QJsonValue(QJsonObject());
+    QTest::newRow("array") << QJsonValue(QJsonArray{ 1, 2.5, u"three"_s, true, QJsonValue::Null });
+    QTest::newRow("object") << QJsonValue(QJsonObject{ { u"a"_s, 1 }, { u"b"_s, u"c"_s } });
+    QTest::newRow("nested") << QJsonValue(QJsonObject{
+            { u"array"_s, QJsonArray{ QJsonArray{}, QJsonObject{}, QJsonArray{ 1, QJsonArray{ 2 } } } },
+            { u"object"_s, QJsonObject{ { u"x"_s, QJsonObject{ { u"y"_s, QJsonArray{} } } } } },
+            { u"key with \"quotes\""_s, u"value\twith\ttabs"_s } });
+}
+
+void tst_QJsonStreamWriter::documents()
+{
+    QFETCH(QJsonValue, value);
+    const QJsonDocument document = value.isArray() ? QJsonDocument(value.toArray())
+                                                   : QJsonDocument(value.toObject());
+
+    QByteArray compact;
+    QJsonStreamWriter writer(&compact);
+    write(writer, value);
+    QCOMPARE(compact, document.toJson(QJsonDocument::Compact) + '\n');
+
+    QByteArray indented;
+    QJsonStreamWriter indentingWriter(&indented);
+    indentingWriter.setFormat(QJsonDocument::Indented);
+    write(indentingWriter, value);
+    QCOMPARE(indented, document.toJson(QJsonDocument::Indented));
+}
+
+void tst_QJsonStreamWriter::documentsWithWriteValue()
+{
+    QFETCH(QJsonValue, value);
+    const QJsonDocument document = value.isArray() ? QJsonDocument(value.toArray())
+                                                   : QJsonDocument(value.toObject());
+
+    QByteArray compact;
+    QJsonStreamWriter writer(&compact);
+    writer.writeValue(value);
+    QCOMPARE(compact, document.toJson(QJsonDocument::Compact) + '\n');
+
+    // nested in a container, writeValue() indents as QJsonDocument does
+    QByteArray indented;
+    QJsonStreamWriter indentingWriter(&indented);
+    indentingWriter.setFormat(QJsonDocument::Indented);
+    indentingWriter.startArray();
+    indentingWriter.writeValue(value);
+    indentingWriter.endArray();
+    QCOMPARE(indented, QJsonDocument(QJsonArray{ value }).toJson(QJsonDocument::Indented));
+}
+
+void tst_QJsonStreamWriter::documentSequence()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::ReadWrite));
+    QJsonStreamWriter writer(&buffer);
+    for (int i = 0; i < 3; ++i) {
+        writer.startObject();
+        writer.writeKey("seq");
+        writer.writeInteger(i);
+        writer.writeKey(u"msg"_s);
+        writer.writeString(QByteArray(i, 'x'));
+        writer.endObject();
+    }
+    QCOMPARE(buffer.data(), "{\"seq\":0,\"msg\":\"\"}\n"
+                            "{\"seq\":1,\"msg\":\"x\"}\n"
+                            "{\"seq\":2,\"msg\":\"xx\"}\n");
+
+    buffer.seek(0);
+    QJsonStreamReader reader(&buffer);
+    reader.setDocumentSequence(true);
+    int documents = 0;
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QJsonStreamReader::EndObject && reader.depth() == 0)
+            ++documents;
+    }
+    QCOMPARE(reader.error(), QJsonStreamReader::NoError);
+    QCOMPARE(documents, 3);
+}
+
+void tst_QJsonStreamWriter::strings()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+    writer.startArray();
+    writer.writeString("latin1 \xe9"_L1);
+    writer.writeString(u8"utf-8 \u00e9");
+    writer.writeString(u"utf-16 \u00e9");
+    writer.writeString(QStringView(u"\U0001F600"));
+    writer.writeString(QString(QChar(0xd800)));
+    writer.endArray();
+    QCOMPARE(data, "[\"latin1 \xc3\xa9\",\"utf-8 \xc3\xa9\",\"utf-16 \xc3\xa9\","
+                   "\"\xf0\x9f\x98\x80\",\"\\ud800\"]\n");
+}
+
+void tst_QJsonStreamWriter::misuse()
+{
+    QByteArray data;
+    QJsonStreamWriter writer(&data);
+
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: closing array that wasn't open");
+    QVERIFY(!writer.endArray());
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: closing object that wasn't open");
+    QVERIFY(!writer.endObject());
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: key not expected here");
+    writer.writeKey(u"a");
+
+    writer.startObject();
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: integer in an object without a key");
+    writer.writeInteger(1);
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: closing array that wasn't open");
+    QVERIFY(!writer.endArray());
+    writer.writeKey(u"a");
+    QTest::ignoreMessage(QtWarningMsg, "QJsonStreamWriter: key not expected here");
+    writer.writeKey(u"b");
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QJsonStreamWriter: closing object with a key without a value");
+    QVERIFY(!writer.endObject());
+    writer.writeInteger(1);
+    QVERIFY(writer.endObject());
+
+    // the misplaced calls wrote nothing
+    QCOMPARE(data, "{\"a\":1}\n");
+}
+
+void tst_QJsonStreamWriter::deviceError()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamWriter writer(&buffer);
+    QVERIFY(!writer.hasError());
+    QTest::ignoreMessage(QtWarningMsg, "QIODevice::write (QBuffer): ReadOnly device");
+    writer.writeNull();
+    QVERIFY(writer.hasError());
+}
+
+QTEST_MAIN(tst_QJsonStreamWriter)
+
+#include "tst_qjsonstreamwriter.moc"
@@ -24,6 +24,7 @@ private slots:
     void overloads();
     void interface();
     void indexIn();
+    void needleLengths();
     void staticByteArrayMatcher();
     void haystacksWithMoreThan4GiBWork();
 };
@@ -152,6 +153,47 @@ void tst_QByteArrayMatcher::indexIn()
     QCOMPARE(matcher.indexIn(haystack, 34), -1);
 }
 
+void tst_QByteArrayMatcher::needleLengths()
+{
+    // Short needles are searched with vectors of 16 or 32 bytes, and the
+    // longer ones with the skip table: check all the needle lengths around
+    // these sizes, with matches at all the positions, against a naive search.
+    // A two-letter alphabet makes many positions match the first and the last
+    // byte of the needle, but not its middle.
+    uint seed = 42;
+    const auto nextLetter = [&seed] {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 1 ? 'b' : 'a';
+    };
+    const auto naiveIndexIn = [](QByteArrayView haystack, QByteArrayView needle, qsizetype from) {
+        for (qsizetype i = from; i <= haystack.size() - needle.size(); ++i) {
+            if (haystack.sliced(i, needle.size()) == needle)
+                return i;
+        }
+        return qsizetype(-1);
+    };
+
+    for (qsizetype needleLength = 1; needleLength <= 40; ++needleLength) {
+        QByteArray needle(needleLength, Qt::Uninitialized);
+        for (char &c : needle)
+            c = nextLetter();
+        const QByteArrayMatcher matcher(needle);
+        for (qsizetype haystackLength = needleLength - 1; haystackLength <= needleLength + 70;
+             ++haystackLength) {
+            QByteArray haystack(haystackLength, Qt::Uninitialized);
+            for (char &c : haystack)
+                c = nextLetter();
+            for (qsizetype pos = 0; pos <= haystackLength - needleLength; pos += 3) {
+                QByteArray planted = haystack;
+                planted.replace(pos, needleLength, needle);
+                for (qsizetype from : { qsizetype(0), pos / 2, pos, pos + 1 })
+                    QCOMPARE(matcher.indexIn(planted, from), naiveIndexIn(planted, needle, from));
+            }
+            QCOMPARE(matcher.indexIn(haystack), naiveIndexIn(haystack, needle, 0));
+        }
+    }
+}
+
 void tst_QByteArrayMatcher::staticByteArrayMatcher()
 {
     {
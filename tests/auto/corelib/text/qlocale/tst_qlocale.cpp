@@ -13,6 +13,7 @@
 #if QT_CONFIG(process)
 #  include <QProcess>
 #endif
+#include <QRandomGenerator>
 #include <QScopedArrayPointer>
 #include <QTimeZone>
 
@@ -65,6 +66,9 @@ private slots:
     void doubleToString();
     void strtod_data();
     void strtod();
+    void shortestDoubleToAscii_data();
+    void shortestDoubleToAscii();
+    void shortestDoubleRoundTrip();
     void long_long_conversion_data();
     void long_long_conversion();
     void long_long_conversion_extra();
@@ -1479,6 +1483,35 @@ void tst_QLocale::strtod_data()
 
     // hexfloat is not supported (yet)
     QTest::newRow("0x1.921fb5p+1")     << QString("0x1.921fb5p+1")     << 0.0 << 1 << true;
+
+    // a leading '+', which std::from_chars() doesn't accept on its own
+    QTest::newRow("+3.4")              << QString("+3.4")              << 3.4  << 4 << true;
+    QTest::newRow("+3.4a")             << QString("+3.4a")             << 3.4  << 4 << true;
+    QTest::newRow("+-3.4")             << QString("+-3.4")             << 0.0  << 0 << false;
+    QTest::newRow("++3.4")             << QString("++3.4")             << 0.0  << 0 << false;
+    QTest::newRow("+")                 << QString("+")                 << 0.0  << 0 << false;
+
+    // subnormals, the smallest normal number and the largest number
+    QTest::newRow("4.9406564584124654e-324") << QString("4.9406564584124654e-324")
+                                             << std::numeric_limits<double>::denorm_min()
+                                             << 23 << true;
+    QTest::newRow("5e-324")            << QString("5e-324")
+                                       << std::numeric_limits<double>::denorm_min() << 6 << true;
+    QTest::newRow("-5e-324")           << QString("-5e-324")
+                                       << -std::numeric_limits<double>::denorm_min() << 7 << true;
+    QTest::newRow("2.2250738585072014e-308") << QString("2.2250738585072014e-308")
+                                             << std::numeric_limits<double>::min() << 23 << true;
+    QTest::newRow("1.7976931348623157e308") << QString("1.7976931348623157e308")
+                                            << std::numeric_limits<double>::max() << 22 << true;
+
+    // infinities, with and without a sign
+    QTest::newRow("inf")               << QString("inf")               << qInf()  << 3 << true;
+    QTest::newRow("+inf")              << QString("+inf")              << qInf()  << 4 << true;
+    QTest::newRow("-inf")              << QString("-inf")              << -qInf() << 4 << true;
+
+    // a trailing exponent marker without digits is junk
+    QTest::newRow("1.5e")              << QString("1.5e")              << 1.5 << 3 << true;
+    QTest::newRow("1.5e+")             << QString("1.5e+")             << 1.5 << 3 << true;
 }
 
 void tst_QLocale::strtod()
@@ -1520,6 +1553,99 @@ void tst_QLocale::strtod()
     QCOMPARE(actualOk, ok);
 }
 
+void tst_QLocale::shortestDoubleToAscii_data()
+{
+    QTest::addColumn<double>("num");
+    QTest::addColumn<QByteArray>("digits");
+    QTest::addColumn<int>("decpt");
+    QTest::addColumn<bool>("sign");
+
+    using D = std::numeric_limits<double>;
+    QTest::newRow("0") << 0.0 << QByteArray("0") << 1 << false;
+    QTest::newRow("-0") << -0.0 << QByteArray("0") << 1 << true;
+    QTest::newRow("1") << 1.0 << QByteArray("1") << 1 << false;
+    QTest::newRow("-1.5") << -1.5 << QByteArray("15") << 1 << true;
+    QTest::newRow("0.1") << 0.1 << QByteArray("1") << 0 << false;
+    QTest::newRow("0.3") << 0.3 << QByteArray("3") << 0 << false;
+    QTest::newRow("0.1+0.2") << 0.1 + 0.2 << QByteArray("30000000000000004") << 0 << false;
+    QTest::newRow("123.456") << 123.456 << QByteArray("123456") << 3 << false;
+    QTest::newRow("1e23") << 1e23 << QByteArray("1") << 24 << false;
+    QTest::newRow("1/3") << 1.0 / 3 << QByteArray("3333333333333333") << 0 << false;
+    QTest::newRow("max") << D::max() << QByteArray("17976931348623157") << 309 << false;
+    QTest::newRow("min") << D::min() << QByteArray("22250738585072014") << -307 << false;
+    QTest::newRow("denorm_min") << D::denorm_min() << QByteArray("5") << -323 << false;
+    QTest::newRow("-denorm_min") << -D::denorm_min() << QByteArray("5") << -323 << true;
+    QTest::newRow("subnormal") << 1e-310 << QByteArray("1") << -309 << false;
+    QTest::newRow("inf") << D::infinity() << QByteArray("inf") << 0 << false;
+    QTest::newRow("-inf") << -D::infinity() << QByteArray("inf") << 0 << true;
+    QTest::newRow("nan") << D::quiet_NaN() << QByteArray("nan") << 0 << false;
+}
+
+void tst_QLocale::shortestDoubleToAscii()
+{
+#if !QT_CONFIG(doubleconversion)
+    QSKIP("The snprintf() fallback has no shortest mode");
+#endif
+    QFETCH(double, num);
+    QFETCH(QByteArray, digits);
+    QFETCH(int, decpt);
+    QFETCH(bool, sign);
+
+    // qdtoa() takes the digits from qt_doubleToAscii() in shortest mode
+    int actualDecpt = 0;
+    int actualSign = -1;
+    QCOMPARE(qdtoa(num, &actualDecpt, &actualSign), QLatin1StringView(digits));
+    if (qt_is_finite(num))
+        QCOMPARE(actualDecpt, decpt);
+    if (!qt_is_nan(num))
+        QCOMPARE(actualSign, sign ? 1 : 0);
+
+    // the sign isn't shown for zero
+    const QString text = QLocale::c().toString(num, 'g', QLocale::FloatingPointShortest);
+    QCOMPARE(text.startsWith(u'-'), sign && num != 0);
+}
+
+void tst_QLocale::shortestDoubleRoundTrip()
+{
+#if !QT_CONFIG(doubleconversion)
+    QSKIP("The snprintf() fallback has no shortest mode");
+#endif
+    // The shortest digits read back as the same number, for values spread over
+    // the whole range of doubles, subnormals included.
+    QRandomGenerator rng(20251016);
+    for (int i = 0; i < 100000; ++i) {
+        double d;
+        do {
+            const quint64 bits = rng.generate64();
+            memcpy(&d, &bits, sizeof d);
+        } while (!qt_is_finite(d));
+
+        const QString text = QString::number(d, 'g', QLocale::FloatingPointShortest);
+        QVERIFY2(text.size() <= 24, qPrintable(text));
+        bool ok = false;
+        const double parsed = text.toDouble(&ok);
+        QVERIFY2(ok, qPrintable(text));
+        QVERIFY2(memcmp(&parsed, &d, sizeof d) == 0 || isZero(d), qPrintable(text));
+        if (QTest::currentTestFailed())
+            return;
+    }
+
+    // -0.0 parses back with its sign
+    bool ok = false;
+    const double negativeZero = QByteArray("-0").toDouble(&ok);
+    QVERIFY(ok);
+    QVERIFY(std::signbit(negativeZero));
+
+    // trailing junk is only counted as processed up to the number
+    const char *end = nullptr;
+    ok = false;
+    QCOMPARE(qstrntod("+2.5e-3x", 8, &end, &ok), 2.5e-3);
+    QVERIFY(ok);
+    QCOMPARE(end, "+2.5e-3x" + 7);
+    QCOMPARE(QByteArray("+2.5e-3x").toDouble(&ok), 0.0);
+    QVERIFY(!ok);
+}
+
 void tst_QLocale::long_long_conversion_data()
 {
     QTest::addColumn<QString>("locale_name");
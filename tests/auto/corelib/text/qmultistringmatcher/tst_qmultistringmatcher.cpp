@@ -0,0 +1,297 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QMultiStringMatcher>
+#include <QRandomGenerator>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace Qt::StringLiterals;
+
+using Match = QMultiStringMatcher::Match;
+
+QT_BEGIN_NAMESPACE
+namespace QTest {
+template <>
+char *toString(const Match &m)
+{
+    return qstrdup(QByteArray::number(m.position) + '+' + QByteArray::number(m.length)
+                   + " #" + QByteArray::number(m.patternIndex));
+}
+}
+QT_END_NAMESPACE
+
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaultConstructed();
+    void overlappingMatches();
+    void leftmostLongest();
+    void duplicateAndEmptyPatterns();
+    void from();
+    void caseInsensitive();
+    void caseInsensitiveSurrogates();
+    void copyAndModify();
+    void byteArrays();
+    void byteArraysCaseInsensitive();
+    void compareWithNaiveSearch_data();
+    void compareWithNaiveSearch();
+};
+
+void tst_QMultiStringMatcher::defaultConstructed()
+{
+    QMultiStringMatcher matcher;
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseSensitive);
+    QVERIFY(matcher.patterns().isEmpty());
+    QCOMPARE(matcher.indexIn(u"foo"), -1);
+    QVERIFY(!matcher.match(u"foo").isValid());
+    QVERIFY(matcher.matchAll(u"foo").isEmpty());
+
+    QMultiByteArrayMatcher bytes;
+    QCOMPARE(bytes.indexIn("foo"), -1);
+    QVERIFY(bytes.matchAll("foo").isEmpty());
+}
+
+void tst_QMultiStringMatcher::overlappingMatches()
+{
+    const QMultiStringMatcher matcher({ u"he"_s, u"she"_s, u"his"_s, u"hers"_s });
+    const QList<Match> expected = {
+        { 1, 3, 1 },    // she
+        { 2, 2, 0 },    // he
+        { 2, 4, 3 },    // hers
+    };
+    QCOMPARE(matcher.matchAll(u"ushers"), expected);
+    QCOMPARE(matcher.match(u"ushers"), Match({ 1, 3, 1 }));
+    QCOMPARE(matcher.indexIn(u"ushers"), 1);
+    QCOMPARE(matcher.indexIn(u"history"), 0);
+    QCOMPARE(matcher.indexIn(u"nothing"), -1);
+    QCOMPARE(matcher.indexIn(u""), -1);
+}
+
+void tst_QMultiStringMatcher::leftmostLongest()
+{
+    // "bcd" ends first, but "abcdef" starts earlier
+    QMultiStringMatcher matcher({ u"bcd"_s, u"abcdef"_s, u"abc"_s });
+    QCOMPARE(matcher.match(u"xabcdefg"), Match({ 1, 6, 1 }));
+    QCOMPARE(matcher.match(u"xabcdeg"), Match({ 1, 3, 2 }));
+    QCOMPARE(matcher.match(u"xbcdefg"), Match({ 1, 3, 0 }));
+
+    matcher.setPatterns({ u"abcdefgh"_s, u"cd"_s });
+    QCOMPARE(matcher.match(u"abcdefg"), Match({ 2, 2, 1 }));
+}
+
+void tst_QMultiStringMatcher::duplicateAndEmptyPatterns()
+{
+    const QMultiStringMatcher matcher({ u""_s, u"ab"_s, u"b"_s, u"ab"_s });
+    const QList<Match> expected = {
+        { 0, 2, 1 },
+        { 0, 2, 3 },
+        { 1, 1, 2 },
+    };
+    QCOMPARE(matcher.matchAll(u"ab"), expected);
+    QCOMPARE(matcher.match(u"ab"), Match({ 0, 2, 1 }));
+    QCOMPARE(matcher.indexIn(u"xyz"), -1);
+
+    const QMultiStringMatcher empty({ u""_s });
+    QCOMPARE(empty.indexIn(u"xyz"), -1);
+}
+
+void tst_QMultiStringMatcher::from()
+{
+    const QMultiStringMatcher matcher({ u"ab"_s, u"ba"_s });
+    const auto haystack = u"ababab"_s;
+    QCOMPARE(matcher.indexIn(haystack, -10), 0);
+    QCOMPARE(matcher.indexIn(haystack, 1), 1);
+    QCOMPARE(matcher.indexIn(haystack, 4), 4);
+    QCOMPARE(matcher.indexIn(haystack, 5), -1);
+    QCOMPARE(matcher.indexIn(haystack, 6), -1);
+    QCOMPARE(matcher.indexIn(haystack, 100), -1);
+    QCOMPARE(matcher.matchAll(haystack, 3).size(), 2);
+}
+
+void tst_QMultiStringMatcher::caseInsensitive()
+{
+    QMultiStringMatcher matcher({ u"Straße"_s, u"ÉTÉ"_s, u"kelvin"_s });
+    QCOMPARE(matcher.indexIn(u"STRASSE Straße été"), 8);
+    matcher.setCaseSensitivity(Qt::CaseInsensitive);
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(matcher.match(u"un été"), Match({ 3, 3, 1 }));
+    QCOMPARE(matcher.match(u"STRAẞE"), Match({ 0, 6, 0 }));
+    // U+212A KELVIN SIGN folds to k
+    QCOMPARE(matcher.match(u"\u212Aelvin"), Match({ 0, 6, 2 }));
+    QCOMPARE(matcher.match(u"KELVIN"), Match({ 0, 6, 2 }));
+    QCOMPARE(matcher.indexIn(u"kelvi"), -1);
+
+    matcher.setCaseSensitivity(Qt::CaseSensitive);
+    QCOMPARE(matcher.indexIn(u"un été"), -1);
+    QCOMPARE(matcher.indexIn(u"KELVIN"), -1);
+}
+
+void tst_QMultiStringMatcher::caseInsensitiveSurrogates()
+{
+    // U+10400 DESERET CAPITAL LETTER LONG I folds to U+10428
+    const QString capital = QString::fromUcs4(U"\U00010400x");
+    const QString small = QString::fromUcs4(U"\U00010428x");
+    const QMultiStringMatcher matcher({ capital, u"\U00010401"_s }, Qt::CaseInsensitive);
+    QCOMPARE(matcher.match(u"ab"_s + small), Match({ 2, 3, 0 }));
+    QCOMPARE(matcher.match(u"ab"_s + capital), Match({ 2, 3, 0 }));
+    QCOMPARE(matcher.match(QString::fromUcs4(U"\U00010429")), Match({ 0, 2, 1 }));
+    // the pattern needs the whole pair
+    QCOMPARE(matcher.indexIn(small.first(1) + u"x"_s), -1);
+
+    const QMultiStringMatcher sensitive({ capital });
+    QCOMPARE(sensitive.indexIn(small), -1);
+    QCOMPARE(sensitive.indexIn(capital), 0);
+}
+
+void tst_QMultiStringMatcher::copyAndModify()
+{
+    QMultiStringMatcher matcher({ u"foo"_s });
+    QMultiStringMatcher copy = matcher;
+    matcher.setPatterns({ u"bar"_s });
+    QCOMPARE(copy.patterns(), QStringList{ u"foo"_s });
+    QCOMPARE(matcher.patterns(), QStringList{ u"bar"_s });
+    QCOMPARE(copy.indexIn(u"foobar"), 0);
+    QCOMPARE(matcher.indexIn(u"foobar"), 3);
+
+    QMultiStringMatcher moved = std::move(copy);
+    QCOMPARE(moved.indexIn(u"xfoo"), 1);
+    copy = moved;
+    QCOMPARE(copy.indexIn(u"xfoo"), 1);
+    moved.swap(matcher);
+    QCOMPARE(moved.indexIn(u"foobar"), 3);
+    QCOMPARE(matcher.indexIn(u"foobar"), 0);
+
+    // the case sensitivity applies to the later patterns too
+    QMultiStringMatcher later;
+    later.setCaseSensitivity(Qt::CaseInsensitive);
+    later.setPatterns({ u"foo"_s });
+    QCOMPARE(later.indexIn(u"xFOO"), 1);
+}
+
+void tst_QMultiStringMatcher::byteArrays()
+{
+    QMultiByteArrayMatcher matcher({ "he", "she", "his", "hers" });
+    const QList<Match> expected = {
+        { 1, 3, 1 },
+        { 2, 2, 0 },
+        { 2, 4, 3 },
+    };
+    QCOMPARE(matcher.matchAll("ushers"), expected);
+    QCOMPARE(matcher.matchAll("ushers"_L1), expected);
+    QCOMPARE(matcher.match("ushers"), Match({ 1, 3, 1 }));
+    QCOMPARE(matcher.indexIn("HIS his"), 4);
+    QCOMPARE(matcher.indexIn("HIS his", 5), -1);
+
+    // all byte values
+    QByteArray all(256, Qt::Uninitialized);
+    std::iota(all.begin(), all.end(), 0);
+    matcher.setPatterns({ all.sliced(250), QByteArray("\0\1", 2) });
+    QCOMPARE(matcher.match(QByteArray("xx\0\1", 4)), Match({ 2, 2, 1 }));
+    QCOMPARE(matcher.indexIn(all), 0);
+    QCOMPARE(matcher.indexIn(all, 1), 250);
+    QCOMPARE(matcher.patterns().size(), 2);
+}
+
+void tst_QMultiStringMatcher::byteArraysCaseInsensitive()
+{
+    const QMultiByteArrayMatcher matcher({ "Content-Length", "\xc9t\xc9" }, Qt::CaseInsensitive);
+    QCOMPARE(matcher.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(matcher.match("content-length: 42"), Match({ 0, 14, 0 }));
+    QCOMPARE(matcher.match("CONTENT-LENGTH: 42"), Match({ 0, 14, 0 }));
+    // Latin-1
+    QCOMPARE(matcher.match("un \xe9t\xe9"_L1), Match({ 3, 3, 1 }));
+    QCOMPARE(matcher.indexIn("un \xe9t"_L1), -1);
+}
+
+void tst_QMultiStringMatcher::compareWithNaiveSearch_data()
+{
+    QTest::addColumn<int>("patternCount");
+    QTest::addColumn<int>("alphabetSize");
+    QTest::addColumn<bool>("caseInsensitive");
+
+    QTest::newRow("few") << 3 << 3 << false;
+    QTest::newRow("many") << 200 << 4 << false;
+    QTest::newRow("large-alphabet") << 50 << 40 << false;
+    QTest::newRow("few-case-insensitive") << 3 << 3 << true;
+    QTest::newRow("many-case-insensitive") << 200 << 4 << true;
+}
+
+void tst_QMultiStringMatcher::compareWithNaiveSearch()
+{
+    QFETCH(int, patternCount);
+    QFETCH(int, alphabetSize);
+    QFETCH(bool, caseInsensitive);
+
+    const Qt::CaseSensitivity cs = caseInsensitive ? Qt::CaseInsensitive : Qt::CaseSensitive;
+    QRandomGenerator rng(patternCount * alphabetSize);
+    const auto randomString = [&](int maximumLength) {
+        QString s(rng.bounded(1, maximumLength + 1), Qt::Uninitialized);
+        for (QChar &c : s) {
+            c = QLatin1Char(char('a' + rng.bounded(alphabetSize)));
+            if (caseInsensitive && rng.bounded(2))
+                c = c.toUpper();
+        }
+        return s;
+    };
+
+    QStringList patterns;
+    for (int i = 0; i < patternCount; ++i)
+        patterns.append(randomString(8));
+    const QMultiStringMatcher matcher(patterns, cs);
+    QByteArrayList bytePatterns;
+    for (const QString &pattern : patterns)
+        bytePatterns.append(pattern.toLatin1());
+    const QMultiByteArrayMatcher byteMatcher(bytePatterns, cs);
+
+    for (int round = 0; round < 20; ++round) {
+        const QString haystack = randomString(300);
+        QList<Match> expected;
+        for (qsizetype end = 1; end <= haystack.size(); ++end) {
+            QList<Match> endingHere;
+            for (qsizetype p = 0; p < patterns.size(); ++p) {
+                const QString &pattern = patterns.at(p);
+                if (pattern.size() <= end
+                        && QStringView(haystack).sliced(end - pattern.size(), pattern.size())
+                                   .compare(pattern, cs) == 0) {
+                    endingHere.append({ end - pattern.size(), pattern.size(), p });
+                }
+            }
+            std::stable_sort(endingHere.begin(), endingHere.end(),
+                             [](const Match &lhs, const Match &rhs) {
+                return lhs.length > rhs.length;
+            });
+            expected += endingHere;
+        }
+
+        QCOMPARE(matcher.matchAll(haystack), expected);
+        QCOMPARE(byteMatcher.matchAll(haystack.toLatin1()), expected);
+
+        Match leftmost;
+        for (const Match &m : std::as_const(expected)) {
+            if (!leftmost.isValid() || m.position < leftmost.position
+                    || (m.position == leftmost.position && m.length > leftmost.length)) {
+                leftmost = m;
+            }
+        }
+        QCOMPARE(matcher.match(haystack), leftmost);
+        QCOMPARE(byteMatcher.match(haystack.toLatin1()), leftmost);
+
+        const qsizetype from = rng.bounded(haystack.size());
+        const qsizetype firstFrom = std::accumulate(expected.cbegin(), expected.cend(),
+                                                    qsizetype(-1),
+                                                    [&](qsizetype first, const Match &m) {
+            return m.position >= from && (first < 0 || m.position < first) ? m.position : first;
+        });
+        QCOMPARE(matcher.indexIn(haystack, from), firstFrom);
+        QCOMPARE(byteMatcher.indexIn(haystack.toLatin1(), from), firstFrom);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QMultiStringMatcher)
+#include "tst_qmultistringmatcher.moc"
@@ -0,0 +1,239 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qnumberformatter.h>
+#include <QTest>
+
+#include <limits>
+
+using namespace Qt::StringLiterals;
+
+class tst_QNumberFormatter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void integers_data();
+    void integers();
+    void doubles_data();
+    void doubles();
+    void otherTypes();
+    void spans();
+    void sharing();
+};
+
+static QList<double> doubleSamples()
+{
+    using D = std::numeric_limits<double>;
+    return { 0.0, -0.0, 1.0, -1.0, 0.1, -0.5, 2.5, 9.995, 99.5, 999999.5, 1234567.0, 12345.678,
+             -98765.4321, 1e-5, 1.5e-7, 0.000123, 1e15, 1e21, 123456789012.0, 1e100, -1e-100,
+             D::max(), D::min(), D::denorm_min(), D::epsilon(), 1.0 / 3, 2.0 / 3, 4e-3,
+             D::infinity(), -D::infinity(), D::quiet_NaN() };
+}
+
+static QList<qlonglong> integerSamples()
+{
+    using L = std::numeric_limits<qlonglong>;
+    return { 0, 1, -1, 7, 12, -123, 1000, 12345, -123456, 1234567, 100000000, -2147483648LL,
+             1234567890123LL, L::max(), L::min() };
+}
+
+static void addLocales()
+{
+    QTest::addColumn<QLocale>("locale");
+
+    // Different digits, separators, signs, exponents and grouping:
+    for (const char *name : { "C", "en_US", "de_DE", "fr_FR", "de_CH", "es_ES", "hi_IN",
+                              "ar_EG", "fa_IR", "sv_SE", "se_NO", "ccp" }) {
+        QLocale locale(QString::fromLatin1(name));
+        QTest::newRow(name) << locale;
+        locale.setNumberOptions(QLocale::OmitGroupSeparator | QLocale::OmitLeadingZeroInExponent
+                                | QLocale::IncludeTrailingZeroesAfterDot);
+        QTest::addRow("%s-options", name) << locale;
+    }
+    QLocale c = QLocale::c();
+    c.setNumberOptions(QLocale::DefaultNumberOptions);
+    QTest::newRow("C-grouping") << c;
+}
+
+void tst_QNumberFormatter::basics()
+{
+    const QNumberFormatter formatter;
+    QCOMPARE(formatter.locale(), QLocale());
+    QCOMPARE(formatter.doubleFormat(), 'g');
+    QCOMPARE(formatter.doublePrecision(), 6);
+
+    QNumberFormatter german(QLocale(QLocale::German, QLocale::Germany));
+    QCOMPARE(german.toString(1234567), "1.234.567"_L1);
+    QCOMPARE(german.toString(-1234.5), "-1.234,5"_L1);
+    german.setDoubleFormat('f', 2);
+    QCOMPARE(german.doubleFormat(), 'f');
+    QCOMPARE(german.doublePrecision(), 2);
+    QCOMPARE(german.toString(1234.5), "1.234,50"_L1);
+
+    german.setLocale(QLocale::c());
+    QCOMPARE(german.locale(), QLocale::c());
+    QCOMPARE(german.doubleFormat(), 'f');
+    QCOMPARE(german.toString(1234.5), "1234.50"_L1);
+
+    QString str = u"x="_s;
+    german.appendTo(str, 3);
+    QCOMPARE(str, "x=3"_L1);
+    QByteArray utf8 = "y=";
+    german.appendTo(utf8, 2.5);
+    QCOMPARE(utf8, "y=2.50");
+}
+
+void tst_QNumberFormatter::integers_data()
+{
+    addLocales();
+}
+
+void tst_QNumberFormatter::integers()
+{
+    QFETCH(const QLocale, locale);
+    const QNumberFormatter formatter(locale);
+
+    for (qlonglong i : integerSamples()) {
+        const QString expected = locale.toString(i);
+        QCOMPARE(formatter.toString(i), expected);
+        QByteArray utf8 = "prefix";
+        formatter.appendTo(utf8, i);
+        QCOMPARE(utf8, "prefix" + expected.toUtf8());
+        if (i >= 0)
+            QCOMPARE(formatter.toString(qulonglong(i)), expected);
+        if (int(i) == i)
+            QCOMPARE(formatter.toString(int(i)), locale.toString(int(i)));
+    }
+    const qulonglong max = std::numeric_limits<qulonglong>::max();
+    QCOMPARE(formatter.toString(max), locale.toString(max));
+}
+
+void tst_QNumberFormatter::doubles_data()
+{
+    addLocales();
+}
+
+void tst_QNumberFormatter::doubles()
+{
+    QFETCH(const QLocale, locale);
+    QNumberFormatter formatter(locale);
+
+    for (char format : { 'e', 'E', 'f', 'F', 'g', 'G' }) {
+        for (int precision : { 6, 0, 1, 3, 17, -1, int(QLocale::FloatingPointShortest) }) {
+            formatter.setDoubleFormat(format, precision);
+            for (double d : doubleSamples()) {
+                if (toupper(format) == 'F' && qAbs(d) > 1e100 && precision > 3)
+                    continue; // too slow, and nothing new
+                const QString expected = locale.toString(d, format, precision);
+                const QString actual = formatter.toString(d);
+                if (actual != expected) {
+                    qWarning() << "format" << format << "precision" << precision
+                               << "value" << d;
+                }
+                QCOMPARE(actual, expected);
+                QByteArray utf8;
+                formatter.appendTo(utf8, d);
+                QCOMPARE(utf8, expected.toUtf8());
+            }
+        }
+    }
+}
+
+void tst_QNumberFormatter::otherTypes()
+{
+    const QLocale locale(QLocale::German, QLocale::Germany);
+    const QNumberFormatter formatter(locale);
+
+    const auto check = [&](auto value) {
+        const QString expected = locale.toString(value);
+        QCOMPARE(formatter.toString(value), expected);
+        QString str = u"x"_s;
+        formatter.appendTo(str, value);
+        QCOMPARE(str, u'x' + expected);
+        QByteArray utf8 = "x";
+        formatter.appendTo(utf8, value);
+        QCOMPARE(utf8, 'x' + expected.toUtf8());
+    };
+    check(short(-12345));
+    check(std::numeric_limits<ushort>::max());
+    check(42u);
+    check(std::numeric_limits<uint>::max());
+    check(std::numeric_limits<long>::min());
+    check(std::numeric_limits<ulong>::max());
+    check(1234.5f);
+    check(0.1f);
+    if (QTest::currentTestFailed())
+        return;
+    QCOMPARE(formatter.toString(42u), "42"_L1);
+    QCOMPARE(formatter.toString(1234.5f), "1.234,5"_L1);
+}
+
+void tst_QNumberFormatter::spans()
+{
+    const QLocale locale(QLocale::French, QLocale::France);
+    QNumberFormatter formatter(locale);
+    formatter.setDoubleFormat('g', QLocale::FloatingPointShortest);
+
+    const QList<double> doubles = doubleSamples();
+    const QList<qlonglong> longs = integerSamples();
+    const QList<int> ints = { 1, -22, 333, 4444, 55555 };
+
+    QString expectedDoubles;
+    for (double d : doubles)
+        expectedDoubles += locale.toString(d, 'g', QLocale::FloatingPointShortest) + u"; "_s;
+    expectedDoubles.chop(2);
+    QString expectedLongs;
+    for (qlonglong i : longs)
+        expectedLongs += locale.toString(i) + u'\n';
+    expectedLongs.chop(1);
+
+    QString str;
+    formatter.appendTo(str, doubles, u"; ");
+    QCOMPARE(str, expectedDoubles);
+    str.clear();
+    formatter.appendTo(str, longs, "\n");
+    QCOMPARE(str, expectedLongs);
+    str.clear();
+    formatter.appendTo(str, ints, u8"¦");
+    QCOMPARE(str, u"1¦-22¦333¦4 444¦55 555"_s);
+
+    QByteArray utf8 = "[";
+    formatter.appendTo(utf8, doubles, u"; ");
+    QCOMPARE(utf8, '[' + expectedDoubles.toUtf8());
+    utf8.clear();
+    formatter.appendTo(utf8, longs, "\n"_L1);
+    QCOMPARE(utf8, expectedLongs.toUtf8());
+
+    // empty spans append nothing
+    str = u"unchanged"_s;
+    formatter.appendTo(str, QList<int>(), u",");
+    QCOMPARE(str, "unchanged"_L1);
+    utf8 = "unchanged";
+    formatter.appendTo(utf8, QList<double>(), u",");
+    QCOMPARE(utf8, "unchanged");
+}
+
+void tst_QNumberFormatter::sharing()
+{
+    QNumberFormatter formatter(QLocale::c());
+    QNumberFormatter copy = formatter;
+    copy.setDoubleFormat('e', 2);
+    QCOMPARE(formatter.doubleFormat(), 'g');
+    QCOMPARE(formatter.toString(1234.5), "1234.5"_L1);
+    QCOMPARE(copy.toString(1234.5), "1.23e+03"_L1);
+
+    copy.setLocale(QLocale(QLocale::German));
+    QCOMPARE(formatter.locale(), QLocale::c());
+    QCOMPARE(copy.toString(1234.5), "1,23E+03"_L1);
+
+    formatter = copy;
+    QCOMPARE(formatter.toString(1234.5), "1,23E+03"_L1);
+    formatter.swap(copy);
+    QCOMPARE(copy.locale(), QLocale(QLocale::German));
+}
+
+QTEST_MAIN(tst_QNumberFormatter)
+
+#include "tst_qnumberformatter.moc"
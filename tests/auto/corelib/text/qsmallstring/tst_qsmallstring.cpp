@@ -0,0 +1,222 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/private/qcomparisontesthelper_p.h>
+#include <QTest>
+
+#include <QSmallString>
+#include <QHash>
+
+#include <utility>
+
+using namespace Qt::StringLiterals;
+
+class tst_QSmallString : public QObject
+{
+    Q_OBJECT
+private slots:
+    void layout();
+    void construct_data();
+    void construct();
+    void fromUtf8_data();
+    void fromUtf8();
+    void copyAndMove();
+    void swap();
+    void sharesLongStrings();
+    void comparisonCompiles();
+    void comparison_data();
+    void comparison();
+    void hash();
+};
+
+void tst_QSmallString::layout()
+{
+    static_assert(sizeof(QSmallString) == 32);
+    static_assert(QSmallString::InlineCapacity == 15);
+    static_assert(std::is_nothrow_move_constructible_v<QSmallString>);
+    static_assert(std::is_nothrow_move_assignable_v<QSmallString>);
+    static_assert(QTypeInfo<QSmallString>::isRelocatable);
+
+    const QSmallString empty;
+    QVERIFY(empty.isEmpty());
+    QVERIFY(empty.isInline());
+    QCOMPARE(empty.size(), 0);
+    QCOMPARE(empty.begin(), empty.end());
+}
+
+void tst_QSmallString::construct_data()
+{
+    QTest::addColumn<QString>("string");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("one") << u"a"_s;
+    QTest::newRow("14") << u"abcdefghijklmn"_s;
+    QTest::newRow("15") << u"abcdefghijklmno"_s;
+    QTest::newRow("16") << u"abcdefghijklmnop"_s;
+    QTest::newRow("long") << QString(100, u'x');
+    QTest::newRow("non-latin1") << u"été € \U0001F600"_s;
+}
+
+void tst_QSmallString::construct()
+{
+    QFETCH(QString, string);
+    const bool inlined = string.size() <= QSmallString::InlineCapacity;
+
+    auto check = [&](const QSmallString &s) {
+        QCOMPARE(s.size(), string.size());
+        QCOMPARE(s.isEmpty(), string.isEmpty());
+        QCOMPARE(s.isInline(), inlined);
+        QCOMPARE(s.view(), string);
+        QCOMPARE(QStringView(s), string);
+        QCOMPARE(s.toString(), string);
+        QCOMPARE(s.toUtf8(), string.toUtf8());
+        if (!s.isEmpty()) {
+            QCOMPARE(s.front(), string.front());
+            QCOMPARE(s.back(), string.back());
+            QCOMPARE(s[1 % s.size()], string[1 % s.size()]);
+        }
+        QVERIFY(std::equal(s.begin(), s.end(), string.cbegin(), string.cend()));
+        QVERIFY(std::equal(s.rbegin(), s.rend(), string.crbegin(), string.crend()));
+    };
+
+    check(QSmallString(string));
+    check(QSmallString(QStringView(string)));
+    check(QSmallString(QString(string)));
+    if (QtPrivate::isLatin1(QStringView(string))) {
+        const QByteArray latin1 = string.toLatin1();
+        check(QSmallString(QLatin1StringView(latin1)));
+        check(QSmallString::fromLatin1(QLatin1StringView(latin1)));
+    }
+}
+
+void tst_QSmallString::fromUtf8_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+    QTest::addColumn<bool>("inlined");
+
+    QTest::newRow("empty") << QByteArray() << true;
+    QTest::newRow("ascii-15") << "abcdefghijklmno"_ba << true;
+    QTest::newRow("ascii-16") << "abcdefghijklmnop"_ba << false;
+    // 30 bytes of UTF-8, but only 15 UTF-16 code units
+    QTest::newRow("2-byte-sequences") << QString(15, u'é').toUtf8() << true;
+    QTest::newRow("surrogate-pair") << u"\U0001F600\U0001F600"_s.toUtf8() << true;
+    QTest::newRow("invalid") << "a\xffz"_ba << true;
+}
+
+void tst_QSmallString::fromUtf8()
+{
+    QFETCH(QByteArray, utf8);
+    QFETCH(bool, inlined);
+
+    const QSmallString s = QSmallString::fromUtf8(utf8);
+    QCOMPARE(s.view(), QString::fromUtf8(utf8));
+    QCOMPARE(s.isInline(), inlined);
+}
+
+void tst_QSmallString::copyAndMove()
+{
+    for (const QString &string : { u"short"_s, QString(40, u'y') }) {
+        QSmallString s(string);
+        QSmallString copy = s;
+        QCOMPARE(copy, s);
+
+        QSmallString moved = std::move(copy);
+        QCOMPARE(moved, s);
+        QVERIFY(copy.isEmpty()); // NOLINT(bugprone-use-after-move)
+
+        QSmallString assigned(u"something else"_s);
+        assigned = s;
+        QCOMPARE(assigned, s);
+        assigned = QSmallString(QString(20, u'z'));
+        QCOMPARE(assigned, QString(20, u'z'));
+        assigned = std::move(moved);
+        QCOMPARE(assigned, s);
+
+        assigned = assigned; // self-assignment
+        QCOMPARE(assigned, s);
+
+        assigned.clear();
+        QVERIFY(assigned.isEmpty());
+        QVERIFY(assigned.isInline());
+    }
+}
+
+void tst_QSmallString::swap()
+{
+    const QString shortString = u"short"_s;
+    const QString longString(40, u'y');
+    QSmallString a(shortString);
+    QSmallString b(longString);
+    a.swap(b);
+    QCOMPARE(a, longString);
+    QCOMPARE(b, shortString);
+    std::swap(a, b);
+    QCOMPARE(a, shortString);
+    QCOMPARE(b, longString);
+}
+
+void tst_QSmallString::sharesLongStrings()
+{
+    const QString longString(40, u'y');
+    const QSmallString s(longString);
+    QCOMPARE(s.data(), longString.data());
+    const QSmallString copy = s;
+    QCOMPARE(copy.data(), longString.data());
+    QVERIFY(copy.toString().isSharedWith(longString));
+}
+
+void tst_QSmallString::comparisonCompiles()
+{
+    QTestPrivate::testAllComparisonOperatorsCompile<QSmallString>();
+    QTestPrivate::testAllComparisonOperatorsCompile<QSmallString, QStringView>();
+    QTestPrivate::testAllComparisonOperatorsCompile<QSmallString, QLatin1StringView>();
+}
+
+void tst_QSmallString::comparison_data()
+{
+    QTest::addColumn<QString>("lhs");
+    QTest::addColumn<QString>("rhs");
+    QTest::addColumn<Qt::strong_ordering>("ordering");
+
+    QTest::newRow("empty") << QString() << QString() << Qt::strong_ordering::equal;
+    QTest::newRow("equal") << u"abc"_s << u"abc"_s << Qt::strong_ordering::equal;
+    QTest::newRow("less") << u"abc"_s << u"abd"_s << Qt::strong_ordering::less;
+    QTest::newRow("prefix") << u"abc"_s << u"ab"_s << Qt::strong_ordering::greater;
+    QTest::newRow("short-long") << u"abc"_s << QString(20, u'a') << Qt::strong_ordering::greater;
+    QTest::newRow("long-long") << QString(20, u'a') << QString(20, u'a')
+                               << Qt::strong_ordering::equal;
+}
+
+void tst_QSmallString::comparison()
+{
+    QFETCH(QString, lhs);
+    QFETCH(QString, rhs);
+    QFETCH(Qt::strong_ordering, ordering);
+
+    const QSmallString s(lhs);
+    QT_TEST_ALL_COMPARISON_OPS(s, QSmallString(rhs), ordering);
+    if (QTest::currentTestFailed())
+        return;
+    QT_TEST_ALL_COMPARISON_OPS(s, QStringView(rhs), ordering);
+    if (QTest::currentTestFailed())
+        return;
+    const QByteArray latin1 = rhs.toLatin1();
+    QT_TEST_ALL_COMPARISON_OPS(s, QLatin1StringView(latin1), ordering);
+}
+
+void tst_QSmallString::hash()
+{
+    for (const QString &string : { QString(), u"short"_s, QString(40, u'y') }) {
+        QCOMPARE(qHash(QSmallString(string)), qHash(string));
+        QCOMPARE(qHash(QSmallString(string), 42), qHash(string, 42));
+    }
+
+    QHash<QSmallString, int> hash;
+    hash.insert(QSmallString(u"one"_s), 1);
+    hash.insert(QSmallString(QString(20, u'2')), 2);
+    QCOMPARE(hash.value(QSmallString(u"one"_s)), 1);
+    QCOMPARE(hash.value(QSmallString(QString(20, u'2'))), 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QSmallString)
+#include "tst_qsmallstring.moc"
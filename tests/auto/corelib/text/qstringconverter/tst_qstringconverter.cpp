@@ -179,6 +179,13 @@ private slots:
     void utf8stateful_data();
     void utf8stateful();
 
+    void utf8LongText_data();
+    void utf8LongText();
+    void utf8LongTextInvalid_data() { utf8LongText_data(); }
+    void utf8LongTextInvalid();
+    void utf8EncodeBufferEnd_data() { utf8LongText_data(); }
+    void utf8EncodeBufferEnd();
+
     void utfHeaders_data();
     void utfHeaders();
 
@@ -2025,6 +2032,178 @@ void tst_QStringConverter::utf8stateful()
     }
 }
 
+// Encodes without QUtf8, to check it
+static QByteArray referenceUtf8(QStringView text)
+{
+    QByteArray result;
+    for (char32_t c : text.toUcs4()) {
+        if (c < 0x80) {
+            result += char(c);
+        } else if (c < 0x800) {
+            result += char(0xc0 | c >> 6);
+            result += char(0x80 | (c & 0x3f));
+        } else if (c < 0x10000) {
+            result += char(0xe0 | c >> 12);
+            result += char(0x80 | ((c >> 6) & 0x3f));
+            result += char(0x80 | (c & 0x3f));
+        } else {
+            result += char(0xf0 | c >> 18);
+            result += char(0x80 | ((c >> 12) & 0x3f));
+            result += char(0x80 | ((c >> 6) & 0x3f));
+            result += char(0x80 | (c & 0x3f));
+        }
+    }
+    return result;
+}
+
+void tst_QStringConverter::utf8LongText_data()
+{
+    // long enough for the SIMD code to process several blocks
+    QTest::addColumn<QString>("text");
+
+    auto addRow = [](const char *name, QStringView sample) {
+        QString text;
+        while (text.size() < 200)
+            text += sample;
+        QTest::newRow(name) << text;
+    };
+    addRow("ascii", u"The quick brown fox jumps over the lazy dog. ");
+    addRow("latin1", u"Hyvää päivää, käyhän että tuon kannettavani saunaan? ");
+    addRow("cyrillic", u"Съешь же ещё этих мягких французских булок, да выпей чаю.");
+    addRow("greek", u"Ξεσκεπάζω τὴν ψυχοφθόρα βδελυγμία");
+    addRow("cjk", u"私はガラスを食べられます。それは私を傷つけません。");
+    addRow("mixed-bmp", u"abc\u00a0Σж\u07ff\u0800中文€\ud7ff\ue000\ufeff\uffff");
+    addRow("mixed-full", u"a😂Ж😃中🌍\U0010FFFD€");
+    addRow("emojis", u"😂😃🧘🏻‍♂️🌍🌦️🍞🚗📞🎉❤️🏁");
+}
+
+void tst_QStringConverter::utf8LongText()
+{
+    QFETCH(const QString, text);
+
+    // start at different offsets, for the blocks of the SIMD code to end
+    // at different places in the characters
+    for (qsizetype from = 0; from < 16; ++from) {
+        const QStringView s = QStringView(text).sliced(from);
+        if (s.front().isLowSurrogate())
+            continue;
+        const QByteArray utf8 = referenceUtf8(s);
+
+        if (!s.startsWith(u'\ufeff'))   // else it's taken for a BOM
+            QCOMPARE(QString::fromUtf8(utf8), s);
+        QCOMPARE(s.toUtf8(), utf8);
+        QStringEncoder encoder(QStringEncoder::Utf8);
+        QCOMPARE(QByteArray(encoder.encode(s)), utf8);
+        QStringDecoder decoder(QStringDecoder::Utf8, QStringDecoder::Flag::ConvertInitialBom);
+        QCOMPARE(QString(decoder.decode(utf8)), s);
+        QVERIFY(utf8.isValidUtf8());
+    }
+
+    // the state must carry the characters cut by the end of a chunk
+    const QByteArray utf8 = referenceUtf8(text);
+    for (qsizetype split = 0; split <= utf8.size(); ++split) {
+        QStringDecoder decoder(QStringDecoder::Utf8);
+        QString decoded = decoder.decode(QByteArrayView(utf8).first(split));
+        decoded += decoder.decode(QByteArrayView(utf8).sliced(split));
+        QVERIFY(!decoder.hasError());
+        QCOMPARE(decoded, text);
+    }
+    for (qsizetype split = 0; split <= text.size(); ++split) {
+        QStringEncoder encoder(QStringEncoder::Utf8);
+        QByteArray encoded = encoder.encode(QStringView(text).first(split));
+        encoded += encoder.encode(QStringView(text).sliced(split));
+        QVERIFY(!encoder.hasError());
+        QCOMPARE(encoded, utf8);
+    }
+}
+
+void tst_QStringConverter::utf8EncodeBufferEnd()
+{
+    QFETCH(const QString, text);
+
+    // Encoding never takes more than three bytes per UTF-16 code unit, so
+    // nothing may be written past that, whatever the SIMD code does.
+    constexpr char Canary = char(0xa5);
+    for (qsizetype size = 1; size <= 64; ++size) {
+        for (qsizetype from = 0; from < 8; ++from) {
+            const QStringView s = QStringView(text).sliced(from, size);
+            if (s.front().isLowSurrogate() || s.back().isHighSurrogate())
+                continue;
+            QStringEncoder encoder(QStringEncoder::Utf8, QStringEncoder::Flag::Stateless);
+            QByteArray buffer(encoder.requiredSpace(size) + 32, Canary);
+            char *end = encoder.appendToBuffer(buffer.data(), s);
+            const QByteArray expected = referenceUtf8(s);
+            QCOMPARE(QByteArrayView(buffer.data(), end), expected);
+            for (qsizetype i = 3 * size; i < buffer.size(); ++i)
+                QCOMPARE(buffer.at(i), Canary);
+        }
+    }
+}
+
+void tst_QStringConverter::utf8LongTextInvalid()
+{
+    QFETCH(const QString, text);
+    const QByteArray utf8 = referenceUtf8(text);
+
+    // The stateless decoding of a character doesn't depend on what follows
+    // its continuation bytes, so it must be the same if decoded alone
+    auto decodeCharByChar = [](QByteArrayView data) {
+        QStringDecoder decoder(QStringDecoder::Utf8, QStringDecoder::Flag::Stateless
+                               | QStringDecoder::Flag::ConvertInitialBom);
+        QString result;
+        qsizetype start = 0;
+        for (qsizetype i = 1; i <= data.size(); ++i) {
+            if (i == data.size() || (uchar(data[i]) & 0xc0) != 0x80) {
+                result += decoder.decode(data.sliced(start, i - start));
+                start = i;
+            }
+        }
+        return result;
+    };
+
+    for (qsizetype i = 0; i < utf8.size(); ++i) {
+        for (char c : { '\xff', '\x80', '\xc0', '\xe0', '\xed', '\xf4' }) {
+            QByteArray corrupted = utf8;
+            corrupted[i] = c;
+            QCOMPARE(QString::fromUtf8(corrupted), decodeCharByChar(corrupted));
+            if (c == '\xff') {
+                QVERIFY(!corrupted.isValidUtf8());
+                QStringDecoder decoder(QStringDecoder::Utf8);
+                const QString decoded = decoder.decode(corrupted);
+                QVERIFY(decoder.hasError());
+            } else {
+                QCOMPARE(corrupted.isValidUtf8(),
+                         !QString::fromUtf8(corrupted).contains(QChar::ReplacementCharacter));
+            }
+        }
+
+        const QByteArrayView truncated = QByteArrayView(utf8).first(i);
+        QCOMPARE(QString::fromUtf8(truncated), decodeCharByChar(truncated));
+        QCOMPARE(QUtf8StringView(truncated).isValidUtf8(),
+                 !QString::fromUtf8(truncated).contains(QChar::ReplacementCharacter));
+    }
+
+    QString unpaired = text;
+    for (qsizetype i = 0; i < unpaired.size(); i += 7)
+        unpaired[i] = QChar(char16_t(0xd800 + (i & 0x7ff)));
+    QStringEncoder encoder(QStringEncoder::Utf8, QStringEncoder::Flag::Stateless);
+    const QByteArray encoded = encoder.encode(unpaired);
+    QVERIFY(encoder.hasError());
+    QString expected;
+    for (qsizetype i = 0; i < unpaired.size(); ++i) {
+        if (unpaired.at(i).isSurrogate() && !(unpaired.at(i).isHighSurrogate() && i + 1 < unpaired.size()
+                                              && unpaired.at(i + 1).isLowSurrogate())) {
+            expected += QChar::ReplacementCharacter;
+        } else if (unpaired.at(i).isHighSurrogate()) {
+            expected += unpaired.sliced(i, 2);
+            ++i;
+        } else {
+            expected += unpaired.at(i);
+        }
+    }
+    QCOMPARE(encoded, referenceUtf8(expected));
+}
+
 void tst_QStringConverter::utfHeaders_data()
 {
     QTest::addColumn<QStringConverter::Encoding>("encoding");
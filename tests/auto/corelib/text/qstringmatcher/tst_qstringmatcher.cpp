@@ -13,6 +13,7 @@ private slots:
     void caseSensitivity();
     void indexIn_data();
     void indexIn();
+    void needleLengths();
     void setCaseSensitivity_data();
     void setCaseSensitivity();
     void assignOperator();
@@ -83,6 +84,48 @@ void tst_QStringMatcher::indexIn()
     QCOMPARE(matcherSV.indexIn(QStringView(haystack), from), indexIn);
 }
 
+void tst_QStringMatcher::needleLengths()
+{
+    // Short needles are searched with vectors of 8 or 16 characters, and the
+    // longer ones with the skip table: check all the needle lengths around
+    // these sizes, with matches at all the positions, against a naive search.
+    // A two-letter alphabet makes many positions match the first and the last
+    // character of the needle, but not its middle. The characters differ only
+    // in their high byte, to check that the comparisons use the whole of them.
+    uint seed = 42;
+    const auto nextLetter = [&seed] {
+        seed = seed * 1103515245 + 12345;
+        return QChar((seed >> 16) & 1 ? u'\u0161' : u'\u0461');
+    };
+    const auto naiveIndexIn = [](QStringView haystack, QStringView needle, qsizetype from) {
+        for (qsizetype i = from; i <= haystack.size() - needle.size(); ++i) {
+            if (haystack.sliced(i, needle.size()) == needle)
+                return i;
+        }
+        return qsizetype(-1);
+    };
+
+    for (qsizetype needleLength = 1; needleLength <= 40; ++needleLength) {
+        QString needle(needleLength, Qt::Uninitialized);
+        for (QChar &c : needle)
+            c = nextLetter();
+        const QStringMatcher matcher(needle);
+        for (qsizetype haystackLength = needleLength - 1; haystackLength <= needleLength + 40;
+             ++haystackLength) {
+            QString haystack(haystackLength, Qt::Uninitialized);
+            for (QChar &c : haystack)
+                c = nextLetter();
+            for (qsizetype pos = 0; pos <= haystackLength - needleLength; pos += 3) {
+                QString planted = haystack;
+                planted.replace(pos, needleLength, needle);
+                for (qsizetype from : { qsizetype(0), pos / 2, pos, pos + 1 })
+                    QCOMPARE(matcher.indexIn(planted, from), naiveIndexIn(planted, needle, from));
+            }
+            QCOMPARE(matcher.indexIn(haystack), naiveIndexIn(haystack, needle, 0));
+        }
+    }
+}
+
 void tst_QStringMatcher::setCaseSensitivity_data()
 {
     QTest::addColumn<QString>("needle");
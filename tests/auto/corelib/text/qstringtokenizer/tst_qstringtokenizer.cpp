@@ -3,11 +3,15 @@
 
 #include <QStringTokenizer>
 #include <QStringBuilder>
+#include <QSpan>
+#include <QVarLengthArray>
 
 #include <QTest>
 
 #include <string>
 
+using namespace Qt::StringLiterals;
+
 Q_DECLARE_METATYPE(Qt::SplitBehavior)
 namespace {
 class tst_QStringTokenizer : public QObject
@@ -19,6 +23,8 @@ private Q_SLOTS:
     void basics_data() const;
     void basics() const;
     void toContainer() const;
+    void tokenizeInto_data() const;
+    void tokenizeInto() const;
 };
 
 static QStringList skipped(const QStringList &sl)
@@ -37,6 +43,11 @@ QString toQString(QStringView str)
     return str.toString();
 }
 
+QString toQString(QLatin1StringView str)
+{
+    return str.toString();
+}
+
 template <typename Container>
 QStringList toQStringList(const Container &c)
 {
@@ -136,5 +147,82 @@ void tst_QStringTokenizer::toContainer() const
     }
 }
 
+void tst_QStringTokenizer::tokenizeInto_data() const
+{
+    QTest::addColumn<QString>("haystack");
+    QTest::addColumn<Qt::SplitBehavior>("sb");
+
+    const auto addRows = [](const char *name, const QString &haystack) {
+        QTest::addRow("%s/keep", name) << haystack << Qt::SplitBehavior{Qt::KeepEmptyParts};
+        QTest::addRow("%s/skip", name) << haystack << Qt::SplitBehavior{Qt::SkipEmptyParts};
+    };
+    addRows("empty", QString());
+    addRows("no-separator", u"abcdefghijklmnopqrstuvwxyz"_s);
+    addRows("only-separators", QString(40, u','));
+    addRows("short", u",a,b,,c,"_s);
+    addRows("csv", u"id,name,,value,1.5\n"_s.repeated(7));
+
+    // put the separators at every position of the SIMD blocks
+    QString blocks;
+    for (int i = 0; i < 40; ++i)
+        blocks += QString(i, u'x') + u',';
+    addRows("blocks", blocks);
+    addRows("non-latin1", u"Ä,ö,Ц,ⅷ,€"_s.repeated(5));
+}
+
+void tst_QStringTokenizer::tokenizeInto() const
+{
+    QFETCH(const QString, haystack);
+    QFETCH(const Qt::SplitBehavior, sb);
+
+    const auto expected = qTokenize(haystack, u',', sb).toContainer();
+    const qsizetype n = expected.size();
+
+    // exactly the right size
+    {
+        QVarLengthArray<QStringView> out(n);
+        QCOMPARE(qTokenize(haystack, u',', sb).tokenizeInto(out), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.end()), expected);
+    }
+    // too small: the first tokens are stored, the total is returned
+    {
+        QVarLengthArray<QStringView> out(n / 2);
+        QCOMPARE(qTokenize(haystack, u',', sb).tokenizeInto(QSpan(out)), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.end()), expected.first(n / 2));
+    }
+    // larger: the remaining elements are untouched
+    {
+        QVarLengthArray<QStringView> out(n + 3, u"untouched");
+        QCOMPARE(qTokenize(haystack, u',', sb).tokenizeInto(out), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.begin() + n), expected);
+        QCOMPARE(out.back(), u"untouched");
+    }
+    // Latin-1 needle, case-insensitive, and multi-character separators go
+    // through the generic code
+    {
+        QVarLengthArray<QStringView> out(n);
+        QCOMPARE(qTokenize(haystack, ","_L1, sb).tokenizeInto(out), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.end()), expected);
+        QCOMPARE(qTokenize(haystack, u',', sb, Qt::CaseInsensitive).tokenizeInto(out), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.end()), expected);
+
+        const QString doubled = QString(haystack).replace(u',', u",;"_s);
+        QCOMPARE(qTokenize(doubled, u",;", sb).tokenizeInto(out), n);
+        QCOMPARE(QList<QStringView>(out.begin(), out.end()), expected);
+    }
+    // Latin-1 haystack
+    if (QtPrivate::isLatin1(haystack)) {
+        const QByteArray latin1 = haystack.toLatin1();
+        QVarLengthArray<QLatin1StringView> out(n);
+        QCOMPARE(qTokenize(QLatin1StringView(latin1), u',', sb).tokenizeInto(out), n);
+        QCOMPARE(toQStringList(out), toQStringList(expected));
+
+        // a separator that isn't in Latin-1 can't match anything
+        QLatin1StringView whole[1];
+        QCOMPARE(qTokenize(QLatin1StringView(latin1), u'€').tokenizeInto(whole), 1);
+        QCOMPARE(whole[0], QLatin1StringView(latin1));
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_QStringTokenizer)
 #include "tst_qstringtokenizer.moc"
@@ -0,0 +1,349 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+#include <qcoroutine.h>
+#include <qexception.h>
+#include <qpromise.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+using namespace Qt::StringLiterals;
+
+class Emitter : public QObject
+{
+    Q_OBJECT
+signals:
+    void noArguments();
+    void oneArgument(int value);
+    void twoArguments(int value, const QString &text);
+};
+
+class tst_QCoroutine : public QObject
+{
+    Q_OBJECT
+private slots:
+    void readyFuture();
+    void futureFinishedInSameThread();
+    void futureFinishedInOtherThread();
+    void voidFuture();
+#ifndef QT_NO_EXCEPTIONS
+    void futureException();
+    void taskException();
+#endif
+    void signalWithoutArguments();
+    void signalWithArgument();
+    void signalWithArguments();
+    void signalFromOtherThread();
+    void nestedTasks();
+    void detachedTask();
+    void resumeInWorkerThread();
+};
+
+static QCoroTask<int> addOne(QFuture<int> future)
+{
+    const int value = co_await future;
+    co_return value + 1;
+}
+
+static QCoroTask<> storeResult(QCoroTask<int> task, std::optional<int> *result)
+{
+    *result = co_await task;
+}
+
+static QCoroTask<> awaitFuture(QFuture<int> future, int *value, QThread **resumedIn)
+{
+    *value = co_await future;
+    *resumedIn = QThread::currentThread();
+}
+
+void tst_QCoroutine::readyFuture()
+{
+    std::optional<int> result;
+    QCoroTask<> task = storeResult(addOne(QtFuture::makeReadyValueFuture(41)), &result);
+    QVERIFY(task.isValid());
+    QVERIFY(task.isFinished());
+    QCOMPARE(result, 42);
+}
+
+void tst_QCoroutine::futureFinishedInSameThread()
+{
+    QPromise<int> promise;
+    promise.start();
+
+    int value = 0;
+    QThread *resumedIn = nullptr;
+    QCoroTask<> task = awaitFuture(promise.future(), &value, &resumedIn);
+    QVERIFY(!task.isFinished());
+
+    promise.addResult(42);
+    promise.finish();
+    // no need to go through the event loop
+    QVERIFY(task.isFinished());
+    QCOMPARE(value, 42);
+    QCOMPARE(resumedIn, QThread::currentThread());
+}
+
+void tst_QCoroutine::futureFinishedInOtherThread()
+{
+    QPromise<int> promise;
+    promise.start();
+
+    int value = 0;
+    QThread *resumedIn = nullptr;
+    QCoroTask<> task = awaitFuture(promise.future(), &value, &resumedIn);
+
+    std::unique_ptr<QThread> thread(QThread::create([&promise] {
+        promise.addResult(42);
+        promise.finish();
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    // resumed from this thread's event loop
+    QVERIFY(!task.isFinished());
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(value, 42);
+    QCOMPARE(resumedIn, QThread::currentThread());
+}
+
+static QCoroTask<> awaitVoid(QFuture<void> future, bool *done)
+{
+    co_await future;
+    *done = true;
+}
+
+void tst_QCoroutine::voidFuture()
+{
+    QPromise<void> promise;
+    promise.start();
+
+    bool done = false;
+    QCoroTask<> task = awaitVoid(promise.future(), &done);
+    QVERIFY(!done);
+    promise.finish();
+    QVERIFY(done);
+    QVERIFY(task.isFinished());
+}
+
+#ifndef QT_NO_EXCEPTIONS
+static QCoroTask<> catchException(QFuture<int> future, bool *caught)
+{
+    try {
+        co_await future;
+    } catch (const QException &) {
+        *caught = true;
+    }
+}
+
+void tst_QCoroutine::futureException()
+{
+    QPromise<int> promise;
+    promise.start();
+
+    bool caught = false;
+    QCoroTask<> task = catchException(promise.future(), &caught);
+    promise.setException(QException());
+    promise.finish();
+    QVERIFY(task.isFinished());
+    QVERIFY(caught);
+}
+
+static QCoroTask<int> throwAfter(QFuture<void> future)
+{
+    co_await future;
+    throw QException();
+    co_return 0;
+}
+
+static QCoroTask<> catchTaskException(QCoroTask<int> task, bool *caught)
+{
+    try {
+        co_await task;
+    } catch (const QException &) {
+        *caught = true;
+    }
+}
+
+void tst_QCoroutine::taskException()
+{
+    QPromise<void> promise;
+    promise.start();
+
+    bool caught = false;
+    QCoroTask<> task = catchTaskException(throwAfter(promise.future()), &caught);
+    QVERIFY(!task.isFinished());
+    promise.finish();
+    QVERIFY(task.isFinished());
+    QVERIFY(caught);
+}
+#endif // QT_NO_EXCEPTIONS
+
+static QCoroTask<> awaitNoArguments(Emitter *emitter, int *count)
+{
+    co_await qAwaitSignal(emitter, &Emitter::noArguments);
+    ++*count;
+}
+
+void tst_QCoroutine::signalWithoutArguments()
+{
+    Emitter emitter;
+    int count = 0;
+    QCoroTask<> task = awaitNoArguments(&emitter, &count);
+    QCOMPARE(count, 0);
+
+    emit emitter.noArguments();
+    QCOMPARE(count, 1);
+    QVERIFY(task.isFinished());
+
+    // the connection is gone
+    emit emitter.noArguments();
+    QCOMPARE(count, 1);
+}
+
+static QCoroTask<int> awaitOneArgument(Emitter *emitter)
+{
+    co_return co_await qAwaitSignal(emitter, &Emitter::oneArgument);
+}
+
+void tst_QCoroutine::signalWithArgument()
+{
+    Emitter emitter;
+    std::optional<int> result;
+    QCoroTask<> task = storeResult(awaitOneArgument(&emitter), &result);
+    emit emitter.oneArgument(7);
+    QVERIFY(task.isFinished());
+    QCOMPARE(result, 7);
+}
+
+static QCoroTask<> awaitTwoArguments(Emitter *emitter, int *value, QString *text)
+{
+    std::tie(*value, *text) = co_await qAwaitSignal(emitter, &Emitter::twoArguments);
+}
+
+void tst_QCoroutine::signalWithArguments()
+{
+    Emitter emitter;
+    int value = 0;
+    QString text;
+    QCoroTask<> task = awaitTwoArguments(&emitter, &value, &text);
+    emit emitter.twoArguments(3, u"three"_s);
+    QVERIFY(task.isFinished());
+    QCOMPARE(value, 3);
+    QCOMPARE(text, u"three"_s);
+}
+
+static QCoroTask<> awaitSignalThread(Emitter *emitter, int *value, QThread **resumedIn)
+{
+    *value = co_await qAwaitSignal(emitter, &Emitter::oneArgument);
+    *resumedIn = QThread::currentThread();
+}
+
+void tst_QCoroutine::signalFromOtherThread()
+{
+    Emitter emitter;
+    int value = 0;
+    QThread *resumedIn = nullptr;
+    QCoroTask<> task = awaitSignalThread(&emitter, &value, &resumedIn);
+
+    std::unique_ptr<QThread> thread(QThread::create([&emitter] { emit emitter.oneArgument(5); }));
+    thread->start();
+    QVERIFY(thread->wait());
+
+    QVERIFY(!task.isFinished());
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(value, 5);
+    QCOMPARE(resumedIn, QThread::currentThread());
+}
+
+static QCoroTask<int> sum(QFuture<int> first, QFuture<int> second)
+{
+    const int a = co_await addOne(first);
+    const int b = co_await addOne(second);
+    co_return a + b;
+}
+
+void tst_QCoroutine::nestedTasks()
+{
+    QPromise<int> first;
+    QPromise<int> second;
+    first.start();
+    second.start();
+
+    std::optional<int> result;
+    QCoroTask<> task = storeResult(sum(first.future(), second.future()), &result);
+    QVERIFY(!task.isFinished());
+
+    second.addResult(20);
+    second.finish();
+    QVERIFY(!task.isFinished());
+
+    first.addResult(10);
+    first.finish();
+    QVERIFY(task.isFinished());
+    QCOMPARE(result, 32);
+}
+
+static QCoroTask<> holdToken(QFuture<void> future, std::shared_ptr<int> token)
+{
+    co_await future;
+    ++*token;
+}
+
+void tst_QCoroutine::detachedTask()
+{
+    auto token = std::make_shared<int>(0);
+
+    QPromise<void> promise;
+    promise.start();
+    holdToken(promise.future(), token);
+    // the suspended coroutine keeps running without its task object
+    QCOMPARE(token.use_count(), 2);
+
+    promise.finish();
+    QCOMPARE(*token, 1);
+    QCOMPARE(token.use_count(), 1);
+
+    // a finished coroutine stays around as long as its task object
+    {
+        QCoroTask<> task = holdToken(QtFuture::makeReadyVoidFuture(), token);
+        QVERIFY(task.isFinished());
+        QCOMPARE(*token, 2);
+        QCOMPARE(token.use_count(), 2);
+    }
+    QCOMPARE(token.use_count(), 1);
+}
+
+static QCoroTask<> recordThread(QFuture<void> future, std::atomic<QThread *> *resumedIn)
+{
+    co_await future;
+    resumedIn->store(QThread::currentThread());
+}
+
+void tst_QCoroutine::resumeInWorkerThread()
+{
+    QThread worker;
+    QObject context;
+    context.moveToThread(&worker);
+    worker.start();
+    auto cleanup = qScopeGuard([&worker] {
+        worker.quit();
+        worker.wait();
+    });
+
+    QPromise<void> promise;
+    promise.start();
+    std::atomic<QThread *> resumedIn = nullptr;
+    QMetaObject::invokeMethod(&context, [&] {
+        recordThread(promise.future(), &resumedIn);
+    }, Qt::BlockingQueuedConnection);
+
+    promise.finish();
+    QTRY_COMPARE(resumedIn.load(), &worker);
+}
+
+QTEST_MAIN(tst_QCoroutine)
+#include "tst_qcoroutine.moc"
@@ -26,6 +26,8 @@
 
 #include <stdio.h>
 
+#include <memory>
+
 using namespace std::chrono_literals;
 
 class tst_QReadWriteLock : public QObject
@@ -60,6 +62,9 @@ private slots:
     void countingTest();
     void limitedReaders();
     void deleteOnUnlock();
+    void contentionPolicy_data();
+    void contentionPolicy();
+    void writerTimeoutReleasesReaders();
 
 /*
     Performance tests
@@ -77,6 +82,16 @@ void tst_QReadWriteLock::constructDestruct()
     {
         QReadWriteLock rwlock;
     }
+    {
+        QReadWriteLock rwlock(QReadWriteLock::NonRecursive,
+                              QReadWriteLock::ContentionPolicy::PreferReaders);
+        rwlock.lockForRead();
+        rwlock.unlock();
+    }
+    {
+        QReadWriteLock rwlock(QReadWriteLock::Recursive,
+                              QReadWriteLock::ContentionPolicy::PreferReaders);
+    }
 }
 
 void tst_QReadWriteLock::readLockUnlock()
@@ -897,6 +912,89 @@ void tst_QReadWriteLock::uncontendedLocks()
     qDebug("%u uncontended write locks/unlocks", write);
 }
 
+void tst_QReadWriteLock::contentionPolicy_data()
+{
+    QTest::addColumn<QReadWriteLock::RecursionMode>("recursionMode");
+    QTest::addColumn<QReadWriteLock::ContentionPolicy>("policy");
+
+    QTest::newRow("prefer-writers")
+            << QReadWriteLock::NonRecursive << QReadWriteLock::ContentionPolicy::PreferWriters;
+    QTest::newRow("prefer-readers")
+            << QReadWriteLock::NonRecursive << QReadWriteLock::ContentionPolicy::PreferReaders;
+    QTest::newRow("recursive-prefer-writers")
+            << QReadWriteLock::Recursive << QReadWriteLock::ContentionPolicy::PreferWriters;
+    QTest::newRow("recursive-prefer-readers")
+            << QReadWriteLock::Recursive << QReadWriteLock::ContentionPolicy::PreferReaders;
+}
+
+/*
+    While a reader holds the lock and a writer waits for it, a second
+    reader only gets in if the lock prefers readers.
+*/
+void tst_QReadWriteLock::contentionPolicy()
+{
+    QFETCH(QReadWriteLock::RecursionMode, recursionMode);
+    QFETCH(QReadWriteLock::ContentionPolicy, policy);
+
+    QReadWriteLock lock(recursionMode, policy);
+    lock.lockForRead();
+
+    QAtomicInt writerDone;
+    std::unique_ptr<QThread> writer(QThread::create([&] {
+        lock.lockForWrite();
+        writerDone.storeRelaxed(1);
+        lock.unlock();
+    }));
+    writer->start();
+    QThread::sleep(200ms);     // let the writer block
+    QVERIFY(!writerDone.loadRelaxed());
+
+    bool readerGotLock = false;
+    std::unique_ptr<QThread> reader(QThread::create([&] {
+        readerGotLock = lock.tryLockForRead();
+        if (readerGotLock)
+            lock.unlock();
+    }));
+    reader->start();
+    QVERIFY(reader->wait());
+    QCOMPARE(readerGotLock, policy == QReadWriteLock::ContentionPolicy::PreferReaders);
+
+    lock.unlock();
+    QVERIFY(writer->wait());
+    QVERIFY(writerDone.loadRelaxed());
+}
+
+/*
+    A reader blocked behind a waiting writer gets the lock, still held by
+    another reader, once that writer gives up.
+*/
+void tst_QReadWriteLock::writerTimeoutReleasesReaders()
+{
+    QReadWriteLock lock;
+    lock.lockForRead();
+
+    QAtomicInt writerResult = -1;
+    std::unique_ptr<QThread> writer(QThread::create([&] {
+        writerResult.storeRelaxed(lock.tryLockForWrite(QDeadlineTimer(500ms)));
+    }));
+    writer->start();
+    QThread::sleep(100ms);
+
+    QAtomicInt readerDone;
+    std::unique_ptr<QThread> reader(QThread::create([&] {
+        lock.lockForRead();
+        readerDone.storeRelaxed(1);
+        lock.unlock();
+    }));
+    reader->start();
+
+    QVERIFY(writer->wait());
+    QCOMPARE(writerResult.loadRelaxed(), 0);
+    QVERIFY(reader->wait(QDeadlineTimer(10s)));
+    QVERIFY(readerDone.loadRelaxed());
+    lock.unlock();
+}
+
 enum { RecursiveLockCount = 10 };
 
 void tst_QReadWriteLock::recursiveReadLock()
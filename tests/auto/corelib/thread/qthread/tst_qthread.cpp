@@ -6,6 +6,7 @@
 #include <QSignalSpy>
 #include <QSemaphore>
 #include <QAbstractEventDispatcher>
+#include <QPointer>
 #if defined(Q_OS_WIN32)
 #include <QWinEventNotifier>
 #endif
@@ -25,6 +26,9 @@
 #ifdef Q_OS_UNIX
 #include <pthread.h>
 #endif
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+#include <sched.h>
+#endif
 #if defined(Q_OS_WIN)
 #include <qt_windows.h>
 #if defined(Q_OS_WIN32)
@@ -36,9 +40,12 @@
 #include <exception>
 #endif
 
+#include <vector>
+
 #include <QtTest/private/qemulationdetector_p.h>
 
 using namespace std::chrono_literals;
+using namespace Qt::StringLiterals;
 
 class tst_QThread : public QObject
 {
@@ -51,6 +58,11 @@ private slots:
     void isRunning();
     void setPriority();
     void setStackSize();
+    void cpuAffinity();
+    void numaNodes();
+    void queuedCallBatching();
+    void queuedCallBatchingReceiverDeleted();
+    void queuedCallBatchingReceiverMoved();
     void exit();
     void start();
     void startSlotUsedInStringBasedLookups();
@@ -414,6 +426,301 @@ void tst_QThread::setStackSize()
     QCOMPARE(thread.stackSize(), 0u);
 }
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+static QList<int> currentThreadCpus()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        return {};
+    QList<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set))
+            cpus.append(cpu);
+    }
+    return cpus;
+}
+
+static bool setCurrentThreadCpus(const QList<int> &cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+#endif
+
+void tst_QThread::cpuAffinity()
+{
+#if !defined(Q_OS_LINUX) || defined(Q_OS_ANDROID)
+    QSKIP("The CPU affinity can only be checked on Linux");
+#else
+    const QList<int> available = currentThreadCpus();
+    QVERIFY(!available.isEmpty());
+    const QList<int> pinned = { available.constLast() };
+
+    // applied when the thread starts
+    QList<int> seen;
+    std::unique_ptr<QThread> thread(QThread::create([&seen] { seen = currentThreadCpus(); }));
+    QVERIFY(thread->cpuAffinity().isEmpty());
+    thread->setCpuAffinity(pinned);
+    QCOMPARE(thread->cpuAffinity(), pinned);
+    thread->start();
+    QVERIFY(thread->wait(five_minutes));
+    QCOMPARE(seen, pinned);
+
+    // changed while the thread is running, then lifted again: the thread
+    // goes back to the processors it inherited, which may be fewer than
+    // the process may use, as with taskset
+    QList<int> inherited = available;
+    if (available.size() > 1)
+        inherited.removeFirst();
+    QVERIFY(setCurrentThreadCpus(inherited));
+    auto restoreCpus = qScopeGuard([&] { setCurrentThreadCpus(available); });
+    QSemaphore proceed, checked;
+    QList<int> restricted, unrestricted;
+    thread.reset(QThread::create([&] {
+        proceed.acquire();
+        restricted = currentThreadCpus();
+        checked.release();
+        proceed.acquire();
+        unrestricted = currentThreadCpus();
+    }));
+    thread->start();
+    thread->setCpuAffinity(pinned);
+    proceed.release();
+    QVERIFY(checked.tryAcquire(1, five_minutes));
+    QCOMPARE(restricted, pinned);
+    thread->setCpuAffinity({});
+    proceed.release();
+    QVERIFY(thread->wait(five_minutes));
+    QCOMPARE(unrestricted, inherited);
+#endif
+}
+
+void tst_QThread::numaNodes()
+{
+    const int nodeCount = QThread::numaNodeCount();
+    QVERIFY(nodeCount >= 1);
+    QVERIFY(QThread::numaNodeCpus(-1).isEmpty());
+    QVERIFY(QThread::numaNodeCpus(nodeCount).isEmpty());
+
+    QList<int> cpus;
+    for (int node = 0; node < nodeCount; ++node)
+        cpus += QThread::numaNodeCpus(node);
+    QVERIFY(!cpus.isEmpty());
+
+    // every processor belongs to one node
+    std::sort(cpus.begin(), cpus.end());
+    QCOMPARE(std::adjacent_find(cpus.cbegin(), cpus.cend()), cpus.cend());
+    QVERIFY(cpus.constFirst() >= 0);
+}
+
+class BatchSender : public QObject
+{
+    Q_OBJECT
+signals:
+    void valueChanged(int value, const QString &text);
+    void valueChangedLarge(int value, const std::vector<int> &values);
+};
+
+// records the calls of BatchReceiver, which may be deleted by one of them
+class BatchCallLog
+{
+public:
+    struct Call
+    {
+        QObject *sender;
+        int value;
+        QString text;
+        QThread *thread;
+    };
+
+    void append(const Call &call)
+    {
+        QMutexLocker locker(&mutex);
+        received.append(call);
+    }
+
+    QList<Call> calls() const
+    {
+        QMutexLocker locker(&mutex);
+        return received;
+    }
+
+private:
+    mutable QMutex mutex;
+    QList<Call> received;
+};
+
+class BatchReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BatchReceiver(BatchCallLog *log) : log(log) { }
+
+    int deleteAt = -1;
+    int moveAt = -1;
+    QThread *moveTo = nullptr;
+
+public slots:
+    void record(int value, const QString &text)
+    {
+        log->append({ sender(), value, text, QThread::currentThread() });
+        if (value == deleteAt)
+            delete this;
+        else if (value == moveAt)
+            moveToThread(moveTo);
+    }
+
+    void recordLarge(int value, const std::vector<int> &values)
+    {
+        record(value, QString::number(values.size()));
+    }
+
+private:
+    BatchCallLog *log;
+};
+
+void tst_QThread::queuedCallBatching()
+{
+    QThread thread;
+    QVERIFY(!thread.isQueuedCallBatchingEnabled());
+    thread.setQueuedCallBatchingEnabled(true);
+    QVERIFY(thread.isQueuedCallBatchingEnabled());
+    thread.start();
+    auto cleanup = qScopeGuard([&thread] {
+        thread.quit();
+        thread.wait();
+    });
+
+    BatchCallLog log;
+    BatchReceiver receiver(&log);
+    receiver.moveToThread(&thread);
+    BatchSender sender1, sender2;
+    connect(&sender1, &BatchSender::valueChanged, &receiver, &BatchReceiver::record);
+    connect(&sender2, &BatchSender::valueChangedLarge, &receiver, &BatchReceiver::recordLarge);
+    connect(&sender2, &BatchSender::valueChanged, &receiver,
+            [&receiver](int value, const QString &text) { receiver.record(value, text + "!"); });
+    QVERIFY(connect(&sender1, SIGNAL(valueChanged(int,QString)),
+                    &receiver, SLOT(record(int,QString))));
+
+    // keep the thread busy while the calls are queued
+    QSemaphore busy, proceed;
+    QMetaObject::invokeMethod(&receiver, [&] {
+        busy.release();
+        proceed.acquire();
+    });
+    QVERIFY(busy.tryAcquire(1, five_minutes));
+
+    emit sender1.valueChanged(0, u"a"_s);
+    emit sender2.valueChanged(1, u"b"_s);
+    emit sender2.valueChangedLarge(2, std::vector<int>(3));
+    // all calls so far are in one event
+    QCOMPARE(QObjectPrivate::get(&receiver)->postedEvents.loadRelaxed(), 1);
+
+    // other events are not overtaken
+    QMetaObject::invokeMethod(&receiver, "record", Q_ARG(int, 3), Q_ARG(QString, u"c"_s));
+    emit sender1.valueChanged(4, u"d"_s);
+    QCOMPARE(QObjectPrivate::get(&receiver)->postedEvents.loadRelaxed(), 3);
+    proceed.release();
+
+    const QList<std::pair<int, QString>> expected = {
+        { 0, u"a"_s }, { 0, u"a"_s }, { 1, u"b!"_s }, { 2, u"3"_s }, { 3, u"c"_s },
+        { 4, u"d"_s }, { 4, u"d"_s },
+    };
+    QTRY_COMPARE(log.calls().size(), expected.size());
+    const QList<BatchCallLog::Call> calls = log.calls();
+    for (qsizetype i = 0; i < calls.size(); ++i) {
+        QCOMPARE(calls.at(i).value, expected.at(i).first);
+        QCOMPARE(calls.at(i).text, expected.at(i).second);
+        QCOMPARE(calls.at(i).thread, &thread);
+    }
+    QCOMPARE(calls.at(0).sender, &sender1);
+    QCOMPARE(calls.at(2).sender, &sender2);
+    QCOMPARE(calls.at(3).sender, &sender2);
+    QCOMPARE(calls.at(4).sender, nullptr);
+    QCOMPARE(calls.at(5).sender, &sender1);
+}
+
+void tst_QThread::queuedCallBatchingReceiverDeleted()
+{
+    QThread thread;
+    thread.setQueuedCallBatchingEnabled(true);
+    thread.start();
+    auto cleanup = qScopeGuard([&thread] {
+        thread.quit();
+        thread.wait();
+    });
+
+    BatchCallLog log;
+    auto receiver = new BatchReceiver(&log);
+    receiver->deleteAt = 2;
+    receiver->moveToThread(&thread);
+    QPointer<BatchReceiver> guard(receiver);
+    BatchSender sender;
+    connect(&sender, &BatchSender::valueChanged, receiver, &BatchReceiver::record);
+    connect(&sender, &BatchSender::valueChangedLarge, receiver, &BatchReceiver::recordLarge);
+
+    QSemaphore busy, proceed;
+    QMetaObject::invokeMethod(receiver, [&] {
+        busy.release();
+        proceed.acquire();
+    });
+    QVERIFY(busy.tryAcquire(1, five_minutes));
+    for (int i = 0; i < 5; ++i) {
+        emit sender.valueChanged(i, QString::number(i));
+        emit sender.valueChangedLarge(i, std::vector<int>(i));
+    }
+    proceed.release();
+
+    // the calls after the one deleting the receiver are discarded
+    QTRY_VERIFY(!guard);
+    QList<int> values;
+    for (const BatchCallLog::Call &call : log.calls())
+        values.append(call.value);
+    QCOMPARE(values, QList<int>({ 0, 0, 1, 1, 2 }));
+}
+
+void tst_QThread::queuedCallBatchingReceiverMoved()
+{
+    QThread thread;
+    thread.setQueuedCallBatchingEnabled(true);
+    thread.start();
+    auto cleanup = qScopeGuard([&thread] {
+        thread.quit();
+        thread.wait();
+    });
+
+    BatchCallLog log;
+    BatchReceiver receiver(&log);
+    receiver.moveAt = 1;
+    receiver.moveTo = QThread::currentThread();
+    receiver.moveToThread(&thread);
+    BatchSender sender;
+    connect(&sender, &BatchSender::valueChanged, &receiver, &BatchReceiver::record);
+
+    QSemaphore busy, proceed;
+    QMetaObject::invokeMethod(&receiver, [&] {
+        busy.release();
+        proceed.acquire();
+    });
+    QVERIFY(busy.tryAcquire(1, five_minutes));
+    for (int i = 0; i < 4; ++i)
+        emit sender.valueChanged(i, QString::number(i));
+    proceed.release();
+
+    // the calls after the one moving the receiver follow it to its new thread
+    QTRY_COMPARE(log.calls().size(), 4);
+    const QList<BatchCallLog::Call> calls = log.calls();
+    for (qsizetype i = 0; i < calls.size(); ++i) {
+        QCOMPARE(calls.at(i).value, i);
+        QCOMPARE(calls.at(i).sender, &sender);
+        QCOMPARE(calls.at(i).thread, i <= 1 ? &thread : QThread::currentThread());
+    }
+}
+
 void tst_QThread::exit()
 {
     Exit_Thread thread;
@@ -88,6 +88,11 @@ private slots:
     void waitForDoneAfterTake();
     void threadReuse();
     void nullFunctions();
+    void workStealing();
+    void workStealingPriority();
+    void workStealingTryTakeAndClear();
+    void threadCpuAffinity();
+    void numaNodeInstance();
 
 private:
     QMutex m_functionTestMutex;
@@ -1488,5 +1493,137 @@ void tst_QThreadPool::nullFunctions()
     }
 }
 
+void tst_QThreadPool::workStealing()
+{
+    constexpr int TaskCount = 1000;
+    constexpr int SubtaskCount = 10;
+
+    TestThreadPool manager;
+    manager.setMaxThreadCount(4);
+    manager.setSchedulingPolicy(QThreadPool::SchedulingPolicy::WorkStealing);
+    QCOMPARE(manager.schedulingPolicy(), QThreadPool::SchedulingPolicy::WorkStealing);
+
+    // runnables started both from this thread and from the pool's threads
+    QAtomicInt count;
+    for (int i = 0; i < TaskCount; ++i) {
+        manager.start([&] {
+            count.ref();
+            QVERIFY(manager.contains(QThread::currentThread()));
+            for (int j = 0; j < SubtaskCount; ++j)
+                manager.start([&count] { count.ref(); });
+        });
+    }
+
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(count.loadRelaxed(), TaskCount * (SubtaskCount + 1));
+    QCOMPARE(manager.activeThreadCount(), 0);
+
+    // the pool can be used again after switching back
+    manager.setSchedulingPolicy(QThreadPool::SchedulingPolicy::SharedQueue);
+    for (int i = 0; i < TaskCount; ++i)
+        manager.start([&count] { count.ref(); });
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(count.loadRelaxed(), TaskCount * (SubtaskCount + 2));
+}
+
+void tst_QThreadPool::workStealingPriority()
+{
+    QSemaphore sem;
+    QMutex mutex;
+    QList<int> order;
+
+    TestThreadPool manager;
+    manager.setMaxThreadCount(1);
+    manager.setSchedulingPolicy(QThreadPool::SchedulingPolicy::WorkStealing);
+
+    // keep the only thread busy while queuing the others
+    manager.start([&sem] { sem.acquire(); });
+    auto record = [&](int priority) {
+        return [&, priority] {
+            QMutexLocker locker(&mutex);
+            order.append(priority);
+        };
+    };
+    for (int i = 0; i < 3; ++i) {
+        manager.start(record(-1), -1);
+        manager.start(record(0), 0);
+        manager.start(record(1), 1);
+    }
+
+    sem.release();
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(order, QList<int>({ 1, 1, 1, 0, 0, 0, -1, -1, -1 }));
+}
+
+void tst_QThreadPool::workStealingTryTakeAndClear()
+{
+    QSemaphore sem;
+    QAtomicInt count;
+
+    TestThreadPool manager;
+    manager.setMaxThreadCount(1);
+    manager.setSchedulingPolicy(QThreadPool::SchedulingPolicy::WorkStealing);
+    manager.start([&sem] { sem.acquire(); });
+
+    std::unique_ptr<QRunnable> taken(QRunnable::create([&count] { count.ref(); }));
+    taken->setAutoDelete(false);
+    manager.start(taken.get());
+    for (int i = 0; i < 10; ++i)
+        manager.start([&count] { count.ref(); });
+
+    QVERIFY(manager.tryTake(taken.get()));
+    QVERIFY(!manager.tryTake(taken.get()));
+    manager.clear();
+
+    sem.release();
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(count.loadRelaxed(), 0);
+}
+
+void tst_QThreadPool::threadCpuAffinity()
+{
+    const QList<int> cpus = QThread::numaNodeCpus(0);
+    QVERIFY(!cpus.isEmpty());
+    const QList<int> pinned = { cpus.constFirst() };
+
+    TestThreadPool manager;
+    QVERIFY(manager.threadCpuAffinity().isEmpty());
+    manager.setThreadCpuAffinity(pinned);
+    QCOMPARE(manager.threadCpuAffinity(), pinned);
+
+    QList<int> affinity;
+    manager.start([&affinity] { affinity = QThread::currentThread()->cpuAffinity(); });
+    WAIT_FOR_DONE(manager);
+    QCOMPARE(affinity, pinned);
+}
+
+void tst_QThreadPool::numaNodeInstance()
+{
+    QVERIFY(!QThreadPool::numaNodeInstance(-1));
+    QVERIFY(!QThreadPool::numaNodeInstance(QThread::numaNodeCount()));
+
+    QThreadPool *pool = nullptr;
+    int node = 0;
+    for (; node < QThread::numaNodeCount() && !pool; ++node)
+        pool = QThreadPool::numaNodeInstance(node);
+    QVERIFY(pool);
+    --node;
+    QCOMPARE(QThreadPool::numaNodeInstance(node), pool);
+    QVERIFY(pool != QThreadPool::globalInstance());
+
+    const QList<int> cpus = QThread::numaNodeCpus(node);
+    QCOMPARE(pool->threadCpuAffinity(), cpus);
+    QCOMPARE(pool->maxThreadCount(), cpus.size());
+
+    QSemaphore sem;
+    QThread *thread = nullptr;
+    pool->start([&] {
+        thread = QThread::currentThread();
+        sem.release();
+    });
+    QVERIFY(sem.tryAcquire(1, DefaultWaitForDoneTimeout));
+    QVERIFY(pool->contains(thread));
+}
+
 QTEST_MAIN(tst_QThreadPool);
 #include "tst_qthreadpool.moc"
@@ -2965,6 +2965,21 @@ void tst_QDateTime::fromStringDateFormat_data()
         << QString::fromLatin1("2017-07-01TZ") << Qt::ISODate << QDateTime();
     QTest::newRow("ISO mis-punctuated")
         << QString::fromLatin1("2018/01/30 ") << Qt::ISODate << QDateTime();
+    // RFC 3339 profile, as found in logs:
+    QTest::newRow("ISO RFC 3339 lower-case")
+        << QString::fromLatin1("2017-07-01t12:34:56.789z") << Qt::ISODateWithMs
+        << QDateTime(QDate(2017, 7, 1), QTime(12, 34, 56, 789), UTC);
+    QTest::newRow("ISO RFC 3339 nanoseconds")
+        << QString::fromLatin1("2017-07-01T12:34:56.123456789+05:30") << Qt::ISODate
+        << QDateTime(QDate(2017, 7, 1), QTime(12, 34, 56, 123),
+                     QTimeZone::fromSecondsAheadOfUtc(5 * 3600 + 30 * 60));
+    QTest::newRow("ISO RFC 3339 rounding up to a second")
+        << QString::fromLatin1("2017-07-01 12:34:59.9999-01:00") << Qt::ISODate
+        << QDateTime(QDate(2017, 7, 1), QTime(12, 35), QTimeZone::fromSecondsAheadOfUtc(-3600));
+    QTest::newRow("ISO RFC 3339 invalid day")
+        << QString::fromLatin1("2017-02-29T12:34:56Z") << Qt::ISODate << QDateTime();
+    QTest::newRow("ISO RFC 3339 invalid offset")
+        << QString::fromLatin1("2017-07-01T12:34:56+24:00") << Qt::ISODate << QDateTime();
 
     // Test Qt::RFC2822Date format (RFC 2822).
     QTest::newRow("RFC 2822 +0100") << QString::fromLatin1("13 Feb 1987 13:24:51 +0100")
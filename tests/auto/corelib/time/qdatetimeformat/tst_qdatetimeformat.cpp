@@ -0,0 +1,189 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qdatetimeformat.h>
+#include <QtCore/qtimezone.h>
+#include <QTest>
+
+using namespace Qt::StringLiterals;
+
+class tst_QDateTimeFormat : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void toString_data();
+    void toString();
+    void timeZone();
+    void calendar();
+    void parse_data();
+    void parse();
+    void invalid();
+    void sharing();
+};
+
+static QList<QDateTime> dateTimeSamples()
+{
+    return { QDateTime(QDate(2025, 3, 4), QTime(5, 6, 7, 8), QTimeZone::UTC),
+             QDateTime(QDate(1999, 12, 31), QTime(23, 59, 59, 999)),
+             QDateTime(QDate(2000, 1, 1), QTime(0, 0)),
+             QDateTime(QDate(2024, 2, 29), QTime(12, 30, 0, 200),
+                       QTimeZone::fromSecondsAheadOfUtc(5 * 3600 + 30 * 60)),
+             QDateTime(QDate(-44, 3, 15), QTime(11, 0, 0, 20), QTimeZone::UTC),
+             QDateTime(QDate(7, 7, 7), QTime(13, 1, 2, 340), QTimeZone::UTC) };
+}
+
+static QStringList formatSamples()
+{
+    return { u"yyyy-MM-dd HH:mm:ss.zzz"_s, u"d/M/yy h:m:s"_s,
+             u"dddd d MMMM yyyy, hh:mm AP"_s, u"ddd MMM d yyy h:mm:ss.z ap"_s,
+             u"'Today is' dddd', it''s' h 'o''clock' Ap"_s, u"yyyyy MMMMM ddddd zzzz"_s,
+             u"'unterminated HH"_s, u"'' x y Y q HHH sss"_s,
+             u"hAhapaAAp"_s, u"MMM yyyy"_s, u"HH:mm"_s, u""_s };
+}
+
+void tst_QDateTimeFormat::basics()
+{
+    const QDateTimeFormat empty;
+    QCOMPARE(empty.format(), QString());
+    QCOMPARE(empty.locale(), QLocale::c());
+    QCOMPARE(empty.toString(QDateTime::currentDateTime()), QString());
+
+    const QDateTimeFormat format(u"yyyy-MM-dd HH:mm:ss.zzz");
+    QCOMPARE(format.format(), "yyyy-MM-dd HH:mm:ss.zzz"_L1);
+    QCOMPARE(format.locale(), QLocale::c());
+    QCOMPARE(format.calendar().name(), QCalendar().name());
+
+    const QDateTime dt(QDate(2025, 3, 4), QTime(5, 6, 7, 8));
+    QCOMPARE(format.toString(dt), "2025-03-04 05:06:07.008"_L1);
+    QString str = u"at "_s;
+    format.appendTo(str, dt);
+    QCOMPARE(str, "at 2025-03-04 05:06:07.008"_L1);
+    QCOMPARE(format.toDateTime(u"2025-03-04 05:06:07.008"_s), dt);
+
+    const QDateTimeFormat german(u"dddd, d. MMMM yyyy", QLocale(QLocale::German));
+    QCOMPARE(german.toString(QDate(2025, 3, 4)), u"Dienstag, 4. März 2025"_s);
+    QCOMPARE(german.toDate(u"Dienstag, 4. März 2025"_s), QDate(2025, 3, 4));
+}
+
+void tst_QDateTimeFormat::toString_data()
+{
+    QTest::addColumn<QLocale>("locale");
+
+    for (const char *name : { "C", "en_US", "de_DE", "fr_FR", "ar_EG", "fa_IR", "ja_JP", "ccp" })
+        QTest::newRow(name) << QLocale(QString::fromLatin1(name));
+}
+
+void tst_QDateTimeFormat::toString()
+{
+    QFETCH(const QLocale, locale);
+
+    for (const QString &format : formatSamples()) {
+        const QDateTimeFormat formatter(format, locale);
+        for (const QDateTime &dt : dateTimeSamples()) {
+            QCOMPARE(formatter.toString(dt), locale.toString(dt, format));
+            QCOMPARE(formatter.toString(dt.date()), locale.toString(dt.date(), format));
+            QCOMPARE(formatter.toString(dt.time()), locale.toString(dt.time(), format));
+
+            QString str = u"prefix "_s;
+            formatter.appendTo(str, dt);
+            QCOMPARE(str, u"prefix "_s + locale.toString(dt, format));
+        }
+    }
+}
+
+void tst_QDateTimeFormat::timeZone()
+{
+    // Zone names are localized by the time zone backend, so stick to C here:
+    for (const QString &format : { u"yyyy-MM-ddTHH:mm:ss.zt"_s, u"hh:mm:ss aP tt ttt tttt"_s }) {
+        const QDateTimeFormat formatter(format);
+        for (const QDateTime &dt : dateTimeSamples()) {
+            QCOMPARE(formatter.toString(dt), dt.toString(format));
+            QCOMPARE(formatter.toString(dt.date()), dt.date().toString(format));
+            QCOMPARE(formatter.toDateTime(formatter.toString(dt)),
+                     QDateTime::fromString(dt.toString(format), format));
+        }
+    }
+}
+
+void tst_QDateTimeFormat::calendar()
+{
+    const QCalendar julian(QCalendar::System::Julian);
+    const QString format = u"dddd d MMMM yyyy"_s;
+    const QDateTimeFormat formatter(format, julian);
+    QCOMPARE(formatter.calendar().name(), julian.name());
+    for (const QDateTime &dt : dateTimeSamples()) {
+        QCOMPARE(formatter.toString(dt), dt.toString(format, julian));
+        QCOMPARE(formatter.toString(dt.date()), dt.date().toString(format, julian));
+        QCOMPARE(formatter.toDate(formatter.toString(dt.date())),
+                 QDate::fromString(dt.date().toString(format, julian), format, julian));
+    }
+}
+
+void tst_QDateTimeFormat::parse_data()
+{
+    QTest::addColumn<QLocale>("locale");
+    QTest::addColumn<QString>("format");
+
+    for (const char *name : { "C", "en_US", "de_DE", "ar_EG" }) {
+        const QLocale locale(QString::fromLatin1(name));
+        for (const char *format : { "yyyy-MM-dd HH:mm:ss.zzz", "dddd d MMMM yyyy h:mm:ss AP",
+                                    "d/M/yy", "'at' hh'h'mm" }) {
+            QTest::addRow("%s: %s", name, format) << locale << QString::fromLatin1(format);
+        }
+    }
+}
+
+void tst_QDateTimeFormat::parse()
+{
+    QFETCH(const QLocale, locale);
+    QFETCH(const QString, format);
+    const QDateTimeFormat formatter(format, locale);
+
+    for (const QDateTime &dt : dateTimeSamples()) {
+        const QString text = formatter.toString(dt);
+        QCOMPARE(formatter.toDateTime(text), locale.toDateTime(text, format));
+        QCOMPARE(formatter.toDateTime(text, 2000), locale.toDateTime(text, format, 2000));
+        QCOMPARE(formatter.toDate(text), locale.toDate(text, format));
+        QCOMPARE(formatter.toTime(text), locale.toTime(text, format));
+        // Parsing the same text again gives the same result:
+        QCOMPARE(formatter.toDateTime(text), locale.toDateTime(text, format));
+    }
+}
+
+void tst_QDateTimeFormat::invalid()
+{
+    const QDateTimeFormat formatter(u"yyyy-MM-dd HH:mm");
+    QCOMPARE(formatter.toString(QDateTime()), QString());
+    QCOMPARE(formatter.toString(QDate()), QString());
+    QCOMPARE(formatter.toString(QTime()), QString());
+    QString str = u"unchanged"_s;
+    formatter.appendTo(str, QDateTime());
+    QCOMPARE(str, "unchanged"_L1);
+
+    QVERIFY(!formatter.toDateTime(u"2025-13-01 00:00"_s).isValid());
+    QVERIFY(!formatter.toDateTime(u"garbage"_s).isValid());
+    QVERIFY(!formatter.toDate(u"2025-02-30 00:00"_s).isValid());
+    QVERIFY(!formatter.toTime(u"2025-01-01 25:00"_s).isValid());
+}
+
+void tst_QDateTimeFormat::sharing()
+{
+    QDateTimeFormat format(u"HH:mm");
+    QDateTimeFormat copy = format;
+    QCOMPARE(copy.format(), "HH:mm"_L1);
+
+    copy = QDateTimeFormat(u"yyyy", QLocale(QLocale::German));
+    QCOMPARE(format.format(), "HH:mm"_L1);
+    QCOMPARE(format.toString(QTime(1, 2)), "01:02"_L1);
+    QCOMPARE(copy.toString(QDate(2025, 1, 1)), "2025"_L1);
+
+    format.swap(copy);
+    QCOMPARE(format.format(), "yyyy"_L1);
+    QCOMPARE(copy.locale(), QLocale::c());
+}
+
+QTEST_MAIN(tst_QDateTimeFormat)
+
+#include "tst_qdatetimeformat.moc"
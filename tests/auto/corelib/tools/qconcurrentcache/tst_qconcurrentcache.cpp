@@ -0,0 +1,274 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QConcurrentCache>
+#include <QAtomicInt>
+#include <QSemaphore>
+#include <QString>
+#include <QThread>
+
+#include <memory>
+#include <vector>
+
+#include "../shared/test_threads_shared.h"
+
+using namespace Qt::StringLiterals;
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void basics();
+    void lruEviction();
+    void costs();
+    void nearMaxCost();
+    void setMaxCost();
+    void statistics();
+    void getOrCompute();
+    void getOrComputeCoalesces();
+    void getOrComputeThrows();
+    void concurrentAccess();
+};
+
+void tst_QConcurrentCache::basics()
+{
+    QConcurrentCache<int, QString> cache(100, 4);
+    QCOMPARE(cache.shardCount(), 4);
+    QCOMPARE(cache.maxCost(), 100);
+    QVERIFY(cache.isEmpty());
+    QVERIFY(!cache.value(1));
+    QCOMPARE(cache.value(1, u"default"_s), u"default"_s);
+
+    QVERIFY(cache.insert(1, u"one"_s));
+    QVERIFY(cache.insert(2, u"two"_s, 2));
+    QVERIFY(cache.contains(1));
+    QCOMPARE(cache.size(), 2);
+    QCOMPARE(cache.count(), 2);
+    QCOMPARE(cache.totalCost(), 3);
+    QCOMPARE(cache.value(1), u"one"_s);
+    QCOMPARE(cache.value(2, QString()), u"two"_s);
+
+    QVERIFY(cache.insert(1, u"uno"_s, 5));
+    QCOMPARE(cache.value(1), u"uno"_s);
+    QCOMPARE(cache.totalCost(), 7);
+
+    QCOMPARE(cache.take(1), u"uno"_s);
+    QCOMPARE(cache.take(1), std::nullopt);
+    QVERIFY(cache.remove(2));
+    QVERIFY(!cache.remove(2));
+    QVERIFY(cache.isEmpty());
+
+    cache.insert(3, u"three"_s);
+    cache.clear();
+    QVERIFY(cache.isEmpty());
+    QCOMPARE(cache.totalCost(), 0);
+}
+
+void tst_QConcurrentCache::lruEviction()
+{
+    // one shard, so that the eviction order is the one of QCache
+    QConcurrentCache<int, int> cache(3, 1);
+    cache.insert(1, 1);
+    cache.insert(2, 2);
+    cache.insert(3, 3);
+    QCOMPARE(cache.value(1), 1); // 2 is now the least recently used
+    cache.insert(4, 4);
+    QVERIFY(cache.contains(1));
+    QVERIFY(!cache.contains(2));
+    QVERIFY(cache.contains(3));
+    QVERIFY(cache.contains(4));
+
+    // contains() does not count as a use
+    QVERIFY(cache.contains(3));
+    cache.insert(5, 5);
+    QVERIFY(!cache.contains(3));
+}
+
+void tst_QConcurrentCache::costs()
+{
+    QConcurrentCache<int, int> cache(40, 4);
+    // only values that cost more than the whole cache are rejected
+    QVERIFY(cache.insert(1, 1, 10));
+    QVERIFY(!cache.insert(2, 2, 41));
+    QVERIFY(!cache.contains(2));
+
+    // an oversized value replacing an existing one removes it
+    QVERIFY(!cache.insert(1, 1, 41));
+    QVERIFY(!cache.contains(1));
+
+    for (int i = 0; i < 1000; ++i)
+        cache.insert(i, i, 3);
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+}
+
+void tst_QConcurrentCache::nearMaxCost()
+{
+    // with the defaults, each shard gets 6 or 7 of the cost of 100
+    using Cache = QConcurrentCache<int, int>;
+    Cache cache;
+    QCOMPARE(cache.maxCost(), 100);
+    QCOMPARE(cache.shardCount(), Cache::DefaultShardCount);
+
+    for (qsizetype cost : { 6, 7, 8, 50, 99, 100 }) {
+        cache.clear();
+        QVERIFY2(cache.insert(1, 1, cost), QByteArray::number(cost));
+        QCOMPARE(cache.value(1), 1);
+        QCOMPARE(cache.totalCost(), cost);
+    }
+    QVERIFY(!cache.insert(1, 1, 101));
+    QVERIFY(!cache.contains(1));
+
+    QCOMPARE(cache.getOrCompute(2, [] { return 90; }, [](int v) { return qsizetype(v); }), 90);
+    QVERIFY(cache.contains(2));
+    QCOMPARE(cache.totalCost(), 90);
+
+    // the expensive value is evicted by the next values of its shard, as it
+    // exceeds the part of the shard
+    for (int i = 3; i < 1000; ++i)
+        cache.insert(i, i);
+    QVERIFY(!cache.contains(2));
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+}
+
+void tst_QConcurrentCache::setMaxCost()
+{
+    QConcurrentCache<int, int> cache(100, 2);
+    for (int i = 0; i < 80; ++i)
+        cache.insert(i, i);
+    const qsizetype before = cache.size();
+    cache.resetStatistics();
+    cache.setMaxCost(10);
+    QCOMPARE(cache.maxCost(), 10);
+    QVERIFY(cache.size() <= 10);
+    QCOMPARE(cache.statistics().evictions, before - cache.size());
+}
+
+void tst_QConcurrentCache::statistics()
+{
+    QConcurrentCache<int, int> cache(2, 1);
+    auto stats = cache.statistics();
+    QCOMPARE(stats.hits, 0);
+    QCOMPARE(stats.hitRatio(), 0.0);
+
+    cache.insert(1, 1);
+    cache.insert(2, 2);
+    cache.value(1);
+    cache.value(1);
+    cache.value(3);
+    cache.contains(3);
+    cache.insert(3, 3); // evicts 2
+
+    stats = cache.statistics();
+    QCOMPARE(stats.hits, 2);
+    QCOMPARE(stats.misses, 1);
+    QCOMPARE(stats.insertions, 3);
+    QCOMPARE(stats.evictions, 1);
+    QCOMPARE(stats.coalescedMisses, 0);
+    QCOMPARE(stats.hitRatio(), 2.0 / 3.0);
+
+    cache.resetStatistics();
+    stats = cache.statistics();
+    QCOMPARE(stats.hits + stats.misses + stats.insertions + stats.evictions, 0);
+    QCOMPARE(cache.size(), 2);
+}
+
+void tst_QConcurrentCache::getOrCompute()
+{
+    QConcurrentCache<QString, int> cache(100, 1);
+    int calls = 0;
+    auto compute = [&] { ++calls; return 42; };
+    QCOMPARE(cache.getOrCompute(u"a"_s, compute), 42);
+    QCOMPARE(cache.getOrCompute(u"a"_s, compute), 42);
+    QCOMPARE(calls, 1);
+    QCOMPARE(cache.totalCost(), 1);
+
+    QCOMPARE(cache.getOrCompute(u"b"_s, [] { return 7; }, [](int v) { return qsizetype(v); }), 7);
+    QCOMPARE(cache.totalCost(), 8);
+
+    // too expensive to be cached, but still returned
+    QCOMPARE(cache.getOrCompute(u"c"_s, [] { return 1000; }, [](int v) { return qsizetype(v); }), 1000);
+    QVERIFY(!cache.contains(u"c"_s));
+
+    const auto stats = cache.statistics();
+    QCOMPARE(stats.hits, 1);
+    QCOMPARE(stats.misses, 3);
+}
+
+void tst_QConcurrentCache::getOrComputeCoalesces()
+{
+    constexpr int ThreadCount = 8;
+    QConcurrentCache<int, QString> cache(100, 2);
+    QAtomicInt calls;
+    QSemaphore started;
+    QSemaphore release;
+    std::vector<QString> results(ThreadCount);
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    threads.emplace_back(QThread::create([&] {
+        results[0] = cache.getOrCompute(1, [&] {
+            calls.ref();
+            started.release(ThreadCount);
+            release.acquire(); // hold the computation until everybody waits
+            return u"value"_s;
+        });
+    }));
+    for (int t = 1; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&, t] {
+            started.acquire();
+            results[t] = cache.getOrCompute(1, [&] { calls.ref(); return u"other"_s; });
+        }));
+    }
+    for (auto &thread : threads)
+        thread->start();
+
+    QTRY_COMPARE(cache.statistics().coalescedMisses, ThreadCount - 1);
+    release.release();
+    for (auto &thread : threads)
+        QVERIFY(thread->wait(QDeadlineTimer(60000)));
+
+    QCOMPARE(calls.loadRelaxed(), 1);
+    for (const QString &r : results)
+        QCOMPARE(r, u"value"_s);
+    const auto stats = cache.statistics();
+    QCOMPARE(stats.misses, ThreadCount);
+    QCOMPARE(stats.insertions, 1);
+}
+
+void tst_QConcurrentCache::getOrComputeThrows()
+{
+#ifdef QT_NO_EXCEPTIONS
+    QSKIP("This test requires exception support");
+#else
+    QConcurrentCache<int, int> cache;
+    QVERIFY_THROWS_EXCEPTION(int, cache.getOrCompute(1, []() -> int { throw 1; }));
+    QVERIFY(!cache.contains(1));
+    // the key is not left pending
+    QCOMPARE(cache.getOrCompute(1, [] { return 2; }), 2);
+#endif
+}
+
+void tst_QConcurrentCache::concurrentAccess()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int Iterations = 5000;
+    QConcurrentCache<int, int> cache(64, 8);
+    QTestThreads::Failures failures;
+    QVERIFY(QTestThreads::runInThreads(ThreadCount, [&](int t) {
+        for (int i = 0; i < Iterations; ++i) {
+            const int key = (i * 31 + t) % 200;
+            const int v = cache.getOrCompute(key, [key] { return key * 2; });
+            failures.verify(v == key * 2, "getOrCompute() returned the value of another key");
+            if (i % 7 == 0)
+                cache.remove(key);
+        }
+    }));
+    QVERIFY2(failures.isEmpty(), failures.report());
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+    const auto stats = cache.statistics();
+    QCOMPARE(stats.hits + stats.misses, qint64(ThreadCount) * Iterations);
+}
+
+QTEST_MAIN(tst_QConcurrentCache)
+#include "tst_qconcurrentcache.moc"
@@ -0,0 +1,283 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QConcurrentHash>
+#include <QAtomicInt>
+#include <QString>
+
+#include "../shared/test_threads_shared.h"
+
+using namespace Qt::StringLiterals;
+
+namespace {
+struct Point
+{
+    int x = 0;
+    int y = 0;
+    friend bool operator==(const Point &lhs, const Point &rhs) noexcept
+    { return lhs.x == rhs.x && lhs.y == rhs.y; }
+};
+
+// a customized qHash() that only takes the key, and collides a lot
+size_t qHash(const Point &p) noexcept
+{
+    return size_t(p.x % 7);
+}
+}
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void shardCount();
+    void basics();
+    void customHash();
+    void insertOrUpdate();
+    void valueOrInsert();
+    void removeIf();
+    void snapshot();
+    void snapshotIsolation();
+    void concurrentInserts();
+    void concurrentUpdates();
+    void concurrentSnapshots();
+};
+
+void tst_QConcurrentHash::shardCount()
+{
+    using Hash = QConcurrentHash<int, int>;
+    QCOMPARE(Hash().shardCount(), Hash::DefaultShardCount);
+    QCOMPARE(Hash(0).shardCount(), 1);
+    QCOMPARE(Hash(1).shardCount(), 1);
+    QCOMPARE(Hash(5).shardCount(), 8);
+    QCOMPARE(Hash(16).shardCount(), 16);
+}
+
+void tst_QConcurrentHash::basics()
+{
+    QConcurrentHash<QString, int> hash(4);
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.size(), 0);
+    QVERIFY(!hash.contains(u"a"_s));
+    QCOMPARE(hash.value(u"a"_s), 0);
+    QCOMPARE(hash.value(u"a"_s, -1), -1);
+
+    for (int i = 0; i < 100; ++i)
+        hash.insert(QString::number(i), i);
+    QCOMPARE(hash.size(), 100);
+    QCOMPARE(hash.count(), 100);
+    QVERIFY(!hash.isEmpty());
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.value(QString::number(i)), i);
+
+    hash.insert(u"5"_s, 500);
+    QCOMPARE(hash.value(u"5"_s), 500);
+    QCOMPARE(hash.size(), 100);
+
+    QVERIFY(!hash.tryInsert(u"5"_s, 5));
+    QCOMPARE(hash.value(u"5"_s), 500);
+    QVERIFY(hash.tryInsert(u"new"_s, 1));
+    QCOMPARE(hash.size(), 101);
+
+    int seen = 0;
+    QVERIFY(hash.visit(u"7"_s, [&](const int &v) { seen = v; }));
+    QCOMPARE(seen, 7);
+    QVERIFY(!hash.visit(u"nope"_s, [&](const int &) { seen = -1; }));
+    QCOMPARE(seen, 7);
+
+    QVERIFY(hash.update(u"7"_s, [](int &v) { v *= 2; }));
+    QCOMPARE(hash.value(u"7"_s), 14);
+    QVERIFY(!hash.update(u"nope"_s, [](int &v) { v = 0; }));
+    QVERIFY(!hash.contains(u"nope"_s));
+
+    QVERIFY(hash.remove(u"new"_s));
+    QVERIFY(!hash.remove(u"new"_s));
+    QCOMPARE(hash.take(u"9"_s), 9);
+    QCOMPARE(hash.take(u"9"_s), 0);
+    QCOMPARE(hash.size(), 99);
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    hash.reserve(1000);
+    QVERIFY(hash.isEmpty());
+}
+
+void tst_QConcurrentHash::customHash()
+{
+    QConcurrentHash<Point, QString> hash;
+    for (int i = 0; i < 50; ++i)
+        hash.insert({ i, -i }, QString::number(i));
+    QCOMPARE(hash.size(), 50);
+    for (int i = 0; i < 50; ++i)
+        QCOMPARE(hash.value({ i, -i }), QString::number(i));
+    QVERIFY(!hash.contains({ 1, 1 }));
+
+    const auto snapshot = hash.snapshot();
+    QCOMPARE(snapshot.value({ 3, -3 }), u"3"_s);
+    QVERIFY(!snapshot.contains({ 3, 3 }));
+}
+
+void tst_QConcurrentHash::insertOrUpdate()
+{
+    QConcurrentHash<QString, int> hash;
+    QVERIFY(hash.insertOrUpdate(u"a"_s, 1, [](int &v) { ++v; }));
+    QCOMPARE(hash.value(u"a"_s), 1);
+    QVERIFY(!hash.insertOrUpdate(u"a"_s, 1, [](int &v) { ++v; }));
+    QVERIFY(!hash.insertOrUpdate(u"a"_s, 1, [](int &v) { ++v; }));
+    QCOMPARE(hash.value(u"a"_s), 3);
+}
+
+void tst_QConcurrentHash::valueOrInsert()
+{
+    QConcurrentHash<int, QString> hash;
+    int calls = 0;
+    auto create = [&] { ++calls; return u"created"_s; };
+    QCOMPARE(hash.valueOrInsert(1, create), u"created"_s);
+    QCOMPARE(hash.valueOrInsert(1, create), u"created"_s);
+    QCOMPARE(calls, 1);
+
+    hash.insert(2, u"existing"_s);
+    QCOMPARE(hash.valueOrInsert(2, create), u"existing"_s);
+    QCOMPARE(calls, 1);
+}
+
+void tst_QConcurrentHash::removeIf()
+{
+    QConcurrentHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i * i);
+    const qsizetype removed = hash.removeIf([](const auto &it) { return it.key() % 3 == 0; });
+    QCOMPARE(removed, 334);
+    QCOMPARE(hash.size(), 666);
+    QVERIFY(!hash.contains(999));
+    QVERIFY(hash.contains(998));
+}
+
+void tst_QConcurrentHash::snapshot()
+{
+    QConcurrentHash<int, int> hash(8);
+    const auto empty = hash.snapshot();
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(empty.begin(), empty.end());
+
+    QHash<int, int> expected;
+    for (int i = 0; i < 500; ++i) {
+        hash.insert(i, -i);
+        expected.insert(i, -i);
+    }
+    const auto snapshot = hash.snapshot();
+    QCOMPARE(snapshot.size(), 500);
+
+    QHash<int, int> iterated;
+    for (auto it = snapshot.begin(); it != snapshot.end(); ++it) {
+        QVERIFY(!iterated.contains(it.key()));
+        iterated.insert(it.key(), *it);
+    }
+    QCOMPARE(iterated, expected);
+    QCOMPARE(snapshot.toHash(), expected);
+    QCOMPARE(hash.toHash(), expected);
+
+    qsizetype n = 0;
+    for (int v : snapshot) {
+        QVERIFY(v <= 0);
+        ++n;
+    }
+    QCOMPARE(n, 500);
+}
+
+void tst_QConcurrentHash::snapshotIsolation()
+{
+    QConcurrentHash<int, QString> hash;
+    hash.insert(1, u"one"_s);
+    hash.insert(2, u"two"_s);
+    const auto before = hash.snapshot();
+
+    hash.insert(1, u"uno"_s);
+    hash.remove(2);
+    hash.insert(3, u"three"_s);
+
+    QCOMPARE(before.size(), 2);
+    QCOMPARE(before.value(1), u"one"_s);
+    QCOMPARE(before.value(2), u"two"_s);
+    QVERIFY(!before.contains(3));
+
+    const auto after = hash.snapshot();
+    QCOMPARE(after.size(), 2);
+    QCOMPARE(after.value(1), u"uno"_s);
+    QVERIFY(!after.contains(2));
+}
+
+void tst_QConcurrentHash::concurrentInserts()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int PerThread = 2000;
+    QConcurrentHash<int, int> hash;
+    QTestThreads::Failures failures;
+    QVERIFY(QTestThreads::runInThreads(ThreadCount, [&](int t) {
+        for (int i = 0; i < PerThread; ++i) {
+            const int key = t * PerThread + i;
+            hash.insert(key, key);
+            if (i % 2)
+                failures.verify(hash.remove(key - 1), "a key inserted by this thread is missing");
+        }
+    }));
+    QVERIFY2(failures.isEmpty(), failures.report());
+    QCOMPARE(hash.size(), ThreadCount * PerThread / 2);
+    for (int key = 0; key < ThreadCount * PerThread; ++key)
+        QCOMPARE(hash.contains(key), key % 2 == 1);
+}
+
+void tst_QConcurrentHash::concurrentUpdates()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int Iterations = 5000;
+    constexpr int KeyCount = 16;
+    QConcurrentHash<int, int> hash(4);
+    QAtomicInt created;
+    QVERIFY(QTestThreads::runInThreads(ThreadCount, [&](int t) {
+        for (int i = 0; i < Iterations; ++i) {
+            const int key = (i + t) % KeyCount;
+            hash.insertOrUpdate(key, 1, [](int &v) { ++v; });
+            hash.valueOrInsert(KeyCount + key, [&] { created.ref(); return 0; });
+        }
+    }));
+    int total = 0;
+    for (int key = 0; key < KeyCount; ++key)
+        total += hash.value(key);
+    QCOMPARE(total, ThreadCount * Iterations);
+    // the factory ran exactly once per key
+    QCOMPARE(created.loadRelaxed(), KeyCount);
+}
+
+void tst_QConcurrentHash::concurrentSnapshots()
+{
+    // each writer inserts its keys in order, so every snapshot taken at
+    // one point in time sees a prefix of the keys of each writer
+    constexpr int Writers = 3;
+    constexpr int PerWriter = 20000;
+    QConcurrentHash<int, int> hash(16);
+    QTestThreads::Failures failures;
+    QVERIFY(QTestThreads::runInThreads(Writers + 1, [&](int t) {
+        if (t < Writers) {
+            for (int i = 0; i < PerWriter; ++i)
+                hash.insert(t * PerWriter + i, i);
+            return;
+        }
+        for (int round = 0; round < 200; ++round) {
+            const auto snapshot = hash.snapshot();
+            int present[Writers] = {};
+            for (auto it = snapshot.begin(); it != snapshot.end(); ++it)
+                ++present[it.key() / PerWriter];
+            for (int w = 0; w < Writers; ++w) {
+                failures.verify(!present[w] || snapshot.contains(w * PerWriter + present[w] - 1),
+                                "a snapshot is missing keys inserted before others it has");
+            }
+        }
+    }));
+    QVERIFY2(failures.isEmpty(), failures.report());
+    QCOMPARE(hash.size(), Writers * PerWriter);
+}
+
+QTEST_MAIN(tst_QConcurrentHash)
+#include "tst_qconcurrenthash.moc"
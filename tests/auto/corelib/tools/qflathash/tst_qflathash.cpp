@@ -0,0 +1,408 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <qflathash.h>
+#include <qrandom.h>
+#include <qset.h>
+#include <qstring.h>
+
+#include <unordered_map>
+
+using namespace Qt::StringLiterals;
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void construction();
+    void insertAndLookup();
+    void operatorBracket();
+    void removeAndTake();
+    void implicitSharing();
+    void iteration();
+    void eraseWhileIterating();
+    void eraseKeepsOtherItems();
+    void reserveAndSqueeze();
+    void collidingHashes();
+    void deletedSlotsAreReused();
+    void randomOperations();
+    void countInstances();
+    void equality();
+    void removeIf();
+};
+
+struct BadHash
+{
+    int value;
+    friend bool operator==(BadHash a, BadHash b) noexcept { return a.value == b.value; }
+    // only four different hashes, all with the same tag
+    friend size_t qHash(BadHash key, size_t = 0) noexcept { return size_t(key.value % 4) << 7; }
+};
+
+struct Counted
+{
+    static inline int instances = 0;
+    int value = 0;
+
+    Counted() { ++instances; }
+    Counted(int v) : value(v) { ++instances; }
+    Counted(const Counted &other) : value(other.value) { ++instances; }
+    Counted &operator=(const Counted &other) = default;
+    ~Counted() { --instances; }
+    friend bool operator==(const Counted &a, const Counted &b) { return a.value == b.value; }
+};
+
+void tst_QFlatHash::construction()
+{
+    QFlatHash<int, QString> empty;
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(empty.size(), 0);
+    QCOMPARE(empty.capacity(), 0);
+    QVERIFY(!empty.contains(1));
+    QCOMPARE(empty.value(1, u"x"_s), u"x"_s);
+    QVERIFY(empty.begin() == empty.end());
+    QVERIFY(empty.find(1) == empty.end());
+
+    QFlatHash<int, QString> hash { { 1, u"one"_s }, { 2, u"two"_s }, { 1, u"uno"_s } };
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash.value(1), u"uno"_s);
+    QCOMPARE(hash.value(2), u"two"_s);
+
+    const QHash<int, QString> source { { 3, u"three"_s }, { 4, u"four"_s } };
+    const QFlatHash<int, QString> fromRange(source.keyValueBegin(), source.keyValueEnd());
+    QCOMPARE(fromRange.size(), 2);
+    QCOMPARE(fromRange.value(4), u"four"_s);
+
+    QFlatHash<int, QString> moved = std::move(hash);
+    QCOMPARE(moved.size(), 2);
+    QVERIFY(hash.isEmpty());
+}
+
+void tst_QFlatHash::insertAndLookup()
+{
+    QFlatHash<QString, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(QString::number(i), i);
+    QCOMPARE(hash.size(), 1000);
+    QVERIFY(hash.load_factor() <= hash.max_load_factor());
+
+    for (int i = 0; i < 1000; ++i) {
+        const QString key = QString::number(i);
+        QVERIFY(hash.contains(key));
+        QCOMPARE(hash.count(key), 1);
+        QCOMPARE(hash.value(key), i);
+        auto it = hash.constFind(key);
+        QVERIFY(it != hash.constEnd());
+        QCOMPARE(it.key(), key);
+        QCOMPARE(*it, i);
+    }
+    QVERIFY(!hash.contains(u"1000"_s));
+    QCOMPARE(hash.value(u"-1"_s, -1), -1);
+
+    // replacing keeps the size
+    auto it = hash.insert(u"7"_s, 70);
+    QCOMPARE(it.value(), 70);
+    QCOMPARE(hash.size(), 1000);
+    QCOMPARE(hash.value(u"7"_s), 70);
+
+    it = hash.emplace(u"emplaced"_s, 5);
+    QCOMPARE(it.key(), u"emplaced"_s);
+    QCOMPARE(hash.size(), 1001);
+}
+
+void tst_QFlatHash::operatorBracket()
+{
+    QFlatHash<int, int> hash;
+    hash[1] = 10;
+    ++hash[2];
+    ++hash[2];
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash[1], 10);
+    QCOMPARE(hash[2], 2);
+
+    const QFlatHash<int, int> &constHash = hash;
+    QCOMPARE(constHash[3], 0);
+    QCOMPARE(hash.size(), 2);
+}
+
+void tst_QFlatHash::removeAndTake()
+{
+    QFlatHash<int, QString> hash;
+    QVERIFY(!hash.remove(1));
+    QCOMPARE(hash.take(1), QString());
+
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, QString::number(i));
+    QVERIFY(hash.remove(10));
+    QVERIFY(!hash.remove(10));
+    QCOMPARE(hash.take(20), u"20"_s);
+    QCOMPARE(hash.take(20), QString());
+    QCOMPARE(hash.size(), 98);
+    QVERIFY(!hash.contains(10));
+    QVERIFY(!hash.contains(20));
+    QCOMPARE(hash.value(30), u"30"_s);
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QVERIFY(!hash.contains(30));
+}
+
+void tst_QFlatHash::implicitSharing()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 50; ++i)
+        hash.insert(i, i);
+
+    QFlatHash<int, int> copy = hash;
+    QVERIFY(copy.isSharedWith(hash));
+
+    // const access does not detach
+    QCOMPARE(copy.value(5), 5);
+    QVERIFY(copy.constFind(6) != copy.constEnd());
+    QVERIFY(copy.isSharedWith(hash));
+
+    copy.insert(100, 100);
+    QVERIFY(!copy.isSharedWith(hash));
+    QCOMPARE(copy.size(), 51);
+    QCOMPARE(hash.size(), 50);
+    QVERIFY(!hash.contains(100));
+
+    copy = hash;
+    QVERIFY(copy.remove(3));
+    QVERIFY(hash.contains(3));
+
+    // a reference into the shared data stays usable across the detach
+    copy = hash;
+    const int &value = *hash.constFind(7);
+    copy.insert(200, value);
+    QCOMPARE(copy.value(200), 7);
+}
+
+void tst_QFlatHash::iteration()
+{
+    QFlatHash<int, int> hash;
+    QSet<int> expected;
+    for (int i = 0; i < 300; ++i) {
+        hash.insert(i * 7, i);
+        expected.insert(i * 7);
+    }
+
+    QSet<int> seen;
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+        QCOMPARE(it.value(), it.key() / 7);
+        QVERIFY(!seen.contains(it.key()));
+        seen.insert(it.key());
+    }
+    QCOMPARE(seen, expected);
+
+    for (auto it = hash.begin(); it != hash.end(); ++it)
+        *it *= 2;
+    QCOMPARE(hash.value(70), 20);
+
+    QCOMPARE(hash.keys().size(), 300);
+    QCOMPARE(hash.values().size(), 300);
+}
+
+void tst_QFlatHash::eraseWhileIterating()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+
+    int visited = 0;
+    auto it = hash.begin();
+    while (it != hash.end()) {
+        ++visited;
+        if (it.key() % 2)
+            it = hash.erase(it);
+        else
+            ++it;
+    }
+    QCOMPARE(visited, 1000);
+    QCOMPARE(hash.size(), 500);
+    for (int i = 0; i < 1000; ++i)
+        QCOMPARE(hash.contains(i), i % 2 == 0);
+}
+
+void tst_QFlatHash::eraseKeepsOtherItems()
+{
+    QFlatHash<int, QString> hash;
+    hash.reserve(1300);
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, QString::number(i));
+
+    const QString *kept = &hash.find(500).value();
+    auto keptIterator = hash.find(502);
+    for (int i = 0; i < 1000; i += 3)
+        hash.remove(i);
+    QCOMPARE(kept, &hash.find(500).value());
+    QCOMPARE(*kept, u"500"_s);
+    QCOMPARE(keptIterator.key(), 502);
+    QVERIFY(keptIterator == hash.find(502));
+
+    // up to the reserved capacity, inserting does not move items either
+    for (int i = 1000; i < 1300; ++i)
+        hash.insert(i, QString::number(i));
+    QCOMPARE(kept, &hash.find(500).value());
+}
+
+void tst_QFlatHash::reserveAndSqueeze()
+{
+    QFlatHash<int, int> hash;
+    hash.reserve(1000);
+    QVERIFY(hash.capacity() >= 1000);
+    const qsizetype capacity = hash.capacity();
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+    QCOMPARE(hash.capacity(), capacity);
+
+    for (int i = 10; i < 1000; ++i)
+        hash.remove(i);
+    hash.squeeze();
+    QVERIFY(hash.capacity() < capacity);
+    QVERIFY(hash.capacity() >= 10);
+    for (int i = 0; i < 10; ++i)
+        QCOMPARE(hash.value(i, -1), i);
+
+    // reserving a shared hash detaches it
+    QFlatHash<int, int> copy = hash;
+    copy.reserve(5000);
+    QVERIFY(!copy.isSharedWith(hash));
+    QVERIFY(copy.capacity() >= 5000);
+    QCOMPARE(copy.size(), 10);
+    QCOMPARE(copy.value(9), 9);
+}
+
+void tst_QFlatHash::collidingHashes()
+{
+    // all keys in four probe sequences: lookups must go through many
+    // groups, and erasing has to leave markers behind
+    QFlatHash<BadHash, int> hash;
+    for (int i = 0; i < 400; ++i)
+        hash.insert(BadHash{i}, i);
+    QCOMPARE(hash.size(), 400);
+    for (int i = 0; i < 400; ++i)
+        QCOMPARE(hash.value(BadHash{i}, -1), i);
+    QVERIFY(!hash.contains(BadHash{400}));
+
+    for (int i = 0; i < 400; i += 2)
+        QVERIFY(hash.remove(BadHash{i}));
+    for (int i = 0; i < 400; ++i)
+        QCOMPARE(hash.contains(BadHash{i}), i % 2 == 1);
+    for (int i = 0; i < 400; i += 2)
+        hash.insert(BadHash{i}, -i);
+    QCOMPARE(hash.size(), 400);
+    for (int i = 0; i < 400; ++i)
+        QCOMPARE(hash.value(BadHash{i}), i % 2 ? i : -i);
+}
+
+void tst_QFlatHash::deletedSlotsAreReused()
+{
+    // a hash that stays small must not grow because of erasures
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 50; ++i)
+        hash.insert(i, i);
+    const qsizetype capacity = hash.capacity();
+    for (int round = 1; round < 200; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            QVERIFY(hash.remove((round - 1) * 50 + i));
+            hash.insert(round * 50 + i, i);
+        }
+    }
+    QCOMPARE(hash.size(), 50);
+    QCOMPARE(hash.capacity(), capacity);
+    for (int i = 0; i < 50; ++i)
+        QCOMPARE(hash.value(199 * 50 + i, -1), i);
+}
+
+void tst_QFlatHash::randomOperations()
+{
+    QRandomGenerator rng(1234);
+    QFlatHash<quint32, quint32> hash;
+    std::unordered_map<quint32, quint32> reference;
+
+    for (int i = 0; i < 100000; ++i) {
+        const quint32 key = rng.bounded(5000);
+        switch (rng.bounded(4)) {
+        case 0:
+        case 1:
+            hash.insert(key, quint32(i));
+            reference[key] = quint32(i);
+            break;
+        case 2:
+            QCOMPARE(hash.remove(key), reference.erase(key) == 1);
+            break;
+        case 3: {
+            auto it = reference.find(key);
+            const auto found = hash.constFind(key);
+            QCOMPARE(found != hash.constEnd(), it != reference.end());
+            if (it != reference.end())
+                QCOMPARE(*found, it->second);
+            break;
+        }
+        }
+        QCOMPARE(hash.size(), qsizetype(reference.size()));
+    }
+
+    qsizetype count = 0;
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it, ++count)
+        QCOMPARE(reference.at(it.key()), it.value());
+    QCOMPARE(count, qsizetype(reference.size()));
+}
+
+void tst_QFlatHash::countInstances()
+{
+    Counted::instances = 0;
+    {
+        QFlatHash<int, Counted> hash;
+        for (int i = 0; i < 500; ++i)
+            hash.insert(i, Counted(i));
+        QCOMPARE(Counted::instances, 500);
+
+        QFlatHash<int, Counted> copy = hash;
+        copy.remove(1);         // detaches
+        QCOMPARE(Counted::instances, 999);
+        copy.clear();
+        QCOMPARE(Counted::instances, 500);
+
+        for (int i = 0; i < 500; i += 2)
+            hash.remove(i);
+        QCOMPARE(Counted::instances, 250);
+        hash.squeeze();
+        QCOMPARE(Counted::instances, 250);
+        QCOMPARE(hash.value(3).value, 3);
+    }
+    QCOMPARE(Counted::instances, 0);
+}
+
+void tst_QFlatHash::equality()
+{
+    QFlatHash<int, QString> a { { 1, u"one"_s }, { 2, u"two"_s } };
+    QFlatHash<int, QString> b;
+    QVERIFY(a != b);
+    b.insert(2, u"two"_s);
+    b.insert(1, u"one"_s);
+    QVERIFY(a == b);
+    b.insert(1, u"uno"_s);
+    QVERIFY(a != b);
+    b = a;
+    QVERIFY(a == b);
+}
+
+void tst_QFlatHash::removeIf()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i * i);
+    QCOMPARE(hash.removeIf([](auto it) { return it.key() % 10 == 0; }), 10);
+    QCOMPARE(erase_if(hash, [](std::pair<const int &, int &> p) { return p.second > 2500; }), 45);
+    QCOMPARE(hash.size(), 45);
+    QVERIFY(!hash.contains(10));
+    QVERIFY(hash.contains(49));
+    QVERIFY(!hash.contains(51));
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatHash)
+#include "tst_qflathash.moc"
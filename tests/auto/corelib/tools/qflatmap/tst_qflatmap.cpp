@@ -2,10 +2,10 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #define QT_USE_QSTRINGBUILDER
-#define QFLATMAP_ENABLE_STL_COMPATIBLE_INSERT
 
 #include <QTest>
 
+#include <QFlatMap>
 #include <private/qflatmap_p.h>
 #include <qbytearray.h>
 #include <qstring.h>
@@ -13,7 +13,10 @@
 #include <qvarlengtharray.h>
 
 #include <algorithm>
+#include <limits>
 #include <list>
+#include <map>
+#include <random>
 #include <tuple>
 
 static constexpr bool is_even(int n) { return n % 2 == 0; }
@@ -35,6 +38,7 @@ class tst_QFlatMap : public QObject
     Q_OBJECT
 private slots:
     void constructing();
+    void constructingFromUnsortedInput();
     void constAccess();
     void insertion();
     void insertRValuesAndLValues();
@@ -50,12 +54,15 @@ private slots:
     void try_emplace_and_insert_or_assign();
     void viewIterators();
     void varLengthArray();
+    void integralLowerBound();
 
 private:
     template <typename Compare>
     void transparency_impl();
     template <typename Predicate>
     void remove_if_impl(Predicate p, bool removeNonEmptyValues = false);
+    template <typename Key>
+    void integralLowerBound_impl();
 };
 
 void tst_QFlatMap::constructing()
@@ -109,6 +116,66 @@ void tst_QFlatMap::constructing()
     auto fmFromSortedRange = Map(Qt::OrderedUniqueRange, sv.begin(), sv.end());
 }
 
+void tst_QFlatMap::constructingFromUnsortedInput()
+{
+    using Map = QFlatMap<int, QByteArray>;
+    // the first of equivalent keys wins, whichever constructor is used
+    const Map::key_container_type keys = { 5, 3, 5, 1, 3, 9 };
+    const Map::mapped_container_type values = { "a", "b", "c", "d", "e", "f" };
+    const Map::key_container_type expectedKeys = { 1, 3, 5, 9 };
+    const Map::mapped_container_type expectedValues = { "d", "b", "a", "f" };
+
+    const Map fromContainers(keys, values);
+    QCOMPARE(fromContainers.keys(), expectedKeys);
+    QCOMPARE(fromContainers.values(), expectedValues);
+
+    std::vector<Map::value_type> pairs;
+    for (qsizetype i = 0; i < keys.size(); ++i)
+        pairs.emplace_back(keys.at(i), values.at(i));
+    const Map fromRange(pairs.begin(), pairs.end());
+    QCOMPARE(fromRange.keys(), expectedKeys);
+    QCOMPARE(fromRange.values(), expectedValues);
+
+    const Map fromInitList{ { 2, "x" }, { 1, "y" }, { 2, "z" } };
+    QCOMPARE(fromInitList.keys(), Map::key_container_type({ 1, 2 }));
+    QCOMPARE(fromInitList.value(2), "x");
+
+    // sorted, unique input is used as is, without detaching
+    const Map::key_container_type sortedKeys = expectedKeys;
+    const Map::mapped_container_type sortedValues = expectedValues;
+    const Map fromSorted(sortedKeys, sortedValues);
+    QVERIFY(fromSorted.keys().isSharedWith(sortedKeys));
+    QVERIFY(fromSorted.values().isSharedWith(sortedValues));
+
+    // copies share the containers
+    Map copy = fromContainers;
+    QVERIFY(copy.keys().isSharedWith(fromContainers.keys()));
+    copy.insert_or_assign(1, "changed");
+    QCOMPARE(fromContainers.value(1), "d");
+    QCOMPARE(copy.value(1), "changed");
+
+    // a large random input
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 2000);
+    Map::key_container_type randomKeys;
+    Map::mapped_container_type randomValues;
+    std::map<int, QByteArray> reference;
+    for (int i = 0; i < 5000; ++i) {
+        const int k = dist(rng);
+        randomKeys.append(k);
+        randomValues.append(QByteArray::number(i));
+        reference.emplace(k, randomValues.last());
+    }
+    const Map big(std::move(randomKeys), std::move(randomValues));
+    QCOMPARE(size_t(big.size()), reference.size());
+    auto it = big.begin();
+    for (const auto &[k, v] : reference) {
+        QCOMPARE(it.key(), k);
+        QCOMPARE(it.value(), v);
+        ++it;
+    }
+}
+
 void tst_QFlatMap::constAccess()
 {
     using Map = QFlatMap<QByteArray, QByteArray>;
@@ -728,5 +795,61 @@ void tst_QFlatMap::varLengthArray()
     QVERIFY(m.isEmpty());
 }
 
+template <typename Key>
+void tst_QFlatMap::integralLowerBound_impl()
+{
+    static_assert(QtPrivate::FlatMapHasFastLowerBound<Key, std::less<Key>, QList<Key>>);
+    using Limits = std::numeric_limits<Key>;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<qint64> dist(qint64(Limits::min() / 2), qint64(Limits::max() / 2));
+    for (qsizetype size : { 0, 1, 2, 15, 16, 17, 31, 64, 100, 127, 128, 129, 1000, 4099 }) {
+        QList<Key> keys;
+        keys.append(Limits::min());
+        for (qsizetype i = 1; i < size; ++i)
+            keys.append(Key(dist(rng)));
+        if (size > 2)
+            keys.last() = Limits::max();
+        keys.resize(size);
+        QFlatMap<Key, int> map(keys, QList<int>(size, 0));
+        const QList<Key> &sorted = map.keys();
+
+        QList<Key> probes = { Limits::min(), Key(Limits::min() + 1), Key(0), Key(1),
+                              Key(Limits::max() - 1), Limits::max() };
+        for (Key k : sorted) {
+            probes.append(k);
+            if (k != Limits::min())
+                probes.append(Key(k - 1));
+            if (k != Limits::max())
+                probes.append(Key(k + 1));
+        }
+        for (Key probe : probes) {
+            const auto expected = std::lower_bound(sorted.begin(), sorted.end(), probe) - sorted.begin();
+            QCOMPARE(map.lower_bound(probe) - map.begin(), expected);
+            QCOMPARE(map.contains(probe), std::binary_search(sorted.begin(), sorted.end(), probe));
+        }
+    }
+}
+
+void tst_QFlatMap::integralLowerBound()
+{
+    integralLowerBound_impl<qint8>();
+    integralLowerBound_impl<quint8>();
+    integralLowerBound_impl<char>();
+    integralLowerBound_impl<qint16>();
+    integralLowerBound_impl<quint16>();
+    integralLowerBound_impl<char16_t>();
+    integralLowerBound_impl<qint32>();
+    integralLowerBound_impl<quint32>();
+    integralLowerBound_impl<qint64>();
+    integralLowerBound_impl<quint64>();
+
+    static_assert(!QtPrivate::FlatMapHasFastLowerBound<int, std::greater<int>, QList<int>>);
+    static_assert(!QtPrivate::FlatMapHasFastLowerBound<bool, std::less<bool>, QList<bool>>);
+    static_assert(!QtPrivate::FlatMapHasFastLowerBound<int, std::less<int>, std::list<int>>);
+    QFlatMap<int, int, std::greater<int>> descending{ { 1, 1 }, { 3, 3 }, { 2, 2 } };
+    QCOMPARE(descending.lower_bound(2).key(), 2);
+    QCOMPARE(descending.begin().key(), 3);
+}
+
 QTEST_APPLESS_MAIN(tst_QFlatMap)
 #include "tst_qflatmap.moc"
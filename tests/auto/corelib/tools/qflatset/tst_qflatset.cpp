@@ -0,0 +1,208 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QFlatSet>
+#include <QString>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+class tst_QFlatSet : public QObject
+{
+    Q_OBJECT
+private slots:
+    void constructing();
+    void insertion();
+    void rangeInsertion();
+    void removal();
+    void lookup();
+    void implicitSharing();
+    void customCompare();
+    void stdVector();
+    void randomOperations();
+};
+
+void tst_QFlatSet::constructing()
+{
+    QFlatSet<int> empty;
+    QVERIFY(empty.isEmpty());
+    QVERIFY(empty.empty());
+    QCOMPARE(empty.size(), 0);
+    QCOMPARE(empty.begin(), empty.end());
+
+    const QFlatSet<int> fromList({ 5, 1, 3, 1, 5, 2 });
+    QCOMPARE(fromList.values(), QList<int>({ 1, 2, 3, 5 }));
+    QCOMPARE(fromList.count(), 4);
+
+    const std::vector<int> v = { 9, 8, 9, 7 };
+    const QFlatSet<int> fromRange(v.begin(), v.end());
+    QCOMPARE(fromRange.values(), QList<int>({ 7, 8, 9 }));
+
+    QList<int> keys = { 4, 4, 2 };
+    const QFlatSet<int> fromContainer(std::move(keys));
+    QCOMPARE(fromContainer.values(), QList<int>({ 2, 4 }));
+
+    const QFlatSet<int> ordered(Qt::OrderedUniqueRange, { 1, 2, 3 });
+    QCOMPARE(ordered.values(), QList<int>({ 1, 2, 3 }));
+
+    QFlatSet<int> moved = fromList;
+    const QList<int> extracted = std::move(moved).extract();
+    QCOMPARE(extracted, fromList.values());
+}
+
+void tst_QFlatSet::insertion()
+{
+    QFlatSet<QString> set;
+    auto r = set.insert(QStringLiteral("b"));
+    QVERIFY(r.second);
+    QCOMPARE(*r.first, u"b");
+    r = set.insert(QStringLiteral("a"));
+    QVERIFY(r.second);
+    QCOMPARE(r.first, set.begin());
+    const QString c = QStringLiteral("c");
+    r = set.insert(c);
+    QVERIFY(r.second);
+    QCOMPARE(r.first, std::prev(set.end()));
+    r = set.insert(QStringLiteral("b"));
+    QVERIFY(!r.second);
+    QCOMPARE(*r.first, u"b");
+    QCOMPARE(set.values(), QStringList({ "a", "b", "c" }));
+}
+
+void tst_QFlatSet::rangeInsertion()
+{
+    QFlatSet<int> set({ 10, 20, 30 });
+    const std::vector<int> more = { 25, 5, 20, 25, 35 };
+    set.insert(more.begin(), more.end());
+    QCOMPARE(set.values(), QList<int>({ 5, 10, 20, 25, 30, 35 }));
+
+    const std::vector<int> sorted = { 1, 10, 40 };
+    set.insert(Qt::OrderedUniqueRange, sorted.begin(), sorted.end());
+    QCOMPARE(set.values(), QList<int>({ 1, 5, 10, 20, 25, 30, 35, 40 }));
+}
+
+void tst_QFlatSet::removal()
+{
+    QFlatSet<int> set({ 1, 2, 3, 4, 5, 6 });
+    QVERIFY(set.remove(3));
+    QVERIFY(!set.remove(3));
+    QCOMPARE(set.values(), QList<int>({ 1, 2, 4, 5, 6 }));
+
+    auto it = set.erase(set.find(4));
+    QCOMPARE(*it, 5);
+    it = set.erase(set.begin(), std::next(set.begin(), 2));
+    QCOMPARE(it, set.begin());
+    QCOMPARE(set.values(), QList<int>({ 5, 6 }));
+
+    set.insert(7);
+    set.insert(8);
+    QCOMPARE(set.remove_if([](int k) { return k % 2 == 0; }), 2);
+    QCOMPARE(set.values(), QList<int>({ 5, 7 }));
+
+    set.clear();
+    QVERIFY(set.isEmpty());
+}
+
+void tst_QFlatSet::lookup()
+{
+    const QFlatSet<int> set({ 2, 4, 6, 8 });
+    QVERIFY(set.contains(4));
+    QVERIFY(!set.contains(5));
+    QCOMPARE(set.find(5), set.end());
+    QCOMPARE(*set.find(6), 6);
+    QCOMPARE(*set.lower_bound(5), 6);
+    QCOMPARE(*set.lower_bound(6), 6);
+    QCOMPARE(*set.upper_bound(6), 8);
+    QCOMPARE(set.lower_bound(9), set.end());
+    QCOMPARE(set.lower_bound(1), set.begin());
+    QCOMPARE(*set.rbegin(), 8);
+    QCOMPARE(std::distance(set.rbegin(), set.rend()), 4);
+
+    // transparent lookup
+    const QFlatSet<QString, std::less<>> strings({ QStringLiteral("x"), QStringLiteral("y") });
+    QVERIFY(strings.contains(QStringView(u"x")));
+    QVERIFY(!strings.contains(QStringView(u"z")));
+    QCOMPARE(*strings.lower_bound(QStringView(u"xx")), u"y");
+}
+
+void tst_QFlatSet::implicitSharing()
+{
+    QFlatSet<int> a({ 1, 2, 3 });
+    QFlatSet<int> b = a;
+    QVERIFY(b.values().isSharedWith(a.values()));
+    QCOMPARE(a, b);
+
+    b.insert(4);
+    QVERIFY(!b.values().isSharedWith(a.values()));
+    QCOMPARE(a.size(), 3);
+    QCOMPARE(b.size(), 4);
+    QVERIFY(a != b);
+
+    // sorted, unique input does not detach the container
+    const QList<int> sorted = { 1, 2, 3 };
+    const QFlatSet<int> c(sorted);
+    QVERIFY(c.values().isSharedWith(sorted));
+}
+
+void tst_QFlatSet::customCompare()
+{
+    const QFlatSet<int, std::greater<int>> set({ 1, 3, 2, 3 });
+    QCOMPARE(set.values(), QList<int>({ 3, 2, 1 }));
+    QCOMPARE(*set.lower_bound(2), 2);
+    QVERIFY(set.contains(1));
+    QVERIFY(!set.contains(4));
+
+    auto caseInsensitive = [](const QString &lhs, const QString &rhs) {
+        return lhs.compare(rhs, Qt::CaseInsensitive) < 0;
+    };
+    QFlatSet<QString, decltype(caseInsensitive)> words({ "b", "A", "a", "B" }, caseInsensitive);
+    // the first of equivalent keys is kept
+    QCOMPARE(words.values(), QStringList({ "A", "b" }));
+    QVERIFY(words.contains(QStringLiteral("B")));
+}
+
+void tst_QFlatSet::stdVector()
+{
+    QFlatSet<qint64, std::less<qint64>, std::vector<qint64>> set({ 3, -1, 3 });
+    QCOMPARE(set.size(), size_t(2));
+    QVERIFY(set.insert(2).second);
+    QCOMPARE(set.values(), std::vector<qint64>({ -1, 2, 3 }));
+    QVERIFY(set.contains(-1));
+}
+
+void tst_QFlatSet::randomOperations()
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> key(-500, 500);
+    std::uniform_int_distribution<int> op(0, 3);
+    QFlatSet<int> set;
+    std::set<int> reference;
+    for (int i = 0; i < 5000; ++i) {
+        const int k = key(rng);
+        switch (op(rng)) {
+        case 0:
+        case 1:
+            QCOMPARE(set.insert(k).second, reference.insert(k).second);
+            break;
+        case 2:
+            QCOMPARE(set.remove(k), reference.erase(k) == 1);
+            break;
+        case 3: {
+            const auto it = set.lower_bound(k);
+            const auto expected = reference.lower_bound(k);
+            QCOMPARE(it == set.end(), expected == reference.end());
+            if (it != set.end())
+                QCOMPARE(*it, *expected);
+            break;
+        }
+        }
+    }
+    QVERIFY(std::equal(set.begin(), set.end(), reference.begin(), reference.end()));
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatSet)
+#include "tst_qflatset.moc"
@@ -0,0 +1,339 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QMemoryResource>
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QThread>
+
+#include <stdlib.h>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+// Allocates with malloc(), and keeps track of the blocks it handed out
+class CountingResource : public QMemoryResource
+{
+public:
+    qsizetype allocations = 0;
+    qsizetype outstandingBlocks = 0;
+    qsizetype outstandingBytes = 0;
+    bool failing = false;
+
+protected:
+    void *doAllocate(qsizetype size, qsizetype alignment) noexcept override
+    {
+        if (failing)
+            return nullptr;
+        Q_ASSERT(alignment <= qsizetype(alignof(std::max_align_t)));
+        ++allocations;
+        ++outstandingBlocks;
+        outstandingBytes += size;
+        return ::malloc(size_t(size));
+    }
+
+    void doDeallocate(void *p, qsizetype size, qsizetype) noexcept override
+    {
+        --outstandingBlocks;
+        outstandingBytes -= size;
+        ::free(p);
+    }
+};
+
+struct alignas(64) OverAligned
+{
+    char c;
+};
+}
+Q_DECLARE_TYPEINFO(OverAligned, Q_PRIMITIVE_TYPE);
+
+class tst_QMemoryResource : public QObject
+{
+    Q_OBJECT
+private slots:
+    void reserve();
+    void otherAllocationsUnaffected();
+    void destroyedAfterwards();
+    void growthStaysInResource();
+    void detachLeavesResource();
+    void overAlignedElements();
+    void allocationFailure();
+    void monotonic();
+    void monotonicWithBuffer();
+    void monotonicContainers();
+};
+
+void tst_QMemoryResource::reserve()
+{
+    CountingResource resource;
+    {
+        QString string(100, u'x');
+        QByteArray bytes;
+        QList<int> ints(100, 42);
+        QList<QString> strings = { u"one"_s, QString(100, u'y') };
+        resource.reserve(string);
+        resource.reserve(bytes, 50);
+        resource.reserve(ints, 200);
+        resource.reserve(strings);
+        QCOMPARE(resource.outstandingBlocks, 4);
+        QCOMPARE(resource.allocations, 4);
+
+        QCOMPARE(string, QString(100, u'x'));
+        QCOMPARE(*(string.constData() + string.size()), u'\0');
+        QVERIFY(bytes.isEmpty());
+        QVERIFY(bytes.capacity() >= 50);
+        QCOMPARE(*bytes.constData(), '\0');
+        QVERIFY(ints.capacity() >= 200);
+        QCOMPARE(ints.size(), 100);
+        QCOMPARE(ints.at(99), 42);
+        QCOMPARE(strings.at(1), QString(100, u'y'));
+
+        // a shared array is copied, not moved
+        QString copy = string;
+        resource.reserve(copy);
+        QCOMPARE(copy, string);
+        QVERIFY(copy.constData() != string.constData());
+        QCOMPARE(resource.outstandingBlocks, 5);
+    }
+    QCOMPARE(resource.outstandingBlocks, 0);
+    QCOMPARE(resource.outstandingBytes, 0);
+}
+
+void tst_QMemoryResource::otherAllocationsUnaffected()
+{
+    CountingResource resource;
+    QStringList list;
+    resource.reserve(list, 10);
+    QCOMPARE(resource.allocations, 1);
+
+    // the elements have arrays of their own, from malloc()
+    for (int i = 0; i < 10; ++i)
+        list.append(QString::number(i).repeated(10));
+    QString joined = list.join(u',');
+    QByteArray bytes = joined.toUtf8();
+    QCOMPARE(resource.allocations, 1);
+
+    QScopedPointer<QThread> thread(QThread::create([&] {
+        QString s(100, u'x');
+        s += list.constFirst();
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QCOMPARE(resource.allocations, 1);
+}
+
+void tst_QMemoryResource::destroyedAfterwards()
+{
+    CountingResource resource;
+    QString string(100, u'x');
+    resource.reserve(string);
+    QCOMPARE(resource.outstandingBlocks, 1);
+    string.clear();
+    string.squeeze();
+    QCOMPARE(resource.outstandingBlocks, 0);
+    QCOMPARE(resource.outstandingBytes, 0);
+}
+
+void tst_QMemoryResource::growthStaysInResource()
+{
+    CountingResource resource;
+    QByteArray bytes(10, 'x');
+    QList<QString> strings;
+    resource.reserve(bytes);
+    resource.reserve(strings);
+    strings.append(u"first"_s); // a literal, which needs no allocation
+    QCOMPARE(resource.allocations, 2);
+
+    for (int i = 0; i < 1000; ++i) {
+        bytes.append('y');
+        strings.prepend(QString());
+    }
+    QVERIFY(resource.allocations > 2);
+    QCOMPARE(resource.outstandingBlocks, 2);
+    QCOMPARE(bytes.size(), 1010);
+    QVERIFY(bytes.startsWith("xxxxxxxxxxy"));
+    QCOMPARE(strings.last(), u"first"_s);
+
+    // the arrays that replace the reserved ones come from the resource
+    // too, or the number of blocks in it would drop
+    QList<int> ints = {1, 2, 3};
+    QString string = u"abc"_s;
+    resource.reserve(ints);
+    resource.reserve(string);
+    QCOMPARE(resource.outstandingBlocks, 4);
+
+    int allocations = resource.allocations;
+    ints.reserve(100);
+    string.reserve(100);
+    QCOMPARE(resource.allocations, allocations + 2);
+    QCOMPARE(resource.outstandingBlocks, 4);
+
+    allocations = resource.allocations;
+    ints.squeeze();
+    string.squeeze();
+    QCOMPARE(resource.allocations, allocations + 2);
+    QCOMPARE(resource.outstandingBlocks, 4);
+    QCOMPARE(ints, QList<int>({1, 2, 3}));
+    QCOMPARE(string, u"abc"_s);
+
+    ints.clear();
+    string.clear();
+    QCOMPARE(resource.outstandingBlocks, 4);
+    QVERIFY(string.isEmpty());
+    QVERIFY(!string.isNull());
+    for (int i = 0; i < 100; ++i) {
+        ints.append(i);
+        string.append(u'y');
+    }
+    QCOMPARE(resource.outstandingBlocks, 4);
+
+    // prepending leaves room at the beginning, which reallocating cannot keep
+    ints.prepend(-1);
+    string.prepend(u'x');
+    for (int i = 0; i < 100; ++i) {
+        ints.append(i);
+        string.append(u'z');
+    }
+    ints.squeeze();
+    string.squeeze();
+    QCOMPARE(resource.outstandingBlocks, 4);
+    QCOMPARE(ints.size(), 201);
+    QCOMPARE(ints.first(), -1);
+    QCOMPARE(string.size(), 201);
+    QVERIFY(string.startsWith(u"xyy"));
+    QVERIFY(string.endsWith(u"zz"));
+
+    bytes = QByteArray();
+    strings = QList<QString>();
+    ints = QList<int>();
+    string = QString();
+    QCOMPARE(resource.outstandingBlocks, 0);
+    QCOMPARE(resource.outstandingBytes, 0);
+}
+
+void tst_QMemoryResource::detachLeavesResource()
+{
+    CountingResource resource;
+    QString original(100, u'x');
+    resource.reserve(original);
+    QCOMPARE(resource.allocations, 1);
+
+    QString copy = original;
+    copy.append(u'y'); // detaches with malloc()
+    QCOMPARE(resource.allocations, 1);
+    QCOMPARE(copy.first(100), original);
+
+    copy = original;
+    copy[0] = u'y';
+    QCOMPARE(resource.allocations, 1);
+    QCOMPARE(copy.mid(1), original.mid(1));
+
+    // the copy remembers that it is not from the resource
+    copy.append(QString(1000, u'z'));
+    copy.reserve(10000);
+    copy = QString();
+    QCOMPARE(resource.allocations, 1);
+    QCOMPARE(resource.outstandingBlocks, 1);
+
+    // and the original, that it is
+    original.reserve(10000);
+    QCOMPARE(resource.allocations, 2);
+    QCOMPARE(resource.outstandingBlocks, 1);
+    original = QString();
+    QCOMPARE(resource.outstandingBlocks, 0);
+}
+
+void tst_QMemoryResource::overAlignedElements()
+{
+    CountingResource resource;
+    QList<OverAligned> list(10);
+    resource.reserve(list);
+    QCOMPARE(quintptr(list.constData()) % alignof(OverAligned), 0u);
+    list.resize(1000);
+    QCOMPARE(quintptr(list.constData()) % alignof(OverAligned), 0u);
+    QCOMPARE(resource.outstandingBlocks, 1);
+}
+
+void tst_QMemoryResource::allocationFailure()
+{
+#ifdef QT_NO_EXCEPTIONS
+    QSKIP("This test requires exception support");
+#else
+    CountingResource resource;
+    QByteArray bytes(100, 'x');
+    resource.failing = true;
+    QVERIFY_THROWS_EXCEPTION(std::bad_alloc, resource.reserve(bytes));
+    QCOMPARE(bytes, QByteArray(100, 'x'));
+    resource.failing = false;
+    resource.reserve(bytes);
+    QCOMPARE(bytes, QByteArray(100, 'x'));
+    QCOMPARE(resource.outstandingBlocks, 1);
+#endif
+}
+
+void tst_QMemoryResource::monotonic()
+{
+    QMonotonicMemoryResource arena(256);
+    QCOMPARE(arena.bytesAllocated(), 0);
+
+    void *a = arena.allocate(10);
+    void *b = arena.allocate(24, 16);
+    QVERIFY(a);
+    QVERIFY(b);
+    QCOMPARE(quintptr(b) % 16, 0u);
+    QVERIFY(quintptr(b) >= quintptr(a) + 10);
+    QCOMPARE(arena.bytesAllocated(), 34);
+
+    // larger than a chunk
+    void *c = arena.allocate(10000, 64);
+    QVERIFY(c);
+    QCOMPARE(quintptr(c) % 64, 0u);
+    memset(c, 0xff, 10000);
+    arena.deallocate(c, 10000, 64);
+
+    // zero-sized allocations are valid too
+    QVERIFY(arena.allocate(0));
+
+    arena.release();
+    QCOMPARE(arena.bytesAllocated(), 0);
+    QVERIFY(arena.allocate(100));
+}
+
+void tst_QMemoryResource::monotonicWithBuffer()
+{
+    alignas(std::max_align_t) char buffer[512];
+    QMonotonicMemoryResource arena(buffer, sizeof(buffer));
+    void *a = arena.allocate(100);
+    QCOMPARE(a, static_cast<void *>(buffer));
+    void *b = arena.allocate(1000);
+    QVERIFY(quintptr(b) < quintptr(buffer) || quintptr(b) >= quintptr(buffer + sizeof(buffer)));
+
+    arena.release();
+    QCOMPARE(arena.allocate(100), static_cast<void *>(buffer));
+}
+
+void tst_QMemoryResource::monotonicContainers()
+{
+    QMonotonicMemoryResource arena;
+    {
+        QStringList list;
+        arena.reserve(list);
+        for (int i = 0; i < 1000; ++i) {
+            QString string;
+            arena.reserve(string);
+            string += QString::number(i);
+            list.append(std::move(string));
+        }
+        QCOMPARE(list.size(), 1000);
+        QCOMPARE(list.at(999), u"999"_s);
+        QVERIFY(list.join(u',').startsWith(u"0,1,2"));
+    }
+    QVERIFY(arena.bytesAllocated() > 0);
+    arena.release();
+}
+
+QTEST_APPLESS_MAIN(tst_QMemoryResource)
+#include "tst_qmemoryresource.moc"
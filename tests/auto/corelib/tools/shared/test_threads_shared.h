@@ -0,0 +1,78 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef QT_TESTS_SHARED_TEST_THREADS_SHARED_H
+#define QT_TESTS_SHARED_TEST_THREADS_SHARED_H
+
+#include <QtCore/qbytearraylist.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qthread.h>
+
+#include <memory>
+#include <vector>
+
+namespace QTestThreads {
+
+// QVERIFY() and QCOMPARE() only work in the thread running the test function,
+// so worker threads record their failures here, and the test function checks
+// them afterwards with QVERIFY2(failures.isEmpty(), failures.report()).
+class Failures
+{
+public:
+    void verify(bool condition, const char *message)
+    {
+        if (!condition) {
+            QMutexLocker locker(&mutex);
+            failures.append(message);
+        }
+    }
+
+    bool isEmpty() const
+    {
+        QMutexLocker locker(&mutex);
+        return failures.isEmpty();
+    }
+
+    QByteArray report() const
+    {
+        QMutexLocker locker(&mutex);
+        QByteArray result = QByteArray::number(failures.size()) + " failures in threads";
+        // the same check usually fails many times, don't flood the log
+        for (qsizetype i = 0; i < qMin(failures.size(), qsizetype(10)); ++i)
+            result += "\n    " + failures.at(i);
+        return result;
+    }
+
+private:
+    mutable QMutex mutex;
+    QByteArrayList failures;
+};
+
+// Calls f(i) in threadCount threads at the same time, for i in [0, threadCount).
+// Returns false if they did not all finish in time; use it in QVERIFY().
+template <typename Function>
+[[nodiscard]] bool runInThreads(int threadCount, Function f, int timeout = 60000)
+{
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < threadCount; ++i)
+        threads.emplace_back(QThread::create(f, i));
+    for (auto &t : threads)
+        t->start();
+
+    const QDeadlineTimer deadline(timeout);
+    bool finished = true;
+    for (auto &t : threads) {
+        if (!t->wait(deadline)) {
+            // a running QThread must not be destroyed
+            t->terminate();
+            t->wait();
+            finished = false;
+        }
+    }
+    return finished;
+}
+
+} // namespace QTestThreads
+
+#endif // QT_TESTS_SHARED_TEST_THREADS_SHARED_H
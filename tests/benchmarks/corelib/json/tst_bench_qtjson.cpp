@@ -3,8 +3,11 @@
 
 #include <QTest>
 #include <QVariantMap>
+#include <qjsonarray.h>
 #include <qjsondocument.h>
+#include <qjsonlazydocument.h>
 #include <qjsonobject.h>
+#include <qjsonstreamreader.h>
 
 class BenchmarkQtJson: public QObject
 {
@@ -21,9 +24,22 @@ private Q_SLOTS:
     void parseNumbers();
     void parseJson();
     void parseJsonToVariant();
+    void parseLargeDocument_data() { largeDocument_data(); }
+    void parseLargeDocument();
+    void parseLargeDocumentLazy_data() { largeDocument_data(); }
+    void parseLargeDocumentLazy();
+    void extractFields_data() { largeDocument_data(); }
+    void extractFields();
+    void extractFieldsLazy_data() { largeDocument_data(); }
+    void extractFieldsLazy();
+    void extractFieldsStream_data() { largeDocument_data(); }
+    void extractFieldsStream();
 
     void jsonObjectInsert();
     void variantMapInsert();
+
+private:
+    void largeDocument_data();
 };
 
 BenchmarkQtJson::BenchmarkQtJson(QObject *parent) : QObject(parent)
@@ -93,6 +109,133 @@ void BenchmarkQtJson::parseJsonToVariant()
     }
 }
 
+// An array of records like those of a typical web API, a few megabytes large
+void BenchmarkQtJson::largeDocument_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QJsonArray records;
+    for (int i = 0; i < 20000; ++i) {
+        const QString name = QStringLiteral("user%1").arg(i);
+        records.append(QJsonObject{
+            { "id", i },
+            { "name", name },
+            { "email", name + QStringLiteral("@example.com") },
+            { "active", i % 3 != 0 },
+            { "score", i * 1.25 },
+            { "tags", QJsonArray{ "alpha", "beta", "gamma" } },
+            { "address", QJsonObject{ { "city", QStringLiteral("City %1").arg(i % 100) },
+                                      { "zip", QStringLiteral("%1").arg(10000 + i) } } },
+            { "bio", QStringLiteral("Line one\nLine \"two\" of the biography of %1").arg(name) },
+        });
+    }
+    const QJsonDocument doc(records);
+    QTest::newRow("compact") << doc.toJson(QJsonDocument::Compact);
+    QTest::newRow("indented") << doc.toJson(QJsonDocument::Indented);
+}
+
+void BenchmarkQtJson::parseLargeDocument()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        QJsonDocument doc = QJsonDocument::fromJson(json);
+        QVERIFY(doc.isArray());
+    }
+}
+
+void BenchmarkQtJson::parseLargeDocumentLazy()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        QJsonLazyDocument doc = QJsonLazyDocument::fromJson(json);
+        QVERIFY(doc.isArray());
+    }
+}
+
+void BenchmarkQtJson::extractFields()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        const QJsonDocument doc = QJsonDocument::fromJson(json);
+        qint64 sum = 0;
+        qsizetype names = 0;
+        for (const QJsonValue record : doc.array()) {
+            if (record["active"].toBool()) {
+                sum += record["id"].toInteger();
+                names += record["name"].toString().size();
+            }
+        }
+        QVERIFY(sum > 0 && names > 0);
+    }
+}
+
+void BenchmarkQtJson::extractFieldsLazy()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        const QJsonLazyDocument doc = QJsonLazyDocument::fromJson(json);
+        qint64 sum = 0;
+        qsizetype names = 0;
+        for (const QJsonLazyValue record : doc.root()) {
+            if (record[u"active"].toBool()) {
+                sum += record[u"id"].toInteger();
+                names += record[u"name"].toString().size();
+            }
+        }
+        QVERIFY(sum > 0 && names > 0);
+    }
+}
+
+void BenchmarkQtJson::extractFieldsStream()
+{
+    QFETCH(QByteArray, json);
+
+    QBENCHMARK {
+        QJsonStreamReader reader(json);
+        qint64 sum = 0;
+        qsizetype names = 0;
+        bool active = false;
+        qint64 id = 0;
+        qsizetype name = 0;
+        while (!reader.atEnd()) {
+            switch (reader.readNext()) {
+            case QJsonStreamReader::StartObject:
+                if (reader.depth() == 2)
+                    active = false;
+                break;
+            case QJsonStreamReader::Key:
+                if (reader.depth() != 2)
+                    break;
+                if (reader.text() == u"active") {
+                    reader.readNext();
+                    active = reader.toBool();
+                } else if (reader.text() == u"id") {
+                    reader.readNext();
+                    id = reader.toInteger();
+                } else if (reader.text() == u"name") {
+                    reader.readNext();
+                    name = reader.text().size();
+                }
+                break;
+            case QJsonStreamReader::EndObject:
+                if (reader.depth() == 1 && active) {
+                    sum += id;
+                    names += name;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        QCOMPARE(reader.error(), QJsonStreamReader::NoError);
+        QVERIFY(sum > 0 && names > 0);
+    }
+}
+
 void BenchmarkQtJson::jsonObjectInsert()
 {
     QJsonObject object;
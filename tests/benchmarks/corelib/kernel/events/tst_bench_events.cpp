@@ -5,6 +5,22 @@
 #include <qtest.h>
 #include <qtesteventloop.h>
 
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+#  include <QtCore/private/qeventdispatcher_unix_p.h>
+#  if QT_CONFIG(epoll)
+#    include <QtCore/private/qeventdispatcher_epoll_p.h>
+#  endif
+#  if QT_CONFIG(io_uring)
+#    include <QtCore/private/qeventdispatcher_io_uring_p.h>
+#  endif
+#  include <sys/resource.h>
+#  include <unistd.h>
+#endif
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
 class PingPong : public QObject
 {
 public:
@@ -71,6 +87,14 @@ private slots:
     void sendEvent();
     void postEvent_data();
     void postEvent();
+    void postEventsFromThreads_data();
+    void postEventsFromThreads();
+    void queuedCallArguments_data();
+    void queuedCallArguments();
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+    void socketNotifierWakeup_data();
+    void socketNotifierWakeup();
+#endif
 };
 
 void EventsBench::initTestCase()
@@ -145,6 +169,202 @@ void EventsBench::postEvent()
     }
 }
 
+void EventsBench::postEventsFromThreads_data()
+{
+    QTest::addColumn<int>("producerCount");
+
+    for (int count : { 1, 2, 4, 8, 16, 32 })
+        QTest::addRow("%d", count) << count;
+}
+
+// Measures the throughput of queued calls posted concurrently by a varying
+// number of threads to one receiver living in a thread of its own.
+void EventsBench::postEventsFromThreads()
+{
+    QFETCH(int, producerCount);
+    constexpr int CallsPerProducer = 20'000;
+
+    QThread consumer;
+    QObject receiver;
+    receiver.moveToThread(&consumer);
+    consumer.start();
+
+    std::atomic<int> delivered = 0;
+    QBENCHMARK {
+        delivered.store(0, std::memory_order_relaxed);
+        QSemaphore done;
+
+        std::vector<std::unique_ptr<QThread>> producers;
+        producers.reserve(producerCount);
+        for (int i = 0; i < producerCount; ++i) {
+            producers.emplace_back(QThread::create([&] {
+                for (int n = 0; n < CallsPerProducer; ++n) {
+                    QMetaObject::invokeMethod(&receiver, [&] {
+                        if (delivered.fetch_add(1, std::memory_order_relaxed) + 1
+                                == producerCount * CallsPerProducer) {
+                            done.release();
+                        }
+                    }, Qt::QueuedConnection);
+                }
+            }));
+        }
+        for (const auto &producer : producers)
+            producer->start();
+        for (const auto &producer : producers)
+            producer->wait();
+        QVERIFY(done.tryAcquire(1, QDeadlineTimer(std::chrono::minutes(1))));
+    }
+    QCOMPARE(delivered.load(), producerCount * CallsPerProducer);
+
+    consumer.quit();
+    consumer.wait();
+}
+
+void EventsBench::queuedCallArguments_data()
+{
+    QTest::addColumn<bool>("withArguments");
+
+    QTest::newRow("no-arguments") << false;
+    QTest::newRow("int-double-qstring") << true;
+}
+
+// Measures queued calls to a receiver in another thread, whose events and
+// argument copies are allocated in one thread and freed in the other.
+void EventsBench::queuedCallArguments()
+{
+    QFETCH(bool, withArguments);
+    constexpr int CallCount = 100'000;
+
+    QThread consumer;
+    QObject receiver;
+    receiver.moveToThread(&consumer);
+    consumer.start();
+
+    int delivered = 0;
+    QSemaphore done;
+    const auto deliver = [&] {
+        if (++delivered == CallCount)
+            done.release();
+    };
+    const QString text = QStringLiteral("text");
+    QBENCHMARK {
+        delivered = 0;
+        for (int n = 0; n < CallCount; ++n) {
+            if (withArguments) {
+                QMetaObject::invokeMethod(&receiver, [&](int, double, const QString &) {
+                    deliver();
+                }, Qt::QueuedConnection, n, 0.5, text);
+            } else {
+                QMetaObject::invokeMethod(&receiver, deliver, Qt::QueuedConnection);
+            }
+        }
+        QVERIFY(done.tryAcquire(1, QDeadlineTimer(std::chrono::minutes(1))));
+    }
+
+    consumer.quit();
+    consumer.wait();
+}
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+void EventsBench::socketNotifierWakeup_data()
+{
+    QTest::addColumn<QByteArray>("dispatcher");
+    QTest::addColumn<int>("notifierCount");
+
+    for (int count : { 100, 1000, 10000 }) {
+        QTest::addRow("poll-%d", count) << QByteArray("poll") << count;
+#if QT_CONFIG(epoll)
+        QTest::addRow("epoll-%d", count) << QByteArray("epoll") << count;
+#endif
+#if QT_CONFIG(io_uring)
+        QTest::addRow("io_uring-%d", count) << QByteArray("io_uring") << count;
+#endif
+    }
+}
+
+// Measures the latency of one event loop wakeup on a single ready socket
+// notifier while a varying number of idle notifiers are registered.
+void EventsBench::socketNotifierWakeup()
+{
+    QFETCH(QByteArray, dispatcher);
+    QFETCH(int, notifierCount);
+
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0 || limit.rlim_cur < rlim_t(notifierCount + 64))
+        QSKIP("Not enough file descriptors available");
+
+    std::unique_ptr<QAbstractEventDispatcher> eventDispatcher;
+#if QT_CONFIG(io_uring)
+    if (dispatcher == "io_uring") {
+        if (!QEventDispatcherIoUring::isSupported())
+            QSKIP("io_uring is not available");
+        eventDispatcher.reset(new QEventDispatcherIoUring);
+    } else
+#endif
+#if QT_CONFIG(epoll)
+    if (dispatcher == "epoll")
+        eventDispatcher.reset(new QEventDispatcherEpoll);
+    else
+#endif
+        eventDispatcher.reset(new QEventDispatcherUNIX);
+
+    int hotPipe[2];
+    QVERIFY(::pipe(hotPipe) == 0);
+
+    // the idle notifiers all watch duplicates of a descriptor that never
+    // becomes readable, so each one costs a single file descriptor
+    int idlePipe[2];
+    QVERIFY(::pipe(idlePipe) == 0);
+
+    std::vector<std::unique_ptr<QSocketNotifier>> notifiers;
+    notifiers.reserve(notifierCount);
+    auto addNotifier = [&](int fd) {
+        // registered with our dispatcher only, not with the thread's one
+        auto notifier = std::make_unique<QSocketNotifier>(QSocketNotifier::Read);
+        notifier->setSocket(fd);
+        eventDispatcher->registerSocketNotifier(notifier.get());
+        notifiers.push_back(std::move(notifier));
+    };
+
+    for (int i = 1; i < notifierCount; ++i) {
+        const int fd = ::dup(idlePipe[0]);
+        QVERIFY(fd != -1);
+        addNotifier(fd);
+    }
+    addNotifier(hotPipe[0]);
+
+    int activations = 0;
+    connect(notifiers.back().get(), &QSocketNotifier::activated, this,
+            [&](QSocketDescriptor socket) {
+        char c;
+        QCOMPARE(::read(socket, &c, 1), 1);
+        ++activations;
+    });
+
+    QBENCHMARK {
+        const char c = 0;
+        QCOMPARE(::write(hotPipe[1], &c, 1), 1);
+        eventDispatcher->processEvents(QEventLoop::AllEvents);
+    }
+    QVERIFY(activations > 0);
+
+    for (auto &notifier : notifiers) {
+        eventDispatcher->unregisterSocketNotifier(notifier.get());
+        if (notifier.get() != notifiers.back().get())
+            ::close(notifier->socket());
+    }
+    notifiers.clear();
+    ::close(hotPipe[0]);
+    ::close(hotPipe[1]);
+    ::close(idlePipe[0]);
+    ::close(idlePipe[1]);
+}
+#endif
+
 QTEST_MAIN(EventsBench)
 
 #include "tst_bench_events.moc"
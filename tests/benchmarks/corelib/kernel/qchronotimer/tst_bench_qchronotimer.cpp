@@ -0,0 +1,104 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QChronoTimer>
+#include <QTest>
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+#  include <QtCore/private/qtimerinfo_unix_p.h>
+#endif
+
+#include <memory>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class tst_QChronoTimer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+    void restartTimerInfoList_data();
+    void restartTimerInfoList();
+#endif
+    void restartChronoTimers_data();
+    void restartChronoTimers();
+};
+
+// Idle/keep-alive timeouts of a server's connections, spread between 1 and 60 seconds
+static std::chrono::nanoseconds keepAliveInterval(int i)
+{
+    return 1s + std::chrono::milliseconds((i * 7919) % 59'000);
+}
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_WASM)
+void tst_QChronoTimer::restartTimerInfoList_data()
+{
+    QTest::addColumn<QTimerInfoList::Storage>("storage");
+    QTest::addColumn<int>("timerCount");
+
+    for (int count : { 1'000, 10'000, 100'000 }) {
+        QTest::addRow("sorted-list-%d", count) << QTimerInfoList::Storage::SortedList << count;
+        QTest::addRow("timer-wheel-%d", count) << QTimerInfoList::Storage::TimerWheel << count;
+    }
+}
+
+// Restarts every timer once per iteration, as a server does when each of its
+// connections receives data, without the QObject and event dispatcher overhead.
+void tst_QChronoTimer::restartTimerInfoList()
+{
+    QFETCH(QTimerInfoList::Storage, storage);
+    QFETCH(int, timerCount);
+
+    QObject receiver;
+    QTimerInfoList timers(storage);
+    for (int i = 1; i <= timerCount; ++i)
+        timers.registerTimer(Qt::TimerId(i), keepAliveInterval(i), Qt::CoarseTimer, &receiver);
+
+    QBENCHMARK {
+        for (int i = 1; i <= timerCount; ++i) {
+            timers.unregisterTimer(Qt::TimerId(i));
+            timers.registerTimer(Qt::TimerId(i), keepAliveInterval(i), Qt::CoarseTimer, &receiver);
+        }
+    }
+
+    QCOMPARE(timers.size(), qsizetype(timerCount));
+    timers.clearTimers();
+}
+#endif
+
+void tst_QChronoTimer::restartChronoTimers_data()
+{
+    QTest::addColumn<int>("timerCount");
+
+    QTest::addRow("1000") << 1'000;
+    QTest::addRow("10000") << 10'000;
+    QTest::addRow("100000") << 100'000;
+}
+
+// The same through the QChronoTimer API and the thread's event dispatcher.
+// Set QT_TIMER_WHEEL=1 to compare the timer wheel with the sorted list.
+void tst_QChronoTimer::restartChronoTimers()
+{
+    QFETCH(int, timerCount);
+
+    std::vector<std::unique_ptr<QChronoTimer>> timers;
+    timers.reserve(timerCount);
+    for (int i = 0; i < timerCount; ++i) {
+        timers.push_back(std::make_unique<QChronoTimer>(keepAliveInterval(i)));
+        timers.back()->start();
+    }
+
+    QBENCHMARK {
+        for (const auto &timer : timers)
+            timer->start();
+    }
+
+    for (const auto &timer : timers)
+        QVERIFY(timer->isActive());
+}
+
+QTEST_MAIN(tst_QChronoTimer)
+
+#include "tst_bench_qchronotimer.moc"
@@ -6,6 +6,11 @@
 #include "object.h"
 #include <qcoreapplication.h>
 #include <qdatetime.h>
+#include <qsemaphore.h>
+#include <qthread.h>
+
+#include <memory>
+#include <vector>
 
 enum {
     CreationDeletionBenckmarkConstant = 34567,
@@ -26,6 +31,8 @@ private slots:
     void connect_disconnect_benchmark_data();
     void connect_disconnect_benchmark();
     void receiver_destroyed_benchmark();
+    void queued_signal_benchmark_data();
+    void queued_signal_benchmark();
 
     void stdAllocator();
 };
@@ -280,6 +287,83 @@ void tst_QObject::receiver_destroyed_benchmark()
     }
 }
 
+class QueuedSender : public QObject
+{
+    Q_OBJECT
+signals:
+    void valueChanged(int value, const QString &text);
+};
+
+class QueuedReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    QSemaphore done;
+    int remaining = 0;
+
+public slots:
+    void onValueChanged(int value, const QString &text)
+    {
+        Q_UNUSED(value);
+        Q_UNUSED(text);
+        if (--remaining == 0)
+            done.release();
+    }
+};
+
+void tst_QObject::queued_signal_benchmark_data()
+{
+    QTest::addColumn<bool>("batched");
+    QTest::addColumn<int>("producers");
+
+    for (int producers : { 1, 4 }) {
+        QTest::addRow("unbatched-%d", producers) << false << producers;
+        QTest::addRow("batched-%d", producers) << true << producers;
+    }
+}
+
+// Producer threads emitting signals at a receiver in another thread as fast
+// as they can, with and without QThread::setQueuedCallBatchingEnabled().
+void tst_QObject::queued_signal_benchmark()
+{
+    QFETCH(bool, batched);
+    QFETCH(int, producers);
+    constexpr int emissions = 100'000;
+
+    QThread consumer;
+    consumer.setQueuedCallBatchingEnabled(batched);
+    consumer.start();
+
+    QueuedReceiver receiver;
+    receiver.moveToThread(&consumer);
+    std::vector<std::unique_ptr<QueuedSender>> senders;
+    for (int i = 0; i < producers; ++i) {
+        senders.push_back(std::make_unique<QueuedSender>());
+        QObject::connect(senders.back().get(), &QueuedSender::valueChanged,
+                         &receiver, &QueuedReceiver::onValueChanged, Qt::QueuedConnection);
+    }
+    const QString text = QStringLiteral("value");
+
+    QBENCHMARK {
+        // the previous run has finished in the consumer thread
+        receiver.remaining = producers * emissions;
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (const auto &sender : senders) {
+            threads.emplace_back(QThread::create([&sender, &text] {
+                for (int n = 0; n < emissions; ++n)
+                    emit sender->valueChanged(n, text);
+            }));
+            threads.back()->start();
+        }
+        receiver.done.acquire();
+        for (const auto &thread : threads)
+            thread->wait();
+    }
+
+    consumer.quit();
+    consumer.wait();
+}
+
 QTEST_MAIN(tst_QObject)
 
 #include "tst_bench_qobject.moc"
@@ -1,6 +1,7 @@
 // Copyright (C) 2021 The Qt Company Ltd.
 // Copyright (C) 2016 Intel Corporation.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+#include <QByteArrayMatcher>
 #include <QDebug>
 #include <QIODevice>
 #include <QFile>
@@ -34,6 +35,14 @@ private slots:
 
     void operator_assign_char();
     void operator_assign_char_data();
+
+    void indexOf_data() { needleLengths_data(); }
+    void indexOf();
+    void matcher_indexIn_data() { needleLengths_data(); }
+    void matcher_indexIn();
+
+private:
+    void needleLengths_data();
 };
 
 void tst_QByteArray::initTestCase()
@@ -388,6 +397,42 @@ void tst_QByteArray::operator_assign_char_data()
     QTest::newRow("length: 1'000") << data;
 }
 
+void tst_QByteArray::needleLengths_data()
+{
+    QTest::addColumn<QByteArray>("haystack");
+    QTest::addColumn<QByteArray>("needle");
+
+    // Some source code, with a needle from it at the end; the first byte of
+    // the needle does not appear elsewhere, so that it is only found there.
+    QByteArray text = sourcecode.repeated(8);
+    for (qsizetype length : { 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 128 }) {
+        const QByteArray needle = '\x01' + sourcecode.mid(1000, length - 1);
+        QTest::addRow("%lld", qlonglong(length)) << text + needle << needle;
+    }
+}
+
+void tst_QByteArray::indexOf()
+{
+    QFETCH(QByteArray, haystack);
+    QFETCH(QByteArray, needle);
+
+    QBENCHMARK {
+        [[maybe_unused]] auto r = haystack.indexOf(needle);
+    }
+}
+
+void tst_QByteArray::matcher_indexIn()
+{
+    QFETCH(QByteArray, haystack);
+    QFETCH(QByteArray, needle);
+
+    const QByteArrayMatcher matcher(needle);
+    QCOMPARE(matcher.indexIn(haystack), haystack.size() - needle.size());
+    QBENCHMARK {
+        [[maybe_unused]] auto r = matcher.indexIn(haystack);
+    }
+}
+
 QTEST_MAIN(tst_QByteArray)
 
 #include "tst_bench_qbytearray.moc"
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QLocale>
+#include <QNumberFormatter>
 #include <QTest>
 
 using namespace Qt::StringLiterals;
@@ -37,6 +38,18 @@ private Q_SLOTS:
     void toULongLong();
     void toDouble_data();
     void toDouble();
+    void number_double_data();
+    void number_double();
+    void toString_double_data() { number_double_data(); }
+    void toString_double();
+    void toDouble_shortest_data() { number_double_data(); }
+    void toDouble_shortest();
+    void column_QLocale_data();
+    void column_QLocale();
+    void column_QNumberFormatter_data() { column_QLocale_data(); }
+    void column_QNumberFormatter();
+    void column_QNumberFormatter_utf8_data() { column_QLocale_data(); }
+    void column_QNumberFormatter_utf8();
 };
 
 static QString data()
@@ -588,6 +601,143 @@ void tst_QLocale::toDouble()
     QCOMPARE(actual, expected);
 }
 
+static QList<double> doubleSamples(double scale)
+{
+    // Deterministic, but with all the digits a measurement would have:
+    QList<double> samples;
+    samples.reserve(1000);
+    double value = scale;
+    for (int i = 0; i < 1000; ++i) {
+        value = value * 1.000123456789 + scale / 7;
+        samples.append(i & 1 ? -value : value);
+    }
+    return samples;
+}
+
+void tst_QLocale::number_double_data()
+{
+    QTest::addColumn<QList<double>>("values");
+
+    QTest::newRow("integral") << QList<double>{ 0, 1, -1, 42, 1024, 1e6, -65536, 1e15 };
+    QTest::newRow("short") << QList<double>{ 0.5, 0.1, -2.25, 3.75, 1e-3, 12.5, 0.2, 1.1 };
+    QTest::newRow("sensor") << doubleSamples(0.001);
+    QTest::newRow("money") << doubleSamples(1234.56);
+    QTest::newRow("large") << doubleSamples(1e20);
+    QTest::newRow("tiny") << doubleSamples(1e-20);
+}
+
+void tst_QLocale::number_double()
+{
+    QFETCH(const QList<double>, values);
+    qsizetype total = 0;
+    QBENCHMARK {
+        total = 0;
+        for (double value : values)
+            total += QString::number(value, 'g', QLocale::FloatingPointShortest).size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QLocale::toString_double()
+{
+    QFETCH(const QList<double>, values);
+    const QLocale locale = QLocale::c();
+    qsizetype total = 0;
+    QBENCHMARK {
+        total = 0;
+        for (double value : values)
+            total += locale.toString(value, 'g', QLocale::FloatingPointShortest).size();
+    }
+    QVERIFY(total > 0);
+}
+
+void tst_QLocale::toDouble_shortest()
+{
+    QFETCH(const QList<double>, values);
+    const QLocale locale = QLocale::c();
+    QStringList texts;
+    for (double value : values)
+        texts.append(locale.toString(value, 'g', QLocale::FloatingPointShortest));
+
+    double sum = 0;
+    QBENCHMARK {
+        sum = 0;
+        for (const QString &text : std::as_const(texts))
+            sum += locale.toDouble(text);
+    }
+
+    // the shortest representation must round-trip exactly
+    for (qsizetype i = 0; i < values.size(); ++i)
+        QCOMPARE(locale.toDouble(texts.at(i)), values.at(i));
+}
+
+void tst_QLocale::column_QLocale_data()
+{
+    QTest::addColumn<QLocale>("locale");
+    QTest::addColumn<char>("format");
+    QTest::addColumn<QList<double>>("values");
+
+    const QList<double> values = doubleSamples(1234.56);
+    QTest::newRow("C: g") << QLocale::c() << 'g' << values;
+    QTest::newRow("C: f") << QLocale::c() << 'f' << values;
+    QTest::newRow("de: g") << QLocale(QLocale::German) << 'g' << values;
+    QTest::newRow("de: f") << QLocale(QLocale::German) << 'f' << values;
+    QTest::newRow("ar_EG: g") << QLocale(QLocale::Arabic, QLocale::Egypt) << 'g' << values;
+}
+
+void tst_QLocale::column_QLocale()
+{
+    QFETCH(const QLocale, locale);
+    QFETCH(const char, format);
+    QFETCH(const QList<double>, values);
+
+    QString column;
+    QBENCHMARK {
+        column.resize(0);
+        for (double value : values) {
+            column += locale.toString(value, format, 2);
+            column += u'\n';
+        }
+    }
+}
+
+void tst_QLocale::column_QNumberFormatter()
+{
+    QFETCH(const QLocale, locale);
+    QFETCH(const char, format);
+    QFETCH(const QList<double>, values);
+
+    QNumberFormatter formatter(locale);
+    formatter.setDoubleFormat(format, 2);
+    QString column;
+    QBENCHMARK {
+        column.resize(0);
+        formatter.appendTo(column, values, u"\n");
+        column += u'\n';
+    }
+
+    QString expected;
+    for (double value : values)
+        expected += locale.toString(value, format, 2) + u'\n';
+    QCOMPARE(column, expected);
+}
+
+void tst_QLocale::column_QNumberFormatter_utf8()
+{
+    QFETCH(const QLocale, locale);
+    QFETCH(const char, format);
+    QFETCH(const QList<double>, values);
+
+    QNumberFormatter formatter(locale);
+    formatter.setDoubleFormat(format, 2);
+    QByteArray column;
+    QBENCHMARK {
+        column.resize(0);
+        formatter.appendTo(column, values, "\n");
+        column += '\n';
+    }
+}
+
 QTEST_MAIN(tst_QLocale)
 
 #include "tst_bench_qlocale.moc"
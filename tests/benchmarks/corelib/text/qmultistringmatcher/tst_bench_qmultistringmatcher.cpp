@@ -0,0 +1,161 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QFile>
+#include <QMultiStringMatcher>
+#include <QRegularExpression>
+#include <QSet>
+#include <QStringMatcher>
+#include <QTest>
+
+class tst_QMultiStringMatcher : public QObject
+{
+    Q_OBJECT
+    QString text;
+
+private slots:
+    void initTestCase();
+
+    void multiStringMatcher_data() { patterns_data(); }
+    void multiStringMatcher();
+    void multiStringMatcher_matchAll_data() { patterns_data(); }
+    void multiStringMatcher_matchAll();
+    void multiByteArrayMatcher_data() { patterns_data(); }
+    void multiByteArrayMatcher();
+    void regularExpression_data() { patterns_data(); }
+    void regularExpression();
+    void stringMatchers_data() { patterns_data(); }
+    void stringMatchers();
+
+private:
+    void patterns_data();
+};
+
+void tst_QMultiStringMatcher::initTestCase()
+{
+    QFile self(QFINDTESTDATA("tst_bench_qmultistringmatcher.cpp"));
+    QVERIFY(self.open(QIODevice::ReadOnly));
+    text = QString::fromLatin1(self.readAll()).repeated(16);
+}
+
+void tst_QMultiStringMatcher::patterns_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<Qt::CaseSensitivity>("cs");
+
+    // words of the text, which are found, and made-up ones, which are not
+    QStringList words;
+    QSet<QString> seen;
+    static const QRegularExpression wordRe(QStringLiteral("\\w{4,}"));
+    for (const QRegularExpressionMatch &m : wordRe.globalMatch(text)) {
+        const QString word = m.captured();
+        if (!seen.contains(word)) {
+            seen.insert(word);
+            words.append(word);
+        }
+    }
+    for (qsizetype count : { 10, 100, 1000 }) {
+        QStringList patterns;
+        for (qsizetype i = 0; i < count; ++i) {
+            if (i % 2 == 0 && i / 2 < words.size())
+                patterns.append(words.at(i / 2));
+            else
+                patterns.append(QStringLiteral("zq%1x").arg(i));
+        }
+        QTest::addRow("%lld", qlonglong(count)) << patterns << Qt::CaseSensitive;
+        QTest::addRow("%lld-case-insensitive", qlonglong(count)) << patterns << Qt::CaseInsensitive;
+    }
+}
+
+// All these benchmarks count the matches that do not overlap, the leftmost
+// first, as QRegularExpression::globalMatch() does
+
+void tst_QMultiStringMatcher::multiStringMatcher()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    const QMultiStringMatcher matcher(patterns, cs);
+    QBENCHMARK {
+        qsizetype count = 0;
+        for (auto m = matcher.match(text); m.isValid();
+             m = matcher.match(text, m.position + m.length)) {
+            ++count;
+        }
+        QVERIFY(count > 0);
+    }
+}
+
+void tst_QMultiStringMatcher::multiStringMatcher_matchAll()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    // all the matches, including the overlapping ones
+    const QMultiStringMatcher matcher(patterns, cs);
+    QBENCHMARK {
+        QVERIFY(!matcher.matchAll(text).isEmpty());
+    }
+}
+
+void tst_QMultiStringMatcher::multiByteArrayMatcher()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    QByteArrayList latin1Patterns;
+    for (const QString &pattern : std::as_const(patterns))
+        latin1Patterns.append(pattern.toLatin1());
+    const QByteArray latin1Text = text.toLatin1();
+    const QMultiByteArrayMatcher matcher(latin1Patterns, cs);
+    QBENCHMARK {
+        qsizetype count = 0;
+        for (auto m = matcher.match(latin1Text); m.isValid();
+             m = matcher.match(latin1Text, m.position + m.length)) {
+            ++count;
+        }
+        QVERIFY(count > 0);
+    }
+}
+
+void tst_QMultiStringMatcher::regularExpression()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    QStringList escaped;
+    for (const QString &pattern : std::as_const(patterns))
+        escaped.append(QRegularExpression::escape(pattern));
+    QRegularExpression re(escaped.join(u'|'), cs == Qt::CaseInsensitive
+                          ? QRegularExpression::CaseInsensitiveOption
+                          : QRegularExpression::NoPatternOption);
+    re.optimize();
+    QVERIFY(re.isValid());
+    QBENCHMARK {
+        qsizetype count = 0;
+        for (auto it = re.globalMatchView(text); it.hasNext(); it.next())
+            ++count;
+        QVERIFY(count > 0);
+    }
+}
+
+void tst_QMultiStringMatcher::stringMatchers()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(Qt::CaseSensitivity, cs);
+
+    // only finds the first match of each pattern
+    QList<QStringMatcher> matchers;
+    for (const QString &pattern : std::as_const(patterns))
+        matchers.append(QStringMatcher(pattern, cs));
+    QBENCHMARK {
+        qsizetype found = 0;
+        for (const QStringMatcher &matcher : std::as_const(matchers))
+            found += matcher.indexIn(text) >= 0;
+        QVERIFY(found > 0);
+    }
+}
+
+QTEST_MAIN(tst_QMultiStringMatcher)
+
+#include "tst_bench_qmultistringmatcher.moc"
@@ -4,8 +4,11 @@
 #include <QByteArray>
 #include <QLatin1StringView>
 #include <QFile>
+#include <QHash>
+#include <QSmallString>
 #include <QTest>
 #include <limits>
+#include <vector>
 
 using namespace Qt::StringLiterals;
 
@@ -55,12 +58,35 @@ private slots:
     void operator_assign_L1SV() { operator_assign<QLatin1StringView>(); }
     void operator_assign_L1SV_data() { operator_assign_data(); }
 
+    // Short strings, with and without the small-buffer optimization:
+    void shortString_construct_QString_data() { shortString_data(); }
+    void shortString_construct_QString() { shortString_construct<QString>(); }
+    void shortString_construct_QSmallString_data() { shortString_data(); }
+    void shortString_construct_QSmallString() { shortString_construct<QSmallString>(); }
+    void shortString_fromUtf8_QString_data() { shortString_data(); }
+    void shortString_fromUtf8_QString() { shortString_fromUtf8<QString>(); }
+    void shortString_fromUtf8_QSmallString_data() { shortString_data(); }
+    void shortString_fromUtf8_QSmallString() { shortString_fromUtf8<QSmallString>(); }
+    void shortString_copy_QString_data() { shortString_data(); }
+    void shortString_copy_QString() { shortString_copy<QString>(); }
+    void shortString_copy_QSmallString_data() { shortString_data(); }
+    void shortString_copy_QSmallString() { shortString_copy<QSmallString>(); }
+    void shortString_hash_QString_data() { shortString_data(); }
+    void shortString_hash_QString() { shortString_hash<QString>(); }
+    void shortString_hash_QSmallString_data() { shortString_data(); }
+    void shortString_hash_QSmallString() { shortString_hash<QSmallString>(); }
+
 private:
     void section_data_impl(bool includeRegExOnly = true);
     template <typename RX> void section_impl();
     template <typename Integer> void number_impl();
     template <typename T> void operator_assign();
     void operator_assign_data();
+    void shortString_data();
+    template <typename String> void shortString_construct();
+    template <typename String> void shortString_fromUtf8();
+    template <typename String> void shortString_copy();
+    template <typename String> void shortString_hash();
 };
 
 tst_QString::tst_QString()
@@ -505,6 +531,95 @@ void tst_QString::operator_assign_data()
     QTest::newRow("length: 1'000") << data;
 }
 
+void tst_QString::shortString_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    for (int length : { 0, 4, 8, 15, 16, 32 })
+        QTest::addRow("length: %d", length) << QByteArray(length, 'k');
+}
+
+// Each iteration works on this many strings, to get past the cost of the
+// benchmark loop itself
+static constexpr qsizetype ShortStringCount = 1000;
+
+static QList<QByteArray> shortStringKeys(const QByteArray &data)
+{
+    // distinct strings of the same length, so that hashes do not collide
+    QList<QByteArray> keys;
+    keys.reserve(ShortStringCount);
+    for (qsizetype i = 0; i < ShortStringCount; ++i) {
+        QByteArray key = data;
+        for (qsizetype j = 0, n = i; j < key.size() && n; ++j, n /= 26)
+            key[j] = char('a' + n % 26);
+        keys.append(key);
+    }
+    return keys;
+}
+
+template <typename String>
+void tst_QString::shortString_construct()
+{
+    QFETCH(QByteArray, data);
+    const QList<QByteArray> keys = shortStringKeys(data);
+    std::vector<String> strings(keys.size());
+
+    QBENCHMARK {
+        for (qsizetype i = 0; i < keys.size(); ++i)
+            strings[i] = String(QLatin1StringView(keys[i]));
+    }
+}
+
+template <typename String>
+void tst_QString::shortString_fromUtf8()
+{
+    QFETCH(QByteArray, data);
+    const QList<QByteArray> keys = shortStringKeys(data);
+    std::vector<String> strings(keys.size());
+
+    QBENCHMARK {
+        for (qsizetype i = 0; i < keys.size(); ++i)
+            strings[i] = String::fromUtf8(keys[i]);
+    }
+}
+
+template <typename String>
+void tst_QString::shortString_copy()
+{
+    QFETCH(QByteArray, data);
+    std::vector<String> strings;
+    for (const QByteArray &key : shortStringKeys(data))
+        strings.push_back(String(QLatin1StringView(key)));
+    std::vector<String> copies(strings.size());
+
+    QBENCHMARK {
+        for (size_t i = 0; i < strings.size(); ++i)
+            copies[i] = strings[i];
+        // destroy the copies, to measure the release of shared data too
+        for (String &copy : copies)
+            copy = String();
+    }
+}
+
+template <typename String>
+void tst_QString::shortString_hash()
+{
+    QFETCH(QByteArray, data);
+    QHash<String, qsizetype> hash;
+    std::vector<String> lookups;
+    for (const QByteArray &key : shortStringKeys(data)) {
+        hash.insert(String(QLatin1StringView(key)), hash.size());
+        lookups.push_back(String(QLatin1StringView(key)));
+    }
+
+    qsizetype sum = 0;
+    QBENCHMARK {
+        for (const String &key : lookups)
+            sum += hash.value(key);
+    }
+    QVERIFY(sum >= 0);
+}
+
 QTEST_APPLESS_MAIN(tst_QString)
 
 #include "tst_bench_qstring.moc"
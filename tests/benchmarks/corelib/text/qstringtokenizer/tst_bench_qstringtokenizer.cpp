@@ -3,7 +3,11 @@
 
 #include <QtTest/QTest>
 
+#include <QSpan>
 #include <QStringTokenizer>
+#include <QVarLengthArray>
+
+using namespace Qt::StringLiterals;
 
 class tst_QStringTokenizer : public QObject
 {
@@ -21,6 +25,22 @@ private slots:
     void tokenize_qlatin1string_qstring() const { tokenize<QLatin1String, QString>(); }
     void tokenize_qstring_qlatin1string_data() const { tokenize_data(); }
     void tokenize_qstring_qlatin1string() const { tokenize<QString, QLatin1String>(); }
+    void tokenizeInto_qlatin1string_qlatin1string_data() const { tokenize_data(); }
+    void tokenizeInto_qlatin1string_qlatin1string() const { tokenizeInto<QLatin1String, QLatin1String>(); }
+    void tokenizeInto_qstring_qstring_data() const { tokenize_data(); }
+    void tokenizeInto_qstring_qstring() const { tokenizeInto<QString, QString>(); }
+
+    void csv_iterate_data() const { csv_data(); }
+    void csv_iterate() const;
+    void csv_split_data() const { csv_data(); }
+    void csv_split() const;
+    void csv_tokenizeInto_data() const { csv_data(); }
+    void csv_tokenizeInto() const;
+
+private:
+    template <typename T, typename U>
+    void tokenizeInto() const;
+    void csv_data() const;
 };
 
 template<typename T>
@@ -115,6 +135,87 @@ void tst_QStringTokenizer::tokenize() const
     }
 }
 
+template<typename T, typename U>
+void tst_QStringTokenizer::tokenizeInto() const
+{
+    QFETCH(QByteArray, input);
+    QFETCH(QByteArray, separator);
+    QFETCH(bool, caseSensitive);
+    QFETCH(int, expectedCount);
+
+    T haystack = fromByteArray<T>(input);
+    U needle = fromByteArray<U>(separator);
+
+    const Qt::CaseSensitivity sensitivity = caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    using View = typename decltype(QStringTokenizer(haystack, needle))::value_type;
+    QVarLengthArray<View, 4096> tokens(expectedCount);
+    QBENCHMARK {
+        QStringTokenizer tok(haystack, needle, sensitivity);
+        QCOMPARE(tok.tokenizeInto(tokens), expectedCount);
+    }
+}
+
+void tst_QStringTokenizer::csv_data() const
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<int>("expectedFields");
+
+    // 10000 lines of 8 short fields each
+    QString csv;
+    for (int i = 0; i < 10000; ++i) {
+        csv += QString::number(i) + u",lorem,ipsum,"_s + QString::number(i * 7 % 1000)
+                + u",,dolor sit amet,"_s + QString::number(i % 13) + u".5,x\n"_s;
+    }
+    QTest::addRow("10000x8") << csv << 80000;
+}
+
+void tst_QStringTokenizer::csv_iterate() const
+{
+    QFETCH(QString, input);
+    QFETCH(int, expectedFields);
+
+    QBENCHMARK {
+        qsizetype count = 0;
+        for (QStringView line : QStringTokenizer(input, u'\n', Qt::SkipEmptyParts)) {
+            for (QStringView field : QStringTokenizer(line, u',')) {
+                Q_UNUSED(field);
+                ++count;
+            }
+        }
+        QCOMPARE(count, expectedFields);
+    }
+}
+
+void tst_QStringTokenizer::csv_split() const
+{
+    QFETCH(QString, input);
+    QFETCH(int, expectedFields);
+
+    QBENCHMARK {
+        qsizetype count = 0;
+        for (const QString &line : input.split(u'\n', Qt::SkipEmptyParts))
+            count += line.split(u',').size();
+        QCOMPARE(count, expectedFields);
+    }
+}
+
+void tst_QStringTokenizer::csv_tokenizeInto() const
+{
+    QFETCH(QString, input);
+    QFETCH(int, expectedFields);
+
+    QVarLengthArray<QStringView, 16384> lines(16384);
+    QVarLengthArray<QStringView, 16> fields(16);
+    QBENCHMARK {
+        qsizetype count = 0;
+        const qsizetype lineCount = QStringTokenizer(input, u'\n', Qt::SkipEmptyParts).tokenizeInto(lines);
+        QCOMPARE_LE(lineCount, lines.size());
+        for (QStringView line : QSpan(lines).first(lineCount))
+            count += QStringTokenizer(line, u',').tokenizeInto(fields);
+        QCOMPARE(count, expectedFields);
+    }
+}
+
 QTEST_MAIN(tst_QStringTokenizer)
 
 #include "tst_bench_qstringtokenizer.moc"
@@ -4,6 +4,7 @@
 #include <qbytearray.h>
 #include <qdebug.h>
 #include <qstring.h>
+#include <qstringconverter.h>
 #include <qtest.h>
 #include <qutf8stringview.h>
 
@@ -36,7 +37,17 @@ private slots:
     void compareStringsWithErrors_data();
     void compareStringsWithErrors();
 
+    void toUtf16_data() { mixedScripts_data(); }
+    void toUtf16();
+    void toUtf16Chunked_data() { mixedScripts_data(); }
+    void toUtf16Chunked();
+    void fromUtf16_data() { mixedScripts_data(); }
+    void fromUtf16();
+    void isValidUtf8_data() { mixedScripts_data(); }
+    void isValidUtf8();
+
 private:
+    void mixedScripts_data();
     void equalStrings_data();
     void compareStringsCaseSensitive_data();
     void compareStringsCaseInsensitive_data();
@@ -258,6 +269,78 @@ void tst_QUtf8StringView::compareStringsWithErrors()
     QCOMPARE(-result, rhv.compare(lhv, cs));
 }
 
+void tst_QUtf8StringView::mixedScripts_data()
+{
+    QTest::addColumn<QString>("text");
+
+    // about 64 KiB of each
+    auto addRow = [](const char *name, QStringView sample) {
+        QString text;
+        while (text.size() < 64 * 1024)
+            text += sample;
+        QTest::newRow(name) << text;
+    };
+    addRow("ascii", u"The quick brown fox jumps over the lazy dog. ");
+    addRow("latin1", u"Hyvää päivää, käyhän että tuon kannettavani saunaan? ");
+    addRow("cyrillic", u"Съешь же ещё этих мягких французских булок, да выпей чаю. ");
+    addRow("greek", u"Ξεσκεπάζω τὴν ψυχοφθόρα βδελυγμία. ");
+    addRow("cjk", u"私はガラスを食べられます。それは私を傷つけません。");
+    addRow("mixed-markup", u"<p lang=\"ru\">Привет</p><p lang=\"zh\">你好，世界</p>\n");
+    addRow("emojis", u"😂, 😃, 🧘🏻‍♂️, 🌍, 🌦️, 🍞, 🚗, 📞, 🎉, ❤️, 🏁 ");
+}
+
+void tst_QUtf8StringView::toUtf16()
+{
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    QString result;
+
+    QBENCHMARK {
+        result = QString::fromUtf8(utf8);
+    }
+    QCOMPARE(result, text);
+}
+
+void tst_QUtf8StringView::toUtf16Chunked()
+{
+    // odd-sized chunks, which cut characters
+    constexpr qsizetype ChunkSize = 4093;
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    QString result;
+
+    QBENCHMARK {
+        QStringDecoder decoder(QStringDecoder::Utf8);
+        result.clear();
+        for (qsizetype i = 0; i < utf8.size(); i += ChunkSize)
+            result += decoder.decode(QByteArrayView(utf8).sliced(i, qMin(ChunkSize, utf8.size() - i)));
+    }
+    QCOMPARE(result, text);
+}
+
+void tst_QUtf8StringView::fromUtf16()
+{
+    QFETCH(QString, text);
+    QByteArray result;
+
+    QBENCHMARK {
+        result = text.toUtf8();
+    }
+    QCOMPARE(result.size(), text.toUtf8().size());
+}
+
+void tst_QUtf8StringView::isValidUtf8()
+{
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    bool result = false;
+
+    QBENCHMARK {
+        result = QUtf8StringView(utf8).isValidUtf8();
+    }
+    QVERIFY(result);
+}
+
 QTEST_MAIN(tst_QUtf8StringView)
 
 #include "tst_bench_qutf8stringview.moc"
@@ -24,6 +24,11 @@ struct QRecursiveReadWriteLock : QReadWriteLock
     QRecursiveReadWriteLock() : QReadWriteLock(Recursive) {}
 };
 
+struct QReaderPreferringReadWriteLock : QReadWriteLock
+{
+    QReaderPreferringReadWriteLock() : QReadWriteLock(NonRecursive, ContentionPolicy::PreferReaders) {}
+};
+
 template <typename T, size_t N>
   // requires N = 2^M for some Integral M >= 0
 struct Recursive
@@ -82,7 +87,10 @@ private slots:
     void readOnly();
     void writeOnly_data();
     void writeOnly();
-    // void readWrite();
+    void readMostly_data();
+    void readMostly();
+    void writeHeavy_data();
+    void writeHeavy();
 };
 
 struct FunctionPtrHolder
@@ -294,5 +302,92 @@ void tst_QReadWriteLock::writeOnly()
     holder.value();
 }
 
+// Every thread looks up a shared hash, and every WriteInterval-th
+// iteration modifies it instead.
+template <typename Mutex, typename ReadLocker, typename WriteLocker, int WriteInterval>
+void testReadWrite()
+{
+    struct Thread : QThread
+    {
+        Mutex *lock;
+        QHash<int, int> *hash;
+        void run() override
+        {
+            for (int i = 0; i < Iterations; ++i) {
+                const int key = i % 1024;
+                if (i % WriteInterval == 0) {
+                    WriteLocker locker(lock);
+                    ++(*hash)[key];
+                } else {
+                    ReadLocker locker(lock);
+                    hash->contains(key);
+                }
+            }
+        }
+    };
+    Mutex lock;
+    QHash<int, int> hash;
+    for (int i = 0; i < 1024; ++i)
+        hash.insert(i, 0);
+    std::vector<std::unique_ptr<Thread>> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        auto t = std::make_unique<Thread>();
+        t->lock = &lock;
+        t->hash = &hash;
+        threads.push_back(std::move(t));
+    }
+    QBENCHMARK {
+        for (auto &t : threads) {
+            t->start();
+        }
+        for (auto &t : threads) {
+            t->wait();
+        }
+    }
+}
+
+template <int WriteInterval>
+static void addReadWriteRows()
+{
+    QTest::addColumn<FunctionPtrHolder>("holder");
+
+    QTest::newRow("QMutex") << FunctionPtrHolder(
+        testReadWrite<QMutex, QMutexLocker<QMutex>, QMutexLocker<QMutex>, WriteInterval>);
+    QTest::newRow("QReadWriteLock") << FunctionPtrHolder(
+        testReadWrite<QReadWriteLock, QReadLocker, QWriteLocker, WriteInterval>);
+    QTest::newRow("QReadWriteLock, prefer readers") << FunctionPtrHolder(
+        testReadWrite<QReaderPreferringReadWriteLock, QReadLocker, QWriteLocker, WriteInterval>);
+    QTest::newRow("QReadWriteLock, recursive") << FunctionPtrHolder(
+        testReadWrite<QRecursiveReadWriteLock, QReadLocker, QWriteLocker, WriteInterval>);
+#ifdef __cpp_lib_shared_mutex
+    QTest::newRow("std::shared_mutex") << FunctionPtrHolder(
+        testReadWrite<std::shared_mutex,
+                      LockerWrapper<std::shared_lock<std::shared_mutex>>,
+                      LockerWrapper<std::unique_lock<std::shared_mutex>>, WriteInterval>);
+#endif
+}
+
+void tst_QReadWriteLock::readMostly_data()
+{
+    addReadWriteRows<100>();
+}
+
+void tst_QReadWriteLock::readMostly()
+{
+    QFETCH(FunctionPtrHolder, holder);
+    holder.value();
+}
+
+void tst_QReadWriteLock::writeHeavy_data()
+{
+    addReadWriteRows<2>();
+}
+
+void tst_QReadWriteLock::writeHeavy()
+{
+    QFETCH(FunctionPtrHolder, holder);
+    holder.value();
+}
+
 QTEST_MAIN(tst_QReadWriteLock)
 #include "tst_bench_qreadwritelock.moc"
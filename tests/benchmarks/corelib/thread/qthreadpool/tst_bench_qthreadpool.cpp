@@ -4,6 +4,9 @@
 #include <qtest.h>
 #include <QtCore>
 
+#include <memory>
+#include <vector>
+
 class tst_QThreadPool : public QObject
 {
     Q_OBJECT
@@ -15,6 +18,12 @@ public:
 private slots:
     void startRunnables();
     void activeThreadCount();
+    void tinyTasks_data();
+    void tinyTasks();
+    void tinyTasksFromWorkers_data();
+    void tinyTasksFromWorkers();
+    void mapMemoryBandwidth_data();
+    void mapMemoryBandwidth();
 };
 
 tst_QThreadPool::tst_QThreadPool()
@@ -50,6 +59,137 @@ void tst_QThreadPool::activeThreadCount()
     }
 }
 
+static void addSchedulingRows()
+{
+    QTest::addColumn<QThreadPool::SchedulingPolicy>("policy");
+    QTest::addColumn<int>("threadCount");
+
+    for (int threadCount : { 1, 2, 4, 8, 16, 32, 64 }) {
+        QTest::addRow("shared-queue-%d", threadCount)
+                << QThreadPool::SchedulingPolicy::SharedQueue << threadCount;
+        QTest::addRow("work-stealing-%d", threadCount)
+                << QThreadPool::SchedulingPolicy::WorkStealing << threadCount;
+    }
+}
+
+void tst_QThreadPool::tinyTasks_data()
+{
+    addSchedulingRows();
+}
+
+// Many tiny runnables started from one thread, like QtConcurrent::run() in a loop
+void tst_QThreadPool::tinyTasks()
+{
+    QFETCH(QThreadPool::SchedulingPolicy, policy);
+    QFETCH(int, threadCount);
+    constexpr int TaskCount = 100'000;
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+    threadPool.setSchedulingPolicy(policy);
+
+    QAtomicInt count;
+    QBENCHMARK {
+        for (int i = 0; i < TaskCount; ++i)
+            threadPool.start([&count] { count.ref(); });
+        threadPool.waitForDone();
+    }
+    QVERIFY(count.loadRelaxed() >= TaskCount);
+}
+
+void tst_QThreadPool::tinyTasksFromWorkers_data()
+{
+    addSchedulingRows();
+}
+
+// Tiny runnables started by the runnables of the pool itself
+void tst_QThreadPool::tinyTasksFromWorkers()
+{
+    QFETCH(QThreadPool::SchedulingPolicy, policy);
+    QFETCH(int, threadCount);
+    constexpr int TaskCount = 1'000;
+    constexpr int SubtaskCount = 100;
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+    threadPool.setSchedulingPolicy(policy);
+
+    QAtomicInt count;
+    QBENCHMARK {
+        for (int i = 0; i < TaskCount; ++i) {
+            threadPool.start([&] {
+                for (int j = 0; j < SubtaskCount; ++j)
+                    threadPool.start([&count] { count.ref(); });
+            });
+        }
+        threadPool.waitForDone();
+    }
+    QVERIFY(count.loadRelaxed() >= TaskCount * SubtaskCount);
+}
+
+void tst_QThreadPool::mapMemoryBandwidth_data()
+{
+    QTest::addColumn<bool>("pinned");
+
+    QTest::newRow("unpinned") << false;
+    QTest::newRow("numa-node-pools") << true;
+}
+
+// A map over an array much larger than the caches, bound by memory bandwidth.
+// With pinning, each chunk is allocated, first written and later processed
+// by the threads of one NUMA node, so that it is in that node's memory.
+void tst_QThreadPool::mapMemoryBandwidth()
+{
+    QFETCH(bool, pinned);
+    constexpr qsizetype ChunkSize = 1 << 19;     // doubles, 4 MB
+
+    std::unique_ptr<QThreadPool> unpinnedPool;
+    QList<QThreadPool *> pools;
+    if (pinned) {
+        for (int node = 0; node < QThread::numaNodeCount(); ++node) {
+            if (QThreadPool *pool = QThreadPool::numaNodeInstance(node))
+                pools.append(pool);
+        }
+    } else {
+        unpinnedPool = std::make_unique<QThreadPool>();
+        pools.append(unpinnedPool.get());
+    }
+    QVERIFY(!pools.isEmpty());
+
+    int threadCount = 0;
+    for (QThreadPool *pool : std::as_const(pools))
+        threadCount += pool->maxThreadCount();
+    const qsizetype chunkCount = qMax(2 * threadCount, 16);
+
+    std::vector<std::unique_ptr<double[]>> chunks(chunkCount);
+    auto forEachChunk = [&](auto function) {
+        QSemaphore done;
+        for (qsizetype i = 0; i < chunkCount; ++i) {
+            pools.at(i % pools.size())->start([&, i] {
+                function(chunks[i]);
+                done.release();
+            });
+        }
+        done.acquire(int(chunkCount));
+    };
+
+    forEachChunk([](std::unique_ptr<double[]> &chunk) {
+        chunk.reset(new double[ChunkSize]);
+        std::fill_n(chunk.get(), ChunkSize, 1.0);
+    });
+
+    QBENCHMARK {
+        forEachChunk([](std::unique_ptr<double[]> &chunk) {
+            double *data = chunk.get();
+            for (qsizetype i = 0; i < ChunkSize; ++i)
+                data[i] = data[i] * 1.0001 + 1.0;
+        });
+    }
+
+    for (const auto &chunk : chunks)
+        QVERIFY(chunk[0] > 1.0);
+}
+
 QTEST_MAIN(tst_QThreadPool)
 
 #include "tst_bench_qthreadpool.moc"
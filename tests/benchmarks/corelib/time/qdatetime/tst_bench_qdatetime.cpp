@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QDateTime>
+#include <QDateTimeFormat>
 #include <QTimeZone>
 #include <QTest>
 #include <QList>
@@ -13,6 +14,7 @@ class tst_QDateTime : public QObject
     Q_OBJECT
 
     static QList<QDateTime> daily(qint64 start, qint64 end);
+    static QStringList logTimestamps(QStringView format);
 #if QT_CONFIG(timezone)
     static QList<QDateTime> norse(qint64 start, qint64 end);
 #endif
@@ -47,6 +49,8 @@ private Q_SLOTS:
     void toString();
     void toStringTextFormat();
     void toStringIsoFormat();
+    void toStringFormat();
+    void toStringQDateTimeFormat();
     void addDays();
 #if QT_CONFIG(timezone)
     void addDaysTz();
@@ -71,6 +75,10 @@ private Q_SLOTS:
     void fromString();
     void fromStringText();
     void fromStringIso();
+    void fromStringIsoLog_data();
+    void fromStringIsoLog();
+    void fromStringFormat();
+    void fromStringQDateTimeFormat();
     void fromMSecsSinceEpoch();
     void fromMSecsSinceEpochUtc();
 #if QT_CONFIG(timezone)
@@ -79,6 +87,7 @@ private Q_SLOTS:
 };
 
 using namespace QtPrivate::DateTimeConstants;
+using namespace Qt::StringLiterals;
 constexpr qint64 JULIAN_DAY_1 = 1721426;
 constexpr qint64 JULIAN_DAY_11 = 1725078;
 constexpr qint64 JULIAN_DAY_1890 = 2411369;
@@ -112,6 +121,22 @@ QList<QDateTime> tst_QDateTime::daily(qint64 start, qint64 end)
         list.append(QDateTime(QDate::fromJulianDay(jd).startOfDay()));
     return list;
 }
+
+// Timestamps a minute and a few milliseconds apart, as a busy log would have:
+QStringList tst_QDateTime::logTimestamps(QStringView format)
+{
+    constexpr int count = 100000;
+    const QDateTimeFormat formatter(format);
+    QDateTime when(QDate(2025, 3, 4), QTime(5, 6, 7, 8), QTimeZone::UTC);
+    QStringList list;
+    list.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        list.append(formatter.toString(when));
+        when = when.addMSecs(60'007);
+    }
+    return list;
+}
+
 #if QT_CONFIG(timezone)
 QList<QDateTime> tst_QDateTime::norse(qint64 start, qint64 end)
 {
@@ -312,6 +337,26 @@ void tst_QDateTime::toStringIsoFormat()
     }
 }
 
+void tst_QDateTime::toStringFormat()
+{
+    const auto list = daily(JULIAN_DAY_2010, JULIAN_DAY_2011);
+    const QString format = u"yyyy-MM-dd hh:mm:ss.zzz"_s;
+    QBENCHMARK {
+        for (const QDateTime &test : list)
+            test.toString(format);
+    }
+}
+
+void tst_QDateTime::toStringQDateTimeFormat()
+{
+    const auto list = daily(JULIAN_DAY_2010, JULIAN_DAY_2011);
+    const QDateTimeFormat format(u"yyyy-MM-dd hh:mm:ss.zzz");
+    QBENCHMARK {
+        for (const QDateTime &test : list)
+            format.toString(test);
+    }
+}
+
 void tst_QDateTime::addDays()
 {
     const auto list = daily(JULIAN_DAY_2010, JULIAN_DAY_2020);
@@ -518,6 +563,48 @@ void tst_QDateTime::fromStringIso()
     }
 }
 
+void tst_QDateTime::fromStringIsoLog_data()
+{
+    QTest::addColumn<QStringList>("timestamps");
+
+    QTest::newRow("utc") << logTimestamps(u"yyyy-MM-ddTHH:mm:ss'Z'");
+    QTest::newRow("utc-ms") << logTimestamps(u"yyyy-MM-ddTHH:mm:ss.zzz'Z'");
+    QTest::newRow("offset-ms") << logTimestamps(u"yyyy-MM-ddTHH:mm:ss.zzz'+05:30'");
+    QTest::newRow("space-local") << logTimestamps(u"yyyy-MM-dd HH:mm:ss");
+}
+
+void tst_QDateTime::fromStringIsoLog()
+{
+    QFETCH(const QStringList, timestamps);
+    QVERIFY(QDateTime::fromString(timestamps.first(), Qt::ISODate).isValid());
+    QBENCHMARK {
+        for (const QString &timestamp : timestamps)
+            QDateTime::fromString(timestamp, Qt::ISODate);
+    }
+}
+
+void tst_QDateTime::fromStringFormat()
+{
+    const QString format = u"yyyy-MM-dd hh:mm:ss.zzz"_s;
+    const QStringList timestamps = logTimestamps(format).first(1000);
+    QVERIFY(QDateTime::fromString(timestamps.first(), format).isValid());
+    QBENCHMARK {
+        for (const QString &timestamp : timestamps)
+            QDateTime::fromString(timestamp, format);
+    }
+}
+
+void tst_QDateTime::fromStringQDateTimeFormat()
+{
+    const QDateTimeFormat format(u"yyyy-MM-dd hh:mm:ss.zzz");
+    const QStringList timestamps = logTimestamps(format.format()).first(1000);
+    QVERIFY(format.toDateTime(timestamps.first()).isValid());
+    QBENCHMARK {
+        for (const QString &timestamp : timestamps)
+            format.toDateTime(timestamp);
+    }
+}
+
 void tst_QDateTime::fromMSecsSinceEpoch()
 {
     const int start = JULIAN_DAY_2010 - JULIAN_DAY_1970;
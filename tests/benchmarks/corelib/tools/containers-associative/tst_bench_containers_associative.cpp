@@ -3,9 +3,17 @@
 #include <QString>
 #include <QMap>
 #include <QHash>
+#include <QFlatMap>
 
 #include <qtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+enum class Container { Hash, Map, FlatMap };
+Q_DECLARE_METATYPE(Container)
+
 class tst_associative_containers : public QObject
 {
     Q_OBJECT
@@ -14,8 +22,25 @@ private slots:
     void insert();
     void lookup_data();
     void lookup();
+    void construct_data();
+    void construct();
 };
 
+static void addContainerRows()
+{
+    QTest::addColumn<Container>("container");
+    QTest::addColumn<int>("size");
+
+    for (int size = 10; size < 20000; size += 100) {
+
+        const QByteArray sizeString = QByteArray::number(size);
+
+        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << Container::Hash << size;
+        QTest::newRow(QByteArray("map--" + sizeString).constData()) << Container::Map << size;
+        QTest::newRow(QByteArray("flatmap--" + sizeString).constData()) << Container::FlatMap << size;
+    }
+}
+
 template <typename T>
 void testInsert(int size)
 {
@@ -29,30 +54,24 @@ void testInsert(int size)
 
 void tst_associative_containers::insert_data()
 {
-    QTest::addColumn<bool>("useHash");
-    QTest::addColumn<int>("size");
-
-    for (int size = 10; size < 20000; size += 100) {
-
-        const QByteArray sizeString = QByteArray::number(size);
-
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
-    }
+    addContainerRows();
 }
 
 void tst_associative_containers::insert()
 {
-    QFETCH(bool, useHash);
+    QFETCH(Container, container);
     QFETCH(int, size);
 
-    QHash<int, int> testHash;
-    QMap<int, int> testMap;
-
-    if (useHash) {
+    switch (container) {
+    case Container::Hash:
         testInsert<QHash<int, int> >(size);
-    } else {
+        break;
+    case Container::Map:
         testInsert<QMap<int, int> >(size);
+        break;
+    case Container::FlatMap:
+        testInsert<QFlatMap<int, int> >(size);
+        break;
     }
 }
 
@@ -61,16 +80,7 @@ void tst_associative_containers::lookup_data()
 //    setReportType(LineChartReport);
 //    setChartTitle("Time to call value(), with an increasing number of items in the container");
 
-    QTest::addColumn<bool>("useHash");
-    QTest::addColumn<int>("size");
-
-    for (int size = 10; size < 20000; size += 100) {
-
-        const QByteArray sizeString = QByteArray::number(size);
-
-        QTest::newRow(QByteArray("hash--" + sizeString).constData()) << true << size;
-        QTest::newRow(QByteArray("map--" + sizeString).constData()) << false << size;
-    }
+    addContainerRows();
 }
 
 template <typename T>
@@ -93,13 +103,60 @@ void testLookup(int size)
 
 void tst_associative_containers::lookup()
 {
-    QFETCH(bool, useHash);
+    QFETCH(Container, container);
     QFETCH(int, size);
 
-    if (useHash) {
+    switch (container) {
+    case Container::Hash:
         testLookup<QHash<int, int> >(size);
-    } else {
+        break;
+    case Container::Map:
         testLookup<QMap<int, int> >(size);
+        break;
+    case Container::FlatMap:
+        testLookup<QFlatMap<int, int> >(size);
+        break;
+    }
+}
+
+void tst_associative_containers::construct_data()
+{
+    addContainerRows();
+}
+
+// builds a container from keys in random order, the way each container is
+// best filled: item by item for QHash and QMap, in bulk for QFlatMap
+void tst_associative_containers::construct()
+{
+    QFETCH(Container, container);
+    QFETCH(int, size);
+
+    QList<int> keys(size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(size));
+    const QList<int> values = keys;
+
+    switch (container) {
+    case Container::Hash:
+        QBENCHMARK {
+            QHash<int, int> hash;
+            for (int i = 0; i < size; ++i)
+                hash.insert(keys.at(i), values.at(i));
+        }
+        break;
+    case Container::Map:
+        QBENCHMARK {
+            QMap<int, int> map;
+            for (int i = 0; i < size; ++i)
+                map.insert(keys.at(i), values.at(i));
+        }
+        break;
+    case Container::FlatMap:
+        QBENCHMARK {
+            QFlatMap<int, int> map(QList<int>(keys.constBegin(), keys.constEnd()), values);
+            Q_UNUSED(map);
+        }
+        break;
     }
 }
 
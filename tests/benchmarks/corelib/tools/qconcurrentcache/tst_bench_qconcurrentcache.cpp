@@ -0,0 +1,110 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QCache>
+#include <QConcurrentCache>
+#include <QMutex>
+#include <QThread>
+#include <QTest>
+
+#include <memory>
+#include <vector>
+
+// the shared cache pattern QConcurrentCache replaces
+class LockedCache
+{
+public:
+    explicit LockedCache(qsizetype maxCost) : cache(maxCost) { }
+
+    template <typename Compute>
+    int getOrCompute(int key, Compute compute)
+    {
+        QMutexLocker locker(&mutex);
+        if (const int *v = cache.object(key))
+            return *v;
+        locker.unlock();
+        const int v = compute();
+        locker.relock();
+        cache.insert(key, new int(v));
+        return v;
+    }
+
+private:
+    QMutex mutex;
+    QCache<int, int> cache;
+};
+
+enum { KeyCount = 20000, OperationsPerThread = 200000 };
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void getOrCompute_data();
+    void getOrCompute();
+};
+
+void tst_QConcurrentCache::getOrCompute_data()
+{
+    QTest::addColumn<bool>("concurrent");
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<int>("maxCost");
+
+    // a cache that holds most of the keys, and one that thrashes
+    for (int maxCost : { KeyCount / 2, KeyCount / 20 }) {
+        for (int threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+            QTest::addRow("QCache+QMutex, cost %d, %d threads", maxCost, threads)
+                    << false << threads << maxCost;
+            QTest::addRow("QConcurrentCache, cost %d, %d threads", maxCost, threads)
+                    << true << threads << maxCost;
+        }
+    }
+}
+
+template <typename Cache>
+static void runThreads(Cache &cache, int threadCount)
+{
+    std::vector<std::unique_ptr<QThread>> threads;
+    const int operations = OperationsPerThread / threadCount;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(QThread::create([&cache, t, operations] {
+            uint key = uint(t) * 7919u;
+            int sum = 0;
+            for (int i = 0; i < operations; ++i) {
+                key = key * 1103515245u + 12345u;
+                // skew the keys towards the low ones, like real lookups
+                const int k = int((key >> 8) % KeyCount) >> (i % 4);
+                sum += cache.getOrCompute(k, [k] { return k * 2; });
+            }
+            Q_UNUSED(sum);
+        }));
+    }
+    for (auto &thread : threads)
+        thread->start();
+    for (auto &thread : threads)
+        thread->wait();
+}
+
+void tst_QConcurrentCache::getOrCompute()
+{
+    QFETCH(bool, concurrent);
+    QFETCH(int, threadCount);
+    QFETCH(int, maxCost);
+
+    // the total work is the same for all thread counts
+    if (concurrent) {
+        QConcurrentCache<int, int> cache(maxCost);
+        QBENCHMARK {
+            runThreads(cache, threadCount);
+        }
+    } else {
+        LockedCache cache(maxCost);
+        QBENCHMARK {
+            runThreads(cache, threadCount);
+        }
+    }
+}
+
+QTEST_MAIN(tst_QConcurrentCache)
+
+#include "tst_bench_qconcurrentcache.moc"
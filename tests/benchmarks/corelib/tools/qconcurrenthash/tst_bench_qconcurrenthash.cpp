@@ -0,0 +1,111 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QConcurrentHash>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QThread>
+#include <QTest>
+
+#include <memory>
+#include <vector>
+
+// the shared cache pattern QConcurrentHash replaces
+class LockedHash
+{
+public:
+    int value(int key) const
+    {
+        QReadLocker locker(&lock);
+        return hash.value(key);
+    }
+    void insert(int key, int value)
+    {
+        QWriteLocker locker(&lock);
+        hash.insert(key, value);
+    }
+
+private:
+    mutable QReadWriteLock lock;
+    QHash<int, int> hash;
+};
+
+enum { KeyCount = 100000, OperationsPerThread = 200000 };
+
+class tst_QConcurrentHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void readMostly_data() { addRows(); }
+    void readMostly() { run(10); }
+    void mixed_data() { addRows(); }
+    void mixed() { run(2); }
+
+private:
+    void addRows();
+    void run(int readsPerWrite);
+};
+
+void tst_QConcurrentHash::addRows()
+{
+    QTest::addColumn<bool>("concurrent");
+    QTest::addColumn<int>("threadCount");
+
+    for (int threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+        QTest::addRow("QHash+QReadWriteLock, %d threads", threads) << false << threads;
+        QTest::addRow("QConcurrentHash, %d threads", threads) << true << threads;
+    }
+}
+
+template <typename Hash>
+static void runThreads(Hash &hash, int threadCount, int readsPerWrite)
+{
+    std::vector<std::unique_ptr<QThread>> threads;
+    const int operations = OperationsPerThread / threadCount;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(QThread::create([&hash, t, operations, readsPerWrite] {
+            uint key = uint(t) * 7919u;
+            int sum = 0;
+            for (int i = 0; i < operations; ++i) {
+                key = key * 1103515245u + 12345u;
+                const int k = int(key % KeyCount);
+                if (i % readsPerWrite == 0)
+                    hash.insert(k, i);
+                else
+                    sum += hash.value(k);
+            }
+            Q_UNUSED(sum);
+        }));
+    }
+    for (auto &thread : threads)
+        thread->start();
+    for (auto &thread : threads)
+        thread->wait();
+}
+
+void tst_QConcurrentHash::run(int readsPerWrite)
+{
+    QFETCH(bool, concurrent);
+    QFETCH(int, threadCount);
+
+    // the total work is the same for all thread counts
+    if (concurrent) {
+        QConcurrentHash<int, int> hash;
+        for (int i = 0; i < KeyCount; i += 2)
+            hash.insert(i, i);
+        QBENCHMARK {
+            runThreads(hash, threadCount, readsPerWrite);
+        }
+    } else {
+        LockedHash hash;
+        for (int i = 0; i < KeyCount; i += 2)
+            hash.insert(i, i);
+        QBENCHMARK {
+            runThreads(hash, threadCount, readsPerWrite);
+        }
+    }
+}
+
+QTEST_MAIN(tst_QConcurrentHash)
+
+#include "tst_bench_qconcurrenthash.moc"
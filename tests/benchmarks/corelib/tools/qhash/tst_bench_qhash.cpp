@@ -7,7 +7,9 @@
 #include "tst_bench_qhash.h"
 
 #include <QFile>
+#include <QFlatHash>
 #include <QHash>
+#include <QRandomGenerator64>
 #include <QString>
 #include <QStringList>
 #include <QUuid>
@@ -49,12 +51,34 @@ private slots:
     void hashing_nonzero_qlatin1string_data() { data(); }
     void hashing_nonzero_qlatin1string() { hashing_nonzero_template<OwningLatin1String>(); }
 
+    void lookupHit_qhash_data() { largeData(); }
+    void lookupHit_qhash() { lookupHit_template<QHash<quint64, quint64>>(); }
+    void lookupHit_qflathash_data() { largeData(); }
+    void lookupHit_qflathash() { lookupHit_template<QFlatHash<quint64, quint64>>(); }
+    void lookupMiss_qhash_data() { largeData(); }
+    void lookupMiss_qhash() { lookupMiss_template<QHash<quint64, quint64>>(); }
+    void lookupMiss_qflathash_data() { largeData(); }
+    void lookupMiss_qflathash() { lookupMiss_template<QFlatHash<quint64, quint64>>(); }
+    void insert_qhash_data() { largeData(); }
+    void insert_qhash() { insert_template<QHash<quint64, quint64>>(); }
+    void insert_qflathash_data() { largeData(); }
+    void insert_qflathash() { insert_template<QFlatHash<quint64, quint64>>(); }
+    void erase_qhash_data() { largeData(); }
+    void erase_qhash() { erase_template<QHash<quint64, quint64>>(); }
+    void erase_qflathash_data() { largeData(); }
+    void erase_qflathash() { erase_template<QFlatHash<quint64, quint64>>(); }
+
 private:
     void data();
+    void largeData();
     template <typename String> void qhash_template();
     template <typename String, size_t Seed = 0> void hashing_template();
     template <typename String> void hashing_nonzero_template()
     { hashing_template<String, size_t(RandomSeed64)>(); }
+    template <typename Hash> void lookupHit_template();
+    template <typename Hash> void lookupMiss_template();
+    template <typename Hash> void insert_template();
+    template <typename Hash> void erase_template();
 
     QStringList smallFilePaths;
     QStringList uuids;
@@ -176,6 +200,96 @@ template <typename String, size_t Seed> void tst_QHash::hashing_template()
     }
 }
 
+// Tables with millions of random integer keys, which do not fit in the CPU
+// caches: these measure how many cache lines a lookup touches rather than
+// the cost of hashing. The 50M rows need a few GB of memory; run a single
+// row with e.g. "lookupHit_qflathash:10M".
+void tst_QHash::largeData()
+{
+    QTest::addColumn<qsizetype>("count");
+    QTest::newRow("1M") << qsizetype(1'000'000);
+    QTest::newRow("10M") << qsizetype(10'000'000);
+    QTest::newRow("50M") << qsizetype(50'000'000);
+}
+
+// keys present in the table are odd, missing ones even
+static QList<quint64> randomKeys(qsizetype count, quint32 seed, bool present = true)
+{
+    QRandomGenerator64 rng(seed);
+    QList<quint64> keys(count);
+    for (quint64 &key : keys)
+        key = present ? rng.generate() | 1 : rng.generate() & ~quint64(1);
+    return keys;
+}
+
+template <typename Hash> static Hash makeHash(const QList<quint64> &keys)
+{
+    Hash hash;
+    hash.reserve(keys.size());
+    for (quint64 key : keys)
+        hash.insert(key, key);
+    return hash;
+}
+
+// one million lookups, in an order unrelated to the one of the table
+static constexpr qsizetype LookupCount = 1'000'000;
+
+template <typename Hash> void tst_QHash::lookupHit_template()
+{
+    QFETCH(qsizetype, count);
+    const QList<quint64> keys = randomKeys(count, RandomSeed32);
+    const Hash hash = makeHash<Hash>(keys);
+    const QList<quint64> lookups = keys.first(qMin(count, LookupCount));
+
+    quint64 sum = 0;
+    QBENCHMARK {
+        for (quint64 key : lookups)
+            sum += hash.value(key);
+    }
+    QVERIFY(sum != 0);
+}
+
+template <typename Hash> void tst_QHash::lookupMiss_template()
+{
+    QFETCH(qsizetype, count);
+    const Hash hash = makeHash<Hash>(randomKeys(count, RandomSeed32));
+    const QList<quint64> lookups = randomKeys(qMin(count, LookupCount), RandomSeed32 + 1, false);
+
+    qsizetype found = 0;
+    QBENCHMARK {
+        for (quint64 key : lookups)
+            found += hash.contains(key);
+    }
+    QCOMPARE(found, 0);
+}
+
+template <typename Hash> void tst_QHash::insert_template()
+{
+    QFETCH(qsizetype, count);
+    const QList<quint64> keys = randomKeys(count, RandomSeed32);
+
+    // includes growing the table
+    QBENCHMARK {
+        Hash hash;
+        for (quint64 key : keys)
+            hash.insert(key, key);
+        QCOMPARE(hash.size(), count);
+    }
+}
+
+template <typename Hash> void tst_QHash::erase_template()
+{
+    QFETCH(qsizetype, count);
+    const QList<quint64> keys = randomKeys(count, RandomSeed32);
+    Hash hash = makeHash<Hash>(keys);
+
+    QBENCHMARK_ONCE {
+        for (quint64 key : keys)
+            hash.remove(key);
+    }
+    QVERIFY(hash.isEmpty());
+}
+
 QTEST_MAIN(tst_QHash)
 
 #include "tst_bench_qhash.moc"